@@ -0,0 +1,184 @@
+// Native benchmark: constraint insertion in the 2D constrained Delaunay
+// triangulation, one insert_constraint() call per segment vs the batch
+// insert_constraints() (Hilbert-sorted segments, existing Delaunay edges
+// flagged without a walk).
+//
+// Usage: cdt_bench [numPolygons] [numSegments] [seed]
+//   numPolygons: closed polygons (CDT2d), 32 vertices each, plus as many
+//                random free points as polygon vertices
+//   numSegments: random long segments (ExactCDT2d, intersection heavy)
+//
+// The segments are given in a shuffled order, as they come from unordered
+// input files. Each run prints one line: mode, seconds, and for the batch the
+// per-phase times (sort, classify, insert) and how many segments were already
+// edges. Both modes must give the same triangulation.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+const GEO::index_t POLYGON_VERTICES = 32;
+
+struct Result {
+    double seconds = 0.0;
+    GEO::index_t vertices = 0;
+    GEO::index_t triangles = 0;
+    std::vector<std::array<GEO::index_t, 3>> sortedTriangles;
+};
+
+void sortTriangles(const GEO::CDTBase2d& cdt, Result& result) {
+    result.sortedTriangles.resize(cdt.nT());
+    for (GEO::index_t t = 0; t < cdt.nT(); ++t) {
+        std::array<GEO::index_t, 3>& T = result.sortedTriangles[t];
+        for (GEO::index_t lv = 0; lv < 3; ++lv) T[lv] = cdt.Tv(t, lv);
+        std::rotate(T.begin(), std::min_element(T.begin(), T.end()), T.end());
+    }
+    std::sort(result.sortedTriangles.begin(), result.sortedTriangles.end());
+}
+
+void print(const char* name, const char* mode, const Result& result, const GEO::CDTBase2d& cdt, bool batch) {
+    std::cout << std::left << std::setw(10) << name << std::setw(6) << mode << std::right << std::fixed
+              << std::setprecision(4) << result.seconds << " s  " << result.vertices << " vertices  "
+              << result.triangles << " triangles";
+    if (batch) {
+        const GEO::CDTBase2d::ConstraintBatchStats& stats = cdt.constraint_batch_stats();
+        std::cout << "  (sort " << stats.sort_time << " s, classify " << stats.classify_time << " s, insert "
+                  << stats.insert_time << " s, " << stats.nb_existing_edges << "/" << stats.nb_constraints
+                  << " already edges)";
+    }
+    std::cout << std::endl;
+}
+
+// Polygons on a grid (disjoint), free points anywhere
+Result polygons(const std::vector<double>& points, const std::vector<GEO::index_t>& edges, bool batch) {
+    GEO::CDT2d cdt;
+    cdt.create_enclosing_rectangle(0.0, 0.0, 1.0, 1.0);
+    const GEO::index_t n = GEO::index_t(points.size() / 2);
+    std::vector<GEO::index_t> indices(n);
+    cdt.insert(n, points.data(), indices.data());
+    std::vector<GEO::index_t> vertexEdges(edges.size());
+    for (std::size_t k = 0; k < edges.size(); ++k) vertexEdges[k] = indices[edges[k]];
+
+    const GEO::index_t nbEdges = GEO::index_t(edges.size() / 2);
+    Result result;
+    GEO::Stopwatch watch("CDT2d", false);
+    if (batch) {
+        cdt.insert_constraints(nbEdges, vertexEdges.data());
+    } else {
+        for (GEO::index_t e = 0; e < nbEdges; ++e) cdt.insert_constraint(vertexEdges[2 * e], vertexEdges[2 * e + 1]);
+    }
+    result.seconds = watch.elapsed_time();
+    result.vertices = cdt.nv();
+    result.triangles = cdt.nT();
+    sortTriangles(cdt, result);
+    print("polygons", batch ? "batch" : "loop", result, cdt, batch);
+    return result;
+}
+
+// Random segments crossing each other, every crossing becomes a vertex
+Result segments(const std::vector<double>& points, const std::vector<GEO::index_t>& edges, bool batch) {
+    GEO::ExactCDT2d cdt;
+    cdt.create_enclosing_rectangle(0.0, 0.0, 1.0, 1.0);
+    const GEO::index_t n = GEO::index_t(points.size() / 2);
+    std::vector<GEO::index_t> indices(n);
+    for (GEO::index_t i = 0; i < n; ++i) {
+        indices[i] = cdt.insert(GEO::ExactCDT2d::ExactPoint(GEO::vec2(points[2 * i], points[2 * i + 1])));
+    }
+    std::vector<GEO::index_t> vertexEdges(edges.size());
+    for (std::size_t k = 0; k < edges.size(); ++k) vertexEdges[k] = indices[edges[k]];
+
+    const GEO::index_t nbEdges = GEO::index_t(edges.size() / 2);
+    Result result;
+    GEO::Stopwatch watch("ExactCDT2d", false);
+    if (batch) {
+        cdt.insert_constraints(nbEdges, vertexEdges.data());
+    } else {
+        for (GEO::index_t e = 0; e < nbEdges; ++e) cdt.insert_constraint(vertexEdges[2 * e], vertexEdges[2 * e + 1]);
+    }
+    result.seconds = watch.elapsed_time();
+    result.vertices = cdt.nv();
+    result.triangles = cdt.nT();
+    print("segments", batch ? "batch" : "loop", result, cdt, batch);
+    return result;
+}
+
+// Shuffles the segments (pairs of indices)
+void shuffleEdges(std::vector<GEO::index_t>& edges, std::mt19937& rng) {
+    const std::size_t count = edges.size() / 2;
+    for (std::size_t k = count; k > 1; --k) {
+        const std::size_t l = std::uniform_int_distribution<std::size_t>(0, k - 1)(rng);
+        std::swap(edges[2 * (k - 1)], edges[2 * l]);
+        std::swap(edges[2 * (k - 1) + 1], edges[2 * l + 1]);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t nbPolygons = (argc > 1) ? std::size_t(std::atol(argv[1])) : 20000u;
+    const std::size_t nbSegments = (argc > 2) ? std::size_t(std::atol(argv[2])) : 400u;
+    const unsigned seed = (argc > 3) ? unsigned(std::atoi(argv[3])) : 42u;
+
+    GEO::initialize();
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    // Polygons: one per cell of a grid, vertices on a jittered circle
+    const std::size_t grid = std::size_t(std::ceil(std::sqrt(double(nbPolygons))));
+    const double cell = 1.0 / double(grid);
+    std::vector<double> polygonPoints;
+    std::vector<GEO::index_t> polygonEdges;
+    for (std::size_t p = 0; p < nbPolygons; ++p) {
+        const double cx = (double(p % grid) + 0.5) * cell;
+        const double cy = (double(p / grid) + 0.5) * cell;
+        const GEO::index_t first = GEO::index_t(polygonPoints.size() / 2);
+        for (GEO::index_t k = 0; k < POLYGON_VERTICES; ++k) {
+            const double angle = 2.0 * M_PI * (double(k) + 0.5 * uniform(rng)) / double(POLYGON_VERTICES);
+            const double radius = cell * (0.25 + 0.15 * uniform(rng));
+            polygonPoints.push_back(cx + radius * std::cos(angle));
+            polygonPoints.push_back(cy + radius * std::sin(angle));
+            polygonEdges.push_back(first + k);
+            polygonEdges.push_back(first + (k + 1) % POLYGON_VERTICES);
+        }
+    }
+    const std::size_t nbFree = nbPolygons * POLYGON_VERTICES;
+    for (std::size_t i = 0; i < 2 * nbFree; ++i) polygonPoints.push_back(0.001 + 0.998 * uniform(rng));
+    shuffleEdges(polygonEdges, rng);
+
+    // Segments: random endpoints, about nbSegments^2 / 10 crossings
+    std::vector<double> segmentPoints(4 * nbSegments);
+    for (double& c : segmentPoints) c = 0.001 + 0.998 * uniform(rng);
+    std::vector<GEO::index_t> segmentEdges(2 * nbSegments);
+    for (std::size_t k = 0; k < segmentEdges.size(); ++k) segmentEdges[k] = GEO::index_t(k);
+    shuffleEdges(segmentEdges, rng);
+
+    std::cout << "polygons " << nbPolygons << " (" << polygonEdges.size() / 2 << " edges)  segments " << nbSegments
+              << std::endl;
+    const Result polygonLoop = polygons(polygonPoints, polygonEdges, false);
+    const Result polygonBatch = polygons(polygonPoints, polygonEdges, true);
+    const Result segmentLoop = segments(segmentPoints, segmentEdges, false);
+    const Result segmentBatch = segments(segmentPoints, segmentEdges, true);
+    std::cout << std::setprecision(2) << "speedup polygons " << polygonLoop.seconds / polygonBatch.seconds
+              << "  segments " << segmentLoop.seconds / segmentBatch.seconds << std::endl;
+
+    if (polygonLoop.sortedTriangles != polygonBatch.sortedTriangles) {
+        std::cerr << "cdt_bench: batch polygon constraints do not match the loop" << std::endl;
+        return 1;
+    }
+    if (segmentLoop.vertices != segmentBatch.vertices || segmentLoop.triangles != segmentBatch.triangles) {
+        std::cerr << "cdt_bench: batch segment constraints do not match the loop" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Native benchmark: PeriodicDelaunay3d output cells in pool order vs sorted
+// along a Hilbert / Morton curve (PeriodicDelaunay3d::set_cell_order), and
+// the downstream passes that read them.
+//
+// Usage: cell_order_bench [numPoints] [periodic 0|1] [seed]
+//
+// Passes timed on each order:
+// - circumcenters: one circumcenter per tet from its 4 vertices (vertex fetch)
+// - adjacency:     for each tet, the vertices of its 4 neighbors (cell_to_cell walk)
+// - edges:         unique edges of the triangulation (6 keys per tet, sort + unique)
+// The checksums must agree between the orders.
+//
+// The sort is paid once per triangulation (in the triangulation time), the
+// gains on every pass over the cells: each order also prints how many such
+// passes it takes to pay for the sort. With a single pass over the mesh, the
+// pool order is faster.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+struct PassTimes {
+    double triangulation = 0.0;
+    double circumcenters = 0.0;
+    double adjacency = 0.0;
+    double edges = 0.0;
+    double circumcenterSum = 0.0;
+    uint64_t adjacencySum = 0;
+    std::size_t edgeCount = 0;
+};
+
+PassTimes run(const std::vector<double>& points, bool periodic, GEO::PeriodicDelaunay3d::CellOrder order) {
+    const GEO::index_t n = GEO::index_t(points.size() / 3);
+    GEO::PeriodicDelaunay3d delaunay(periodic, 1.0);
+    delaunay.set_stores_cicl(false);
+    delaunay.set_cell_order(order);
+
+    PassTimes times;
+    GEO::Stopwatch triangulation("triangulation", false);
+    delaunay.set_vertices(n, points.data());
+    delaunay.compute();
+    times.triangulation = triangulation.elapsed_time();
+
+    const GEO::index_t nbTets = delaunay.nb_cells();
+
+    {
+        GEO::Stopwatch watch("circumcenters", false);
+        std::vector<double> centers(3 * std::size_t(nbTets));
+        for (GEO::index_t t = 0; t < nbTets; ++t) {
+            const GEO::vec3 p0 = delaunay.vertex(delaunay.cell_vertex(t, 0));
+            const GEO::vec3 a = delaunay.vertex(delaunay.cell_vertex(t, 1)) - p0;
+            const GEO::vec3 b = delaunay.vertex(delaunay.cell_vertex(t, 2)) - p0;
+            const GEO::vec3 c = delaunay.vertex(delaunay.cell_vertex(t, 3)) - p0;
+            const double det = 2.0 * GEO::dot(a, GEO::cross(b, c));
+            const GEO::vec3 center = p0 + (GEO::length2(a) * GEO::cross(b, c) + GEO::length2(b) * GEO::cross(c, a) +
+                                           GEO::length2(c) * GEO::cross(a, b)) / det;
+            centers[3 * t] = center.x;
+            centers[3 * t + 1] = center.y;
+            centers[3 * t + 2] = center.z;
+        }
+        times.circumcenters = watch.elapsed_time();
+        for (double c : centers) times.circumcenterSum += c;
+    }
+
+    {
+        GEO::Stopwatch watch("adjacency", false);
+        uint64_t sum = 0;
+        for (GEO::index_t t = 0; t < nbTets; ++t) {
+            for (GEO::index_t lf = 0; lf < 4; ++lf) {
+                const GEO::index_t adj = delaunay.cell_adjacent(t, lf);
+                if (adj == GEO::NO_INDEX) continue;
+                for (GEO::index_t lv = 0; lv < 4; ++lv) {
+                    sum += delaunay.cell_vertex(adj, lv) % n;
+                }
+            }
+        }
+        times.adjacency = watch.elapsed_time();
+        times.adjacencySum = sum;
+    }
+
+    {
+        GEO::Stopwatch watch("edges", false);
+        std::vector<uint64_t> keys;
+        keys.reserve(6 * std::size_t(nbTets));
+        for (GEO::index_t t = 0; t < nbTets; ++t) {
+            GEO::index_t v[4];
+            for (GEO::index_t lv = 0; lv < 4; ++lv) v[lv] = delaunay.cell_vertex(t, lv) % n;
+            for (int i = 0; i < 4; ++i) {
+                for (int j = i + 1; j < 4; ++j) {
+                    const uint64_t lo = std::min(v[i], v[j]);
+                    const uint64_t hi = std::max(v[i], v[j]);
+                    keys.push_back((lo << 32) | hi);
+                }
+            }
+        }
+        std::sort(keys.begin(), keys.end());
+        times.edgeCount = std::size_t(std::unique(keys.begin(), keys.end()) - keys.begin());
+        times.edges = watch.elapsed_time();
+    }
+    return times;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t n = (argc > 1) ? std::size_t(std::atol(argv[1])) : 500000u;
+    const bool periodic = (argc > 2) ? (std::atoi(argv[2]) != 0) : true;
+    const unsigned seed = (argc > 3) ? unsigned(std::atoi(argv[3])) : 42u;
+    if (n < 4) {
+        std::cerr << "cell_order_bench: at least 4 points are needed" << std::endl;
+        return 1;
+    }
+
+    GEO::initialize();
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> points(3 * n);
+    for (double& c : points) c = uniform(rng);
+
+    std::cout << "points " << n << (periodic ? " periodic" : " bounded")
+              << " threads " << GEO::Process::maximum_concurrent_threads() << std::endl;
+
+    const struct {
+        const char* name;
+        GEO::PeriodicDelaunay3d::CellOrder order;
+    } orders[] = {
+        { "pool", GEO::PeriodicDelaunay3d::CELL_ORDER_NONE },
+        { "hilbert", GEO::PeriodicDelaunay3d::CELL_ORDER_HILBERT },
+        { "morton", GEO::PeriodicDelaunay3d::CELL_ORDER_MORTON },
+    };
+    PassTimes reference;
+    bool consistent = true;
+    for (const auto& order : orders) {
+        const PassTimes times = run(points, periodic, order.order);
+        if (order.order == GEO::PeriodicDelaunay3d::CELL_ORDER_NONE) {
+            reference = times;
+        } else {
+            consistent = consistent && times.adjacencySum == reference.adjacencySum &&
+                         times.edgeCount == reference.edgeCount;
+        }
+        std::cout << std::left << std::setw(8) << order.name << std::right << std::fixed << std::setprecision(4)
+                  << " triangulation " << times.triangulation << " s, circumcenters " << times.circumcenters
+                  << " s, adjacency " << times.adjacency << " s, edges " << times.edges << " s ("
+                  << times.edgeCount << ")";
+        if (order.order != GEO::PeriodicDelaunay3d::CELL_ORDER_NONE) {
+            // Break-even: sort cost over the gain of one round of the three passes
+            const double sortCost = times.triangulation - reference.triangulation;
+            const double gain = (reference.circumcenters + reference.adjacency + reference.edges) -
+                                (times.circumcenters + times.adjacency + times.edges);
+            std::cout << ", sort " << sortCost << " s, gain " << gain << " s per round: ";
+            if (gain > 0.0) {
+                std::cout << "pays off after " << std::setprecision(1) << std::max(0.0, sortCost / gain) << " rounds";
+            } else {
+                std::cout << "never pays off";
+            }
+        }
+        std::cout << std::endl;
+    }
+    if (!consistent) {
+        std::cerr << "cell_order_bench: sorted cells do not match the pool order" << std::endl;
+        return 1;
+    }
+    return 0;
+}
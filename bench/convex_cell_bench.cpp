@@ -0,0 +1,127 @@
+// Native benchmark: clipping Voronoi cells with ConvexCell, one plane at a time
+// (clip_by_plane_fast(), scalar conflict test per triangle), with
+// clip_by_plane_vectorized() (cached triangle duals, SIMD filtered
+// determinants, exact fallback) and with clip_by_planes() (all the planes of
+// the cell, nearest first, stopping at the security radius).
+//
+// Usage: convex_cell_bench [numPoints] [numNeighbors] [seed]
+//
+// Each cell is the unit cube clipped by the bisectors with the numNeighbors
+// nearest points, given in a shuffled order (as they come from a Delaunay
+// neighborhood). Each mode prints one line: seconds, ns per plane and, for
+// clip_by_planes(), the number of planes that cut the cell (the others were
+// skipped). All modes must give the same volumes.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+enum class Mode { Fast, Vectorized, Batch };
+
+struct Run {
+    double seconds = 0.0;
+    std::size_t clipped = 0;
+    std::vector<double> volumes;
+};
+
+Run clipCells(Mode mode, const std::vector<double>& points, const std::vector<GEO::vec4>& planes, std::size_t k) {
+    const std::size_t n = points.size() / 3;
+    Run run;
+    run.volumes.resize(n);
+    GEO::ConvexCell C;
+    GEO::Stopwatch watch("clip", false);
+    for (std::size_t i = 0; i < n; ++i) {
+        C.init_with_box(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+        const GEO::vec4* P = &planes[i * k];
+        if (mode == Mode::Batch) {
+            const GEO::vec3 center(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+            run.clipped += C.clip_by_planes(center, GEO::index_t(k), P);
+        } else {
+            for (std::size_t l = 0; l < k; ++l) {
+                if (mode == Mode::Fast) {
+                    C.clip_by_plane_fast(P[l]);
+                } else {
+                    C.clip_by_plane_vectorized(P[l]);
+                }
+            }
+        }
+        C.compute_geometry();
+        run.volumes[i] = C.empty() ? 0.0 : C.volume();
+    }
+    run.seconds = watch.elapsed_time();
+    return run;
+}
+
+void print(const char* mode, const Run& run, std::size_t nbPlanes, bool batch) {
+    std::cout << std::left << std::setw(11) << mode << std::right << std::fixed << std::setprecision(4)
+              << run.seconds << " s  " << std::setprecision(1) << std::setw(6)
+              << 1e9 * run.seconds / double(nbPlanes) << " ns/plane";
+    if (batch) std::cout << "  " << run.clipped << "/" << nbPlanes << " planes cut the cells";
+    std::cout << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t n = (argc > 1) ? std::size_t(std::atol(argv[1])) : 100000u;
+    const std::size_t k = (argc > 2) ? std::size_t(std::atol(argv[2])) : 40u;
+    const unsigned seed = (argc > 3) ? unsigned(std::atoi(argv[3])) : 42u;
+    if (n < k + 1 || k == 0) {
+        std::cerr << "convex_cell_bench: numNeighbors must be in [1, numPoints)" << std::endl;
+        return 1;
+    }
+
+    GEO::initialize();
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> points(3 * n);
+    for (double& c : points) c = uniform(rng);
+
+    // Bisector planes with the k nearest neighbors (the first one is the point)
+    GEO::NearestNeighborSearch_var search = GEO::NearestNeighborSearch::create(3, "BNN");
+    search->set_points(GEO::index_t(n), points.data());
+    std::vector<GEO::vec4> planes(n * k);
+    std::vector<GEO::index_t> neighbors(k + 1);
+    std::vector<double> distances(k + 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        search->get_nearest_neighbors(GEO::index_t(k + 1), &points[3 * i], neighbors.data(), distances.data());
+        const GEO::vec3 Pi(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+        for (std::size_t l = 0; l < k; ++l) {
+            const GEO::index_t j = neighbors[l + 1];
+            const GEO::vec3 Pj(points[3 * j], points[3 * j + 1], points[3 * j + 2]);
+            planes[i * k + l] = GEO::vec4(2.0 * (Pi.x - Pj.x), 2.0 * (Pi.y - Pj.y), 2.0 * (Pi.z - Pj.z),
+                                          GEO::length2(Pj) - GEO::length2(Pi));
+        }
+        std::shuffle(planes.begin() + std::ptrdiff_t(i * k), planes.begin() + std::ptrdiff_t((i + 1) * k), rng);
+    }
+
+    std::cout << "points " << n << "  planes per cell " << k << std::endl;
+    const Run fast = clipCells(Mode::Fast, points, planes, k);
+    print("fast", fast, planes.size(), false);
+    const Run vectorized = clipCells(Mode::Vectorized, points, planes, k);
+    print("vectorized", vectorized, planes.size(), false);
+    const Run batch = clipCells(Mode::Batch, points, planes, k);
+    print("batch", batch, planes.size(), true);
+    std::cout << std::setprecision(2) << "speedup vectorized " << fast.seconds / vectorized.seconds << "  batch "
+              << fast.seconds / batch.seconds << std::endl;
+
+    double largest = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        largest = std::max(largest, std::fabs(fast.volumes[i] - vectorized.volumes[i]));
+        largest = std::max(largest, std::fabs(fast.volumes[i] - batch.volumes[i]));
+    }
+    if (largest > 1e-12) {
+        std::cerr << "convex_cell_bench: volumes differ by " << largest << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Native benchmark: 2D Delaunay triangulation, sequential (BDEL2d) vs
+// multithreaded (PDEL2d, ParallelDelaunay2d), and the 3D PDEL on the same
+// number of points for the per-point comparison.
+//
+// Usage: delaunay2d_bench [numPoints] [threads] [seed]
+//   threads: 0 = all the cores (default)
+//
+// Each run prints one line: algorithm, threads, seconds, ns per point and the
+// number of triangles (tets for PDEL). BDEL2d and PDEL2d must give the same
+// triangles.
+//
+// It then checks PeriodicDelaunay2d on the torus, on square lattices (every
+// cell of the grid is a cocircular quad) and on the random points: 2n
+// triangles (Euler), and every periodic edge shared by exactly two of them.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+#include "PeriodicDelaunay2d.h"
+
+namespace {
+
+struct Run {
+    double seconds = 0.0;
+    GEO::index_t cells = 0;
+    std::vector<std::array<GEO::index_t, 3>> triangles;
+};
+
+Run triangulate(const char* algorithm, GEO::coord_index_t dimension, const std::vector<double>& points,
+                bool keepTriangles) {
+    const GEO::index_t n = GEO::index_t(points.size() / dimension);
+    GEO::Delaunay_var delaunay = GEO::Delaunay::create(dimension, algorithm);
+    Run run;
+    GEO::Stopwatch watch(algorithm, false);
+    delaunay->set_vertices(n, points.data());
+    run.seconds = watch.elapsed_time();
+    run.cells = delaunay->nb_cells();
+    if (keepTriangles) {
+        run.triangles.resize(run.cells);
+        for (GEO::index_t t = 0; t < run.cells; ++t) {
+            std::array<GEO::index_t, 3>& T = run.triangles[t];
+            for (GEO::index_t lv = 0; lv < 3; ++lv) T[lv] = delaunay->cell_vertex(t, lv);
+            std::rotate(T.begin(), std::min_element(T.begin(), T.end()), T.end());
+        }
+        std::sort(run.triangles.begin(), run.triangles.end());
+    }
+    return run;
+}
+
+void print(const char* algorithm, GEO::index_t threads, const Run& run, std::size_t n) {
+    std::cout << std::left << std::setw(8) << algorithm << std::right << " threads " << std::setw(3) << threads
+              << std::fixed << std::setprecision(4) << "  " << run.seconds << " s  " << std::setprecision(1)
+              << std::setw(7) << 1e9 * run.seconds / double(n) << " ns/point  " << run.cells << " cells"
+              << std::endl;
+}
+
+// PeriodicDelaunay2d output is a triangulation of the torus
+bool checkTorus(const char* name, const std::vector<double>& points) {
+    const std::size_t n = points.size() / 2;
+    PeriodicDelaunay2d delaunay;
+    if (!delaunay.compute(points.data(), n, true)) {
+        std::cerr << "delaunay2d_bench: periodic " << name << " failed" << std::endl;
+        return false;
+    }
+    // Edges (i, j, translation of j) with i <= j, counted over the triangles
+    const uint32_t* triangles = delaunay.getTriangleBufferPtr();
+    const int8_t* offsets = delaunay.getTriangleOffsetBufferPtr();
+    std::map<std::tuple<uint32_t, uint32_t, int, int>, int> edges;
+    for (std::size_t t = 0; t < delaunay.getTriangleCount(); ++t) {
+        for (int k = 0; k < 3; ++k) {
+            const int l = (k + 1) % 3;
+            uint32_t i = triangles[3 * t + k];
+            uint32_t j = triangles[3 * t + l];
+            int dx = offsets[6 * t + 2 * l] - offsets[6 * t + 2 * k];
+            int dy = offsets[6 * t + 2 * l + 1] - offsets[6 * t + 2 * k + 1];
+            if (i > j || (i == j && (dx < 0 || (dx == 0 && dy < 0)))) {
+                std::swap(i, j);
+                dx = -dx;
+                dy = -dy;
+            }
+            ++edges[std::make_tuple(i, j, dx, dy)];
+        }
+    }
+    std::size_t badEdges = 0;
+    for (const auto& edge : edges) badEdges += (edge.second != 2);
+    std::cout << "periodic " << std::left << std::setw(12) << name << std::right << " points " << n << "  triangles "
+              << delaunay.getTriangleCount() << "  edges " << edges.size() << std::endl;
+    if (delaunay.getTriangleCount() != 2 * n || badEdges != 0) {
+        std::cerr << "delaunay2d_bench: periodic " << name << " is not a torus triangulation (" << badEdges
+                  << " edges not shared by two triangles)" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::vector<double> lattice(std::size_t side, double shift) {
+    std::vector<double> points;
+    for (std::size_t i = 0; i < side; ++i) {
+        for (std::size_t j = 0; j < side; ++j) {
+            points.push_back((double(i) + shift) / double(side));
+            points.push_back((double(j) + shift) / double(side));
+        }
+    }
+    return points;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t n = (argc > 1) ? std::size_t(std::atol(argv[1])) : 2000000u;
+    const GEO::index_t threads = (argc > 2) ? GEO::index_t(std::atoi(argv[2])) : 0u;
+    const unsigned seed = (argc > 3) ? unsigned(std::atoi(argv[3])) : 42u;
+    if (n < 4) {
+        std::cerr << "delaunay2d_bench: at least 4 points are needed" << std::endl;
+        return 1;
+    }
+
+    GEO::initialize();
+    if (threads != 0) GEO::Process::set_max_threads(threads);
+    const GEO::index_t usedThreads = GEO::Process::maximum_concurrent_threads();
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> points2d(2 * n);
+    for (double& c : points2d) c = uniform(rng);
+    std::vector<double> points3d(3 * n);
+    for (double& c : points3d) c = uniform(rng);
+
+    std::cout << "points " << n << std::endl;
+    const Run sequential = triangulate("BDEL2d", 2, points2d, true);
+    print("BDEL2d", 1, sequential, n);
+    const Run parallel = triangulate("PDEL2d", 2, points2d, true);
+    print("PDEL2d", usedThreads, parallel, n);
+    const Run parallel3d = triangulate("PDEL", 3, points3d, false);
+    print("PDEL", usedThreads, parallel3d, n);
+    // (both timings may round to zero on tiny inputs)
+    if (parallel.seconds > 0.0) {
+        std::cout << "speedup PDEL2d / BDEL2d " << std::setprecision(2) << sequential.seconds / parallel.seconds
+                  << std::endl;
+    } else {
+        std::cout << "speedup PDEL2d / BDEL2d n/a (too fast to time)" << std::endl;
+    }
+
+    if (sequential.triangles != parallel.triangles) {
+        std::cerr << "delaunay2d_bench: PDEL2d does not match BDEL2d" << std::endl;
+        return 1;
+    }
+
+    bool torus = checkTorus("random", points2d);
+    for (std::size_t side : { std::size_t(16), std::size_t(50), std::size_t(200) }) {
+        const std::string name = "lattice" + std::to_string(side);
+        torus = checkTorus(name.c_str(), lattice(side, 0.5)) && torus;
+        torus = checkTorus((name + "e").c_str(), lattice(side, 0.0)) && torus; // on the edges of the square
+    }
+    return torus ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+// Native benchmark: sequential Delaunay insertion (BDEL, BDEL2d) without
+// spatial reordering, where each walk starts from the hint grid instead of
+// the last created cell, against the default BRIO order, and nearest_vertex()
+// queries located from the hint grid.
+//
+// Usage: locate_bench [numPoints] [numQueries] [seed]
+//
+// The points are given in three orders: BRIO (default reordering), random
+// (set_reorder(false), as from an unordered stream) and sorted along x
+// (set_reorder(false), a sweep). Each run prints one line: dimension, order,
+// seconds, and the time of the nearest_vertex() queries. All the orders must
+// give the same number of cells.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+struct Run {
+    double seconds = 0.0;
+    double querySeconds = 0.0;
+    GEO::index_t cells = 0;
+};
+
+Run triangulate(GEO::coord_index_t dimension, const std::vector<double>& points, bool reorder,
+                const std::vector<double>& queries) {
+    const GEO::index_t n = GEO::index_t(points.size() / dimension);
+    GEO::Delaunay_var delaunay = GEO::Delaunay::create(dimension, dimension == 3 ? "BDEL" : "BDEL2d");
+    delaunay->set_reorder(reorder);
+    Run run;
+    GEO::Stopwatch watch("insert", false);
+    delaunay->set_vertices(n, points.data());
+    run.seconds = watch.elapsed_time();
+    run.cells = delaunay->nb_cells();
+
+    const GEO::index_t nbQueries = GEO::index_t(queries.size() / dimension);
+    std::vector<GEO::index_t> nearest(nbQueries);
+    GEO::Stopwatch queryWatch("nearest", false);
+    delaunay->nearest_vertices(nbQueries, queries.data(), nearest.data());
+    run.querySeconds = queryWatch.elapsed_time();
+    return run;
+}
+
+void print(GEO::coord_index_t dimension, const char* order, const Run& run) {
+    std::cout << int(dimension) << "d  " << std::left << std::setw(9) << order << std::right << std::fixed
+              << std::setprecision(4) << run.seconds << " s  " << run.cells << " cells  nearest_vertex "
+              << run.querySeconds << " s" << std::endl;
+}
+
+// Same points, sorted along x
+std::vector<double> sortedAlongX(const std::vector<double>& points, GEO::coord_index_t dimension) {
+    const std::size_t n = points.size() / dimension;
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::sort(order.begin(), order.end(),
+              [&](std::size_t a, std::size_t b) { return points[dimension * a] < points[dimension * b]; });
+    std::vector<double> result(points.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        std::copy_n(&points[dimension * order[i]], dimension, &result[dimension * i]);
+    }
+    return result;
+}
+
+bool compare(GEO::coord_index_t dimension, std::size_t n, std::size_t nbQueries, std::mt19937& rng) {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> points(dimension * n);
+    for (double& c : points) c = uniform(rng);
+    std::vector<double> queries(dimension * nbQueries);
+    for (double& c : queries) c = 0.01 + 0.98 * uniform(rng);
+
+    const Run brio = triangulate(dimension, points, true, queries);
+    print(dimension, "BRIO", brio);
+    const Run random = triangulate(dimension, points, false, queries);
+    print(dimension, "random", random);
+    const Run sweep = triangulate(dimension, sortedAlongX(points, dimension), false, queries);
+    print(dimension, "sorted x", sweep);
+    return brio.cells == random.cells && brio.cells == sweep.cells;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t n = (argc > 1) ? std::size_t(std::atol(argv[1])) : 200000u;
+    const std::size_t nbQueries = (argc > 2) ? std::size_t(std::atol(argv[2])) : 100000u;
+    const unsigned seed = (argc > 3) ? unsigned(std::atoi(argv[3])) : 42u;
+    if (n < 4) {
+        std::cerr << "locate_bench: at least 4 points are needed" << std::endl;
+        return 1;
+    }
+
+    GEO::initialize();
+    std::mt19937 rng(seed);
+    std::cout << "points " << n << "  queries " << nbQueries << std::endl;
+    const bool same3d = compare(3, n, nbQueries, rng);
+    const bool same2d = compare(2, n, nbQueries, rng);
+    if (!same3d || !same2d) {
+        std::cerr << "locate_bench: the insertion orders give different triangulations" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,418 @@
+// Microbenchmarks of the kernels under the triangulations and the particle
+// steps, to tell which one moved when a macro benchmark does: PCK predicates,
+// expansion_nt arithmetic, ConvexCell clipping and moments, kd-tree, Hilbert
+// sort and the ParticleSystem repulsion (each pair potential) and PCA (per
+// cell and batched). Builds natively and with Emscripten (run the .js with
+// node).
+//
+// Usage: micro_bench [scale] [seed] [filter]
+//   scale:  multiplies the operation counts (default 1)
+//   filter: only the kernels whose name contains this string
+//
+// Prints one JSON object per line:
+//   {"kernel":..., "input":..., "ops":..., "seconds":..., "ns_per_op":...,
+//    "ops_per_second":..., "checksum":...}
+// The inputs only depend on the seed. The checksum (sum of signs, volumes,
+// indices, squared displacements...) keeps the results alive and changes if
+// a kernel computes something else; it is never a conserved quantity.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ParticleSystem.h"
+
+// Geogram (PSM version vendored in this repo), the private header declares
+// compute_Hilbert_order()
+#include "Delaunay_psm.h"
+#include "Delaunay_psm_private.h"
+
+namespace {
+
+// Distinct point sets per predicate input (reused cyclically)
+const std::size_t PREDICATE_INPUTS = 4096;
+
+// Planes per ConvexCell and points per PCA cloud (about one Voronoi cell)
+const std::size_t CELL_PLANES = 32;
+const std::size_t CLOUD_POINTS = 24;
+
+struct Options {
+    double scale = 1.0;
+    unsigned seed = 42u;
+    std::string filter;
+};
+
+std::size_t scaled(const Options& options, std::size_t count) {
+    return std::max<std::size_t>(1u, std::size_t(double(count) * options.scale));
+}
+
+bool selected(const Options& options, const char* kernel) {
+    return options.filter.empty() || std::string(kernel).find(options.filter) != std::string::npos;
+}
+
+// One generator per kernel, so that a filter does not change the inputs of the others
+std::mt19937 kernelRng(const Options& options, unsigned kernel) {
+    return std::mt19937(options.seed + 1000u * kernel);
+}
+
+// Wall clock in seconds (GEO::Stopwatch only has millisecond resolution)
+class Timer {
+public:
+    Timer() : start(std::chrono::steady_clock::now()) {}
+    double elapsed() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start;
+};
+
+void report(const char* kernel, const char* input, std::size_t ops, double seconds, double checksum) {
+    const double nsPerOp = 1e9 * seconds / double(ops);
+    std::cout << std::setprecision(6) << "{\"kernel\":\"" << kernel << "\",\"input\":\"" << input
+              << "\",\"ops\":" << ops << ",\"seconds\":" << seconds << ",\"ns_per_op\":" << nsPerOp
+              << ",\"ops_per_second\":" << (seconds > 0.0 ? double(ops) / seconds : 0.0)
+              << ",\"checksum\":" << std::setprecision(12) << checksum << "}" << std::endl;
+}
+
+std::vector<double> uniformPoints(std::size_t count, std::mt19937& rng) {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> points(3 * count);
+    for (double& c : points) c = uniform(rng);
+    return points;
+}
+
+// Point sets of nbPoints points each (x,y,z packed)
+enum class PointSet { Random, NearDegenerate, Degenerate };
+
+std::vector<double> predicateInputs(PointSet kind, std::size_t nbPoints, std::mt19937& rng) {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> points = uniformPoints(PREDICATE_INPUTS * nbPoints, rng);
+    for (std::size_t s = 0; s < PREDICATE_INPUTS && kind != PointSet::Random; ++s) {
+        double* p = &points[3 * nbPoints * s];
+        if (kind == PointSet::Degenerate) {
+            // Corners of an integer box: coplanar quadruples, cospherical quintuples
+            const double o[3] = { std::floor(100.0 * uniform(rng)), std::floor(100.0 * uniform(rng)),
+                                  std::floor(100.0 * uniform(rng)) };
+            const double size = 1.0 + std::floor(10.0 * uniform(rng));
+            // (corners 0..3: the z = o.z face, 0 3 5 6 7: five of the eight corners)
+            const int corners[2][5] = { { 0, 1, 2, 3, 0 }, { 0, 3, 5, 6, 7 } };
+            for (std::size_t k = 0; k < nbPoints; ++k) {
+                const int corner = corners[nbPoints == 4 ? 0 : 1][k];
+                for (int c = 0; c < 3; ++c) p[3 * k + c] = o[c] + (((corner >> c) & 1) ? size : 0.0);
+            }
+        } else if (nbPoints == 4) {
+            // Plane z = a x + b y + c, rounded
+            const double a = uniform(rng);
+            const double b = uniform(rng);
+            const double c = uniform(rng);
+            for (std::size_t k = 0; k < 4; ++k) p[3 * k + 2] = a * p[3 * k] + b * p[3 * k + 1] + c;
+        } else {
+            // Unit sphere around a random center, rounded
+            const double center[3] = { uniform(rng), uniform(rng), uniform(rng) };
+            for (std::size_t k = 0; k < nbPoints; ++k) {
+                double* q = &p[3 * k];
+                const double length = std::sqrt(
+                    (q[0] - 0.5) * (q[0] - 0.5) + (q[1] - 0.5) * (q[1] - 0.5) + (q[2] - 0.5) * (q[2] - 0.5));
+                for (int c = 0; c < 3; ++c) q[c] = center[c] + (q[c] - 0.5) / length;
+            }
+        }
+    }
+    return points;
+}
+
+const char* pointSetName(PointSet kind, std::size_t nbPoints) {
+    switch (kind) {
+    case PointSet::Random:
+        return "random";
+    case PointSet::NearDegenerate:
+        return (nbPoints == 4) ? "near_coplanar" : "near_cospherical";
+    case PointSet::Degenerate:
+        return (nbPoints == 4) ? "coplanar" : "cospherical";
+    }
+    return "";
+}
+
+void predicates(const Options& options) {
+    const PointSet kinds[3] = { PointSet::Random, PointSet::NearDegenerate, PointSet::Degenerate };
+    if (selected(options, "pck.orient_3d")) {
+        std::mt19937 rng = kernelRng(options, 1);
+        for (PointSet kind : kinds) {
+            const std::vector<double> points = predicateInputs(kind, 4, rng);
+            const std::size_t ops = scaled(options, kind == PointSet::Random ? 1000000u : 100000u);
+            double checksum = 0.0;
+            const Timer watch;
+            for (std::size_t op = 0; op < ops; ++op) {
+                const double* p = &points[12 * (op % PREDICATE_INPUTS)];
+                checksum += double(GEO::PCK::orient_3d(p, p + 3, p + 6, p + 9));
+            }
+            report("pck.orient_3d", pointSetName(kind, 4), ops, watch.elapsed(), checksum);
+        }
+    }
+    if (selected(options, "pck.in_sphere_3d_SOS")) {
+        std::mt19937 rng = kernelRng(options, 2);
+        for (PointSet kind : kinds) {
+            const std::vector<double> points = predicateInputs(kind, 5, rng);
+            const std::size_t ops = scaled(options, kind == PointSet::Random ? 1000000u : 100000u);
+            double checksum = 0.0;
+            const Timer watch;
+            for (std::size_t op = 0; op < ops; ++op) {
+                const double* p = &points[15 * (op % PREDICATE_INPUTS)];
+                checksum += double(GEO::PCK::in_sphere_3d_SOS(p, p + 3, p + 6, p + 9, p + 12));
+            }
+            report("pck.in_sphere_3d_SOS", pointSetName(kind, 5), ops, watch.elapsed(), checksum);
+        }
+    }
+}
+
+void expansions(const Options& options) {
+    if (!selected(options, "expansion_nt")) return;
+    std::mt19937 rng = kernelRng(options, 3);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<double> values(4 * PREDICATE_INPUTS);
+    for (double& v : values) v = uniform(rng);
+
+    // 2x2 determinant, then a 3x3 one (cofactor expansion) from the same values
+    const std::size_t ops = scaled(options, 1000000u);
+    double checksum = 0.0;
+    const Timer watch;
+    for (std::size_t op = 0; op < ops; ++op) {
+        const double* v = &values[4 * (op % PREDICATE_INPUTS)];
+        const GEO::expansion_nt d = GEO::expansion_nt(v[0]) * v[3] - GEO::expansion_nt(v[1]) * v[2];
+        checksum += double(d.sign());
+    }
+    report("expansion_nt", "det2x2", ops, watch.elapsed(), checksum);
+
+    const std::size_t ops3 = scaled(options, 200000u);
+    checksum = 0.0;
+    const Timer watch3;
+    for (std::size_t op = 0; op < ops3; ++op) {
+        const double* a = &values[4 * (op % PREDICATE_INPUTS)];
+        const double* b = &values[4 * ((op + 1) % PREDICATE_INPUTS)];
+        const double* c = &values[4 * ((op + 2) % PREDICATE_INPUTS)];
+        const GEO::expansion_nt m0 = GEO::expansion_nt(b[1]) * c[2] - GEO::expansion_nt(b[2]) * c[1];
+        const GEO::expansion_nt m1 = GEO::expansion_nt(b[0]) * c[2] - GEO::expansion_nt(b[2]) * c[0];
+        const GEO::expansion_nt m2 = GEO::expansion_nt(b[0]) * c[1] - GEO::expansion_nt(b[1]) * c[0];
+        const GEO::expansion_nt d = m0 * a[0] - m1 * a[1] + m2 * a[2];
+        checksum += double(d.sign());
+    }
+    report("expansion_nt", "det3x3", ops3, watch3.elapsed(), checksum);
+}
+
+void convexCells(const Options& options) {
+    if (!selected(options, "convex_cell")) return;
+    std::mt19937 rng = kernelRng(options, 4);
+    // Bisectors of a point with random neighbors at distance up to 0.3
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const std::size_t nbCells = 1024;
+    std::vector<GEO::vec4> planes(nbCells * CELL_PLANES);
+    for (std::size_t i = 0; i < nbCells; ++i) {
+        const GEO::vec3 Pi(0.35 + 0.3 * uniform(rng), 0.35 + 0.3 * uniform(rng), 0.35 + 0.3 * uniform(rng));
+        for (std::size_t l = 0; l < CELL_PLANES; ++l) {
+            const GEO::vec3 Pj = Pi + GEO::vec3(0.6 * uniform(rng) - 0.3, 0.6 * uniform(rng) - 0.3,
+                                                0.6 * uniform(rng) - 0.3);
+            planes[i * CELL_PLANES + l] = GEO::vec4(2.0 * (Pi.x - Pj.x), 2.0 * (Pi.y - Pj.y), 2.0 * (Pi.z - Pj.z),
+                                                    GEO::length2(Pj) - GEO::length2(Pi));
+        }
+    }
+
+    const std::size_t ops = scaled(options, 20000u);
+    for (int vectorized = 0; vectorized < 2; ++vectorized) {
+        GEO::ConvexCell C;
+        double checksum = 0.0;
+        const Timer watch;
+        for (std::size_t op = 0; op < ops; ++op) {
+            const GEO::vec4* P = &planes[(op % nbCells) * CELL_PLANES];
+            C.init_with_box(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+            for (std::size_t l = 0; l < CELL_PLANES; ++l) {
+                if (vectorized) {
+                    C.clip_by_plane_vectorized(P[l]);
+                } else {
+                    C.clip_by_plane_fast(P[l]);
+                }
+            }
+            C.compute_geometry();
+            checksum += C.empty() ? 0.0 : C.volume();
+        }
+        report("convex_cell.box_32_clips", vectorized ? "vectorized" : "fast", ops, watch.elapsed(), checksum);
+    }
+
+    // Volume, first and second moments of an already clipped cell (inertia steering)
+    GEO::ConvexCell C;
+    C.init_with_box(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+    for (std::size_t l = 0; l < CELL_PLANES; ++l) C.clip_by_plane_vectorized(planes[l]);
+    C.compute_geometry();
+    double checksum = 0.0;
+    const Timer watch;
+    for (std::size_t op = 0; op < ops; ++op) {
+        double m = 0.0;
+        GEO::vec3 mg;
+        double I[6];
+        C.compute_second_moments(m, mg, I);
+        checksum += I[0] + I[3] + I[5];
+    }
+    report("convex_cell.second_moments", "box_32_clips", ops, watch.elapsed(), checksum);
+}
+
+void kdTree(const Options& options) {
+    if (!selected(options, "kdtree")) return;
+    std::mt19937 rng = kernelRng(options, 5);
+    const std::size_t n = scaled(options, 200000u);
+    const std::vector<double> points = uniformPoints(n, rng);
+    GEO::NearestNeighborSearch_var search = GEO::NearestNeighborSearch::create(3, "BNN");
+
+    const Timer buildWatch;
+    search->set_points(GEO::index_t(n), points.data());
+    report("kdtree.build", "uniform", n, buildWatch.elapsed(), double(n));
+
+    const GEO::index_t k = 10;
+    const std::vector<double> queries = uniformPoints(n, rng);
+    std::vector<GEO::index_t> neighbors(k);
+    std::vector<double> distances(k);
+    double checksum = 0.0;
+    const Timer queryWatch;
+    for (std::size_t q = 0; q < n; ++q) {
+        search->get_nearest_neighbors(k, &queries[3 * q], neighbors.data(), distances.data());
+        checksum += double(neighbors[0]);
+    }
+    report("kdtree.query_10nn", "uniform", n, queryWatch.elapsed(), checksum);
+}
+
+void hilbert(const Options& options) {
+    if (!selected(options, "hilbert")) return;
+    std::mt19937 rng = kernelRng(options, 6);
+    const std::size_t n = scaled(options, 500000u);
+    const std::vector<double> points = uniformPoints(n, rng);
+    GEO::vector<GEO::index_t> order(n);
+    for (GEO::index_t i = 0; i < GEO::index_t(n); ++i) order[i] = i;
+
+    const Timer watch;
+    GEO::compute_Hilbert_order(GEO::index_t(n), points.data(), order, 0, GEO::index_t(n), 3);
+    const double seconds = watch.elapsed();
+    double checksum = 0.0;
+    for (GEO::index_t i = 0; i < GEO::index_t(std::min<std::size_t>(n, 1000u)); ++i) checksum += double(order[i]);
+    report("hilbert.order", "uniform", n, seconds, checksum);
+}
+
+void particles(const Options& options) {
+    if (selected(options, "particles.repulsion")) {
+        // Pair loop of update(), steering off, with each pair potential; one op is one pair
+        const std::size_t n = 2000;
+        const std::size_t steps = scaled(options, 20u);
+        const char* inputs[] = { "linear_2000", "hertz_2000", "cohesive_2000", "wca_2000", "tabulated_2000" };
+        std::vector<float> table(1025); // the linear spring, 1 - x
+        for (std::size_t k = 0; k < table.size(); ++k) table[k] = 1.0f - float(k) / float(table.size() - 1);
+        for (int potential = ParticleSystem::POTENTIAL_LINEAR; potential <= ParticleSystem::POTENTIAL_TABULATED;
+             ++potential) {
+            ParticleSystem system;
+            system.setSteeringStrength(0.0f);
+            system.setPairPotential(potential);
+            system.setPairPotentialTable(table.data(), table.size(), 1.0f);
+            system.initialize(n, 0.02f, options.seed);
+            const float* positions = system.getPositionBufferPtr();
+            const std::vector<float> start(positions, positions + 3 * n);
+            const Timer watch;
+            for (std::size_t s = 0; s < steps; ++s) system.update(1.0f / 60.0f);
+            const double seconds = watch.elapsed();
+            // Squared displacements (minimum image): the sum of the positions is
+            // conserved by the equal and opposite impulses, whatever the kernel
+            double checksum = 0.0;
+            positions = system.getPositionBufferPtr();
+            for (std::size_t k = 0; k < 3 * n; ++k) {
+                double d = double(positions[k]) - double(start[k]);
+                d -= std::round(d);
+                checksum += d * d;
+            }
+            report("particles.repulsion", inputs[potential], steps * n * (n - 1) / 2, seconds, checksum);
+        }
+    }
+    if (selected(options, "particles.pca")) {
+        std::mt19937 rng = kernelRng(options, 7);
+        // Elongated clouds (a random direction stretched 3 times)
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        const std::size_t nbClouds = 4096;
+        std::vector<float> clouds(3 * CLOUD_POINTS * nbClouds);
+        for (std::size_t c = 0; c < nbClouds; ++c) {
+            float axis[3] = { normal(rng), normal(rng), normal(rng) };
+            const float length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+            for (float& a : axis) a /= length;
+            for (std::size_t k = 0; k < CLOUD_POINTS; ++k) {
+                const float t = 2.0f * normal(rng);
+                float* p = &clouds[3 * (c * CLOUD_POINTS + k)];
+                for (int d = 0; d < 3; ++d) p[d] = 0.01f * (t * axis[d] + normal(rng));
+            }
+        }
+        const std::size_t ops = scaled(options, 500000u);
+        double checksum = 0.0;
+        const Timer watch;
+        for (std::size_t op = 0; op < ops; ++op) {
+            float mean[3];
+            float axis[3];
+            float deviation = 0.0f;
+            if (principalAxis3d(&clouds[3 * CLOUD_POINTS * (op % nbClouds)], CLOUD_POINTS, mean, axis, deviation)) {
+                checksum += double(std::fabs(axis[0])) + double(deviation);
+            }
+        }
+        report("particles.pca", "cloud_24", ops, watch.elapsed(), checksum);
+
+        // Same clouds, covariances then SymmetricEigen3Batch (the steering path)
+        SymmetricEigen3Batch batch;
+        batch.resize(nbClouds);
+        const std::size_t rounds = std::max<std::size_t>(1u, ops / nbClouds);
+        checksum = 0.0;
+        const Timer batchWatch;
+        for (std::size_t round = 0; round < rounds; ++round) {
+            for (std::size_t c = 0; c < nbClouds; ++c) {
+                const float* p = &clouds[3 * CLOUD_POINTS * c];
+                float mean[3] = { 0.0f, 0.0f, 0.0f };
+                for (std::size_t k = 0; k < CLOUD_POINTS; ++k) {
+                    for (int d = 0; d < 3; ++d) mean[d] += p[3 * k + d];
+                }
+                for (float& m : mean) m /= float(CLOUD_POINTS);
+                float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+                for (std::size_t k = 0; k < CLOUD_POINTS; ++k) {
+                    const float dx = p[3 * k] - mean[0];
+                    const float dy = p[3 * k + 1] - mean[1];
+                    const float dz = p[3 * k + 2] - mean[2];
+                    cov[0] += dx * dx; cov[1] += dx * dy; cov[2] += dx * dz;
+                    cov[3] += dy * dy; cov[4] += dy * dz; cov[5] += dz * dz;
+                }
+                const float norm = 1.0f / float(CLOUD_POINTS - 1);
+                batch.set(c, cov[0] * norm, cov[1] * norm, cov[2] * norm, cov[3] * norm, cov[4] * norm, cov[5] * norm);
+            }
+            batch.solve();
+            for (std::size_t c = 0; c < nbClouds; ++c) {
+                checksum += double(std::fabs(batch.axis(c, 0))) + double(std::sqrt(std::max(0.0f, batch.eigenvalue(c, 0))));
+            }
+        }
+        report("particles.pca_batch", "cloud_24", rounds * nbClouds, batchWatch.elapsed(), checksum);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (argc > 1) options.scale = std::atof(argv[1]);
+    if (argc > 2) options.seed = unsigned(std::atoi(argv[2]));
+    if (argc > 3) options.filter = argv[3];
+    if (!(options.scale > 0.0)) {
+        std::cerr << "micro_bench: scale must be positive" << std::endl;
+        return 1;
+    }
+
+    GEO::initialize();
+    predicates(options);
+    expansions(options);
+    convexCells(options);
+    kdTree(options);
+    hilbert(options);
+    particles(options);
+    return 0;
+}
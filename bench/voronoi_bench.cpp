@@ -0,0 +1,116 @@
+// Native benchmark: Delaunay-free KnnVoronoi vs PeriodicDelaunay3d followed by
+// per-cell extraction (copy_Laguerre_cell_from_Delaunay + compute_geometry).
+//
+// Usage: voronoi_bench [numPoints] [periodic 0|1] [seed]
+//
+// Both paths produce the cell volumes; the largest per-cell volume difference
+// is reported as a consistency check.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "KnnVoronoi.h"
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+double delaunayVolumes(const std::vector<double>& points, bool periodic,
+                       std::vector<double>& volumes, double& triangulationTime) {
+    const GEO::index_t n = GEO::index_t(points.size() / 3);
+    GEO::PeriodicDelaunay3d delaunay(periodic, 1.0);
+    delaunay.set_stores_cicl(false);
+
+    GEO::Stopwatch total("delaunay", false);
+    delaunay.set_vertices(n, points.data());
+    delaunay.compute();
+    triangulationTime = total.elapsed_time();
+
+    volumes.assign(n, 0.0);
+    GEO::parallel_for_slice(0, n, [&](GEO::index_t b, GEO::index_t e) {
+        GEO::ConvexCell C;
+        GEO::PeriodicDelaunay3d::IncidentTetrahedra W;
+        std::vector<GEO::index_t> neighbors;
+        for (GEO::index_t i = b; i < e; ++i) {
+            if (periodic) {
+                delaunay.copy_Laguerre_cell_from_Delaunay(i, C, W);
+            } else {
+                // Same domain as KnnVoronoi: clip the cell by the unit cube
+                C.init_with_box(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+                neighbors.clear();
+                delaunay.get_incident_tets(i, W);
+                for (GEO::index_t t : W) {
+                    for (GEO::index_t lv = 0; lv < 4; ++lv) {
+                        const GEO::index_t j = delaunay.cell_vertex(t, lv);
+                        if (j != i && j != GEO::NO_INDEX) neighbors.push_back(j);
+                    }
+                }
+                std::sort(neighbors.begin(), neighbors.end());
+                neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+                const GEO::vec3 Pi = delaunay.vertex(i);
+                for (GEO::index_t j : neighbors) {
+                    const GEO::vec3 Pj = delaunay.vertex(j);
+                    C.clip_by_plane_fast(GEO::vec4(
+                        2.0 * (Pi.x - Pj.x), 2.0 * (Pi.y - Pj.y), 2.0 * (Pi.z - Pj.z),
+                        GEO::length2(Pj) - GEO::length2(Pi)
+                    ));
+                }
+            }
+            C.compute_geometry();
+            volumes[i] = C.empty() ? 0.0 : C.volume();
+        }
+    });
+    return total.elapsed_time();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t n = (argc > 1) ? std::size_t(std::atol(argv[1])) : 20000u;
+    const bool periodic = (argc > 2) ? (std::atoi(argv[2]) != 0) : true;
+    const unsigned seed = (argc > 3) ? unsigned(std::atoi(argv[3])) : 42u;
+    if (n < 4) {
+        std::cerr << "voronoi_bench: at least 4 points are needed by the Delaunay path" << std::endl;
+        return 1;
+    }
+
+    GEO::initialize();
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> points(3 * n);
+    for (double& c : points) c = uniform(rng);
+
+    std::vector<double> delaunayCellVolumes;
+    double triangulationTime = 0.0;
+    const double delaunayTime = delaunayVolumes(points, periodic, delaunayCellVolumes, triangulationTime);
+
+    KnnVoronoi knn;
+    GEO::Stopwatch knnWatch("knn", false);
+    const bool ok = knn.compute(points.data(), n, periodic);
+    const double knnTime = knnWatch.elapsed_time();
+
+    double knnTotal = 0.0;
+    double maxDifference = 0.0;
+    if (ok) {
+        const double* volumes = knn.getVolumeBufferPtr();
+        for (std::size_t i = 0; i < n; ++i) {
+            knnTotal += volumes[i];
+            maxDifference = std::max(maxDifference, std::fabs(volumes[i] - delaunayCellVolumes[i]));
+        }
+    }
+
+    std::cout << "points " << n << (periodic ? " periodic" : " bounded")
+              << " threads " << GEO::Process::maximum_concurrent_threads() << std::endl;
+    std::cout << "delaunay+cells " << delaunayTime << " s (triangulation " << triangulationTime << " s)" << std::endl;
+    std::cout << "knn " << knnTime << " s, " << knn.getAverageClipCount() << " clips/cell, "
+              << knn.getFaceCount() / double(std::max<std::size_t>(n, 1)) << " faces/cell" << std::endl;
+    std::cout << "total volume " << knnTotal << ", max cell volume difference " << maxDifference << std::endl;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+// Node benchmark of the WASM build variants (./build.sh release).
+//
+// Usage: node bench/wasm_bench.mjs [variant ...]
+//   variants: scalar, simd, simd-mt (default: every one found in dist/)
+//
+// Each case runs on the same seeded inputs in every variant. Prints one JSON
+// object per line (variant, case, seconds), then a table.
+
+import { existsSync } from 'node:fs';
+import { fileURLToPath } from 'node:url';
+import { loadPeriodicDelaunay, WASM_VARIANTS } from '../src/js/loadPeriodicDelaunay.js';
+
+const distDir = new URL('../dist/', import.meta.url);
+
+const PARTICLES = 2000;
+const PARTICLE_RADIUS = 0.02;
+const REPULSION_FRAMES = 20;
+const STEERING_FRAMES = 5;
+const POINTS = 20000;
+const SEED = 42;
+
+// Deterministic uniform points in the unit cube (mulberry32)
+function randomPoints(count, seed) {
+    let state = seed >>> 0;
+    const next = () => {
+        state = (state + 0x6D2B79F5) >>> 0;
+        let t = state;
+        t = Math.imul(t ^ (t >>> 15), t | 1);
+        t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+        return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+    };
+    const points = new Float64Array(3 * count);
+    for (let i = 0; i < points.length; ++i) points[i] = next();
+    return points;
+}
+
+function time(fn) {
+    const start = process.hrtime.bigint();
+    fn();
+    return Number(process.hrtime.bigint() - start) * 1e-9;
+}
+
+// Cases are skipped when the module does not expose what they need
+const CASES = [
+    {
+        name: 'particles.repulsion',
+        available: (Module) => typeof Module.ParticleSystem === 'function',
+        run(Module) {
+            const system = new Module.ParticleSystem();
+            system.initialize(PARTICLES, PARTICLE_RADIUS, SEED);
+            system.setSteeringStrength(0.0);
+            const seconds = time(() => {
+                for (let f = 0; f < REPULSION_FRAMES; ++f) system.update(1 / 60);
+            });
+            system.delete();
+            return seconds / REPULSION_FRAMES;
+        }
+    },
+    {
+        name: 'particles.steering',
+        available: (Module) => typeof Module.ParticleSystem === 'function',
+        run(Module) {
+            const system = new Module.ParticleSystem();
+            system.initialize(PARTICLES, PARTICLE_RADIUS, SEED);
+            system.setSteeringEveryNFrames(1);
+            const seconds = time(() => {
+                for (let f = 0; f < STEERING_FRAMES; ++f) system.update(1 / 60);
+            });
+            system.delete();
+            return seconds / STEERING_FRAMES;
+        }
+    },
+    {
+        name: 'delaunay.periodic',
+        available: (Module) => typeof Module.compute_delaunay === 'function',
+        run(Module) {
+            const points = randomPoints(POINTS, SEED);
+            return time(() => Module.compute_delaunay(points, POINTS, true));
+        }
+    },
+    {
+        name: 'delaunay2d.periodic',
+        available: (Module) => typeof Module.PeriodicDelaunay2d === 'function',
+        run(Module) {
+            const points = randomPoints(POINTS, SEED).subarray(0, 2 * POINTS);
+            const mesh = new Module.PeriodicDelaunay2d();
+            const seconds = time(() => mesh.compute(points, POINTS, true));
+            mesh.delete();
+            return seconds;
+        }
+    },
+    {
+        name: 'knn_voronoi.periodic',
+        available: (Module) => typeof Module.KnnVoronoi === 'function',
+        run(Module) {
+            const points = randomPoints(POINTS, SEED);
+            const cells = new Module.KnnVoronoi();
+            const seconds = time(() => cells.compute(points, POINTS, true));
+            cells.delete();
+            return seconds;
+        }
+    }
+];
+
+async function main() {
+    const requested = process.argv.slice(2);
+    const variants = requested.length > 0 ? requested : WASM_VARIANTS.filter(
+        (variant) => existsSync(fileURLToPath(new URL(`periodic_delaunay.${variant}.js`, distDir))));
+    if (variants.length === 0) {
+        console.error('No release build in dist/, run ./build.sh release first.');
+        process.exit(1);
+    }
+
+    const results = {};
+    for (const variant of variants) {
+        // The module logs every computation, keep the benchmark output readable
+        const Module = await loadPeriodicDelaunay({
+            baseUrl: distDir,
+            variant,
+            moduleArgs: { print: () => {}, printErr: () => {} }
+        });
+        results[variant] = {};
+        for (const benchCase of CASES) {
+            if (!benchCase.available(Module)) continue;
+            const seconds = benchCase.run(Module);
+            results[variant][benchCase.name] = seconds;
+            console.log(JSON.stringify({ variant, case: benchCase.name, seconds }));
+        }
+    }
+
+    const rows = CASES.map((benchCase) => benchCase.name);
+    console.log(['case'.padEnd(24), ...variants.map((variant) => variant.padStart(12))].join(''));
+    for (const row of rows) {
+        const cells = variants.map((variant) => {
+            const seconds = results[variant][row];
+            return (seconds === undefined ? '-' : `${(seconds * 1000).toFixed(2)} ms`).padStart(12);
+        });
+        console.log([row.padEnd(24), ...cells].join(''));
+    }
+}
+
+// pthread workers keep node alive
+main().then(() => process.exit(0), (error) => {
+    console.error(error);
+    process.exit(1);
+});
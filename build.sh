@@ -12,27 +12,57 @@ if ! command -v em++ &> /dev/null; then
     exit 1
 fi
 
+# Usage: ./build.sh            development module (ASSERTIONS, -O2): dist/periodic_delaunay.js
+#        ./build.sh release    release variants, picked at runtime by src/js/loadPeriodicDelaunay.js:
+#                                dist/periodic_delaunay.scalar.js   plain wasm
+#                                dist/periodic_delaunay.simd.js     wasm simd128
+#                                dist/periodic_delaunay.simd-mt.js  simd128 + pthreads (needs
+#                                                                   SharedArrayBuffer, i.e. a
+#                                                                   cross-origin isolated page)
+MODE=${1:-dev}
+
 # Navigate to source directory
 cd src/cpp
 
-# Compile with Emscripten
-em++ --bind -o ../../dist/periodic_delaunay.js \
-    periodic_delaunay.cpp Delaunay_psm.cpp ParticleSystem.cpp \
-    -I. -I../../third_party/eigen-3.4.0 \
-    -s ALLOW_MEMORY_GROWTH=1 \
-    -s EXPORTED_RUNTIME_METHODS='["HEAPF32"]' \
-    -s MODULARIZE=1 \
-    -s EXPORT_NAME="PeriodicDelaunayModule" \
-    -s ASSERTIONS=1 \
-    -std=c++17 \
-    -O2
+# Geogram PSM parts used by the module (core, numerics, delaunay; the CDT and
+# kd-tree parts are not linked), see the geogram_psm_* libraries in CMakeLists.txt
+PSM_SOURCES="Delaunay_psm.cpp Delaunay_psm_numerics.cpp Delaunay_psm_delaunay.cpp"
+SOURCES="periodic_delaunay.cpp $PSM_SOURCES GeogramInit.cpp PointBuffer.cpp ParticleSystem.cpp SymmetricEigen3.cpp AlphaFiltration.cpp BoundedVoronoi.cpp KnnVoronoi.cpp PeriodicDelaunay2d.cpp"
+
+# Pthreads: one worker per logical core, created at startup (Geogram joins its
+# threads synchronously, so they must exist before the first parallel section)
+POOL_SIZE="(typeof navigator!=='undefined'&&navigator.hardwareConcurrency)||require('os').cpus().length"
+
+# build_module <output.js> <flags...>
+build_module() {
+    local output=$1
+    shift
+    em++ --bind -o "../../dist/$output" \
+        $SOURCES \
+        -I. -I../../third_party/eigen-3.4.0 \
+        -ffunction-sections -fdata-sections -Wl,--gc-sections \
+        -s ALLOW_MEMORY_GROWTH=1 \
+        -s EXPORTED_RUNTIME_METHODS='["HEAPF32","HEAPF64","HEAP32","HEAP8"]' \
+        -s MODULARIZE=1 \
+        -s EXPORT_NAME="PeriodicDelaunayModule" \
+        -std=c++17 \
+        "$@" || return 1
+    echo "  - dist/$output, dist/${output%.js}.wasm"
+}
+
+if [ "$MODE" = "release" ]; then
+    RELEASE_FLAGS="-O3 -s ASSERTIONS=0"
+    build_module periodic_delaunay.scalar.js $RELEASE_FLAGS &&
+    build_module periodic_delaunay.simd.js $RELEASE_FLAGS -msimd128 &&
+    build_module periodic_delaunay.simd-mt.js $RELEASE_FLAGS -msimd128 -pthread -s PTHREAD_POOL_SIZE="$POOL_SIZE"
+else
+    build_module periodic_delaunay.js -O2 -s ASSERTIONS=1
+fi
 
 # Check if compilation was successful
 if [ $? -eq 0 ]; then
-    echo "Build successful! Output files:"
-    echo "  - dist/periodic_delaunay.js"
-    echo "  - dist/periodic_delaunay.wasm"
+    echo "Build successful!"
 else
     echo "Build failed!"
     exit 1
-fi 
\ No newline at end of file
+fi
@@ -0,0 +1,396 @@
+#include "AlphaFiltration.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+// A simplex is identified by up to four packed vertices, sorted ascending.
+// Each packed vertex holds the real vertex index (high bits) and the integer
+// period offset relative to the simplex anchor (three biased bytes), which
+// makes the key invariant under periodic translation.
+typedef std::array<uint64_t, 4> SimplexKey;
+
+const uint64_t NO_VERTEX = std::numeric_limits<uint64_t>::max();
+
+inline uint64_t packVertex(uint64_t real, int tx, int ty, int tz) {
+    return (real << 24) |
+           (uint64_t(tx + 128) << 16) |
+           (uint64_t(ty + 128) << 8) |
+           uint64_t(tz + 128);
+}
+
+inline uint32_t packedReal(uint64_t packed) {
+    return uint32_t(packed >> 24);
+}
+
+inline int packedOffset(uint64_t packed, int axis) {
+    return int((packed >> (8 * (2 - axis))) & 0xffu) - 128;
+}
+
+// One occurrence of a simplex: a subset (bitmask of local vertices) of a
+// tetrahedron of the triangulation. The tetrahedron gives a consistent frame
+// for the coordinates of the vertices in periodic mode.
+struct Occurrence {
+    GEO::index_t tet;
+    uint8_t mask;
+};
+
+// Entry used to group simplices of dimension d from the facets of the unique
+// simplices of dimension d+1.
+struct FacetEntry {
+    SimplexKey key;
+    Occurrence occ;       // occurrence of the facet
+    uint32_t coface;      // index of the (d+1)-simplex in its dimension
+    uint8_t oppositeLv;   // local vertex of occ.tet opposite to the facet
+    uint8_t slot;         // position of the facet in the coface boundary
+};
+
+// Per-dimension grouped simplices
+struct SimplexSet {
+    std::vector<SimplexKey> keys;
+    std::vector<Occurrence> reps;
+    std::vector<double> values;
+    // Cofaces of simplex i are entries[cofaceBegin[i] .. cofaceBegin[i+1])
+    std::vector<FacetEntry> entries;
+    std::vector<uint32_t> cofaceBegin;
+    // Facets of simplex i (d+1 per simplex, filled by the lower dimension)
+    std::vector<uint32_t> facets;
+};
+
+class Frame {
+public:
+    Frame(const GEO::PeriodicDelaunay3d& delaunay, bool periodic)
+        : delaunay(delaunay), periodic(periodic),
+          n(delaunay.nb_vertices_non_periodic()) {}
+
+    uint64_t absoluteVertex(GEO::index_t v) const {
+        if (!periodic) return packVertex(v, 0, 0, 0);
+        const GEO::index_t instance = v / n;
+        return packVertex(v % n,
+                          GEO::Periodic::translation[instance][0],
+                          GEO::Periodic::translation[instance][1],
+                          GEO::Periodic::translation[instance][2]);
+    }
+
+    // Translation-invariant key of the vertices of tet selected by mask
+    SimplexKey key(const Occurrence& occ) const {
+        SimplexKey k;
+        k.fill(NO_VERTEX);
+        std::size_t count = 0;
+        for (GEO::index_t lv = 0; lv < 4; ++lv) {
+            if ((occ.mask & (1u << lv)) == 0) continue;
+            k[count++] = absoluteVertex(delaunay.cell_vertex(occ.tet, lv));
+        }
+        std::sort(k.begin(), k.begin() + count);
+        // Anchor: lowest real index (then lowest offset), invariant by translation
+        const uint64_t anchor = k[0];
+        const int ax = packedOffset(anchor, 0);
+        const int ay = packedOffset(anchor, 1);
+        const int az = packedOffset(anchor, 2);
+        for (std::size_t i = 0; i < count; ++i) {
+            k[i] = packVertex(packedReal(k[i]),
+                              packedOffset(k[i], 0) - ax,
+                              packedOffset(k[i], 1) - ay,
+                              packedOffset(k[i], 2) - az);
+        }
+        return k;
+    }
+
+    GEO::vec3 point(GEO::index_t tet, GEO::index_t lv) const {
+        return delaunay.vertex(delaunay.cell_vertex(tet, lv));
+    }
+
+    double weight(GEO::index_t tet, GEO::index_t lv) const {
+        return delaunay.weight(delaunay.cell_vertex(tet, lv));
+    }
+
+    // Smallest orthogonal sphere of the weighted vertices selected by occ.
+    // Returns the squared radius (power), and the center in 'center'.
+    double orthosphere(const Occurrence& occ, GEO::vec3& center) const {
+        GEO::vec3 p[4];
+        double w[4];
+        GEO::index_t k = 0;
+        for (GEO::index_t lv = 0; lv < 4; ++lv) {
+            if ((occ.mask & (1u << lv)) == 0) continue;
+            p[k] = point(occ.tet, lv);
+            w[k] = weight(occ.tet, lv);
+            ++k;
+        }
+        center = p[0];
+        if (k == 1) return -w[0];
+
+        // Center is p0 + sum_j lambda_j a_j with a_j = pj - p0, solve the
+        // (k-1)x(k-1) Gram system G lambda = b.
+        const GEO::index_t m = k - 1;
+        GEO::vec3 a[3];
+        double G[3][4];
+        for (GEO::index_t i = 0; i < m; ++i) {
+            a[i] = p[i + 1] - p[0];
+        }
+        for (GEO::index_t i = 0; i < m; ++i) {
+            for (GEO::index_t j = 0; j < m; ++j) {
+                G[i][j] = GEO::dot(a[i], a[j]);
+            }
+            G[i][m] = 0.5 * (GEO::length2(a[i]) - w[i + 1] + w[0]);
+        }
+
+        // Gaussian elimination with partial pivoting
+        for (GEO::index_t col = 0; col < m; ++col) {
+            GEO::index_t pivot = col;
+            for (GEO::index_t r = col + 1; r < m; ++r) {
+                if (std::fabs(G[r][col]) > std::fabs(G[pivot][col])) pivot = r;
+            }
+            if (std::fabs(G[pivot][col]) < 1e-300) {
+                return std::numeric_limits<double>::infinity(); // degenerate (flat) simplex
+            }
+            if (pivot != col) {
+                for (GEO::index_t c = 0; c <= m; ++c) std::swap(G[col][c], G[pivot][c]);
+            }
+            for (GEO::index_t r = col + 1; r < m; ++r) {
+                const double f = G[r][col] / G[col][col];
+                for (GEO::index_t c = col; c <= m; ++c) G[r][c] -= f * G[col][c];
+            }
+        }
+        double lambda[3];
+        for (GEO::index_t i = m; i-- > 0;) {
+            double s = G[i][m];
+            for (GEO::index_t j = i + 1; j < m; ++j) s -= G[i][j] * lambda[j];
+            lambda[i] = s / G[i][i];
+        }
+
+        GEO::vec3 d(0.0, 0.0, 0.0);
+        for (GEO::index_t i = 0; i < m; ++i) d += lambda[i] * a[i];
+        center = p[0] + d;
+        return GEO::length2(d) - w[0];
+    }
+
+    // True if the facet occurrence is attached to its coface, i.e. if the
+    // opposite vertex is strictly inside the facet's smallest orthosphere.
+    bool isAttached(const Occurrence& facet, GEO::index_t oppositeLv, double& facetValue) const {
+        GEO::vec3 c;
+        facetValue = orthosphere(facet, c);
+        if (!std::isfinite(facetValue)) return false;
+        const GEO::vec3 q = point(facet.tet, oppositeLv);
+        const double power = GEO::length2(q - c) - weight(facet.tet, oppositeLv) - facetValue;
+        return power < 0.0;
+    }
+
+private:
+    const GEO::PeriodicDelaunay3d& delaunay;
+    bool periodic;
+    GEO::index_t n;
+};
+
+// Sort entries by key and group them, filling keys/reps/cofaceBegin of set
+void groupEntries(SimplexSet& set) {
+    std::vector<FacetEntry>& entries = set.entries;
+    GEO::sort(entries.begin(), entries.end(), [](const FacetEntry& a, const FacetEntry& b) {
+        return a.key < b.key;
+    });
+    set.keys.clear();
+    set.reps.clear();
+    set.cofaceBegin.clear();
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (i == 0 || entries[i].key != entries[i - 1].key) {
+            set.keys.push_back(entries[i].key);
+            set.reps.push_back(entries[i].occ);
+            set.cofaceBegin.push_back(uint32_t(i));
+        }
+    }
+    set.cofaceBegin.push_back(uint32_t(entries.size()));
+}
+
+} // namespace
+
+AlphaFiltration::AlphaFiltration() {
+    clear();
+}
+
+void AlphaFiltration::clear() {
+    values.clear();
+    vertices.clear();
+    boundary.clear();
+    offsets.clear();
+    for (int d = 0; d < 4; ++d) countByDimension[d] = 0;
+}
+
+std::size_t AlphaFiltration::getSimplexCount(int dimension) const {
+    return (dimension >= 0 && dimension < 4) ? countByDimension[dimension] : 0;
+}
+
+bool AlphaFiltration::compute(const double* points, std::size_t numPoints, const double* radii, bool periodic) {
+    clear();
+    if (numPoints < 4) return false;
+
+    std::unique_ptr<GEO::PeriodicDelaunay3d> delaunay;
+    if (periodic) {
+        delaunay = std::make_unique<GEO::PeriodicDelaunay3d>(GEO::vec3(1.0, 1.0, 1.0));
+    } else {
+        delaunay = std::make_unique<GEO::PeriodicDelaunay3d>(false);
+    }
+    delaunay->set_stores_cicl(false);
+
+    // Power weights (r^2), must outlive the triangulation
+    std::vector<double> weights;
+    if (radii != nullptr) {
+        weights.resize(numPoints);
+        for (std::size_t i = 0; i < numPoints; ++i) weights[i] = radii[i] * radii[i];
+    }
+
+    delaunay->set_vertices(GEO::index_t(numPoints), points);
+    if (!weights.empty()) delaunay->set_weights(weights.data());
+    try {
+        delaunay->compute();
+    } catch (...) {
+        return false;
+    }
+    if (delaunay->has_empty_cells()) return false;
+
+    return computeFromDelaunay(*delaunay, periodic);
+}
+
+bool AlphaFiltration::computeFromDelaunay(const GEO::PeriodicDelaunay3d& delaunay, bool periodic) {
+    clear();
+    const GEO::index_t numCells = delaunay.nb_cells();
+    if (numCells == 0) return false;
+
+    const Frame frame(delaunay, periodic);
+    SimplexSet sets[4];
+
+    // --- Tetrahedra: one entry per kept cell (several periodic copies may map to the same key)
+    {
+        SimplexSet& tets = sets[3];
+        tets.entries.resize(numCells);
+        GEO::parallel_for(0, numCells, [&](GEO::index_t t) {
+            FacetEntry& e = tets.entries[t];
+            e.occ.tet = t;
+            e.occ.mask = 0xF;
+            e.key = frame.key(e.occ);
+            e.coface = 0;
+            e.oppositeLv = 0;
+            e.slot = 0;
+        });
+        groupEntries(tets);
+        tets.entries.clear();
+        tets.entries.shrink_to_fit();
+        tets.cofaceBegin.assign(tets.keys.size() + 1, 0);
+
+        tets.values.resize(tets.keys.size());
+        GEO::parallel_for(0, GEO::index_t(tets.keys.size()), [&](GEO::index_t i) {
+            GEO::vec3 c;
+            tets.values[i] = frame.orthosphere(tets.reps[i], c);
+        });
+    }
+
+    // --- Triangles, edges, vertices: facets of the unique simplices one dimension up
+    for (int d = 2; d >= 0; --d) {
+        SimplexSet& upper = sets[d + 1];
+        SimplexSet& cur = sets[d];
+        const std::size_t nbUpper = upper.keys.size();
+        const std::size_t nbFacets = std::size_t(d + 2);
+
+        cur.entries.resize(nbUpper * nbFacets);
+        GEO::parallel_for(0, GEO::index_t(nbUpper), [&](GEO::index_t s) {
+            const Occurrence& rep = upper.reps[s];
+            std::size_t slot = 0;
+            for (GEO::index_t lv = 0; lv < 4; ++lv) {
+                if ((rep.mask & (1u << lv)) == 0) continue;
+                FacetEntry& e = cur.entries[s * nbFacets + slot];
+                e.occ.tet = rep.tet;
+                e.occ.mask = uint8_t(rep.mask & ~(1u << lv));
+                e.key = frame.key(e.occ);
+                e.coface = uint32_t(s);
+                e.oppositeLv = uint8_t(lv);
+                e.slot = uint8_t(slot);
+                ++slot;
+            }
+        });
+        groupEntries(cur);
+
+        // Boundary of the upper dimension
+        upper.facets.resize(nbUpper * nbFacets);
+        for (std::size_t i = 0; i + 1 < cur.cofaceBegin.size(); ++i) {
+            for (uint32_t k = cur.cofaceBegin[i]; k < cur.cofaceBegin[i + 1]; ++k) {
+                const FacetEntry& e = cur.entries[k];
+                upper.facets[std::size_t(e.coface) * nbFacets + e.slot] = uint32_t(i);
+            }
+        }
+
+        // Filtration values: own radius if Gabriel, else min over cofaces
+        cur.values.resize(cur.keys.size());
+        GEO::parallel_for(0, GEO::index_t(cur.keys.size()), [&](GEO::index_t i) {
+            double own = 0.0;
+            bool attached = false;
+            double minCoface = std::numeric_limits<double>::infinity();
+            for (uint32_t k = cur.cofaceBegin[i]; k < cur.cofaceBegin[i + 1]; ++k) {
+                const FacetEntry& e = cur.entries[k];
+                if (frame.isAttached(e.occ, e.oppositeLv, own)) attached = true;
+                minCoface = std::min(minCoface, upper.values[e.coface]);
+            }
+            cur.values[i] = attached ? minCoface : own;
+        });
+    }
+
+    // --- Sort all simplices by (value, dimension, key)
+    struct Ref {
+        double value;
+        uint32_t index;
+        uint8_t dim;
+    };
+    std::size_t total = 0;
+    for (int d = 0; d < 4; ++d) {
+        countByDimension[d] = sets[d].keys.size();
+        total += countByDimension[d];
+    }
+    std::vector<Ref> order;
+    order.reserve(total);
+    for (int d = 0; d < 4; ++d) {
+        for (std::size_t i = 0; i < sets[d].keys.size(); ++i) {
+            order.push_back(Ref{ sets[d].values[i], uint32_t(i), uint8_t(d) });
+        }
+    }
+    GEO::sort(order.begin(), order.end(), [&sets](const Ref& a, const Ref& b) {
+        if (a.value != b.value) return a.value < b.value;
+        if (a.dim != b.dim) return a.dim < b.dim;
+        return sets[a.dim].keys[a.index] < sets[b.dim].keys[b.index];
+    });
+
+    // Position of each simplex in the output, used to renumber boundaries
+    std::vector<uint32_t> position[4];
+    for (int d = 0; d < 4; ++d) position[d].resize(sets[d].keys.size());
+    for (std::size_t r = 0; r < order.size(); ++r) {
+        position[order[r].dim][order[r].index] = uint32_t(r);
+    }
+
+    values.resize(total);
+    vertices.assign(total * 4, -1);
+    boundary.assign(total * 4, -1);
+    offsets.assign(total * 12, 0);
+    GEO::parallel_for(0, GEO::index_t(total), [&](GEO::index_t r) {
+        const Ref& ref = order[r];
+        const SimplexSet& set = sets[ref.dim];
+        const SimplexKey& key = set.keys[ref.index];
+        values[r] = ref.value;
+        for (int lv = 0; lv <= ref.dim; ++lv) {
+            vertices[r * 4 + lv] = int32_t(packedReal(key[lv]));
+            for (int axis = 0; axis < 3; ++axis) {
+                offsets[r * 12 + lv * 3 + axis] = int8_t(packedOffset(key[lv], axis));
+            }
+        }
+        if (ref.dim > 0) {
+            const std::size_t nbFacets = std::size_t(ref.dim + 1);
+            for (std::size_t f = 0; f < nbFacets; ++f) {
+                boundary[r * 4 + f] = int32_t(position[ref.dim - 1][set.facets[ref.index * nbFacets + f]]);
+            }
+        }
+    });
+
+    return true;
+}
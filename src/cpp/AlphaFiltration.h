@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace GEO {
+    class PeriodicDelaunay3d;
+}
+
+// AlphaFiltration computes the (weighted) alpha-complex filtration of a
+// periodic or non-periodic 3D Delaunay/regular triangulation.
+//
+// Every simplex (vertex, edge, triangle, tetrahedron) receives the squared
+// radius of the smallest empty orthogonal sphere through its vertices
+// (same convention as CGAL/Gudhi, so the value is alpha^2):
+// - Gabriel simplices keep the radius of their own smallest orthosphere.
+// - Attached (non-Gabriel) simplices, whose smallest orthosphere contains
+//   the opposite vertex of a coface, inherit the minimum over their cofaces.
+// With radii, the power weights are r^2 and vertices start at -r^2.
+//
+// In periodic mode, simplices are identified by their real vertex indices
+// plus the integer offsets relative to their lowest vertex, so every
+// simplex of the flat torus is output exactly once.
+//
+// Output is sorted by (value, dimension), which is a valid filtration order
+// (faces always come before their cofaces) and can be fed directly into
+// persistent-homology tools. All buffers are flat arrays for JS interop:
+// - values:   one double per simplex
+// - vertices: four int32 per simplex (real vertex indices, -1 padded)
+// - boundary: four int32 per simplex (indices of the facets in this
+//             sorted order, -1 padded; empty boundary for vertices)
+// - offsets:  twelve int8 per simplex (integer period offset of each vertex
+//             relative to the first one, zero in non-periodic mode)
+
+class AlphaFiltration {
+public:
+    AlphaFiltration();
+
+    // Triangulate the points (x,y,z packed, in [0,1)^3 when periodic) and
+    // compute the filtration. radii may be null for the unweighted case.
+    // Geogram must have been initialized. Returns false on failure
+    // (degenerate input, or hidden vertices in the weighted periodic case).
+    bool compute(const double* points, std::size_t numPoints, const double* radii, bool periodic);
+
+    // Compute the filtration from an already computed triangulation.
+    bool computeFromDelaunay(const GEO::PeriodicDelaunay3d& delaunay, bool periodic);
+
+    std::size_t getSimplexCount() const { return values.size(); }
+    std::size_t getSimplexCount(int dimension) const;
+
+    double* getValueBufferPtr() { return values.empty() ? nullptr : values.data(); }
+    int32_t* getVertexBufferPtr() { return vertices.empty() ? nullptr : vertices.data(); }
+    int32_t* getBoundaryBufferPtr() { return boundary.empty() ? nullptr : boundary.data(); }
+    int8_t* getOffsetBufferPtr() { return offsets.empty() ? nullptr : offsets.data(); }
+
+private:
+    void clear();
+
+    std::vector<double> values;
+    std::vector<int32_t> vertices;
+    std::vector<int32_t> boundary;
+    std::vector<int8_t> offsets;
+    std::size_t countByDimension[4];
+};
@@ -0,0 +1,181 @@
+#include "BoundedVoronoi.h"
+
+#include <algorithm>
+#include <memory>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+// Cells computed by one parallel slice [begin, end), concatenated in order afterwards
+struct SliceOutput {
+    GEO::index_t begin = 0;
+    std::vector<double> volumes;
+    std::vector<uint32_t> faceCounts;      // per cell
+    std::vector<int32_t> faceNeighbors;
+    std::vector<double> faceAreas;
+    std::vector<uint32_t> polygonCounts;   // per face
+    std::vector<float> polygonVertices;
+};
+
+// Local vertex indices 1..6 of a ConvexCell initialized by init_with_box()
+// are the box walls, clipping planes come next.
+const VBW::index_t FIRST_CLIP_VERTEX = 7;
+
+} // namespace
+
+BoundedVoronoi::BoundedVoronoi() {
+    setBox(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+}
+
+void BoundedVoronoi::setBox(double xmin, double ymin, double zmin, double xmax, double ymax, double zmax) {
+    boxMin[0] = xmin;
+    boxMin[1] = ymin;
+    boxMin[2] = zmin;
+    boxMax[0] = xmax;
+    boxMax[1] = ymax;
+    boxMax[2] = zmax;
+}
+
+void BoundedVoronoi::clear() {
+    volumes.clear();
+    faceOffsets.clear();
+    faceNeighbors.clear();
+    faceAreas.clear();
+    polygonOffsets.clear();
+    polygonVertices.clear();
+}
+
+bool BoundedVoronoi::compute(const double* points, std::size_t numPoints, const double* radii) {
+    clear();
+    if (numPoints < 4) return false;
+
+    std::unique_ptr<GEO::PeriodicDelaunay3d> delaunay = std::make_unique<GEO::PeriodicDelaunay3d>(false);
+    delaunay->set_stores_cicl(false);
+
+    // Power weights (r^2), must outlive the triangulation
+    std::vector<double> weights;
+    if (radii != nullptr) {
+        weights.resize(numPoints);
+        for (std::size_t i = 0; i < numPoints; ++i) weights[i] = radii[i] * radii[i];
+    }
+
+    delaunay->set_vertices(GEO::index_t(numPoints), points);
+    if (!weights.empty()) delaunay->set_weights(weights.data());
+    try {
+        delaunay->compute();
+    } catch (...) {
+        return false;
+    }
+    if (delaunay->has_empty_cells()) return false;
+
+    return computeFromDelaunay(*delaunay);
+}
+
+bool BoundedVoronoi::computeFromDelaunay(const GEO::PeriodicDelaunay3d& delaunay) {
+    clear();
+    const GEO::index_t n = delaunay.nb_vertices_non_periodic();
+    if (n == 0 || delaunay.nb_cells() == 0) return false;
+
+    std::vector<std::unique_ptr<SliceOutput>> slices;
+    GEO::Process::spinlock slicesLock = GEOGRAM_SPINLOCK_INIT;
+
+    GEO::parallel_for_slice(0, n, [&](GEO::index_t b, GEO::index_t e) {
+        std::unique_ptr<SliceOutput> out = std::make_unique<SliceOutput>();
+        out->begin = b;
+        out->volumes.reserve(e - b);
+        out->faceCounts.reserve(e - b);
+
+        GEO::ConvexCell C;
+        GEO::PeriodicDelaunay3d::IncidentTetrahedra W;
+        std::vector<GEO::index_t> neighbors;
+
+        for (GEO::index_t i = b; i < e; ++i) {
+            C.init_with_box(boxMin[0], boxMin[1], boxMin[2], boxMax[0], boxMax[1], boxMax[2]);
+
+            // Delaunay neighbors from the star of i
+            neighbors.clear();
+            delaunay.get_incident_tets(i, W);
+            for (GEO::index_t t : W) {
+                for (GEO::index_t lv = 0; lv < 4; ++lv) {
+                    const GEO::index_t j = delaunay.cell_vertex(t, lv);
+                    if (j != i && j != GEO::NO_INDEX) neighbors.push_back(j);
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+            // Clip by the (power) bisectors, same plane convention as
+            // PeriodicDelaunay3d::copy_Laguerre_cell_from_Delaunay()
+            const GEO::vec3 Pi = delaunay.vertex(i);
+            const double wi = delaunay.weight(i);
+            const double Pi_len2 = GEO::length2(Pi);
+            for (GEO::index_t j : neighbors) {
+                const GEO::vec3 Pj = delaunay.vertex(j);
+                const double wj = delaunay.weight(j);
+                C.clip_by_plane_fast(GEO::vec4(
+                    2.0 * (Pi.x - Pj.x),
+                    2.0 * (Pi.y - Pj.y),
+                    2.0 * (Pi.z - Pj.z),
+                    (wi - Pi_len2) - (wj - GEO::length2(Pj))
+                ));
+            }
+
+            uint32_t nbFaces = 0;
+            if (C.empty()) {
+                out->volumes.push_back(0.0);
+                out->faceCounts.push_back(0);
+                continue;
+            }
+
+            C.compute_geometry();
+            out->volumes.push_back(C.volume());
+
+            for (VBW::index_t v = 1; v < C.nb_v(); ++v) {
+                if (!C.vertex_is_contributing(v)) continue;
+                const int32_t neighbor = (v < FIRST_CLIP_VERTEX)
+                    ? -int32_t(v)
+                    : int32_t(neighbors[v - FIRST_CLIP_VERTEX]);
+                out->faceNeighbors.push_back(neighbor);
+                out->faceAreas.push_back(C.facet_area(v));
+
+                uint32_t nbPolygonVertices = 0;
+                C.for_each_Voronoi_vertex(v, [&](VBW::index_t t) {
+                    const GEO::vec3 p = C.triangle_point(VBW::ushort(t));
+                    out->polygonVertices.insert(out->polygonVertices.end(),
+                                                { float(p.x), float(p.y), float(p.z) });
+                    ++nbPolygonVertices;
+                });
+                out->polygonCounts.push_back(nbPolygonVertices);
+                ++nbFaces;
+            }
+            out->faceCounts.push_back(nbFaces);
+        }
+
+        GEO::Process::acquire_spinlock(slicesLock);
+        slices.push_back(std::move(out));
+        GEO::Process::release_spinlock(slicesLock);
+    });
+
+    // Concatenate slices in cell order
+    std::sort(slices.begin(), slices.end(), [](const std::unique_ptr<SliceOutput>& a,
+                                               const std::unique_ptr<SliceOutput>& b) {
+        return a->begin < b->begin;
+    });
+
+    volumes.reserve(n);
+    faceOffsets.reserve(std::size_t(n) + 1u);
+    faceOffsets.push_back(0);
+    polygonOffsets.push_back(0);
+    for (const std::unique_ptr<SliceOutput>& slice : slices) {
+        volumes.insert(volumes.end(), slice->volumes.begin(), slice->volumes.end());
+        for (uint32_t count : slice->faceCounts) faceOffsets.push_back(faceOffsets.back() + count);
+        faceNeighbors.insert(faceNeighbors.end(), slice->faceNeighbors.begin(), slice->faceNeighbors.end());
+        faceAreas.insert(faceAreas.end(), slice->faceAreas.begin(), slice->faceAreas.end());
+        for (uint32_t count : slice->polygonCounts) polygonOffsets.push_back(polygonOffsets.back() + count);
+        polygonVertices.insert(polygonVertices.end(), slice->polygonVertices.begin(), slice->polygonVertices.end());
+    }
+
+    return volumes.size() == n;
+}
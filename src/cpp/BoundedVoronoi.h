@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace GEO {
+    class PeriodicDelaunay3d;
+}
+
+// BoundedVoronoi computes the Voronoi (or Laguerre, with radii) cells of a
+// non-periodic point set, clipped to an axis-aligned domain box.
+//
+// Each cell starts as the box (VBW::ConvexCell::init_with_box) and is clipped
+// by the bisector planes of its Delaunay neighbors (clip_by_plane_fast).
+// Cells are independent and computed in parallel.
+//
+// Results are flat arrays for JS interop (CSR layout):
+// - volumes:          one double per cell
+// - faceOffsets:      numCells+1 uint32, faces of cell i are [faceOffsets[i], faceOffsets[i+1])
+// - faceNeighbors:    one int32 per face: neighbor index, or -1-k for box wall k
+//                     (k = 0..5 for xmin, xmax, ymin, ymax, zmin, zmax)
+// - faceAreas:        one double per face
+// - polygonOffsets:   numFaces+1 uint32, vertices of face f are [polygonOffsets[f], polygonOffsets[f+1])
+// - polygonVertices:  three floats per polygon vertex, in order around the face
+
+class BoundedVoronoi {
+public:
+    BoundedVoronoi();
+
+    // Domain box, defaults to the unit cube.
+    void setBox(double xmin, double ymin, double zmin, double xmax, double ymax, double zmax);
+
+    // Triangulate the points (x,y,z packed, inside the box) and compute the clipped cells.
+    // radii may be null (Voronoi), otherwise Laguerre cells with power weights r^2.
+    // Geogram must have been initialized. Returns false on failure.
+    bool compute(const double* points, std::size_t numPoints, const double* radii);
+
+    // Compute the clipped cells from a non-periodic triangulation.
+    bool computeFromDelaunay(const GEO::PeriodicDelaunay3d& delaunay);
+
+    std::size_t getCellCount() const { return volumes.size(); }
+    std::size_t getFaceCount() const { return faceNeighbors.size(); }
+    std::size_t getPolygonVertexCount() const { return polygonVertices.size() / 3u; }
+
+    double* getVolumeBufferPtr() { return volumes.empty() ? nullptr : volumes.data(); }
+    uint32_t* getFaceOffsetBufferPtr() { return faceOffsets.empty() ? nullptr : faceOffsets.data(); }
+    int32_t* getFaceNeighborBufferPtr() { return faceNeighbors.empty() ? nullptr : faceNeighbors.data(); }
+    double* getFaceAreaBufferPtr() { return faceAreas.empty() ? nullptr : faceAreas.data(); }
+    uint32_t* getPolygonOffsetBufferPtr() { return polygonOffsets.empty() ? nullptr : polygonOffsets.data(); }
+    float* getPolygonVertexBufferPtr() { return polygonVertices.empty() ? nullptr : polygonVertices.data(); }
+
+private:
+    void clear();
+
+    double boxMin[3];
+    double boxMax[3];
+
+    std::vector<double> volumes;
+    std::vector<uint32_t> faceOffsets;
+    std::vector<int32_t> faceNeighbors;
+    std::vector<double> faceAreas;
+    std::vector<uint32_t> polygonOffsets;
+    std::vector<float> polygonVertices;
+};
@@ -160,6 +160,10 @@ namespace GEO {
         GEOGRAM_INSTALL_FPE = 8,
         /// Enable global citation database
         GEOGRAM_INSTALL_BIBLIO = 16,
+        /// Minimal profile: only the logger and command line used by the
+        /// algorithms, the thread manager, the predicates and the Delaunay
+        /// factories (no file system, progress, stopwatch or NODEFS mount)
+        GEOGRAM_INSTALL_MINIMAL = 32,
         /// Install everything
         GEOGRAM_INSTALL_ALL = GEOGRAM_INSTALL_HANDLERS
         | GEOGRAM_INSTALL_LOCALE
@@ -8767,6 +8771,35 @@ namespace VBW {
 
     void clip_by_plane_fast(vec4 P, global_index_t j);
 
+    /**
+     * \brief Same cell as clip_by_plane_fast(), with the conflict test of all
+     *  the triangles evaluated at once.
+     * \details The dual point of each triangle is kept, in
+     *  structure-of-arrays form, as the coefficients of its conflict
+     *  determinant (linear in the plane equation), and updated as triangles
+     *  are created. The determinants for \p P are evaluated two triangles at
+     *  a time (SSE2 or wasm simd128) with an error bound, only the triangles
+     *  that the bound cannot decide go through triangle_is_in_conflict().
+     */
+    void clip_by_plane_vectorized(vec4 P);
+
+    void clip_by_plane_vectorized(vec4 P, global_index_t j);
+
+    /**
+     * \brief Clips by a set of candidate planes, nearest first.
+     * \details The planes are sorted by signed distance to \p center (the
+     *  seed of a Voronoi cell, on the positive side of its bisectors).
+     *  Planes that do not cut the cell are rejected without creating a
+     *  vertex, and clipping stops at the first plane farther from \p center
+     *  than all the vertices of the cell.
+     * \param[in] j optional global indices of the planes
+     * \return the number of planes that clipped the cell
+     */
+    index_t clip_by_planes(
+        vec3 center, index_t nb_planes, const vec4* P,
+        const global_index_t* j = nullptr
+    );
+
     index_t nb_t() const {
         return nb_t_;
     }
@@ -8795,6 +8828,7 @@ namespace VBW {
         vbw_assert(i < nb_v());
         vbw_assert(j < nb_v());
         vbw_assert(k < nb_v());
+        triangle_duals_valid_ = false;
         return new_triangle(i,j,k);
     }
 
@@ -8830,6 +8864,19 @@ namespace VBW {
 
     void compute_mg(double& m, vec3& mg) const ;
 
+    /**
+     * \brief Computes the volume, first and second moments in one pass
+     * \details Same tetrahedral decomposition as compute_mg(); for each
+     *  tet, the second moment about the origin is
+     *  vol / 20 * (sum of p p^T over its vertices + s s^T), s the sum
+     *  of its vertices. Translate the cell so that the origin is nearby
+     *  (e.g. the seed) to keep the entries well conditioned.
+     * \param[out] m the volume
+     * \param[out] mg the first moment (volume times barycenter)
+     * \param[out] I the integrals of xx, xy, xz, yy, yz, zz
+     */
+    void compute_second_moments(double& m, vec3& mg, double I[6]) const;
+
 
     double squared_radius(vec3 center) const;
 
@@ -9096,6 +9143,12 @@ namespace VBW {
         std::swap(has_vglobal_,other.has_vglobal_);
         std::swap(tflags_,other.tflags_);
         std::swap(has_tflags_,other.has_tflags_);
+        for(index_t c=0; c<8; ++c) {
+            std::swap(triangle_dual_[c],other.triangle_dual_[c]);
+        }
+        std::swap(triangle_status_,other.triangle_status_);
+        std::swap(triangle_duals_valid_,other.triangle_duals_valid_);
+        std::swap(clip_order_,other.clip_order_);
 #ifndef STANDALONE_CONVEX_CELL
         std::swap(use_exact_predicates_,other.use_exact_predicates_);
 #endif
@@ -9118,8 +9171,19 @@ namespace VBW {
         vbw_assert(v < max_v());
         plane_eqn_[v] = P;
         geometry_dirty_ = true;
+        triangle_duals_valid_ = false;
     }
 
+    void update_triangle_dual(index_t t);
+
+    void update_triangle_duals();
+
+    void classify_triangles_vectorized(vec4 P);
+
+    bool clip_by_plane_with_duals(vec4 P, bool skip_if_no_conflict);
+
+    double squared_radius_from_duals(vec3 center) const;
+
 
     private:
 
@@ -9165,6 +9229,21 @@ namespace VBW {
 
     bool has_tflags_;
 
+    // Conflict determinant of triangle t with plane E is
+    //   sum_c triangle_dual_[c][t] * E[c]      (c = 0..3)
+    // with error bound proportional to
+    //   sum_c triangle_dual_[4+c][t] * |E[c]|
+    // NaN for the triangles with the vertex at infinity.
+    vector<double> triangle_dual_[8];
+
+    // Per triangle: 0 not in conflict, 1 in conflict, 2 undecided
+    vector<uchar> triangle_status_;
+
+    bool triangle_duals_valid_;
+
+    // Scratch of clip_by_planes(): (distance to center, plane index)
+    vector<std::pair<double, index_t> > clip_order_;
+
 #ifndef STANDALONE_CONVEX_CELL
     bool use_exact_predicates_;
 #endif
@@ -9603,7 +9682,135 @@ namespace GEO {
 
     class Mesh;
 
-    
+    /**
+     * \brief Coarse uniform grid that maps a point to a nearby cell of a
+     *  triangulation, used as the starting point of locate().
+     * \details Each grid cell remembers the last triangulation cell that was
+     *  recorded for a vertex inside it, with the vertex, about two points
+     *  per grid cell. The entries are not kept in sync with the
+     *  triangulation: a recorded cell may have been destroyed or recycled
+     *  elsewhere since, callers check that it is still incident to the
+     *  vertex with the predicate passed to find().
+     */
+    class GEOGRAM_API LocateHintGrid {
+    public:
+        LocateHintGrid();
+
+        /**
+         * \brief Sizes the grid on the bounding box of the points, all
+         *  the entries empty.
+         * \param[in] dim number of coordinates used, 2 or 3
+         * \param[in] stride number of doubles between two points
+         */
+        void initialize(
+            index_t nb_points, const double* points,
+            coord_index_t dim, index_t stride
+        );
+
+        void clear();
+
+        bool is_initialized() const {
+            return !hints_.empty();
+        }
+
+        /**
+         * \brief Empties all the entries, keeps the grid geometry.
+         */
+        void reset_hints();
+
+        void set_hint(const double* p, index_t c, index_t v) {
+            index_t g = grid_cell(p);
+            hints_[2 * g] = c;
+            hints_[2 * g + 1] = v;
+        }
+
+        /**
+         * \brief Finds a recorded cell near a point.
+         * \details Looks in the grid cell of \p p, then in the rings of
+         *  grid cells around it, up to \p max_ring.
+         * \param[in] is_valid is_valid(c, v) tells whether recorded cell c
+         *  still exists and is incident to recorded vertex v
+         * \return a valid recorded cell, or NO_INDEX if there is none
+         */
+        template <class IS_VALID> index_t find(
+            const double* p, index_t max_ring, const IS_VALID& is_valid
+        ) const {
+            index_t g = grid_cell(p);
+            if(
+                hints_[2 * g] != NO_INDEX &&
+                is_valid(hints_[2 * g], hints_[2 * g + 1])
+            ) {
+                return hints_[2 * g];
+            }
+            index_t center[3];
+            grid_coords(p, center);
+            for(index_t ring = 1; ring <= max_ring; ++ring) {
+                signed_index_t r = signed_index_t(ring);
+                signed_index_t zr = (dim_ == 3) ? r : 0;
+                for(signed_index_t dz = -zr; dz <= zr; ++dz) {
+                    for(signed_index_t dy = -r; dy <= r; ++dy) {
+                        for(signed_index_t dx = -r; dx <= r; ++dx) {
+                            // Only the shell of the ring
+                            if(
+                                std::abs(dx) != r && std::abs(dy) != r &&
+                                std::abs(dz) != zr
+                            ) {
+                                continue;
+                            }
+                            signed_index_t x = signed_index_t(center[0]) + dx;
+                            signed_index_t y = signed_index_t(center[1]) + dy;
+                            signed_index_t z = signed_index_t(center[2]) + dz;
+                            if(
+                                x < 0 || x >= signed_index_t(res_[0]) ||
+                                y < 0 || y >= signed_index_t(res_[1]) ||
+                                z < 0 || z >= signed_index_t(res_[2])
+                            ) {
+                                continue;
+                            }
+                            g = (index_t(z) * res_[1] + index_t(y)) * res_[0] +
+                                index_t(x);
+                            if(
+                                hints_[2 * g] != NO_INDEX &&
+                                is_valid(hints_[2 * g], hints_[2 * g + 1])
+                            ) {
+                                return hints_[2 * g];
+                            }
+                        }
+                    }
+                }
+            }
+            return NO_INDEX;
+        }
+
+    protected:
+        void grid_coords(const double* p, index_t* coords) const {
+            for(coord_index_t coord = 0; coord < 3; ++coord) {
+                coords[coord] = 0;
+                if(coord >= dim_) {
+                    continue;
+                }
+                double x = (p[coord] - origin_[coord]) * inv_cell_size_;
+                // Written so that NaNs fall in the first grid cell
+                if(x >= double(res_[coord] - 1)) {
+                    coords[coord] = res_[coord] - 1;
+                } else if(x > 0.0) {
+                    coords[coord] = index_t(x);
+                }
+            }
+        }
+
+        index_t grid_cell(const double* p) const {
+            index_t coords[3];
+            grid_coords(p, coords);
+            return (coords[2] * res_[1] + coords[1]) * res_[0] + coords[0];
+        }
+
+        coord_index_t dim_;
+        index_t res_[3];
+        double origin_[3];
+        double inv_cell_size_;
+        vector<index_t> hints_; // (cell, vertex) per grid cell
+    };
 
     class GEOGRAM_API Delaunay : public Counted {
     public:
@@ -9711,6 +9918,14 @@ namespace GEO {
 
         virtual index_t nearest_vertex(const double* p) const;
 
+        /**
+         * \brief Batched nearest_vertex(), \p points has dimension()
+         *  doubles per point.
+         */
+        virtual void nearest_vertices(
+            index_t nb_points, const double* points, index_t* result
+        ) const;
+
         index_t cell_vertex(index_t c, index_t lv) const {
             geo_debug_assert(c < nb_cells());
             geo_debug_assert(lv < cell_size());
@@ -9960,6 +10175,8 @@ namespace GEO {
 
         index_t insert(index_t v, index_t hint = NO_TRIANGLE);
 
+        index_t locate_hint(const double* p) const;
+
         void find_conflict_zone(
             index_t v,
             index_t t, const Sign* orient,
@@ -10300,6 +10517,11 @@ namespace GEO {
         bool has_empty_cells_;
 
         bool abort_if_empty_cell_;
+
+        // Filled during insertion without reordering, then lazily from
+        // the final triangles for nearest_vertex()
+        mutable LocateHintGrid hint_grid_;
+        mutable std::atomic<bool> hint_grid_is_valid_;
     };
 
     
@@ -10616,6 +10838,17 @@ namespace GEO {
             }
         };
 
+        enum CellOrder {
+            CELL_ORDER_NONE,
+            CELL_ORDER_HILBERT,
+            CELL_ORDER_MORTON
+        };
+
+        enum CellOrderKey {
+            CELL_ORDER_KEY_CENTROID,
+            CELL_ORDER_KEY_LOWEST_VERTEX
+        };
+
         PeriodicDelaunay3d(bool periodic, double period=1.0);
 
         PeriodicDelaunay3d(const vec3& period);
@@ -10632,6 +10865,27 @@ namespace GEO {
             convex_cell_exact_predicates_ = x;
         }
 
+        /**
+         * \brief Spatial order of the output cells.
+         * \details By default compute() leaves the cells in pool order.
+         *  With CELL_ORDER_HILBERT or CELL_ORDER_MORTON, they are sorted
+         *  along the curve (in parallel), keyed by the centroid of each
+         *  cell or by its vertex of lowest index, and cell adjacency is
+         *  renumbered to match. The sort costs much more than it saves
+         *  on a single pass over the cells; it only pays off when many
+         *  passes reuse the mesh (see bench/cell_order_bench.cpp).
+         */
+        void set_cell_order(
+            CellOrder order, CellOrderKey key = CELL_ORDER_KEY_CENTROID
+        ) {
+            cell_order_ = order;
+            cell_order_key_ = key;
+        }
+
+        CellOrder cell_order() const {
+            return cell_order_;
+        }
+
         vec3 vertex(index_t v) const {
             if(!periodic_) {
                 geo_debug_assert(v < nb_vertices());
@@ -10677,6 +10931,28 @@ namespace GEO {
             return has_empty_cells_;
         }
 
+        /**
+         * \brief Warm start of the periodic copies.
+         * \details \p vertex_instances has one bit mask per vertex, as
+         *  returned by periodic_vertex_instances() after the previous
+         *  compute() (owned by the caller, nullptr to disable).
+         *  compute() then inserts these copies, and the ones of the
+         *  vertices closer than \p margin to a face, right after the
+         *  main pass, instead of phases I and II. They are checked with
+         *  the criteria of phases I and II, and the missing ones are
+         *  inserted.
+         */
+        void set_periodic_warm_start(
+            const Numeric::uint32* vertex_instances, double margin = 0.0
+        ) {
+            warm_start_instances_ = vertex_instances;
+            warm_start_margin_ = margin;
+        }
+
+        const vector<Numeric::uint32>& periodic_vertex_instances() const {
+            return required_vertex_instances_;
+        }
+
         void save_cells(const std::string& basename, bool clipped);
 
     protected:
@@ -10694,6 +10970,8 @@ namespace GEO {
 
         index_t compress(bool shrink=true);
 
+        void reorder_cells(index_t nb_tets);
+
         void update_v_to_cell() override;
 
         void update_cicl() override;
@@ -10705,7 +10983,25 @@ namespace GEO {
 
 	bool Laguerre_vertex_is_in_conflict_with_plane(index_t t, vec4 P) const;
 
-	void handle_periodic_boundaries_phase_II();
+	void handle_periodic_boundaries_phase_II(
+	    const vector<Numeric::uint32>* phase_I_instances = nullptr
+	);
+
+	void handle_periodic_boundaries_warm_start();
+
+	bool add_missing_phase_I_vertices(
+	    vector<Numeric::uint32>& phase_I_instances
+	);
+
+	void compute_Laguerre_cell_status(
+	    std::atomic<Numeric::uint16>* Lag_cell_status
+	);
+
+	Numeric::uint32 instances_from_conflict_status(
+	    Numeric::uint16 status
+	) const;
+
+	void compute_translation_table(Numeric::int8 table[27][27]) const;
 
 	void insert_vertices(const char* phase, index_t b, index_t e);
 
@@ -10755,6 +11051,8 @@ namespace GEO {
 
         vector<Numeric::uint32> vertex_instances_;
 
+        vector<Numeric::uint32> required_vertex_instances_;
+
         bool update_periodic_v_to_cell_;
         vector<index_t> periodic_v_to_cell_rowptr_;
         vector<index_t> periodic_v_to_cell_data_;
@@ -10765,6 +11063,12 @@ namespace GEO {
 
         bool convex_cell_exact_predicates_;
 
+        CellOrder cell_order_;
+        CellOrderKey cell_order_key_;
+
+        const Numeric::uint32* warm_start_instances_;
+        double warm_start_margin_;
+
 	struct Stats {
 
 	    Stats();
@@ -10796,6 +11100,11 @@ namespace GEO {
 	    double  phase_II_classify_t_;
 	    double  phase_II_insert_t_;
 	    index_t phase_II_insert_nb_;
+
+	    double  warm_start_t_;
+	    double  warm_start_check_t_;
+	    index_t warm_start_insert_nb_;
+	    index_t warm_start_repair_nb_;
 	} stats_;
 
 	friend class LaguerreDiagramOmegaSimple3d;
@@ -10828,6 +11137,24 @@ namespace GEO {
 
     void insert_constraint(index_t i, index_t j);
 
+    struct ConstraintBatchStats {
+        index_t nb_constraints;
+        index_t nb_existing_edges;
+        index_t nb_inserted;
+        double sort_time;
+        double classify_time;
+        double insert_time;
+    };
+
+    void insert_constraints(
+        index_t nb_constraints, const index_t* edges,
+        const double* midpoints = nullptr
+    );
+
+    const ConstraintBatchStats& constraint_batch_stats() const {
+        return constraint_batch_stats_;
+    }
+
     void remove_external_triangles(bool remove_internal_holes=false);
 
     void set_delaunay(bool delaunay) {
@@ -11518,9 +11845,15 @@ namespace GEO {
 
     void Delaunayize_new_edges_naive(vector<Edge>& N);
 
+    void insert_constraint_with_id(index_t i, index_t j, index_t cnstr_id);
+
+    bool constrain_existing_edge(index_t i, index_t j, index_t cnstr_id);
+
     protected:
     index_t nv_;
     index_t ncnstr_;
+    index_t cur_cnstr_; // id of the constraint being inserted
+    ConstraintBatchStats constraint_batch_stats_;
     vector<index_t> T_;        
     vector<index_t> Tadj_;     
     vector<index_t> v2T_;      
@@ -11551,6 +11884,8 @@ namespace GEO {
             const vec2& p1, const vec2& p2, const vec2& p3
         );
 
+        void insert_constraints(index_t nb_constraints, const index_t* edges);
+
         void create_enclosing_quad(
             const vec2& p1, const vec2& p2, const vec2& p3, const vec2& p4
         );
@@ -11629,6 +11964,11 @@ namespace GEO {
             CDTBase2d::insert_constraint(v1,v2);
         }
 
+        void insert_constraints(
+            index_t nb_constraints, const index_t* edges,
+            const index_t* operand_bits = nullptr
+        );
+
         void create_enclosing_triangle(
             const ExactPoint& p1, const ExactPoint& p2, const ExactPoint& p3
         );
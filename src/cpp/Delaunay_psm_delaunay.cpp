@@ -0,0 +1,12660 @@
+#include "Delaunay_psm_private.h"
+
+/*
+ *  Copyright (c) 2000-2022 Inria
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     https://www.inria.fr/fr/bruno-levy
+ *
+ *     Inria,
+ *     Domaine de Voluceau,
+ *     78150 Le Chesnay - Rocquencourt
+ *     FRANCE
+ *
+ */
+
+
+/*
+ *  This file is a PSM (pluggable software module)
+ *   generated from the distribution of Geogram.
+ *
+ *  See Geogram documentation on:
+ *   http://alice.loria.fr/software/geogram/doc/html/index.html
+ *
+ *  See documentation of the functions bundled in this PSM on:
+ *   http://alice.loria.fr/software/geogram/doc/html/classGEO_1_1Delaunay.html
+ */
+
+
+
+/******* extracted from delaunay.cpp *******/
+
+
+#ifdef GEOGRAM_WITH_PDEL
+#endif
+
+#ifdef GEOGRAM_WITH_TETGEN
+#endif
+
+#ifdef GEOGRAM_WITH_TRIANGLE
+#endif
+
+
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+    using namespace GEO;
+
+    std::string invalid_dimension_error(
+        coord_index_t dimension,
+        const char* name,
+        const char* expected
+    ) {
+        std::ostringstream out;
+        out << "Invalid dimension: dimension " << index_t(dimension)
+            << " is not supported by the " << name
+            << " algorithm. Supported dimension(s): " << expected;
+        return out.str();
+    }
+}
+
+namespace GEO {
+
+    LocateHintGrid::LocateHintGrid() :
+        dim_(0),
+        inv_cell_size_(0.0)
+    {
+        for(coord_index_t coord = 0; coord < 3; ++coord) {
+            res_[coord] = 1;
+            origin_[coord] = 0.0;
+        }
+    }
+
+    void LocateHintGrid::initialize(
+        index_t nb_points, const double* points,
+        coord_index_t dim, index_t stride
+    ) {
+        geo_assert(dim == 2 || dim == 3);
+        dim_ = dim;
+        double xyz_min[3] = { 0.0, 0.0, 0.0 };
+        double xyz_max[3] = { 0.0, 0.0, 0.0 };
+        for(index_t i = 0; i < nb_points; ++i) {
+            const double* p = points + i * stride;
+            for(coord_index_t coord = 0; coord < dim; ++coord) {
+                if(i == 0 || p[coord] < xyz_min[coord]) {
+                    xyz_min[coord] = p[coord];
+                }
+                if(i == 0 || p[coord] > xyz_max[coord]) {
+                    xyz_max[coord] = p[coord];
+                }
+            }
+        }
+
+        //   Square grid cells, about two points per grid cell. Flat
+        // extents count as a thousandth of the largest one, so that
+        // coplanar or colinear inputs do not get empty grid cells.
+        double max_extent = 0.0;
+        for(coord_index_t coord = 0; coord < dim; ++coord) {
+            max_extent = std::max(max_extent, xyz_max[coord] - xyz_min[coord]);
+        }
+        double measure = 1.0;
+        for(coord_index_t coord = 0; coord < dim; ++coord) {
+            measure *= std::max(
+                xyz_max[coord] - xyz_min[coord], 1e-3 * max_extent
+            );
+        }
+        double nb_grid_cells = std::max(double(nb_points) / 2.0, 1.0);
+        double cell_size = std::pow(measure / nb_grid_cells, 1.0 / double(dim));
+        if(!(cell_size > 0.0)) {
+            cell_size = 1.0;
+        }
+        inv_cell_size_ = 1.0 / cell_size;
+
+        index_t nb_cells = 1;
+        for(coord_index_t coord = 0; coord < 3; ++coord) {
+            origin_[coord] = xyz_min[coord];
+            res_[coord] = 1;
+            if(coord < dim) {
+                double extent = xyz_max[coord] - xyz_min[coord];
+                res_[coord] = index_t(std::min(
+                    std::ceil(extent * inv_cell_size_), double(nb_points)
+                ));
+                res_[coord] = std::max(res_[coord], index_t(1));
+            }
+            nb_cells *= res_[coord];
+        }
+        hints_.assign(2 * nb_cells, NO_INDEX);
+    }
+
+    void LocateHintGrid::clear() {
+        hints_.clear();
+    }
+
+    void LocateHintGrid::reset_hints() {
+        std::fill(hints_.begin(), hints_.end(), NO_INDEX);
+    }
+
+    Delaunay::InvalidDimension::InvalidDimension(
+        coord_index_t dimension,
+        const char* name,
+        const char* expected
+    ) :
+        std::logic_error(invalid_dimension_error(dimension, name, expected)) {
+    }
+
+    const char* Delaunay::InvalidDimension::what() const GEO_NOEXCEPT {
+        return std::logic_error::what();
+    }
+
+
+    Delaunay::InvalidInput::InvalidInput(int code) :
+        logic_error("Invalid input for Delaunay"),
+        error_code(code) {
+    }
+
+    Delaunay::InvalidInput::InvalidInput(
+        const InvalidInput& rhs
+    ) :
+        std::logic_error(rhs),
+        error_code(rhs.error_code),
+        invalid_facets(rhs.invalid_facets) {
+    }
+
+    Delaunay::InvalidInput::~InvalidInput() GEO_NOEXCEPT {
+    }
+
+    const char* Delaunay::InvalidInput::what() const GEO_NOEXCEPT {
+        return std::logic_error::what();
+    }
+
+    
+
+    void Delaunay::initialize() {
+
+#ifdef GEOGRAM_WITH_TETGEN
+        geo_register_Delaunay_creator(DelaunayTetgen, "tetgen");
+#endif
+
+#ifdef GEOGRAM_WITH_TRIANGLE
+        geo_register_Delaunay_creator(DelaunayTriangle, "triangle");
+#endif
+
+        geo_register_Delaunay_creator(Delaunay3d, "BDEL");
+
+#ifdef GEOGRAM_WITH_PDEL
+        geo_register_Delaunay_creator(ParallelDelaunay3d, "PDEL");
+#endif
+        geo_register_Delaunay_creator(RegularWeightedDelaunay3d, "BPOW");
+
+        geo_register_Delaunay_creator(Delaunay2d, "BDEL2d");
+#ifdef GEOGRAM_WITH_PDEL
+        geo_register_Delaunay_creator(ParallelDelaunay2d, "PDEL2d");
+#endif
+        geo_register_Delaunay_creator(RegularWeightedDelaunay2d, "BPOW2d");
+
+#ifndef GEOGRAM_PSM
+        geo_register_Delaunay_creator(Delaunay_NearestNeighbors, "NN");
+#endif
+    }
+
+    Delaunay* Delaunay::create(coord_index_t dim, const std::string& name_in) {
+
+        std::string name = name_in;
+        if(name == "default") {
+            name = CmdLine::get_arg("algo:delaunay");
+        }
+
+        try {
+            Delaunay* d = DelaunayFactory::create_object(name, dim);
+            if(d != nullptr) {
+                return d;
+            }
+
+            Logger::warn("Delaunay")
+                << "Could not create Delaunay triangulation: " << name
+                << std::endl;
+        }
+        catch(InvalidDimension& ex) {
+            Logger::warn("Delaunay") << ex.what() << std::endl;
+        }
+
+#ifdef GEOGRAM_PSM
+        Logger::err("Delaunay")
+            << "Could not create Delaunay triangulation"
+            << std::endl;
+        return nullptr;
+#else
+        Logger::warn("Delaunay")
+            << "Falling back to NN mode"
+            << std::endl;
+
+        return new Delaunay_NearestNeighbors(dim);
+#endif
+    }
+
+    Delaunay::Delaunay(coord_index_t dimension) {
+        set_dimension(dimension);
+        vertices_ = nullptr;
+        nb_vertices_ = 0;
+        nb_cells_ = 0;
+        cell_to_v_ = nullptr;
+        cell_to_cell_ = nullptr;
+        is_locked_ = false;
+        store_neighbors_ = false;
+        default_nb_neighbors_ = 30;
+        constraints_ = nullptr;
+        do_reorder_ = true;
+        refine_ = false;
+        quality_ = 2.0;
+        store_cicl_ = false;
+        keep_infinite_ = false;
+        nb_finite_cells_ = 0;
+        keep_regions_ = false;
+    }
+
+    Delaunay::~Delaunay() {
+    }
+
+    void Delaunay::set_vertices(index_t nb_vertices, const double* vertices) {
+        nb_vertices_ = nb_vertices;
+        vertices_ = vertices;
+    }
+
+    void Delaunay::set_BRIO_levels(const vector<index_t>& levels) {
+        geo_argused(levels);
+        // Default implementation does nothing
+    }
+
+    void Delaunay::set_arrays(
+        index_t nb_cells,
+        const index_t* cell_to_v, const index_t* cell_to_cell
+    ) {
+        nb_cells_ = nb_cells;
+        cell_to_v_ = cell_to_v;
+        cell_to_cell_ = cell_to_cell;
+
+        if(cell_to_cell != nullptr) {
+            if(store_cicl_) {
+                update_v_to_cell();
+                update_cicl();
+            }
+            if(store_neighbors_) {
+                update_neighbors();
+            }
+        }
+    }
+
+    bool Delaunay::supports_constraints() const {
+        return false;
+    }
+
+    index_t Delaunay::nearest_vertex(const double* p) const {
+        // Unefficient implementation (but at least it works).
+        // Derived classes are supposed to overload.
+        geo_assert(nb_vertices() > 0);
+        index_t result = 0;
+        double d = Geom::distance2(vertex_ptr(0), p, dimension());
+        for(index_t i = 1; i < nb_vertices(); i++) {
+            double cur_d = Geom::distance2(vertex_ptr(i), p, dimension());
+            if(cur_d < d) {
+                d = cur_d;
+                result = i;
+            }
+        }
+        return result;
+    }
+
+    void Delaunay::nearest_vertices(
+        index_t nb_points, const double* points, index_t* result
+    ) const {
+        for(index_t i = 0; i < nb_points; ++i) {
+            result[i] = nearest_vertex(points + i * index_t(dimension()));
+        }
+    }
+
+    void Delaunay::update_neighbors() {
+        if(nb_vertices() != neighbors_.nb_arrays()) {
+            neighbors_.init(
+                nb_vertices(),
+                default_nb_neighbors_
+            );
+            for(index_t i = 0; i < nb_vertices(); i++) {
+                neighbors_.resize_array(i, default_nb_neighbors_, false);
+            }
+        }
+        parallel_for(
+            0, nb_vertices(),
+            [this](index_t i) { store_neighbors_CB(i); },
+            1, true
+        );
+    }
+
+    void Delaunay::get_neighbors_internal(
+	index_t v, vector<index_t>& neighbors
+    ) const {
+        // Step 1: traverse the incident cells list, and insert
+        // all neighbors (may be duplicated)
+        neighbors.resize(0);
+        index_t vt = v_to_cell_[v];
+        if(vt != NO_INDEX) { // Happens when there are duplicated vertices.
+            index_t t = vt;
+            do {
+                index_t lvit = index(t, v);
+                // In the current cell, test all edges incident
+                // to current vertex 'it'
+                for(index_t lv = 0; lv < cell_size(); lv++) {
+                    if(lvit != lv) {
+                        index_t neigh = cell_vertex(t, lv);
+                        geo_debug_assert(neigh != NO_INDEX);
+                        neighbors.push_back(neigh);
+                    }
+                }
+                t = next_around_vertex(t, index(t, v));
+            } while(t != vt);
+        }
+
+        // Step 2: Sort the neighbors and remove all duplicates
+        sort_unique(neighbors);
+    }
+
+    void Delaunay::store_neighbors_CB(index_t i) {
+        // TODO: this one is not multithread-friendly
+        // since it does dynamic memory allocation
+        // (but not really a problem, since the one
+        // that is used is in Delaunay_ANN).
+        vector<index_t> neighbors;
+        get_neighbors_internal(i, neighbors);
+        neighbors_.set_array(i, neighbors);
+    }
+
+    void Delaunay::update_v_to_cell() {
+        geo_assert(!is_locked_);  // Not thread-safe
+        is_locked_ = true;
+
+        // Note: if keeps_infinite is set, then infinite vertex
+        // tet chaining is at t2v_[nb_vertices].
+
+        if(keeps_infinite()) {
+            v_to_cell_.assign(nb_vertices()+1, NO_INDEX);
+            for(index_t c = 0; c < nb_cells(); c++) {
+                for(index_t lv = 0; lv < cell_size(); lv++) {
+                    index_t v = cell_vertex(c, lv);
+                    if(v == NO_INDEX) {
+                        v = nb_vertices();
+                    }
+                    v_to_cell_[v] = c;
+                }
+            }
+        } else {
+            v_to_cell_.assign(nb_vertices(), NO_INDEX);
+            for(index_t c = 0; c < nb_cells(); c++) {
+                for(index_t lv = 0; lv < cell_size(); lv++) {
+                    v_to_cell_[cell_vertex(c, lv)] = c;
+                }
+            }
+        }
+        is_locked_ = false;
+    }
+
+    void Delaunay::update_cicl() {
+        geo_assert(!is_locked_);  // Not thread-safe
+        is_locked_ = true;
+        cicl_.resize(cell_size() * nb_cells());
+
+        for(index_t v = 0; v < nb_vertices(); ++v) {
+            index_t t = v_to_cell_[v];
+            if(t != NO_INDEX) {
+                index_t lv = index(t, v);
+                set_next_around_vertex(t, lv, t);
+            }
+        }
+
+        if(keeps_infinite()) {
+
+            {
+                // Process the infinite vertex at index nb_vertices().
+                index_t t = v_to_cell_[nb_vertices()];
+                if(t != NO_INDEX) {
+                    index_t lv = index(t, NO_INDEX);
+                    set_next_around_vertex(t, lv, t);
+                }
+            }
+
+            for(index_t t = 0; t < nb_cells(); ++t) {
+                for(index_t lv = 0; lv < cell_size(); ++lv) {
+                    index_t v = cell_vertex(t, lv);
+                    index_t vv = (v == NO_INDEX) ? nb_vertices() : v;
+                    if(v_to_cell_[vv] != t) {
+                        index_t t1 = v_to_cell_[vv];
+                        index_t lv1 = index(t1, v);
+                        index_t t2 = next_around_vertex(t1, lv1);
+                        set_next_around_vertex(t1, lv1, t);
+                        set_next_around_vertex(t, lv, t2);
+                    }
+                }
+            }
+
+
+        } else {
+            for(index_t t = 0; t < nb_cells(); ++t) {
+                for(index_t lv = 0; lv < cell_size(); ++lv) {
+                    index_t v = cell_vertex(t, lv);
+                    if(v_to_cell_[v] != t) {
+                        index_t t1 = v_to_cell_[v];
+                        index_t lv1 = index(t1, v);
+                        index_t t2 = next_around_vertex(t1, lv1);
+                        set_next_around_vertex(t1, lv1, t);
+                        set_next_around_vertex(t, lv, t2);
+                    }
+                }
+            }
+        }
+
+        is_locked_ = false;
+    }
+
+    void Delaunay::save_histogram(std::ostream& out) const {
+        vector<index_t> histogram;
+        for(index_t v = 0; v < nb_vertices(); v++) {
+            index_t N = neighbors_.array_size(v);
+            if(histogram.size() < N) {
+                histogram.resize(N + 1);
+            }
+            histogram[N]++;
+        }
+        for(index_t i = 0; i < histogram.size(); i++) {
+            out << i << " " << histogram[i] << std::endl;
+        }
+    }
+
+    bool Delaunay::cell_is_infinite(index_t c) const {
+        geo_debug_assert(c < nb_cells());
+        for(index_t lv=0; lv < cell_size(); ++lv) {
+            if(cell_vertex(c,lv) == NO_INDEX) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    index_t Delaunay::region(index_t t) const {
+        geo_argused(t);
+        geo_debug_assert(t < nb_cells());
+        return NO_INDEX;
+    }
+}
+
+/******* extracted from delaunay_2d.cpp *******/
+
+
+#include <stack>
+#include <algorithm>
+
+// TODO: optimizations:
+// - convex hull traversal for nearest_vertex()
+
+namespace {
+    using namespace GEO;
+
+    inline Sign orient_2d_inexact(
+	const double* p0, const double* p1, const double* p2
+    ) {
+        double a11 = p1[0] - p0[0] ;
+        double a12 = p1[1] - p0[1] ;
+
+        double a21 = p2[0] - p0[0] ;
+        double a22 = p2[1] - p0[1] ;
+
+        double Delta = det2x2(
+            a11,a12,
+            a21,a22
+        );
+
+        return geo_sgn(Delta);
+    }
+}
+
+namespace GEO {
+
+    // triangle edge vertex is such that the triangle
+    // formed with:
+    //  vertex lv
+    //  triangle_edge_vertex[lv][0]
+    //  triangle_edge_vertex[lv][1]
+    // has the same orientation as the original triangle for
+    // any vertex lv.
+
+    char Delaunay2d::triangle_edge_vertex_[3][2] = {
+        {1,2},
+        {2,0},
+        {0,1}
+    };
+
+    Delaunay2d::Delaunay2d(coord_index_t dimension) :
+        Delaunay(dimension),
+        hint_grid_is_valid_(false)
+    {
+        geo_cite_with_info(
+            "DBLP:journals/cj/Bowyer81",
+            "One of the two initial references to the algorithm, "
+            "discovered independently and simultaneously by Bowyer and Watson."
+        );
+        geo_cite_with_info(
+            "journals/cj/Watson81",
+            "One of the two initial references to the algorithm, "
+            "discovered independently and simultaneously by Bowyer and Watson."
+        );
+        geo_cite_with_info(
+            "DBLP:conf/compgeom/AmentaCR03",
+            "Using spatial sorting has a dramatic impact on the performances."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/comgeo/FunkeMN05",
+            "Initializing \\verb|locate()| with a non-exact version "
+            " (structural filtering) gains (a bit of) performance."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/comgeo/BoissonnatDPTY02",
+            "The idea of traversing the cavity from inside "
+            " used in GEOGRAM is inspired by the implementation of "
+            " \\verb|Delaunay_triangulation_3| in CGAL."
+        );
+        geo_cite_with_info(
+            "DBLP:conf/imr/Si06",
+            "The triangulation data structure used in GEOGRAM is inspired "
+            "by Tetgen."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/ijfcs/DevillersPT02",
+            "Analysis of the different versions of the line walk algorithm "
+            " used by \\verb|locate()|."
+        );
+
+        if(dimension != 2 && dimension != 3) {
+            throw InvalidDimension(dimension, "Delaunay2d", "2 or 3");
+        }
+        first_free_ = END_OF_LIST;
+        weighted_ = (dimension == 3);
+        // In weighted mode, vertices are 3d but combinatorics is 2d.
+        if(weighted_) {
+            cell_size_ = 3;
+            cell_v_stride_ = 3;
+            cell_neigh_stride_ = 3;
+        }
+        cur_stamp_ = 0;
+        debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay");
+        verbose_debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay_verbose");
+        debug_mode_ = (debug_mode_ || verbose_debug_mode_);
+        benchmark_mode_ = CmdLine::get_arg_bool("dbg:delaunay_benchmark");
+        has_empty_cells_ = false;
+        abort_if_empty_cell_ = false;
+    }
+
+    Delaunay2d::~Delaunay2d() {
+    }
+
+    void Delaunay2d::set_vertices(index_t nb_vertices, const double* vertices) {
+        has_empty_cells_ = false;
+	Stopwatch W("DelInternal", benchmark_mode_);
+
+        cur_stamp_ = 0;
+        if(weighted_) {
+            heights_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                // Client code uses 3d embedding with ti = sqrt(W - wi)
+                //   where W = max(wi)
+                // We recompute the standard "shifted" lifting on
+                // the paraboloid from it.
+                // (we use wi - W, everything is shifted by W, but
+                // we do not care since the power diagram is invariant
+                // by a translation of all weights).
+                double w = -geo_sqr(vertices[3 * i + 2]);
+                heights_[i] = -w +
+                    geo_sqr(vertices[3 * i]) +
+                    geo_sqr(vertices[3 * i + 1]);
+            }
+        }
+
+        Delaunay::set_vertices(nb_vertices, vertices);
+
+        index_t expected_triangles = nb_vertices * 2;
+
+        cell_to_v_store_.reserve(expected_triangles * 3);
+        cell_to_cell_store_.reserve(expected_triangles * 3);
+        cell_next_.reserve(expected_triangles);
+
+        cell_to_v_store_.resize(0);
+        cell_to_cell_store_.resize(0);
+        cell_next_.resize(0);
+        first_free_ = END_OF_LIST;
+
+        //   Sort the vertices spatially. This makes localisation
+        // faster.
+        if(do_reorder_) {
+            compute_BRIO_order(
+                nb_vertices, vertex_ptr(0), reorder_, 2, dimension_
+            );
+        } else {
+            reorder_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                reorder_[i] = i;
+            }
+        }
+
+        //   Without spatial sorting, the last created triangle can be far
+        // from the next vertex: the walk then starts from the triangle
+        // recorded in the hint grid near the vertex, which makes the
+        // insertion cost independent of the input order.
+        bool use_hint_grid = !do_reorder_;
+        hint_grid_is_valid_ = false;
+        if(use_hint_grid) {
+            hint_grid_.initialize(
+                nb_vertices, vertices_ptr(), 2, vertex_stride_
+            );
+        } else {
+            hint_grid_.clear();
+        }
+        auto triangle_has_vertex = [this](index_t t, index_t v) {
+            return !triangle_is_free(t) && (
+                triangle_vertex(t, 0) == v || triangle_vertex(t, 1) == v ||
+                triangle_vertex(t, 2) == v
+            );
+        };
+
+        double sorting_time = 0;
+        if(benchmark_mode_) {
+            sorting_time = W.elapsed_time();
+            Logger::out("DelInternal1") << "BRIO sorting:"
+                                        << sorting_time
+                                        << std::endl;
+        }
+
+        // The indices of the vertices of the first triangle.
+        index_t v0, v1, v2;
+        if(!create_first_triangle(v0, v1, v2)) {
+            Logger::warn("Delaunay2d") << "All the points are colinear"
+                                       << std::endl;
+            return;
+        }
+
+        index_t hint = NO_TRIANGLE;
+        // Insert all the vertices incrementally.
+        for(index_t i = 0; i < nb_vertices; ++i) {
+            index_t v = reorder_[i];
+            // Do not re-insert the first four vertices.
+            if(v != v0 && v != v1 && v != v2) {
+                index_t start = hint;
+                if(use_hint_grid) {
+                    index_t grid_hint = hint_grid_.find(
+                        vertex_ptr(v), 3, triangle_has_vertex
+                    );
+                    if(grid_hint != NO_TRIANGLE) {
+                        start = grid_hint;
+                    }
+                }
+                index_t new_hint = insert(v, start);
+                if(new_hint == NO_TRIANGLE) {
+                    has_empty_cells_ = true;
+                    if(abort_if_empty_cell_) {
+                        return;
+                    }
+                } else {
+                    hint = new_hint;
+                    if(use_hint_grid) {
+                        hint_grid_.set_hint(vertex_ptr(v), new_hint, v);
+                    }
+                }
+            }
+        }
+
+        if(benchmark_mode_) {
+            Logger::out("DelInternal2") << "Core insertion algo:"
+                                        << W.elapsed_time() - sorting_time
+                                        << std::endl;
+        }
+
+        if(debug_mode_) {
+            check_combinatorics(verbose_debug_mode_);
+            check_geometry(verbose_debug_mode_);
+        }
+
+        //   Compress cell_to_v_store_ and cell_to_cell_store_
+        // (remove free and virtual tetrahedra).
+        //   Since cell_next_ is not used at this point,
+        // we reuse it for storing the conversion array that
+        // maps old trgl indices to new trgl indices
+        // Note: trgl_is_real() uses the previous value of
+        // cell_next(), but we are processing indices
+        // in increasing order and since old2new[t] is always
+        // smaller or equal to t, we never overwrite a value
+        // before needing it.
+
+        vector<index_t>& old2new = cell_next_;
+        index_t nb_triangles = 0;
+        index_t nb_triangles_to_delete = 0;
+
+        {
+            for(index_t t = 0; t < max_t(); ++t) {
+                if(
+                    (keep_infinite_ && !triangle_is_free(t)) ||
+                    triangle_is_real(t)
+                ) {
+                    if(t != nb_triangles) {
+                        Memory::copy(
+                            &cell_to_v_store_[nb_triangles * 3],
+                            &cell_to_v_store_[t * 3],
+                            3 * sizeof(index_t)
+                        );
+                        Memory::copy(
+                            &cell_to_cell_store_[nb_triangles * 3],
+                            &cell_to_cell_store_[t * 3],
+                            3 * sizeof(index_t)
+                        );
+                    }
+                    old2new[t] = nb_triangles;
+                    ++nb_triangles;
+                } else {
+                    old2new[t] = NO_INDEX;
+                    ++nb_triangles_to_delete;
+                }
+            }
+            cell_to_v_store_.resize(3 * nb_triangles);
+            cell_to_cell_store_.resize(3 * nb_triangles);
+            for(index_t i = 0; i < 3 * nb_triangles; ++i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                // Note: t can be equal to -1 when a real trgl is
+                // adjacent to a virtual one (and this is how the
+                // rest of Vorpaline expects to see trgls on the
+                // border).
+                cell_to_cell_store_[i] = t;
+            }
+        }
+
+        // In "keep_infinite" mode, we reorder the cells in such
+        // a way that finite cells have indices [0..nb_finite_cells_-1]
+        // and infinite cells have indices [nb_finite_cells_ .. nb_cells_-1]
+
+        if(keep_infinite_) {
+            nb_finite_cells_ = 0;
+            index_t finite_ptr = 0;
+            index_t infinite_ptr = nb_triangles - 1;
+            for(;;) {
+                while(triangle_is_finite(finite_ptr)) {
+                    old2new[finite_ptr] = finite_ptr;
+                    ++finite_ptr;
+                    ++nb_finite_cells_;
+                }
+                while(!triangle_is_finite(infinite_ptr)) {
+                    old2new[infinite_ptr] = infinite_ptr;
+                    --infinite_ptr;
+                }
+                if(finite_ptr > infinite_ptr) {
+                    break;
+                }
+                old2new[finite_ptr] = infinite_ptr;
+                old2new[infinite_ptr] = finite_ptr;
+                ++nb_finite_cells_;
+                for(index_t lf=0; lf<3; ++lf) {
+                    std::swap(
+                        cell_to_cell_store_[3*finite_ptr + lf],
+                        cell_to_cell_store_[3*infinite_ptr + lf]
+                    );
+                }
+                for(index_t lv=0; lv<3; ++lv) {
+                    std::swap(
+                        cell_to_v_store_[3*finite_ptr + lv],
+                        cell_to_v_store_[3*infinite_ptr + lv]
+                    );
+                }
+                ++finite_ptr;
+                --infinite_ptr;
+            }
+            for(index_t i = 0; i < 3 * nb_triangles; ++i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                geo_debug_assert(t != NO_INDEX);
+                cell_to_cell_store_[i] = t;
+            }
+        }
+
+        if(benchmark_mode_) {
+            if(keep_infinite_) {
+                Logger::out("DelCompress")
+                    << "Removed " << nb_triangles_to_delete
+                    << " triangles (free list)" << std::endl;
+            } else {
+                Logger::out("DelCompress")
+                    << "Removed " << nb_triangles_to_delete
+                    << " triangles (free list and infinite)" << std::endl;
+            }
+        }
+
+        set_arrays(
+            nb_triangles,
+            cell_to_v_store_.data(), cell_to_cell_store_.data()
+        );
+
+        // Not mandatory, but doing so makes it possible to
+        // use locate() in derived classes outside of
+        // set_vertices().
+        cell_next_.assign(cell_next_.size(),NO_INDEX);
+    }
+
+    index_t Delaunay2d::nearest_vertex(const double* p) const {
+
+        // TODO: For the moment, we fallback to the (unefficient)
+        // baseclass implementation when in weighted mode.
+        if(weighted_) {
+            return Delaunay::nearest_vertex(p);
+        }
+
+        // Find a triangle (real or virtual) that contains p
+        index_t t = locate(p, locate_hint(p), thread_safe());
+
+        //   If p is outside the convex hull of the inserted points,
+        // a special traversal is required (not implemented yet).
+        // TODO: implement convex hull boundary traversal
+        // (for now we fallback to linear search implemented
+        //  in baseclass)
+        if(t == NO_TRIANGLE || triangle_is_virtual(t)) {
+            return Delaunay::nearest_vertex(p);
+        }
+
+        double sq_dist = 1e30;
+        index_t result = NO_TRIANGLE;
+
+        // Find the nearest vertex among t's vertices
+        for(index_t lv = 0; lv < 3; ++lv) {
+            index_t v = triangle_vertex(t, lv);
+            // If the triangle is virtual, then the first vertex
+            // is the vertex at infinity and is skipped.
+            if(v == NO_INDEX) {
+                continue;
+            }
+            double cur_sq_dist = Geom::distance2(p, vertex_ptr(v), 2);
+            if(cur_sq_dist < sq_dist) {
+                sq_dist = cur_sq_dist;
+                result = v;
+            }
+        }
+        return result;
+    }
+
+    index_t Delaunay2d::locate_hint(const double* p) const {
+        //   The hint grid of the insertion refers to triangles before
+        // compression, it is refilled from the final triangles on first use.
+        if(!hint_grid_is_valid_) {
+            static Process::spinlock lock = GEOGRAM_SPINLOCK_INIT;
+            Process::acquire_spinlock(lock);
+            if(!hint_grid_is_valid_) {
+                if(hint_grid_.is_initialized()) {
+                    hint_grid_.reset_hints();
+                } else {
+                    hint_grid_.initialize(
+                        nb_vertices(), vertices_ptr(), 2, vertex_stride_
+                    );
+                }
+                for(index_t t = 0; t < nb_cells(); ++t) {
+                    for(index_t lv = 0; lv < 3; ++lv) {
+                        index_t v = cell_vertex(t, lv);
+                        if(v != NO_INDEX) {
+                            hint_grid_.set_hint(vertex_ptr(v), t, v);
+                        }
+                    }
+                }
+                hint_grid_is_valid_ = true;
+            }
+            Process::release_spinlock(lock);
+        }
+        return hint_grid_.find(p, 2, [](index_t, index_t) { return true; });
+    }
+
+    index_t Delaunay2d::locate_inexact(
+        const double* p, index_t hint, index_t max_iter
+    ) const {
+
+        // If no hint specified, find a triangle randomly
+        while(hint == NO_TRIANGLE) {
+            hint = index_t(Numeric::random_int32()) % max_t();
+            if(triangle_is_free(hint)) {
+                hint = NO_TRIANGLE;
+            }
+        }
+
+        geo_debug_assert(!triangle_is_free(hint));
+        geo_debug_assert(!triangle_is_in_list(hint));
+
+        //  Always start from a real trgl. If the trgl is virtual,
+        // find its real neighbor (always opposite to the
+        // infinite vertex)
+        if(triangle_is_virtual(hint)) {
+            for(index_t lf = 0; lf < 3; ++lf) {
+                if(triangle_vertex(hint, lf) == VERTEX_AT_INFINITY) {
+                    hint = triangle_adjacent(hint, lf);
+                    geo_debug_assert(hint != NO_TRIANGLE);
+                    break;
+                }
+            }
+        }
+
+        index_t t = hint;
+        index_t t_pred = NO_TRIANGLE;
+
+    still_walking:
+        {
+            const double* pv[3];
+            pv[0] = vertex_ptr(finite_triangle_vertex(t,0));
+            pv[1] = vertex_ptr(finite_triangle_vertex(t,1));
+            pv[2] = vertex_ptr(finite_triangle_vertex(t,2));
+
+            for(index_t le = 0; le < 3; ++le) {
+
+                index_t t_next = triangle_adjacent(t,le);
+
+                //  If the opposite trgl is -1, then it means that
+                // we are trying to locate() (e.g. called from
+                // nearest_vertex) within a triangulation
+                // from which the infinite trgls were removed.
+                if(t_next == NO_INDEX) {
+                    return NO_TRIANGLE;
+                }
+
+                //   If the candidate next triangle is the
+                // one we came from, then we know already that
+                // the orientation is positive, thus we examine
+                // the next candidate (or exit the loop if they
+                // are exhausted).
+                if(t_next == t_pred) {
+                    continue ;
+                }
+
+                //   To test the orientation of p w.r.t. the facet f of
+                // t, we replace vertex number f with p in t (same
+                // convention as in CGAL).
+                const double* pv_bkp = pv[le];
+                pv[le] = p;
+                Sign ori = orient_2d_inexact(pv[0], pv[1], pv[2]);
+
+                //   If the orientation is not negative, then we cannot
+                // walk towards t_next, and examine the next candidate
+                // (or exit the loop if they are exhausted).
+                if(ori != NEGATIVE) {
+                    pv[le] = pv_bkp;
+                    continue;
+                }
+
+                //  If the opposite trgl is a virtual trgl, then
+                // the point has a positive orientation relative
+                // to the facet on the border of the convex hull,
+                // thus t_next is a trgl in conflict and we are
+                // done.
+                if(triangle_is_virtual(t_next)) {
+                    return t_next;
+                }
+
+                //   If we reach this point, then t_next is a valid
+                // successor, thus we are still walking.
+                t_pred = t;
+                t = t_next;
+                if(--max_iter != 0) {
+                    goto still_walking;
+                }
+            }
+        }
+
+        //   If we reach this point, we did not find a valid successor
+        // for walking (a face for which p has negative orientation),
+        // thus we reached the trgl for which p has all positive
+        // face orientations (i.e. the trgl that contains p).
+
+        return t;
+    }
+
+
+    index_t Delaunay2d::locate(
+        const double* p, index_t hint, bool thread_safe, Sign* orient
+    ) const {
+
+        //   Try improving the hint by using the
+        // inexact locate function. This gains
+        // (a little bit) performance (a few
+        // percent in total Delaunay computation
+        // time), but it is better than nothing...
+        //   Note: there is a maximum number of trgls
+        // traversed by locate_inexact()  (2500)
+        // since there exists configurations in which
+        // locate_inexact() loops forever !
+
+        hint = locate_inexact(p, hint, 2500);
+
+        static Process::spinlock lock = GEOGRAM_SPINLOCK_INIT;
+
+        // We need to have this spinlock because
+        // of random() that is not thread-safe
+        // (TODO: implement a random() function with
+        //  thread local storage)
+        if(thread_safe) {
+            Process::acquire_spinlock(lock);
+        }
+
+        // If no hint specified, find a triangle randomly
+        while(hint == NO_TRIANGLE) {
+            hint = index_t(Numeric::random_int32()) % max_t();
+            if(triangle_is_free(hint)) {
+                hint = NO_TRIANGLE;
+            }
+        }
+
+        geo_debug_assert(!triangle_is_free(hint));
+        geo_debug_assert(!triangle_is_in_list(hint));
+
+        //  Always start from a real trgl. If the trgl is virtual,
+        // find its real neighbor (always opposite to the
+        // infinite vertex)
+        if(triangle_is_virtual(hint)) {
+            for(index_t le = 0; le < 3; ++le) {
+                if(triangle_vertex(hint, le) == VERTEX_AT_INFINITY) {
+                    hint = triangle_adjacent(hint, le);
+                    geo_debug_assert(hint != NO_TRIANGLE);
+                    break;
+                }
+            }
+        }
+
+        geo_debug_assert(!triangle_is_free(hint));
+        geo_debug_assert(!triangle_is_in_list(hint));
+        geo_debug_assert(!triangle_is_virtual(hint));
+
+        index_t t = hint;
+        index_t t_pred = NO_TRIANGLE;
+        Sign orient_local[3];
+        if(orient == nullptr) {
+            orient = orient_local;
+        }
+
+
+    still_walking:
+        {
+            const double* pv[3];
+            pv[0] = vertex_ptr(finite_triangle_vertex(t,0));
+            pv[1] = vertex_ptr(finite_triangle_vertex(t,1));
+            pv[2] = vertex_ptr(finite_triangle_vertex(t,2));
+
+            // Start from a random facet
+            index_t e0 = index_t(Numeric::random_int32()) % 3;
+            for(index_t de = 0; de < 3; ++de) {
+                index_t le = (e0 + de) % 3;
+
+                index_t t_next = triangle_adjacent(t,le);
+
+                //  If the opposite triangle is -1, then it means that
+                // we are trying to locate() (e.g. called from
+                // nearest_vertex) within a triangulation
+                // from which the infinite trgls were removed.
+                if(t_next == NO_INDEX) {
+                    if(thread_safe) {
+                        Process::release_spinlock(lock);
+                    }
+                    return NO_TRIANGLE;
+                }
+
+                geo_debug_assert(!triangle_is_free(t_next));
+                geo_debug_assert(!triangle_is_in_list(t_next));
+
+                //   If the candidate next triangle is the
+                // one we came from, then we know already that
+                // the orientation is positive, thus we examine
+                // the next candidate (or exit the loop if they
+                // are exhausted).
+                if(t_next == t_pred) {
+                    orient[le] = POSITIVE ;
+                    continue ;
+                }
+
+                //   To test the orientation of p w.r.t. the facet f of
+                // t, we replace vertex number f with p in t (same
+                // convention as in CGAL).
+                // This is equivalent to trgl_facet_point_orient3d(t,f,p)
+                // (but less costly, saves a couple of lookups)
+                const double* pv_bkp = pv[le];
+                pv[le] = p;
+                orient[le] = PCK::orient_2d(pv[0], pv[1], pv[2]);
+
+                //   If the orientation is not negative, then we cannot
+                // walk towards t_next, and examine the next candidate
+                // (or exit the loop if they are exhausted).
+                if(orient[le] != NEGATIVE) {
+                    pv[le] = pv_bkp;
+                    continue;
+                }
+
+                //  If the opposite trgl is a virtual trgl, then
+                // the point has a positive orientation relative
+                // to the facet on the border of the convex hull,
+                // thus t_next is a trgl in conflict and we are
+                // done.
+                if(triangle_is_virtual(t_next)) {
+                    if(thread_safe) {
+                        Process::release_spinlock(lock);
+                    }
+                    for(index_t tle = 0; tle < 3; ++tle) {
+                        orient[tle] = POSITIVE;
+                    }
+                    return t_next;
+                }
+
+                //   If we reach this point, then t_next is a valid
+                // successor, thus we are still walking.
+                t_pred = t;
+                t = t_next;
+                goto still_walking;
+            }
+        }
+
+        //   If we reach this point, we did not find a valid successor
+        // for walking (a face for which p has negative orientation),
+        // thus we reached the trgl for which p has all positive
+        // face orientations (i.e. the trgl that contains p).
+
+        if(thread_safe) {
+            Process::release_spinlock(lock);
+        }
+        return t;
+    }
+
+    void Delaunay2d::find_conflict_zone(
+        index_t v,
+        index_t t, const Sign* orient,
+        index_t& t_bndry, index_t& e_bndry,
+        index_t& first, index_t& last
+    ) {
+        first = last = END_OF_LIST;
+
+        //  Generate a unique stamp from current vertex index,
+        // used for marking triangles
+        set_triangle_mark_stamp(v);
+
+        // Pointer to the coordinates of the point to be inserted
+        const double* p = vertex_ptr(v);
+
+        geo_debug_assert(t != NO_TRIANGLE);
+
+        // Test whether the point already exists in
+        // the triangulation. The point already exists
+        // if it's located on three faces of the
+        // triangle returned by locate().
+        int nb_zero =
+            (orient[0] == ZERO) +
+            (orient[1] == ZERO) +
+            (orient[2] == ZERO) ;
+
+        if(nb_zero >= 2) {
+            return;
+        }
+
+        //  Weighted triangulations can have dangling
+        // vertices. Such vertices p are characterized by
+        // the fact that p is not in conflict with the
+        // triangle returned by locate().
+        if(weighted_ && !triangle_is_conflict(t, p)) {
+            return;
+        }
+
+        // Note: points on edges and on facets are
+        // handled by the way triangle_is_in_conflict()
+        // is implemented, that naturally inserts
+        // the correct triangles in the conflict list.
+
+
+        // Mark t as conflict
+        add_triangle_to_list(t, first, last);
+
+        // A small optimization: if the point to be inserted
+        // is on some faces of the located triangle, insert
+        // the neighbors accros those edges in the conflict list.
+        // It saves a couple of calls to the predicates in this
+        // specific case (combinatorics are in general less
+        // expensive than the predicates).
+        if(!weighted_ && nb_zero != 0) {
+            for(index_t le = 0; le < 3; ++le) {
+                if(orient[le] == ZERO) {
+                    index_t t2 = triangle_adjacent(t, le);
+                    add_triangle_to_list(t2, first, last);
+                }
+            }
+            for(index_t le = 0; le < 3; ++le) {
+                if(orient[le] == ZERO) {
+                    index_t t2 = triangle_adjacent(t, le);
+                    find_conflict_zone_iterative(
+                        p,t2,t_bndry,e_bndry,first,last
+                    );
+                }
+            }
+        }
+
+        // Determine the conflict list by greedy propagation from t.
+        find_conflict_zone_iterative(p,t,t_bndry,e_bndry,first,last);
+    }
+
+    void Delaunay2d::find_conflict_zone_iterative(
+        const double* p, index_t t_in,
+        index_t& t_bndry, index_t& e_bndry,
+        index_t& first, index_t& last
+    ) {
+
+        S_.push(t_in);
+
+        while(!S_.empty()) {
+
+            index_t t = S_.top();
+            S_.pop();
+
+            for(index_t le = 0; le < 3; ++le) {
+                index_t t2 = triangle_adjacent(t, le);
+
+                if(
+                    triangle_is_in_list(t2) || // known as conflict
+                    triangle_is_marked(t2)     // known as non-conflict
+                ) {
+                    continue;
+                }
+
+                if(triangle_is_conflict(t2, p)) {
+                    // Chain t2 in conflict list
+                    add_triangle_to_list(t2, first, last);
+                    S_.push(t2);
+                    continue;
+                }
+
+                //   At this point, t is in conflict
+                // and t2 is not in conflict.
+                // We keep a reference to a trgl on the boundary
+                t_bndry = t;
+                e_bndry = le;
+                // Mark t2 as visited (but not conflict)
+                mark_triangle(t2);
+            }
+        }
+    }
+
+    index_t Delaunay2d::stellate_conflict_zone(
+        index_t v_in, index_t t1, index_t t1ebord
+    ) {
+
+        index_t t = t1;
+        index_t e = t1ebord;
+        index_t t_adj = triangle_adjacent(t,e);
+
+        geo_debug_assert(t_adj != NO_INDEX);
+
+        geo_debug_assert(triangle_is_in_list(t));
+        geo_debug_assert(!triangle_is_in_list(t_adj));
+
+
+        index_t new_t_first = NO_INDEX;
+        index_t new_t_prev  = NO_INDEX;
+
+        do {
+
+            index_t v1 = triangle_vertex(t, (e+1)%3);
+            index_t v2 = triangle_vertex(t, (e+2)%3);
+
+            // Create new triangle
+            index_t new_t = new_triangle(v_in, v1, v2);
+
+            //   Connect new triangle to triangle on the other
+            // side of the conflict zone.
+            set_triangle_adjacent(new_t, 0, t_adj);
+            index_t adj_e = find_triangle_adjacent(t_adj, t);
+            set_triangle_adjacent(t_adj, adj_e, new_t);
+
+
+            // Move to next triangle
+            e = (e + 1)%3;
+            t_adj = triangle_adjacent(t,e);
+            while(triangle_is_in_list(t_adj)) {
+                t = t_adj;
+                e = (find_triangle_vertex(t,v2) + 2)%3;
+                t_adj = triangle_adjacent(t,e);
+                geo_debug_assert(t_adj != NO_INDEX);
+            }
+
+            if(new_t_prev == NO_INDEX) {
+                new_t_first = new_t;
+            } else {
+                set_triangle_adjacent(new_t_prev, 1, new_t);
+                set_triangle_adjacent(new_t, 2, new_t_prev);
+            }
+
+            new_t_prev = new_t;
+
+        } while((t != t1) || (e != t1ebord));
+
+        // Connect last triangle to first triangle
+        set_triangle_adjacent(new_t_prev, 1, new_t_first);
+        set_triangle_adjacent(new_t_first, 2, new_t_prev);
+
+        return new_t_prev;
+    }
+
+    index_t Delaunay2d::insert(index_t v, index_t hint) {
+        index_t t_bndry = NO_TRIANGLE;
+        index_t e_bndry = NO_INDEX;
+        index_t first_conflict = NO_TRIANGLE;
+        index_t last_conflict  = NO_TRIANGLE;
+
+        const double* p = vertex_ptr(v);
+
+        Sign orient[3];
+        index_t t = locate(p, hint, false, orient);
+        find_conflict_zone(
+            v,t,orient,t_bndry,e_bndry,first_conflict,last_conflict
+        );
+
+        // The conflict list can be empty if:
+        //  - Vertex v already exists in the triangulation
+        //  - The triangulation is weighted and v is not visible
+        if(first_conflict == END_OF_LIST) {
+            return NO_TRIANGLE;
+        }
+
+        index_t new_triangle = stellate_conflict_zone(v,t_bndry,e_bndry);
+
+        // Recycle the triangles of the conflict zone.
+        cell_next_[last_conflict] = first_free_;
+        first_free_ = first_conflict;
+
+        // Return one of the newly created triangles
+        return new_triangle;
+    }
+
+    bool Delaunay2d::create_first_triangle(
+        index_t& iv0, index_t& iv1, index_t& iv2
+    ) {
+        if(nb_vertices() < 3) {
+            return false;
+        }
+
+        iv0 = 0;
+
+        iv1 = 1;
+        while(
+            iv1 < nb_vertices() &&
+            PCK::points_are_identical_2d(
+                vertex_ptr(iv0), vertex_ptr(iv1)
+            )
+        ) {
+            ++iv1;
+        }
+        if(iv1 == nb_vertices()) {
+            return false;
+        }
+
+        iv2 = iv1 + 1;
+        Sign s = ZERO;
+        while(
+            iv2 < nb_vertices() &&
+            (s = PCK::orient_2d(
+		vertex_ptr(iv0), vertex_ptr(iv1), vertex_ptr(iv2)
+	    )) == ZERO
+        ) {
+            ++iv2;
+        }
+        if(iv2 == nb_vertices()) {
+            return false;
+        }
+        if(s == NEGATIVE) {
+            std::swap(iv1,iv2);
+        }
+
+        // Create the first triangle
+        index_t t0 = new_triangle(iv0, iv1, iv2);
+
+        // Create the first three virtual triangles surrounding it
+        index_t t[3];
+        for(index_t e = 0; e < 3; ++e) {
+            // In reverse order since it is an adjacent triangle
+            index_t v1 = triangle_vertex(t0, triangle_edge_vertex(e,1));
+            index_t v2 = triangle_vertex(t0, triangle_edge_vertex(e,0));
+            t[e] = new_triangle(VERTEX_AT_INFINITY, v1, v2);
+        }
+
+        // Connect the virtual triangles to the real one
+        for(index_t e=0; e<3; ++e) {
+            set_triangle_adjacent(t[e], 0, t0);
+            set_triangle_adjacent(t0, e, t[e]);
+        }
+
+        // Interconnect the three virtual triangles along their common
+        // edges
+        for(index_t e = 0; e < 3; ++e) {
+            // In reverse order since it is an adjacent triangle
+            index_t lv1 = triangle_edge_vertex(e,1);
+            index_t lv2 = triangle_edge_vertex(e,0);
+            set_triangle_adjacent(t[e], 1, t[lv1]);
+            set_triangle_adjacent(t[e], 2, t[lv2]);
+        }
+
+        return true;
+    }
+
+    
+
+    void Delaunay2d::show_triangle(index_t t) const {
+        std::cerr << "tri"
+                  << (triangle_is_in_list(t) ? '*' : ' ')
+                  << t
+                  << ", v=["
+                  << triangle_vertex(t, 0)
+                  << ' '
+                  << triangle_vertex(t, 1)
+                  << ' '
+                  << triangle_vertex(t, 2)
+                  << "]  adj=[";
+        show_triangle_adjacent(t, 0);
+        show_triangle_adjacent(t, 1);
+        show_triangle_adjacent(t, 2);
+        std::cerr << "] ";
+
+        for(index_t e = 0; e < 3; ++e) {
+            std::cerr << 'e' << e << ':';
+            for(index_t v = 0; v < 2; ++v) {
+                std::cerr << triangle_vertex(t, triangle_edge_vertex(e,v))
+                          << ',';
+            }
+            std::cerr << ' ';
+        }
+        std::cerr << std::endl;
+    }
+
+    void Delaunay2d::show_triangle_adjacent(index_t t, index_t le) const {
+        index_t adj = triangle_adjacent(t, le);
+        if(adj != NO_INDEX) {
+            std::cerr << (triangle_is_in_list(adj) ? '*' : ' ');
+        }
+        std::cerr << adj;
+        std::cerr << ' ';
+    }
+
+    void Delaunay2d::show_list(
+	index_t first, const std::string& list_name
+    ) const {
+        index_t t = first;
+        std::cerr << "tri list: " << list_name << std::endl;
+        while(t != END_OF_LIST) {
+            show_triangle(t);
+            t = triangle_next(t);
+        }
+        std::cerr << "-------------" << std::endl;
+    }
+
+    void Delaunay2d::check_combinatorics(bool verbose) const {
+        if(verbose) {
+            std::cerr << std::endl;
+        }
+        bool ok = true;
+        std::vector<bool> v_has_triangle(nb_vertices(), false);
+        for(index_t t = 0; t < max_t(); ++t) {
+            if(triangle_is_free(t)) {
+/*
+  if(verbose) {
+  std::cerr << "-Deleted tri: ";
+  show_tri(t);
+  }
+*/
+            } else {
+/*
+  if(verbose) {
+  std::cerr << "Checking tri: ";
+  show_tri(t);
+  }
+*/
+                for(index_t le = 0; le < 3; ++le) {
+                    if(triangle_adjacent(t, le) == NO_INDEX) {
+                        std::cerr << le << ":Missing adjacent tri"
+                                  << std::endl;
+                        ok = false;
+                    } else if(triangle_adjacent(t, le) == t) {
+                        std::cerr << le << ":Tri is adjacent to itself"
+                                  << std::endl;
+                        ok = false;
+                    } else {
+                        index_t t2 = triangle_adjacent(t, le);
+                        bool found = false;
+                        for(index_t le2 = 0; le2 < 3; ++le2) {
+                            if(triangle_adjacent(t2, le2) == t) {
+                                found = true;
+                            }
+                        }
+                        if(!found) {
+                            std::cerr
+                                << le << ":Adjacent link is not bidirectional"
+                                << std::endl;
+                            ok = false;
+                        }
+                    }
+                }
+                index_t nb_infinite = 0;
+                for(index_t lv = 0; lv < 3; ++lv) {
+                    if(triangle_vertex(t, lv) == NO_INDEX) {
+                        ++nb_infinite;
+                    }
+                }
+                if(nb_infinite > 1) {
+                    ok = false;
+                    std::cerr << "More than one infinite vertex"
+                              << std::endl;
+                }
+            }
+            for(index_t lv = 0; lv < 3; ++lv) {
+                index_t v = triangle_vertex(t, lv);
+                if(v != NO_INDEX) {
+                    v_has_triangle[v] = true;
+                }
+            }
+        }
+        for(index_t v = 0; v < nb_vertices(); ++v) {
+            if(!v_has_triangle[v]) {
+                if(verbose) {
+                    std::cerr << "Vertex " << v
+                              << " is isolated (duplicated ?)" << std::endl;
+                }
+            }
+        }
+        geo_assert(ok);
+        if(verbose) {
+            std::cerr << std::endl;
+        }
+        std::cerr << std::endl << "Delaunay Combi OK" << std::endl;
+    }
+
+    void Delaunay2d::check_geometry(bool verbose) const {
+        bool ok = true;
+        for(index_t t = 0; t < max_t(); ++t) {
+            if(!triangle_is_free(t)) {
+                index_t v0 = triangle_vertex(t, 0);
+                index_t v1 = triangle_vertex(t, 1);
+                index_t v2 = triangle_vertex(t, 2);
+                for(index_t v = 0; v < nb_vertices(); ++v) {
+                    if(v == v0 || v == v1 || v == v2) {
+                        continue;
+                    }
+                    if(triangle_is_conflict(t, vertex_ptr(v))) {
+                        ok = false;
+                        if(verbose) {
+                            std::cerr << "Tri " << t <<
+                                " is in conflict with vertex " << v
+                                      << std::endl;
+
+                            std::cerr << "  offending tri: ";
+                            show_triangle(t);
+                        }
+                    }
+                }
+            }
+        }
+        geo_assert(ok);
+        std::cerr << std::endl << "Delaunay Geo OK" << std::endl;
+    }
+
+    
+
+    RegularWeightedDelaunay2d::RegularWeightedDelaunay2d(
+        coord_index_t dimension
+    ) :
+        Delaunay2d(3)
+    {
+        if(dimension != 3) {
+            throw InvalidDimension(dimension, "RegularWeightedDelaunay2d", "3");
+        }
+    }
+
+    RegularWeightedDelaunay2d::~RegularWeightedDelaunay2d() {
+    }
+}
+
+/******* extracted from delaunay_3d.cpp *******/
+
+#include <stack>
+
+// TODO: optimizations:
+// - convex hull traversal for nearest_vertex()
+
+namespace GEO {
+
+    char Delaunay3d::halfedge_facet_[4][4] = {
+        {4, 2, 3, 1},
+        {3, 4, 0, 2},
+        {1, 3, 4, 0},
+        {2, 0, 1, 4}
+    };
+
+    // tet facet vertex is such that the tetrahedron
+    // formed with:
+    //  vertex lv
+    //  tet_facet_vertex[lv][0]
+    //  tet_facet_vertex[lv][1]
+    //  tet_facet_vertex[lv][2]
+    // has the same orientation as the original tetrahedron for
+    // any vertex lv.
+
+    char Delaunay3d::tet_facet_vertex_[4][3] = {
+        {1, 2, 3},
+        {0, 3, 2},
+        {3, 0, 1},
+        {1, 0, 2}
+    };
+
+    Delaunay3d::Delaunay3d(coord_index_t dimension) :
+        Delaunay(dimension),
+        hint_grid_is_valid_(false)
+    {
+        geo_cite_with_info(
+            "DBLP:journals/cj/Bowyer81",
+            "One of the two initial references to the algorithm, "
+            "discovered independently and simultaneously by Bowyer and Watson."
+        );
+        geo_cite_with_info(
+            "journals/cj/Watson81",
+            "One of the two initial references to the algorithm, "
+            "discovered independently and simultaneously by Bowyer and Watson."
+        );
+        geo_cite_with_info(
+            "DBLP:conf/compgeom/AmentaCR03",
+            "Using spatial sorting has a dramatic impact on the performances."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/comgeo/FunkeMN05",
+            "Initializing \\verb|locate()| with a non-exact version "
+            " (structural filtering) gains (a bit of) performance."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/comgeo/BoissonnatDPTY02",
+            "The idea of traversing the cavity from inside "
+            " used in GEOGRAM is inspired by the implementation of "
+            " \\verb|Delaunay_triangulation_3| in CGAL."
+        );
+        geo_cite_with_info(
+            "DBLP:conf/imr/Si06",
+            "The triangulation data structure used in GEOGRAM is inspired "
+            "by Tetgen."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/ijfcs/DevillersPT02",
+            "Analysis of the different versions of the line walk algorithm "
+            " used by \\verb|locate()|."
+        );
+
+        if(dimension != 3 && dimension != 4) {
+            throw InvalidDimension(dimension, "Delaunay3d", "3 or 4");
+        }
+        first_free_ = END_OF_LIST;
+        weighted_ = (dimension == 4);
+        // In weighted mode, vertices are 4d but combinatorics is 3d.
+        if(weighted_) {
+            cell_size_ = 4;
+            cell_v_stride_ = 4;
+            cell_neigh_stride_ = 4;
+        }
+        cur_stamp_ = 0;
+        debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay");
+        verbose_debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay_verbose");
+        debug_mode_ = (debug_mode_ || verbose_debug_mode_);
+        benchmark_mode_ = CmdLine::get_arg_bool("dbg:delaunay_benchmark");
+    }
+
+    Delaunay3d::~Delaunay3d() {
+    }
+
+    void Delaunay3d::set_vertices(index_t nb_vertices, const double* vertices) {
+        Stopwatch* W = nullptr;
+        if(benchmark_mode_) {
+            W = new Stopwatch("DelInternal");
+        }
+        cur_stamp_ = 0;
+        if(weighted_) {
+            heights_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                // Client code uses 4d embedding with ti = sqrt(W - wi)
+                //   where W = max(wi)
+                // We recompute the standard "shifted" lifting on
+                // the paraboloid from it.
+                // (we use wi - W, everything is shifted by W, but
+                // we do not care since the power diagram is invariant
+                // by a translation of all weights).
+                double w = -geo_sqr(vertices[4 * i + 3]);
+                heights_[i] = -w +
+                    geo_sqr(vertices[4 * i]) +
+                    geo_sqr(vertices[4 * i + 1]) +
+                    geo_sqr(vertices[4 * i + 2]);
+            }
+        }
+
+        Delaunay::set_vertices(nb_vertices, vertices);
+
+        index_t expected_tetra = nb_vertices * 7;
+
+        cell_to_v_store_.reserve(expected_tetra * 4);
+        cell_to_cell_store_.reserve(expected_tetra * 4);
+        cell_next_.reserve(expected_tetra);
+
+        cell_to_v_store_.resize(0);
+        cell_to_cell_store_.resize(0);
+        cell_next_.resize(0);
+        first_free_ = END_OF_LIST;
+
+        //   Sort the vertices spatially. This makes localisation
+        // faster.
+        if(do_reorder_) {
+            compute_BRIO_order(
+                nb_vertices, vertex_ptr(0), reorder_, 3, dimension_
+            );
+        } else {
+            reorder_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                reorder_[i] = i;
+            }
+        }
+
+        //   Without spatial sorting, the last created tet can be far
+        // from the next vertex: the walk then starts from the tet
+        // recorded in the hint grid near the vertex, which makes the
+        // insertion cost independent of the input order.
+        bool use_hint_grid = !do_reorder_;
+        hint_grid_is_valid_ = false;
+        if(use_hint_grid) {
+            hint_grid_.initialize(
+                nb_vertices, vertices_ptr(), 3, vertex_stride_
+            );
+        } else {
+            hint_grid_.clear();
+        }
+        auto tet_has_vertex = [this](index_t t, index_t v) {
+            return !tet_is_free(t) && (
+                tet_vertex(t, 0) == v || tet_vertex(t, 1) == v ||
+                tet_vertex(t, 2) == v || tet_vertex(t, 3) == v
+            );
+        };
+
+        double sorting_time = 0;
+        if(benchmark_mode_) {
+            sorting_time = W->elapsed_time();
+            Logger::out("DelInternal1") << "BRIO sorting:"
+                                        << sorting_time
+                                        << std::endl;
+        }
+
+        // The indices of the vertices of the first tetrahedron.
+        index_t v0, v1, v2, v3;
+        if(!create_first_tetrahedron(v0, v1, v2, v3)) {
+            Logger::warn("Delaunay3d") << "All the points are coplanar"
+                                       << std::endl;
+            return;
+        }
+
+        index_t hint = NO_TETRAHEDRON;
+        // Insert all the vertices incrementally.
+        for(index_t i = 0; i < nb_vertices; ++i) {
+            index_t v = reorder_[i];
+            // Do not re-insert the first four vertices.
+            if(v != v0 && v != v1 && v != v2 && v != v3) {
+                index_t start = hint;
+                if(use_hint_grid) {
+                    index_t grid_hint = hint_grid_.find(
+                        vertex_ptr(v), 3, tet_has_vertex
+                    );
+                    if(grid_hint != NO_TETRAHEDRON) {
+                        start = grid_hint;
+                    }
+                }
+                index_t new_hint = insert(v, start);
+                if(new_hint != NO_TETRAHEDRON) {
+                    hint = new_hint;
+                    if(use_hint_grid) {
+                        hint_grid_.set_hint(vertex_ptr(v), new_hint, v);
+                    }
+                }
+            }
+        }
+
+        if(benchmark_mode_) {
+            Logger::out("DelInternal2") << "Core insertion algo:"
+                                        << W->elapsed_time() - sorting_time
+                                        << std::endl;
+        }
+        delete W;
+
+        if(debug_mode_) {
+            check_combinatorics(verbose_debug_mode_);
+            check_geometry(verbose_debug_mode_);
+        }
+
+        //   Compress cell_to_v_store_ and cell_to_cell_store_
+        // (remove free and virtual tetrahedra).
+        //   Since cell_next_ is not used at this point,
+        // we reuse it for storing the conversion array that
+        // maps old tet indices to new tet indices
+        // Note: tet_is_real() uses the previous value of
+        // cell_next(), but we are processing indices
+        // in increasing order and since old2new[t] is always
+        // smaller or equal to t, we never overwrite a value
+        // before needing it.
+
+        vector<index_t>& old2new = cell_next_;
+        index_t nb_tets = 0;
+        index_t nb_tets_to_delete = 0;
+
+        {
+            for(index_t t = 0; t < max_t(); ++t) {
+                if(
+                    (keep_infinite_ && !tet_is_free(t)) ||
+                    tet_is_real(t)
+                ) {
+                    if(t != nb_tets) {
+                        Memory::copy(
+                            &cell_to_v_store_[nb_tets * 4],
+                            &cell_to_v_store_[t * 4],
+                            4 * sizeof(index_t)
+                        );
+                        Memory::copy(
+                            &cell_to_cell_store_[nb_tets * 4],
+                            &cell_to_cell_store_[t * 4],
+                            4 * sizeof(index_t)
+                        );
+                    }
+                    old2new[t] = nb_tets;
+                    ++nb_tets;
+                } else {
+                    old2new[t] = NO_INDEX;
+                    ++nb_tets_to_delete;
+                }
+            }
+            cell_to_v_store_.resize(4 * nb_tets);
+            cell_to_cell_store_.resize(4 * nb_tets);
+            for(index_t i = 0; i < 4 * nb_tets; ++i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                // Note: t can be equal to -1 when a real tet is
+                // adjacent to a virtual one (and this is how the
+                // rest of Vorpaline expects to see tets on the
+                // border).
+                cell_to_cell_store_[i] = t;
+            }
+        }
+
+        // In "keep_infinite" mode, we reorder the cells in such
+        // a way that finite cells have indices [0..nb_finite_cells_-1]
+        // and infinite cells have indices [nb_finite_cells_ .. nb_cells_-1]
+
+        if(keep_infinite_) {
+            nb_finite_cells_ = 0;
+            index_t finite_ptr = 0;
+            index_t infinite_ptr = nb_tets - 1;
+            for(;;) {
+                while(tet_is_finite(finite_ptr)) {
+                    old2new[finite_ptr] = finite_ptr;
+                    ++finite_ptr;
+                    ++nb_finite_cells_;
+                }
+                while(!tet_is_finite(infinite_ptr)) {
+                    old2new[infinite_ptr] = infinite_ptr;
+                    --infinite_ptr;
+                }
+                if(finite_ptr > infinite_ptr) {
+                    break;
+                }
+                old2new[finite_ptr] = infinite_ptr;
+                old2new[infinite_ptr] = finite_ptr;
+                ++nb_finite_cells_;
+                for(index_t lf=0; lf<4; ++lf) {
+                    std::swap(
+                        cell_to_cell_store_[4*finite_ptr + lf],
+                        cell_to_cell_store_[4*infinite_ptr + lf]
+                    );
+                }
+                for(index_t lv=0; lv<4; ++lv) {
+                    std::swap(
+                        cell_to_v_store_[4*finite_ptr + lv],
+                        cell_to_v_store_[4*infinite_ptr + lv]
+                    );
+                }
+                ++finite_ptr;
+                --infinite_ptr;
+            }
+            for(index_t i = 0; i < 4 * nb_tets; ++i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                geo_debug_assert(t != NO_INDEX);
+                cell_to_cell_store_[i] = t;
+            }
+        }
+
+        if(benchmark_mode_) {
+            if(keep_infinite_) {
+                Logger::out("DelCompress")
+                    << "Removed " << nb_tets_to_delete
+                    << " tets (free list)" << std::endl;
+            } else {
+                Logger::out("DelCompress")
+                    << "Removed " << nb_tets_to_delete
+                    << " tets (free list and infinite)" << std::endl;
+            }
+        }
+
+        set_arrays(
+            nb_tets,
+            cell_to_v_store_.data(), cell_to_cell_store_.data()
+        );
+    }
+
+    index_t Delaunay3d::nearest_vertex(const double* p) const {
+
+        // TODO: For the moment, we fallback to the (unefficient)
+        // baseclass implementation when in weighted mode.
+        if(weighted_) {
+            return Delaunay::nearest_vertex(p);
+        }
+
+        // Find a tetrahedron (real or virtual) that contains p
+        index_t t = locate(p, locate_hint(p), thread_safe());
+
+        //   If p is outside the convex hull of the inserted points,
+        // a special traversal is required (not implemented yet).
+        // TODO: implement convex hull boundary traversal
+        // (for now we fallback to linear search implemented
+        //  in baseclass)
+        if(t == NO_TETRAHEDRON || tet_is_virtual(t)) {
+            return Delaunay::nearest_vertex(p);
+        }
+
+        double sq_dist = 1e30;
+        index_t result = NO_TETRAHEDRON;
+
+        // Find the nearest vertex among t's vertices
+        for(index_t lv = 0; lv < 4; ++lv) {
+            index_t v = tet_vertex(t, lv);
+            // If the tetrahedron is virtual, then the first vertex
+            // is the vertex at infinity and is skipped.
+            if(v == NO_INDEX) {
+                continue;
+            }
+            double cur_sq_dist = Geom::distance2(p, vertex_ptr(v), 3);
+            if(cur_sq_dist < sq_dist) {
+                sq_dist = cur_sq_dist;
+                result = v;
+            }
+        }
+        return result;
+    }
+
+
+
+    index_t Delaunay3d::locate_hint(const double* p) const {
+        //   The hint grid of the insertion refers to tets before
+        // compression, it is refilled from the final tets on first use.
+        if(!hint_grid_is_valid_) {
+            static Process::spinlock lock = GEOGRAM_SPINLOCK_INIT;
+            Process::acquire_spinlock(lock);
+            if(!hint_grid_is_valid_) {
+                if(hint_grid_.is_initialized()) {
+                    hint_grid_.reset_hints();
+                } else {
+                    hint_grid_.initialize(
+                        nb_vertices(), vertices_ptr(), 3, vertex_stride_
+                    );
+                }
+                for(index_t t = 0; t < nb_cells(); ++t) {
+                    for(index_t lv = 0; lv < 4; ++lv) {
+                        index_t v = cell_vertex(t, lv);
+                        if(v != NO_INDEX) {
+                            hint_grid_.set_hint(vertex_ptr(v), t, v);
+                        }
+                    }
+                }
+                hint_grid_is_valid_ = true;
+            }
+            Process::release_spinlock(lock);
+        }
+        return hint_grid_.find(p, 2, [](index_t, index_t) { return true; });
+    }
+
+    index_t Delaunay3d::locate_inexact(
+        const double* p, index_t hint, index_t max_iter
+    ) const {
+
+        // If no hint specified, find a tetrahedron randomly
+        while(hint == NO_TETRAHEDRON) {
+            hint = index_t(Numeric::random_int32()) % max_t();
+            if(tet_is_free(hint)) {
+                hint = NO_TETRAHEDRON;
+            }
+        }
+
+        //  Always start from a real tet. If the tet is virtual,
+        // find its real neighbor (always opposite to the
+        // infinite vertex)
+        if(tet_is_virtual(hint)) {
+            for(index_t lf = 0; lf < 4; ++lf) {
+                if(tet_vertex(hint, lf) == VERTEX_AT_INFINITY) {
+                    hint = tet_adjacent(hint, lf);
+                    geo_debug_assert(hint != NO_TETRAHEDRON);
+                    break;
+                }
+            }
+        }
+
+        index_t t = hint;
+        index_t t_pred = NO_TETRAHEDRON;
+
+    still_walking:
+        {
+            const double* pv[4];
+            pv[0] = vertex_ptr(finite_tet_vertex(t,0));
+            pv[1] = vertex_ptr(finite_tet_vertex(t,1));
+            pv[2] = vertex_ptr(finite_tet_vertex(t,2));
+            pv[3] = vertex_ptr(finite_tet_vertex(t,3));
+
+            for(index_t f = 0; f < 4; ++f) {
+
+                index_t t_next = tet_adjacent(t,f);
+
+                //  If the opposite tet is -1, then it means that
+                // we are trying to locate() (e.g. called from
+                // nearest_vertex) within a tetrahedralization
+                // from which the infinite tets were removed.
+                if(t_next == NO_INDEX) {
+                    return NO_TETRAHEDRON;
+                }
+
+                //   If the candidate next tetrahedron is the
+                // one we came from, then we know already that
+                // the orientation is positive, thus we examine
+                // the next candidate (or exit the loop if they
+                // are exhausted).
+                if(t_next == t_pred) {
+                    continue ;
+                }
+
+                //   To test the orientation of p w.r.t. the facet f of
+                // t, we replace vertex number f with p in t (same
+                // convention as in CGAL).
+                const double* pv_bkp = pv[f];
+                pv[f] = p;
+                Sign ori = PCK::orient_3d_inexact(pv[0], pv[1], pv[2], pv[3]);
+
+                //   If the orientation is not negative, then we cannot
+                // walk towards t_next, and examine the next candidate
+                // (or exit the loop if they are exhausted).
+                if(ori != NEGATIVE) {
+                    pv[f] = pv_bkp;
+                    continue;
+                }
+
+                //  If the opposite tet is a virtual tet, then
+                // the point has a positive orientation relative
+                // to the facet on the border of the convex hull,
+                // thus t_next is a tet in conflict and we are
+                // done.
+                if(tet_is_virtual(t_next)) {
+                    return t_next;
+                }
+
+                //   If we reach this point, then t_next is a valid
+                // successor, thus we are still walking.
+                t_pred = t;
+                t = t_next;
+                if(--max_iter != 0) {
+                    goto still_walking;
+                }
+            }
+        }
+
+        //   If we reach this point, we did not find a valid successor
+        // for walking (a face for which p has negative orientation),
+        // thus we reached the tet for which p has all positive
+        // face orientations (i.e. the tet that contains p).
+
+        return t;
+    }
+
+
+    index_t Delaunay3d::locate(
+        const double* p, index_t hint, bool thread_safe,
+        Sign* orient
+    ) const {
+
+        //   Try improving the hint by using the
+        // inexact locate function. This gains
+        // (a little bit) performance (a few
+        // percent in total Delaunay computation
+        // time), but it is better than nothing...
+        //   Note: there is a maximum number of tets
+        // traversed by locate_inexact()  (2500)
+        // since there exists configurations in which
+        // locate_inexact() loops forever !
+        hint = locate_inexact(p, hint, 2500);
+
+        static Process::spinlock lock = GEOGRAM_SPINLOCK_INIT;
+
+        // We need to have this spinlock because
+        // of random() that is not thread-safe
+        // (TODO: implement a random() function with
+        //  thread local storage)
+        if(thread_safe) {
+            Process::acquire_spinlock(lock);
+        }
+
+        // If no hint specified, find a tetrahedron randomly
+        while(hint == NO_TETRAHEDRON) {
+            hint = index_t(Numeric::random_int32()) % max_t();
+            if(tet_is_free(hint)) {
+                hint = NO_TETRAHEDRON;
+            }
+        }
+
+        //  Always start from a real tet. If the tet is virtual,
+        // find its real neighbor (always opposite to the
+        // infinite vertex)
+        if(tet_is_virtual(hint)) {
+            for(index_t lf = 0; lf < 4; ++lf) {
+                if(tet_vertex(hint, lf) == VERTEX_AT_INFINITY) {
+                    hint = tet_adjacent(hint, lf);
+                    geo_debug_assert(hint != NO_TETRAHEDRON);
+                    break;
+                }
+            }
+        }
+
+        index_t t = hint;
+        index_t t_pred = NO_TETRAHEDRON;
+        Sign orient_local[4];
+        if(orient == nullptr) {
+            orient = orient_local;
+        }
+
+
+    still_walking:
+        {
+            const double* pv[4];
+            pv[0] = vertex_ptr(finite_tet_vertex(t,0));
+            pv[1] = vertex_ptr(finite_tet_vertex(t,1));
+            pv[2] = vertex_ptr(finite_tet_vertex(t,2));
+            pv[3] = vertex_ptr(finite_tet_vertex(t,3));
+
+            // Start from a random facet
+            index_t f0 = index_t(Numeric::random_int32()) % 4;
+            for(index_t df = 0; df < 4; ++df) {
+                index_t f = (f0 + df) % 4;
+
+                index_t t_next = tet_adjacent(t,f);
+
+                //  If the opposite tet is -1, then it means that
+                // we are trying to locate() (e.g. called from
+                // nearest_vertex) within a tetrahedralization
+                // from which the infinite tets were removed.
+                if(t_next == NO_INDEX) {
+                    if(thread_safe) {
+                        Process::release_spinlock(lock);
+                    }
+                    return NO_TETRAHEDRON;
+                }
+
+                //   If the candidate next tetrahedron is the
+                // one we came from, then we know already that
+                // the orientation is positive, thus we examine
+                // the next candidate (or exit the loop if they
+                // are exhausted).
+                if(t_next == t_pred) {
+                    orient[f] = POSITIVE ;
+                    continue ;
+                }
+
+                //   To test the orientation of p w.r.t. the facet f of
+                // t, we replace vertex number f with p in t (same
+                // convention as in CGAL).
+                // This is equivalent to tet_facet_point_orient3d(t,f,p)
+                // (but less costly, saves a couple of lookups)
+                const double* pv_bkp = pv[f];
+                pv[f] = p;
+                orient[f] = PCK::orient_3d(pv[0], pv[1], pv[2], pv[3]);
+
+                //   If the orientation is not negative, then we cannot
+                // walk towards t_next, and examine the next candidate
+                // (or exit the loop if they are exhausted).
+                if(orient[f] != NEGATIVE) {
+                    pv[f] = pv_bkp;
+                    continue;
+                }
+
+                //  If the opposite tet is a virtual tet, then
+                // the point has a positive orientation relative
+                // to the facet on the border of the convex hull,
+                // thus t_next is a tet in conflict and we are
+                // done.
+                if(tet_is_virtual(t_next)) {
+                    if(thread_safe) {
+                        Process::release_spinlock(lock);
+                    }
+                    for(index_t lf = 0; lf < 4; ++lf) {
+                        orient[lf] = POSITIVE;
+                    }
+                    return t_next;
+                }
+
+                //   If we reach this point, then t_next is a valid
+                // successor, thus we are still walking.
+                t_pred = t;
+                t = t_next;
+                goto still_walking;
+            }
+        }
+
+        //   If we reach this point, we did not find a valid successor
+        // for walking (a face for which p has negative orientation),
+        // thus we reached the tet for which p has all positive
+        // face orientations (i.e. the tet that contains p).
+
+        if(thread_safe) {
+            Process::release_spinlock(lock);
+        }
+        return t;
+    }
+
+    void Delaunay3d::find_conflict_zone(
+        index_t v,
+        index_t t, const Sign* orient,
+        index_t& t_bndry, index_t& f_bndry,
+        index_t& first, index_t& last
+    ) {
+        cavity_.clear();
+
+        first = last = END_OF_LIST;
+
+        //  Generate a unique stamp from current vertex index,
+        // used for marking tetrahedra.
+        set_tet_mark_stamp(v);
+
+        // Pointer to the coordinates of the point to be inserted
+        const double* p = vertex_ptr(v);
+
+        geo_debug_assert(t != NO_TETRAHEDRON);
+
+        // Test whether the point already exists in
+        // the triangulation. The point already exists
+        // if it's located on three faces of the
+        // tetrahedron returned by locate().
+        int nb_zero =
+            (orient[0] == ZERO) +
+            (orient[1] == ZERO) +
+            (orient[2] == ZERO) +
+            (orient[3] == ZERO) ;
+
+        if(nb_zero >= 3) {
+            return;
+        }
+
+        //  Weighted triangulations can have dangling
+        // vertices. Such vertices p are characterized by
+        // the fact that p is not in conflict with the
+        // tetrahedron returned by locate().
+        if(weighted_ && !tet_is_conflict(t, p)) {
+            return;
+        }
+
+        // Note: points on edges and on facets are
+        // handled by the way tet_is_in_conflict()
+        // is implemented, that naturally inserts
+        // the correct tetrahedra in the conflict list.
+
+
+        // Mark t as conflict
+        add_tet_to_list(t, first, last);
+
+        // A small optimization: if the point to be inserted
+        // is on some faces of the located tetrahedron, insert
+        // the neighbors accros those faces in the conflict list.
+        // It saves a couple of calls to the predicates in this
+        // specific case (combinatorics are in general less
+        // expensive than the predicates).
+        if(!weighted_ && nb_zero != 0) {
+            for(index_t lf = 0; lf < 4; ++lf) {
+                if(orient[lf] == ZERO) {
+                    index_t t2 = tet_adjacent(t, lf);
+                    add_tet_to_list(t2, first, last);
+                }
+            }
+            for(index_t lf = 0; lf < 4; ++lf) {
+                if(orient[lf] == ZERO) {
+                    index_t t2 = tet_adjacent(t, lf);
+                    find_conflict_zone_iterative(
+                        p,t2,t_bndry,f_bndry,first,last
+                    );
+                }
+            }
+        }
+
+        // Determine the conflict list by greedy propagation from t.
+        find_conflict_zone_iterative(p,t,t_bndry,f_bndry,first,last);
+    }
+
+    void Delaunay3d::find_conflict_zone_iterative(
+        const double* p, index_t t_in,
+        index_t& t_bndry, index_t& f_bndry,
+        index_t& first, index_t& last
+    ) {
+
+        //std::stack<index_t> S;
+        S_.push(t_in);
+
+        while(!S_.empty()) {
+
+            index_t t = S_.top();
+            S_.pop();
+
+            for(index_t lf = 0; lf < 4; ++lf) {
+                index_t t2 = tet_adjacent(t, lf);
+
+                if(
+                    tet_is_in_list(t2)  // known as conflict
+                ) {
+                    continue;
+                }
+
+                if(
+                    tet_is_marked(t2)     // known as non-conflict
+                ) {
+                    cavity_.new_facet(
+                        t, lf,
+                        tet_vertex(t, tet_facet_vertex(lf,0)),
+                        tet_vertex(t, tet_facet_vertex(lf,1)),
+                        tet_vertex(t, tet_facet_vertex(lf,2))
+                    );
+                    continue;
+                }
+
+
+                if(tet_is_conflict(t2, p)) {
+                    // Chain t2 in conflict list
+                    add_tet_to_list(t2, first, last);
+                    S_.push(t2);
+                    continue;
+                }
+
+                //   At this point, t is in conflict
+                // and t2 is not in conflict.
+                // We keep a reference to a tet on the boundary
+                t_bndry = t;
+                f_bndry = lf;
+                // Mark t2 as visited (but not conflict)
+                mark_tet(t2);
+
+                cavity_.new_facet(
+                    t, lf,
+                    tet_vertex(t, tet_facet_vertex(lf,0)),
+                    tet_vertex(t, tet_facet_vertex(lf,1)),
+                    tet_vertex(t, tet_facet_vertex(lf,2))
+                );
+
+            }
+        }
+    }
+
+    index_t Delaunay3d::stellate_conflict_zone_iterative(
+        index_t v, index_t t1, index_t t1fbord, index_t t1fprev
+    ) {
+        //   This function is de-recursified because some degenerate
+        // inputs can cause stack overflow (system stack is limited to
+        // a few megs). For instance, it can happen when a large number
+        // of points are on the same sphere exactly.
+
+        //   To de-recursify, it uses class StellateConflictStack
+        // that emulates system's stack for storing functions's
+        // parameters and local variables in all the nested stack
+        // frames.
+
+        S2_.push(t1, t1fbord, t1fprev);
+
+        index_t new_t;   // the newly created tetrahedron.
+
+        index_t t1ft2;   // traverses the 4 facets of t1.
+
+        index_t t2;      // the tetrahedron on the border of
+                         // the conflict zone that shares an
+                         // edge with t1 along t1ft2.
+
+        index_t t2fbord; // the facet of t2 on the border of
+                         // the conflict zone.
+
+        index_t t2ft1;   // the facet of t2 that is incident to t1.
+
+    entry_point:
+        S2_.get_parameters(t1, t1fbord, t1fprev);
+
+        geo_debug_assert(tet_is_in_list(t1));
+        geo_debug_assert(tet_adjacent(t1,t1fbord) != NO_INDEX);
+        geo_debug_assert(!tet_is_in_list(tet_adjacent(t1,t1fbord)));
+
+        // Create new tetrahedron with same vertices as t_bndry
+        new_t = new_tetrahedron(
+            tet_vertex(t1,0),
+            tet_vertex(t1,1),
+            tet_vertex(t1,2),
+            tet_vertex(t1,3)
+        );
+
+        // Replace in new_t the vertex opposite to t1fbord with v
+        set_tet_vertex(new_t, t1fbord, v);
+
+        // Connect new_t with t1's neighbor accros t1fbord
+        {
+            index_t tbord = tet_adjacent(t1,t1fbord);
+            set_tet_adjacent(new_t, t1fbord, tbord);
+            set_tet_adjacent(tbord, find_tet_adjacent(tbord,t1), new_t);
+        }
+
+        //  Lookup new_t's neighbors accros its three other
+        // facets and connect them
+        for(t1ft2=0; t1ft2<4; ++t1ft2) {
+
+            if(t1ft2 == t1fprev || tet_adjacent(new_t,t1ft2) != NO_INDEX) {
+                continue;
+            }
+
+            // Get t1's neighbor along the border of the conflict zone
+            if(!get_neighbor_along_conflict_zone_border(
+                   t1,t1fbord,t1ft2, t2,t2fbord,t2ft1
+               )) {
+                //   If t1's neighbor is not a new tetrahedron,
+                // create a new tetrahedron through a recursive call.
+                S2_.save_locals(new_t, t1ft2, t2ft1);
+                S2_.push(t2, t2fbord, t2ft1);
+                goto entry_point;
+
+            return_point:
+                // This is the return value of the called function.
+                index_t result = new_t;
+                S2_.pop();
+
+                // Special case: we were in the outermost frame,
+                // then we (truly) return from the function.
+                if(S2_.empty()) {
+                    return result;
+                }
+
+                S2_.get_parameters(t1, t1fbord, t1fprev);
+                S2_.get_locals(new_t, t1ft2, t2ft1);
+                t2 = result;
+            }
+
+            set_tet_adjacent(t2, t2ft1, new_t);
+            set_tet_adjacent(new_t, t1ft2, t2);
+        }
+
+        // Except for the initial call (see "Special case" above),
+        // the nested calls all come from the same location,
+        // thus there is only one possible return point
+        // (no need to push any return address).
+        goto return_point;
+    }
+
+    index_t Delaunay3d::stellate_cavity(index_t v) {
+
+        index_t new_tet = NO_INDEX;
+
+        for(index_t f=0; f<cavity_.nb_facets(); ++f) {
+            index_t old_tet = cavity_.facet_tet(f);
+            index_t lf = cavity_.facet_facet(f);
+            index_t t_neigh = tet_adjacent(old_tet, lf);
+            index_t v1 = cavity_.facet_vertex(f,0);
+            index_t v2 = cavity_.facet_vertex(f,1);
+            index_t v3 = cavity_.facet_vertex(f,2);
+            new_tet = new_tetrahedron(v, v1, v2, v3);
+            set_tet_adjacent(new_tet, 0, t_neigh);
+            set_tet_adjacent(
+		t_neigh, find_tet_adjacent(t_neigh,old_tet), new_tet
+	    );
+            cavity_.set_facet_tet(f, new_tet);
+        }
+
+        for(index_t f=0; f<cavity_.nb_facets(); ++f) {
+            new_tet = cavity_.facet_tet(f);
+            index_t neigh1, neigh2, neigh3;
+            cavity_.get_facet_neighbor_tets(f, neigh1, neigh2, neigh3);
+            set_tet_adjacent(new_tet, 1, neigh1);
+            set_tet_adjacent(new_tet, 2, neigh2);
+            set_tet_adjacent(new_tet, 3, neigh3);
+        }
+
+        return new_tet;
+    }
+
+    index_t Delaunay3d::insert(index_t v, index_t hint) {
+        index_t t_bndry = NO_TETRAHEDRON;
+        index_t f_bndry = NO_INDEX;
+        index_t first_conflict = NO_TETRAHEDRON;
+        index_t last_conflict = NO_TETRAHEDRON;
+
+        const double* p = vertex_ptr(v);
+
+        Sign orient[4];
+        index_t t = locate(p, hint, false, orient);
+        find_conflict_zone(
+            v,t,orient,t_bndry,f_bndry,first_conflict,last_conflict
+        );
+
+        // The conflict list can be empty if:
+        //  - Vertex v already exists in the triangulation
+        //  - The triangulation is weighted and v is not visible
+        if(first_conflict == END_OF_LIST) {
+            return NO_TETRAHEDRON;
+        }
+
+        index_t new_tet = NO_INDEX;
+        if(cavity_.OK()) {
+            new_tet = stellate_cavity(v);
+        } else {
+            new_tet = stellate_conflict_zone_iterative(v,t_bndry,f_bndry);
+        }
+
+        // Recycle the tetrahedra of the conflict zone.
+        cell_next_[last_conflict] = first_free_;
+        first_free_ = first_conflict;
+
+        // Return one of the newly created tets
+        return new_tet;
+    }
+
+    bool Delaunay3d::create_first_tetrahedron(
+        index_t& iv0, index_t& iv1, index_t& iv2, index_t& iv3
+    ) {
+        if(nb_vertices() < 4) {
+            return false;
+        }
+
+        iv0 = 0;
+
+        iv1 = 1;
+        while(
+            iv1 < nb_vertices() &&
+            PCK::points_are_identical_3d(
+                vertex_ptr(iv0), vertex_ptr(iv1)
+            )
+        ) {
+            ++iv1;
+        }
+        if(iv1 == nb_vertices()) {
+            return false;
+        }
+
+        iv2 = iv1 + 1;
+        while(
+            iv2 < nb_vertices() &&
+            PCK::points_are_colinear_3d(
+                vertex_ptr(iv0), vertex_ptr(iv1), vertex_ptr(iv2)
+            )
+        ) {
+            ++iv2;
+        }
+        if(iv2 == nb_vertices()) {
+            return false;
+        }
+
+        iv3 = iv2 + 1;
+        Sign s = ZERO;
+        while(
+            iv3 < nb_vertices() &&
+            (s = PCK::orient_3d(
+                vertex_ptr(iv0), vertex_ptr(iv1),
+                vertex_ptr(iv2), vertex_ptr(iv3)
+            )) == ZERO
+        ) {
+            ++iv3;
+        }
+
+        if(iv3 == nb_vertices()) {
+            return false;
+        }
+
+        geo_debug_assert(s != ZERO);
+
+        if(s == NEGATIVE) {
+            std::swap(iv2, iv3);
+        }
+
+        // Create the first tetrahedron
+        index_t t0 = new_tetrahedron(iv0, iv1, iv2, iv3);
+
+        // Create the first four virtual tetrahedra surrounding it
+        index_t t[4];
+        for(index_t f = 0; f < 4; ++f) {
+            // In reverse order since it is an adjacent tetrahedron
+            index_t v1 = tet_vertex(t0, tet_facet_vertex(f,2));
+            index_t v2 = tet_vertex(t0, tet_facet_vertex(f,1));
+            index_t v3 = tet_vertex(t0, tet_facet_vertex(f,0));
+            t[f] = new_tetrahedron(VERTEX_AT_INFINITY, v1, v2, v3);
+        }
+
+        // Connect the virtual tetrahedra to the real one
+        for(index_t f=0; f<4; ++f) {
+            set_tet_adjacent(t[f], 0, t0);
+            set_tet_adjacent(t0, f, t[f]);
+        }
+
+        // Interconnect the four virtual tetrahedra along their common
+        // faces
+        for(index_t f = 0; f < 4; ++f) {
+            // In reverse order since it is an adjacent tetrahedron
+            index_t lv1 = tet_facet_vertex(f,2);
+            index_t lv2 = tet_facet_vertex(f,1);
+            index_t lv3 = tet_facet_vertex(f,0);
+            set_tet_adjacent(t[f], 1, t[lv1]);
+            set_tet_adjacent(t[f], 2, t[lv2]);
+            set_tet_adjacent(t[f], 3, t[lv3]);
+        }
+
+        return true;
+    }
+
+    
+
+    void Delaunay3d::show_tet(index_t t) const {
+        std::cerr << "tet"
+                  << (tet_is_in_list(t) ? '*' : ' ')
+                  << t
+                  << ", v=["
+                  << tet_vertex(t, 0)
+                  << ' '
+                  << tet_vertex(t, 1)
+                  << ' '
+                  << tet_vertex(t, 2)
+                  << ' '
+                  << tet_vertex(t, 3)
+                  << "]  adj=[";
+        show_tet_adjacent(t, 0);
+        show_tet_adjacent(t, 1);
+        show_tet_adjacent(t, 2);
+        show_tet_adjacent(t, 3);
+        std::cerr << "] ";
+
+        for(index_t f = 0; f < 4; ++f) {
+            std::cerr << 'f' << f << ':';
+            for(index_t v = 0; v < 3; ++v) {
+                std::cerr << tet_vertex(t, tet_facet_vertex(f,v))
+                          << ',';
+            }
+            std::cerr << ' ';
+        }
+        std::cerr << std::endl;
+    }
+
+    void Delaunay3d::show_tet_adjacent(index_t t, index_t lf) const {
+        index_t adj = tet_adjacent(t, lf);
+        if(adj != NO_INDEX) {
+            std::cerr << (tet_is_in_list(adj) ? '*' : ' ');
+        }
+        std::cerr << adj;
+        std::cerr << ' ';
+    }
+
+    void Delaunay3d::show_list(
+        index_t first, const std::string& list_name
+    ) const {
+        index_t t = first;
+        std::cerr << "tet list: " << list_name << std::endl;
+        while(t != END_OF_LIST) {
+            show_tet(t);
+            t = tet_next(t);
+        }
+        std::cerr << "-------------" << std::endl;
+    }
+
+    void Delaunay3d::check_combinatorics(bool verbose) const {
+        if(verbose) {
+            std::cerr << std::endl;
+        }
+        bool ok = true;
+        std::vector<bool> v_has_tet(nb_vertices(), false);
+        for(index_t t = 0; t < max_t(); ++t) {
+            if(tet_is_free(t)) {
+/*
+  if(verbose) {
+  std::cerr << "-Deleted tet: ";
+  show_tet(t);
+  }
+*/
+            } else {
+/*
+  if(verbose) {
+  std::cerr << "Checking tet: ";
+  show_tet(t);
+  }
+*/
+                for(index_t lf = 0; lf < 4; ++lf) {
+                    if(tet_adjacent(t, lf) == NO_INDEX) {
+                        std::cerr << lf << ":Missing adjacent tet"
+                                  << std::endl;
+                        ok = false;
+                    } else if(tet_adjacent(t, lf) == t) {
+                        std::cerr << lf << ":Tet is adjacent to itself"
+                                  << std::endl;
+                        ok = false;
+                    } else {
+                        index_t t2 = tet_adjacent(t, lf);
+                        bool found = false;
+                        for(index_t lf2 = 0; lf2 < 4; ++lf2) {
+                            if(tet_adjacent(t2, lf2) == t) {
+                                found = true;
+                            }
+                        }
+                        if(!found) {
+                            std::cerr
+                                << lf << ":Adjacent link is not bidirectional"
+                                << std::endl;
+                            ok = false;
+                        }
+                    }
+                }
+                index_t nb_infinite = 0;
+                for(index_t lv = 0; lv < 4; ++lv) {
+                    if(tet_vertex(t, lv) == NO_INDEX) {
+                        ++nb_infinite;
+                    }
+                }
+                if(nb_infinite > 1) {
+                    ok = false;
+                    std::cerr << "More than one infinite vertex"
+                              << std::endl;
+                }
+            }
+            for(index_t lv = 0; lv < 4; ++lv) {
+                index_t v = tet_vertex(t, lv);
+                if(v != NO_INDEX) {
+                    v_has_tet[v] = true;
+                }
+            }
+        }
+        for(index_t v = 0; v < nb_vertices(); ++v) {
+            if(!v_has_tet[v]) {
+                if(verbose) {
+                    std::cerr << "Vertex " << v
+                              << " is isolated (duplicated ?)" << std::endl;
+                }
+            }
+        }
+        geo_assert(ok);
+        if(verbose) {
+            std::cerr << std::endl;
+        }
+        std::cerr << std::endl << "Delaunay Combi OK" << std::endl;
+    }
+
+    void Delaunay3d::check_geometry(bool verbose) const {
+        bool ok = true;
+        for(index_t t = 0; t < max_t(); ++t) {
+            if(!tet_is_free(t)) {
+                index_t v0 = tet_vertex(t, 0);
+                index_t v1 = tet_vertex(t, 1);
+                index_t v2 = tet_vertex(t, 2);
+                index_t v3 = tet_vertex(t, 3);
+                for(index_t v = 0; v < nb_vertices(); ++v) {
+                    if(v == v0 || v == v1 || v == v2 || v == v3) {
+                        continue;
+                    }
+                    if(tet_is_conflict(t, vertex_ptr(v))) {
+                        ok = false;
+                        if(verbose) {
+                            std::cerr << "Tet " << t <<
+                                " is in conflict with vertex " << v
+                                      << std::endl;
+
+                            std::cerr << "  offending tet: ";
+                            show_tet(t);
+                        }
+                    }
+                }
+            }
+        }
+        geo_assert(ok);
+        std::cerr << std::endl << "Delaunay Geo OK" << std::endl;
+    }
+
+    
+
+    RegularWeightedDelaunay3d::RegularWeightedDelaunay3d(
+        coord_index_t dimension
+    ) :
+        Delaunay3d(4)
+    {
+        if(dimension != 4) {
+            throw InvalidDimension(dimension, "RegularWeightedDelaunay3d", "4");
+        }
+    }
+
+    RegularWeightedDelaunay3d::~RegularWeightedDelaunay3d() {
+    }
+}
+
+/******* extracted from parallel_delaunay_3d.cpp *******/
+
+#ifdef GEOGRAM_WITH_PDEL
+
+
+#include <mutex>
+#include <condition_variable>
+
+// ParallelDelaunayThread class, declared locally, has
+// no out-of-line virtual functions. It is not a
+// problem since they are only visible from this translation
+// unit, but clang will complain.
+#ifdef __clang__
+#pragma GCC diagnostic ignored "-Wweak-vtables"
+#endif
+
+namespace {
+    using namespace GEO;
+
+    index_t thread_safe_random(index_t choices_in) {
+#ifdef GARGANTUA
+        typedef Numeric::int64 Int;
+#else
+        typedef long int Int;
+#endif
+        signed_index_t choices = signed_index_t(choices_in);
+        static thread_local Int randomseed = 1l ;
+        if (choices >= 714025l) {
+            Int newrandom = (randomseed * 1366l + 150889l) % 714025l;
+            randomseed = (newrandom * 1366l + 150889l) % 714025l;
+            newrandom = newrandom * (choices / 714025l) + randomseed;
+            if (newrandom >= choices) {
+                return index_t(newrandom - choices);
+            } else {
+                return index_t(newrandom);
+            }
+        } else {
+            randomseed = (randomseed * 1366l + 150889l) % 714025l;
+            return index_t(randomseed % choices);
+        }
+    }
+
+    index_t thread_safe_random_4() {
+        static thread_local long int randomseed = 1l ;
+        randomseed = (randomseed * 1366l + 150889l) % 714025l;
+        return index_t(randomseed % 4);
+    }
+}
+
+namespace GEO {
+
+    class Delaunay3dThread : public GEO::Thread {
+    public:
+
+        static constexpr index_t NO_THREAD = CellStatusArray::FREE_CELL;
+
+        Delaunay3dThread(
+            ParallelDelaunay3d* master,
+            index_t pool_begin,
+            index_t pool_end
+        ) :
+            master_(master),
+            cell_to_v_store_(master_->cell_to_v_store_),
+            cell_to_cell_store_(master_->cell_to_cell_store_),
+            cell_next_(master_->cell_next_),
+            cell_status_(master_->cell_status_)
+            {
+
+                // max_used_t_ is initialized to 1 so that
+                // computing modulos does not trigger FPEs
+                // at the beginning.
+                max_used_t_ = 1;
+                max_t_ = master_->cell_next_.size();
+
+                nb_vertices_ = master_->nb_vertices();
+                vertices_ = master_->vertex_ptr(0);
+                weighted_ = master_->weighted_;
+                heights_ = weighted_ ? master_->heights_.data() : nullptr;
+                dimension_ = master_->dimension();
+                vertex_stride_ = dimension_;
+                reorder_ = master_->reorder_.data();
+
+                // Initialize free list in memory pool
+                first_free_ = pool_begin;
+                for(index_t t=pool_begin; t<pool_end-1; ++t) {
+                    cell_next_[t] = t+1;
+                }
+                cell_next_[pool_end-1] = END_OF_LIST;
+                nb_free_ = pool_end - pool_begin;
+                memory_overflow_ = false;
+
+                work_begin_ = NO_INDEX;
+                work_end_ = NO_INDEX;
+                finished_ = false;
+                b_hint_ = NO_TETRAHEDRON;
+                e_hint_ = NO_TETRAHEDRON;
+                direction_ = true;
+
+#ifdef GEO_DEBUG
+                nb_acquired_tets_ = 0;
+#endif
+                interfering_thread_ = NO_THREAD;
+
+                nb_rollbacks_ = 0;
+                nb_failed_locate_ = 0;
+
+                nb_tets_to_create_ = 0;
+                t_boundary_ = NO_TETRAHEDRON;
+                f_boundary_ = NO_INDEX;
+
+                v1_ = NO_INDEX;
+                v2_ = NO_INDEX;
+                v3_ = NO_INDEX;
+                v4_ = NO_INDEX;
+            }
+
+        void initialize_from(const Delaunay3dThread* rhs) {
+            max_used_t_ = rhs->max_used_t_;
+            max_t_ = rhs->max_t_;
+            v1_ = rhs->v1_;
+            v2_ = rhs->v2_;
+            v3_ = rhs->v3_;
+            v4_ = rhs->v4_;
+        }
+
+        index_t nb_rollbacks() const {
+            return nb_rollbacks_;
+        }
+
+        index_t nb_failed_locate() const {
+            return nb_failed_locate_;
+        }
+
+        void set_work(index_t b, index_t e) {
+            work_begin_ = b;
+            // e is one position past the last point index
+            // to insert.
+            work_end_ = e-1;
+        }
+
+        index_t work_size() const {
+            if(work_begin_ == NO_INDEX && work_end_ == NO_INDEX) {
+                return 0;
+            }
+            geo_debug_assert(work_begin_ != NO_INDEX);
+            geo_debug_assert(work_end_ != NO_INDEX);
+            return std::max(work_end_ - work_begin_ + 1, index_t(0));
+        }
+
+        index_t nb_threads() const {
+            return index_t(master_->threads_.size());
+        }
+
+        Delaunay3dThread* thread(index_t t) {
+            return static_cast<Delaunay3dThread*>(master_->threads_[t].get());
+        }
+
+        void run() override {
+
+            finished_ = false;
+
+            if(work_begin_ == NO_INDEX || work_end_ == NO_INDEX) {
+                return ;
+            }
+
+            memory_overflow_ = false;
+
+            // Current hint associated with b
+            b_hint_ = NO_TETRAHEDRON;
+
+            // Current hint associated with e
+            e_hint_ = NO_TETRAHEDRON;
+
+            // If true, insert in b->e order,
+            // else insert in e->b order
+            direction_ = true;
+
+            while(work_end_ >= work_begin_ && !memory_overflow_) {
+                index_t v = direction_ ? work_begin_ : work_end_ ;
+                index_t& hint = direction_ ? b_hint_ : e_hint_;
+
+                // Try to insert v and update hint
+                bool success = insert(reorder_[v],hint);
+
+                //   Notify all threads that are waiting for
+                // this thread to release some tetrahedra.
+                send_event();
+
+                if(success) {
+                    if(direction_) {
+                        ++work_begin_;
+                    } else {
+                        --work_end_;
+                    }
+                } else {
+                    ++nb_rollbacks_;
+                    if(interfering_thread_ != NO_THREAD) {
+                        if(id() < interfering_thread_) {
+                            // If this thread has a higher priority than
+                            // the one that interfered, wait for the
+                            // interfering thread to release the tets that
+                            // it holds (then the loop will retry to insert
+                            // the same vertex).
+                            wait_for_event(interfering_thread_);
+                        } else {
+                            // If this thread has a lower priority than
+                            // the interfering thread, try inserting
+                            // from the other end of the points sequence.
+                            direction_ = !direction_;
+                        }
+                    }
+                }
+            }
+            finished_ = true;
+
+            //   Fix by Hiep Vu: wake up threads that potentially missed
+            // the previous wake ups.
+            mutex_.lock();
+            send_event();
+            mutex_.unlock();
+        }
+
+        static constexpr index_t NO_TETRAHEDRON = NO_INDEX;
+
+        static constexpr index_t VERTEX_AT_INFINITY = NO_INDEX;
+
+
+        index_t max_t() const {
+            return max_t_;
+        }
+
+        bool tet_is_finite(index_t t) const {
+            return
+                cell_to_v_store_[4 * t]     != NO_INDEX &&
+                cell_to_v_store_[4 * t + 1] != NO_INDEX &&
+                cell_to_v_store_[4 * t + 2] != NO_INDEX &&
+                cell_to_v_store_[4 * t + 3] != NO_INDEX ;
+        }
+
+        bool tet_is_real(index_t t) const {
+            return !tet_is_free(t) && tet_is_finite(t);
+        }
+
+        bool tet_is_free(index_t t) const {
+            return tet_is_in_list(t);
+        }
+
+        bool tet_is_in_list(index_t t, index_t first) const {
+            for(
+                index_t cur = first; cur != END_OF_LIST;
+                cur = tet_next(cur)
+            ) {
+                if(cur == t) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+
+        index_t create_first_tetrahedron() {
+            index_t iv0,iv1,iv2,iv3;
+            if(nb_vertices() < 4) {
+                return NO_TETRAHEDRON;
+            }
+
+            iv0 = 0;
+
+            iv1 = 1;
+            while(
+                iv1 < nb_vertices() &&
+                PCK::points_are_identical_3d(
+                    vertex_ptr(iv0), vertex_ptr(iv1)
+                )
+            ) {
+                ++iv1;
+            }
+            if(iv1 == nb_vertices()) {
+                return NO_TETRAHEDRON;
+            }
+
+            iv2 = iv1 + 1;
+            while(
+                iv2 < nb_vertices() &&
+                PCK::points_are_colinear_3d(
+                    vertex_ptr(iv0), vertex_ptr(iv1), vertex_ptr(iv2)
+                )
+            ) {
+                ++iv2;
+            }
+            if(iv2 == nb_vertices()) {
+                return NO_TETRAHEDRON;
+            }
+
+            iv3 = iv2 + 1;
+            Sign s = ZERO;
+            while(
+                iv3 < nb_vertices() &&
+                (s = PCK::orient_3d(
+                    vertex_ptr(iv0), vertex_ptr(iv1),
+                    vertex_ptr(iv2), vertex_ptr(iv3)
+                )) == ZERO
+            ) {
+                ++iv3;
+            }
+
+            if(iv3 == nb_vertices()) {
+                return NO_TETRAHEDRON;
+            }
+
+            geo_debug_assert(s != ZERO);
+
+            if(s == NEGATIVE) {
+                std::swap(iv2, iv3);
+            }
+
+            // Create the first tetrahedron
+            index_t t0 = new_tetrahedron(iv0, iv1, iv2, iv3);
+
+            // Create the first four virtual tetrahedra surrounding it
+            index_t t[4];
+            for(index_t f = 0; f < 4; ++f) {
+                // In reverse order since it is an adjacent tetrahedron
+                index_t v1 = tet_vertex(t0, tet_facet_vertex(f,2));
+                index_t v2 = tet_vertex(t0, tet_facet_vertex(f,1));
+                index_t v3 = tet_vertex(t0, tet_facet_vertex(f,0));
+                t[f] = new_tetrahedron(VERTEX_AT_INFINITY, v1, v2, v3);
+            }
+
+            // Connect the virtual tetrahedra to the real one
+            for(index_t f=0; f<4; ++f) {
+                set_tet_adjacent(t[f], 0, t0);
+                set_tet_adjacent(t0, f, t[f]);
+            }
+
+            // Interconnect the four virtual tetrahedra along their common
+            // faces
+            for(index_t f = 0; f < 4; ++f) {
+                // In reverse order since it is an adjacent tetrahedron
+                index_t lv1 = tet_facet_vertex(f,2);
+                index_t lv2 = tet_facet_vertex(f,1);
+                index_t lv3 = tet_facet_vertex(f,0);
+                set_tet_adjacent(t[f], 1, t[lv1]);
+                set_tet_adjacent(t[f], 2, t[lv2]);
+                set_tet_adjacent(t[f], 3, t[lv3]);
+            }
+
+            v1_ = iv0;
+            v2_ = iv1;
+            v3_ = iv2;
+            v4_ = iv3;
+
+            release_tets();
+
+            return t0;
+        }
+
+
+        index_t stellate_cavity(index_t v) {
+            index_t new_tet = NO_INDEX;
+
+            for(index_t f=0; f<cavity_.nb_facets(); ++f) {
+                index_t old_tet = cavity_.facet_tet(f);
+                index_t lf = cavity_.facet_facet(f);
+                index_t t_neigh = tet_adjacent(old_tet, lf);
+                index_t v1 = cavity_.facet_vertex(f,0);
+                index_t v2 = cavity_.facet_vertex(f,1);
+                index_t v3 = cavity_.facet_vertex(f,2);
+                new_tet = new_tetrahedron(v, v1, v2, v3);
+                set_tet_adjacent(new_tet, 0, t_neigh);
+                set_tet_adjacent(
+                    t_neigh, find_tet_adjacent(t_neigh,old_tet), new_tet
+                );
+                cavity_.set_facet_tet(f, new_tet);
+            }
+
+            for(index_t f=0; f<cavity_.nb_facets(); ++f) {
+                new_tet = cavity_.facet_tet(f);
+                index_t neigh1, neigh2, neigh3;
+                cavity_.get_facet_neighbor_tets(f, neigh1, neigh2, neigh3);
+                set_tet_adjacent(new_tet, 1, neigh1);
+                set_tet_adjacent(new_tet, 2, neigh2);
+                set_tet_adjacent(new_tet, 3, neigh3);
+            }
+
+            return new_tet;
+        }
+
+        bool insert(index_t v, index_t& hint) {
+
+            // If v is one of the vertices of the
+            // first tetrahedron, nothing to do.
+            if(
+                v == v1_ ||
+                v == v2_ ||
+                v == v3_ ||
+                v == v4_
+            ) {
+                return true;
+            }
+
+            Sign orient[4];
+            index_t t = locate(vertex_ptr(v),hint,orient);
+
+            //   locate() may fail due to tets already owned by
+            // other threads.
+            if(t == NO_TETRAHEDRON) {
+                ++nb_failed_locate_;
+                geo_debug_assert(nb_acquired_tets_ == 0);
+                return false;
+            }
+
+            //  At this point, t is a valid tetrahedron,
+            // and this thread acquired a lock on it.
+
+            // Test whether the point already exists in
+            // the triangulation. The point already exists
+            // if it's located on three faces of the
+            // tetrahedron returned by locate().
+            int nb_zero =
+                (orient[0] == ZERO) +
+                (orient[1] == ZERO) +
+                (orient[2] == ZERO) +
+                (orient[3] == ZERO) ;
+
+            if(nb_zero >= 3) {
+                release_tet(t);
+                return true;
+            }
+
+            geo_debug_assert(nb_acquired_tets_ == 1);
+            geo_debug_assert(weighted_ || tet_is_in_conflict(t,vertex_ptr(v)));
+
+            index_t t_bndry = NO_TETRAHEDRON;
+            index_t f_bndry = NO_INDEX;
+
+            cavity_.clear();
+
+            bool ok = find_conflict_zone(v,t,t_bndry,f_bndry);
+
+            // When in multithreading mode, we cannot allocate memory
+            // dynamically and we use a fixed pool. If the fixed pool
+            // is full, then we exit the thread (and the missing points
+            // are inserted after, in sequential mode).
+            if(
+                nb_tets_to_create_ > nb_free_ &&
+                Process::is_running_threads()
+            ) {
+                memory_overflow_ = true;
+                ok = false;
+            }
+
+            if(!ok) {
+                //  At this point, this thread did not successfully
+                // acquire all the tets in the conflict zone, so
+                // we need to rollback.
+                release_tets();
+                geo_debug_assert(nb_acquired_tets_ == 0);
+                return false;
+            }
+
+            // The conflict list can be empty if
+            //  the triangulation is weighted and v is not visible
+            if(tets_to_delete_.size() == 0) {
+                release_tets();
+                geo_debug_assert(nb_acquired_tets_ == 0);
+                return true;
+            }
+
+
+            geo_debug_assert(
+                nb_acquired_tets_ ==
+                tets_to_delete_.size() + tets_to_release_.size()
+            );
+
+#ifdef GEO_DEBUG
+            // Sanity check: make sure this threads owns all the tets
+            // in conflict and their neighbors.
+            for(index_t i=0; i<tets_to_delete_.size(); ++i) {
+                index_t tdel = tets_to_delete_[i];
+                geo_debug_assert(owns_tet(tdel));
+                for(index_t lf=0; lf<4; ++lf) {
+                    geo_debug_assert(tet_adjacent(tdel,lf) != NO_INDEX);
+                    geo_debug_assert(owns_tet(tet_adjacent(tdel,lf)));
+                }
+            }
+#endif
+            geo_debug_assert(owns_tet(t_bndry));
+            geo_debug_assert(owns_tet(tet_adjacent(t_bndry,f_bndry)));
+            geo_debug_assert(
+		!tet_is_marked_as_conflict(tet_adjacent(t_bndry,f_bndry))
+            );
+
+            //   At this point, this threads owns all the tets in conflict and
+            // their neighbors, therefore no other thread can interfere, and
+            // we can update the triangulation.
+
+            index_t new_tet = NO_INDEX;
+            if(cavity_.OK()) {
+                new_tet = stellate_cavity(v);
+            } else {
+                new_tet = stellate_conflict_zone_iterative(v,t_bndry,f_bndry);
+            }
+
+
+            // Recycle the tetrahedra of the conflict zone.
+            for(index_t i=0; i<tets_to_delete_.size()-1; ++i) {
+                cell_next_[tets_to_delete_[i]] = tets_to_delete_[i+1];
+            }
+            cell_next_[tets_to_delete_[tets_to_delete_.size()-1]] =
+                first_free_;
+            first_free_ = tets_to_delete_[0];
+            nb_free_ += nb_tets_in_conflict();
+
+            // For debugging purposes.
+#ifdef GEO_DEBUG
+            for(index_t i=0; i<tets_to_delete_.size(); ++i) {
+                index_t tdel = tets_to_delete_[i];
+                set_tet_vertex(tdel,0,VERTEX_OF_DELETED_TET);
+                set_tet_vertex(tdel,1,VERTEX_OF_DELETED_TET);
+                set_tet_vertex(tdel,2,VERTEX_OF_DELETED_TET);
+                set_tet_vertex(tdel,3,VERTEX_OF_DELETED_TET);
+            }
+#endif
+
+            // Return one of the newly created tets
+            hint=new_tet;
+
+            release_tets();
+
+            geo_debug_assert(nb_acquired_tets_ == 0);
+            return true;
+        }
+
+        bool find_conflict_zone(
+            index_t v, index_t t,
+            index_t& t_bndry, index_t& f_bndry
+        ) {
+            nb_tets_to_create_ = 0;
+
+            geo_debug_assert(t != NO_TETRAHEDRON);
+            geo_debug_assert(owns_tet(t));
+
+            // Pointer to the coordinates of the point to be inserted
+            const double* p = vertex_ptr(v);
+
+            //  Weighted triangulations can have dangling
+            // vertices. Such vertices p are characterized by
+            // the fact that p is not in conflict with the
+            // tetrahedron returned by locate().
+            if(weighted_ && !tet_is_in_conflict(t,p)) {
+                release_tet(t);
+                return true;
+            }
+
+            mark_tet_as_conflict(t);
+
+            //   Sanity check: the vertex to be inserted should
+            // not correspond to one of the vertices of t.
+            geo_debug_assert(v != tet_vertex(t,0));
+            geo_debug_assert(v != tet_vertex(t,1));
+            geo_debug_assert(v != tet_vertex(t,2));
+            geo_debug_assert(v != tet_vertex(t,3));
+
+            // Note: points on edges and on facets are
+            // handled by the way tet_is_in_conflict()
+            // is implemented, that naturally inserts
+            // the correct tetrahedra in the conflict list.
+
+            // Determine the conflict list by greedy propagation from t.
+            bool result = find_conflict_zone_iterative(p,t);
+            t_bndry = t_boundary_;
+            f_bndry = f_boundary_;
+            return result;
+        }
+
+
+        bool find_conflict_zone_iterative(
+            const double* p, index_t t_in
+        ) {
+            geo_debug_assert(owns_tet(t_in));
+            S_.push_back(t_in);
+
+            while(S_.size() != 0) {
+                index_t t = *(S_.rbegin());
+                S_.pop_back();
+
+                geo_debug_assert(owns_tet(t));
+
+                for(index_t lf = 0; lf < 4; ++lf) {
+                    index_t t2 = tet_adjacent(t, lf);
+
+                    // If t2 is already owned by current thread, then
+                    // its status was previously determined.
+                    if(owns_tet(t2)) {
+                        geo_debug_assert(
+                            tet_is_marked_as_conflict(t2) ==
+                            tet_is_in_conflict(t2,p)
+                        );
+
+                        // If t2 is not in conflict list, then t has a facet
+                        // on the border of the conflict zone, and there is
+                        // a tet to create.
+                        if(!tet_is_marked_as_conflict(t2)) {
+                            ++nb_tets_to_create_;
+                            cavity_.new_facet(
+                                t, lf,
+                                tet_vertex(t, tet_facet_vertex(lf,0)),
+                                tet_vertex(t, tet_facet_vertex(lf,1)),
+                                tet_vertex(t, tet_facet_vertex(lf,2))
+                            );
+                        }
+                        continue;
+                    }
+
+                    if(!acquire_tet(t2)) {
+                        S_.resize(0);
+                        return false;
+                    }
+
+                    geo_debug_assert(owns_tet(t2));
+
+                    if(!tet_is_in_conflict(t2,p)) {
+                        mark_tet_as_neighbor(t2);
+                        // If t2 is not in conflict list, then t has a facet
+                        // on the border of the conflict zone, and there is
+                        // a tet to create.
+                        ++nb_tets_to_create_;
+                    } else {
+                        mark_tet_as_conflict(t2);
+                        geo_debug_assert(owns_tet(t2));
+                        S_.push_back(t2);
+                        continue;
+                    }
+
+                    //  At this point, t is in conflict
+                    // and t2 is not in conflict.
+                    // We keep a reference to a tet on the boundary
+                    t_boundary_ = t;
+                    f_boundary_ = lf;
+                    ++nb_tets_to_create_;
+                    cavity_.new_facet(
+                        t, lf,
+                        tet_vertex(t, tet_facet_vertex(lf,0)),
+                        tet_vertex(t, tet_facet_vertex(lf,1)),
+                        tet_vertex(t, tet_facet_vertex(lf,2))
+                    );
+                    geo_debug_assert(tet_adjacent(t,lf) == t2);
+                    geo_debug_assert(owns_tet(t));
+                    geo_debug_assert(owns_tet(t2));
+                }
+            }
+            return true;
+        }
+
+        double lifted_coordinate(const double* p) const {
+            // Compute the index of the point from its address
+            index_t pindex = index_t(
+                (p - vertex_ptr(0)) / int(vertex_stride_)
+            );
+            return heights_[pindex];
+        }
+
+
+        bool tet_is_in_conflict(index_t t, const double* p) const {
+
+            // Lookup tetrahedron vertices
+            const double* pv[4];
+            for(index_t i=0; i<4; ++i) {
+                index_t v = tet_vertex(t,i);
+                pv[i] = (v == NO_INDEX) ? nullptr : vertex_ptr(v);
+            }
+
+            // Check for virtual tetrahedra (then in_sphere()
+            // is replaced with orient3d())
+            for(index_t lf = 0; lf < 4; ++lf) {
+
+                if(pv[lf] == nullptr) {
+
+                    // Facet of a virtual tetrahedron opposite to
+                    // infinite vertex corresponds to
+                    // the triangle on the convex hull of the points.
+                    // Orientation is obtained by replacing vertex lf
+                    // with p.
+                    pv[lf] = p;
+                    Sign sign = PCK::orient_3d(pv[0],pv[1],pv[2],pv[3]);
+
+                    if(sign > 0) {
+                        return true;
+                    }
+
+                    if(sign < 0) {
+                        return false;
+                    }
+
+                    // If sign is zero, we check the real tetrahedron
+                    // adjacent to the facet on the convex hull.
+                    geo_debug_assert(tet_adjacent(t, lf) != NO_INDEX);
+                    index_t t2 = tet_adjacent(t, lf);
+                    geo_debug_assert(!tet_is_virtual(t2));
+
+                    //   If t2 was already visited by this thread, then
+                    // it is in conflict if it is already marked.
+                    if(owns_tet(t2)) {
+                        return tet_is_marked_as_conflict(t2);
+                    }
+
+                    //  If t2 was not already visited, then we need to
+                    // switch to the in_circum_circle_3d() predicate.
+
+                    const double* q0 = pv[(lf+1)%4];
+                    const double* q1 = pv[(lf+2)%4];
+                    const double* q2 = pv[(lf+3)%4];
+
+                    if(weighted_) {
+                        return (
+                            PCK::in_circle_3dlifted_SOS(
+                                q0, q1, q2, p,
+                                lifted_coordinate(q0),
+                                lifted_coordinate(q1),
+                                lifted_coordinate(q2),
+                                lifted_coordinate(p)
+                            ) > 0
+                        );
+                    } else {
+                        return (
+                            PCK::in_circle_3d_SOS(
+                                q0,q1,q2,p
+                            ) > 0
+                        );
+                    }
+                }
+            }
+
+            //   If the tetrahedron is a finite one, it is in conflict
+            // if its circumscribed sphere contains the point (this is
+            // the standard case).
+
+            if(weighted_) {
+                double h0 = heights_[finite_tet_vertex(t, 0)];
+                double h1 = heights_[finite_tet_vertex(t, 1)];
+                double h2 = heights_[finite_tet_vertex(t, 2)];
+                double h3 = heights_[finite_tet_vertex(t, 3)];
+                double h = lifted_coordinate(p);
+                return (PCK::orient_3dlifted_SOS(
+                            pv[0],pv[1],pv[2],pv[3],p,h0,h1,h2,h3,h
+                        ) > 0) ;
+            }
+
+            return (PCK::in_sphere_3d_SOS(pv[0], pv[1], pv[2], pv[3], p) > 0);
+        }
+
+
+        index_t locate(
+            const double* p, index_t hint = NO_TETRAHEDRON,
+            Sign* orient = nullptr
+        ) {
+            //   Try improving the hint by using the
+            // inexact locate function. This gains
+            // (a little bit) performance (a few
+            // percent in total Delaunay computation
+            // time), but it is better than nothing...
+            //   Note: there is a maximum number of tets
+            // traversed by locate_inexact()  (2500)
+            // since there exists configurations in which
+            // locate_inexact() loops forever !
+
+            {
+                index_t new_hint = locate_inexact(p, hint, 2500);
+
+                if(new_hint == NO_TETRAHEDRON) {
+                    return NO_TETRAHEDRON;
+                }
+
+                hint = new_hint;
+            }
+
+            // If no hint specified, find a tetrahedron randomly
+
+            if(hint != NO_TETRAHEDRON) {
+                if(tet_is_free(hint)) {
+                    hint = NO_TETRAHEDRON;
+                } else {
+                    if( !owns_tet(hint) && !acquire_tet(hint) ) {
+                        hint = NO_TETRAHEDRON;
+                    }
+                    if((hint != NO_TETRAHEDRON) && tet_is_free(hint)) {
+                        release_tet(hint);
+                        hint = NO_TETRAHEDRON;
+                    }
+                }
+            }
+
+            do {
+                if(hint == NO_TETRAHEDRON) {
+                    hint = thread_safe_random(max_used_t_);
+                }
+                if(
+                    tet_is_free(hint) ||
+                    (!owns_tet(hint) && !acquire_tet(hint))
+                ) {
+                    if(owns_tet(hint)) {
+                        release_tet(hint);
+                    }
+                    hint = NO_TETRAHEDRON;
+                } else {
+                    for(index_t f=0; f<4; ++f) {
+                        if(tet_vertex(hint,f) == VERTEX_AT_INFINITY) {
+                            index_t new_hint = tet_adjacent(hint,f);
+                            if(
+                                tet_is_free(new_hint) ||
+                                !acquire_tet(new_hint)
+                            ) {
+                                new_hint = NO_TETRAHEDRON;
+                            }
+                            release_tet(hint);
+                            hint = new_hint;
+                            break;
+                        }
+                    }
+                }
+            } while(hint == NO_TETRAHEDRON) ;
+
+            index_t t = hint;
+            index_t t_pred = NO_TETRAHEDRON;
+            Sign orient_local[4];
+            if(orient == nullptr) {
+                orient = orient_local;
+            }
+
+
+        still_walking:
+            {
+                if(t_pred != NO_TETRAHEDRON) {
+                    release_tet(t_pred);
+                }
+
+                if(tet_is_free(t)) {
+                    return NO_TETRAHEDRON;
+                }
+
+                if(!owns_tet(t) && !acquire_tet(t)) {
+                    return NO_TETRAHEDRON;
+                }
+
+
+                if(!tet_is_real(t)) {
+                    release_tet(t);
+                    return NO_TETRAHEDRON;
+                }
+
+                const double* pv[4];
+                pv[0] = vertex_ptr(finite_tet_vertex(t,0));
+                pv[1] = vertex_ptr(finite_tet_vertex(t,1));
+                pv[2] = vertex_ptr(finite_tet_vertex(t,2));
+                pv[3] = vertex_ptr(finite_tet_vertex(t,3));
+
+                // Start from a random facet
+                index_t f0 = thread_safe_random_4();
+                for(index_t df = 0; df < 4; ++df) {
+                    index_t f = (f0 + df) % 4;
+
+                    index_t t_next = tet_adjacent(t,f);
+
+                    //  If the opposite tet is -1, then it means that
+                    // we are trying to locate() (e.g. called from
+                    // nearest_vertex) within a tetrahedralization
+                    // from which the infinite tets were removed.
+                    if(t_next == NO_INDEX) {
+                        release_tet(t);
+                        return NO_TETRAHEDRON;
+                    }
+
+                    //   If the candidate next tetrahedron is the
+                    // one we came from, then we know already that
+                    // the orientation is positive, thus we examine
+                    // the next candidate (or exit the loop if they
+                    // are exhausted).
+                    if(t_next == t_pred) {
+                        orient[f] = POSITIVE ;
+                        continue ;
+                    }
+
+                    //   To test the orientation of p w.r.t. the facet f of
+                    // t, we replace vertex number f with p in t (same
+                    // convention as in CGAL).
+                    // This is equivalent to tet_facet_point_orient3d(t,f,p)
+                    // (but less costly, saves a couple of lookups)
+                    const double* pv_bkp = pv[f];
+                    pv[f] = p;
+                    orient[f] = PCK::orient_3d(pv[0], pv[1], pv[2], pv[3]);
+
+                    //   If the orientation is not negative, then we cannot
+                    // walk towards t_next, and examine the next candidate
+                    // (or exit the loop if they are exhausted).
+                    if(orient[f] != NEGATIVE) {
+                        pv[f] = pv_bkp;
+                        continue;
+                    }
+
+                    //  If the opposite tet is a virtual tet, then
+                    // the point has a positive orientation relative
+                    // to the facet on the border of the convex hull,
+                    // thus t_next is a tet in conflict and we are
+                    // done.
+                    if(tet_is_virtual(t_next)) {
+                        release_tet(t);
+                        if(!acquire_tet(t_next)) {
+                            return NO_TETRAHEDRON;
+                        }
+                        for(index_t lf = 0; lf < 4; ++lf) {
+                            orient[lf] = POSITIVE;
+                        }
+                        return t_next;
+                    }
+
+                    //   If we reach this point, then t_next is a valid
+                    // successor, thus we are still walking.
+                    t_pred = t;
+                    t = t_next;
+                    goto still_walking;
+                }
+            }
+
+            //   If we reach this point, we did not find a valid successor
+            // for walking (a face for which p has negative orientation),
+            // thus we reached the tet for which p has all positive
+            // face orientations (i.e. the tet that contains p).
+
+#ifdef GEO_DEBUG
+            geo_debug_assert(tet_is_real(t));
+
+            const double* pv[4];
+            Sign signs[4];
+            pv[0] = vertex_ptr(finite_tet_vertex(t,0));
+            pv[1] = vertex_ptr(finite_tet_vertex(t,1));
+            pv[2] = vertex_ptr(finite_tet_vertex(t,2));
+            pv[3] = vertex_ptr(finite_tet_vertex(t,3));
+            for(index_t f=0; f<4; ++f) {
+                const double* pv_bkp = pv[f];
+                pv[f] = p;
+                signs[f] = PCK::orient_3d(pv[0], pv[1], pv[2], pv[3]);
+                geo_debug_assert(signs[f] >= 0);
+                pv[f] = pv_bkp;
+            }
+#endif
+
+            return t;
+        }
+
+
+    protected:
+
+        bool tet_is_marked_as_conflict(index_t t) const {
+            geo_debug_assert(owns_tet(t));
+            return cell_status_.cell_is_marked_as_conflict(t);
+        }
+
+
+        index_t nb_tets_in_conflict() const {
+            return tets_to_delete_.size();
+        }
+
+        void mark_tet_as_conflict(index_t t) {
+            geo_debug_assert(owns_tet(t));
+            tets_to_delete_.push_back(t);
+            cell_status_.mark_cell_as_conflict(t);
+            geo_debug_assert(owns_tet(t));
+            geo_debug_assert(tet_is_marked_as_conflict(t));
+        }
+
+        void mark_tet_as_neighbor(index_t t) {
+            //   Note: nothing to change in cell_status_[t]
+            // since LSB=0 means neigbhor tet.
+            tets_to_release_.push_back(t);
+        }
+
+        void acquire_and_mark_tet_as_created(index_t t) {
+            //  The tet was created in this thread's tet pool,
+            // therefore there is no need to use sync
+            // primitives to acquire a lock on it.
+            geo_debug_assert(cell_status_.cell_thread(t) == NO_THREAD);
+            cell_status_.set_cell_status(
+		t, CellStatusArray::thread_index_t(id())
+	    );
+#ifdef GEO_DEBUG
+            ++nb_acquired_tets_;
+#endif
+            tets_to_release_.push_back(t);
+        }
+
+
+        void release_tets() {
+            for(index_t i=0; i<tets_to_release_.size(); ++i) {
+                release_tet(tets_to_release_[i]);
+            }
+            tets_to_release_.resize(0);
+            for(index_t i=0; i<tets_to_delete_.size(); ++i) {
+                release_tet(tets_to_delete_[i]);
+            }
+            tets_to_delete_.resize(0);
+        }
+
+        bool acquire_tet(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(!owns_tet(t));
+
+            interfering_thread_ = cell_status_.acquire_cell(
+                t, CellStatusArray::thread_index_t(id())
+            );
+
+            if(interfering_thread_ == NO_THREAD) {
+                geo_debug_assert(t == first_free_ || !tet_is_in_list(t));
+#ifdef GEO_DEBUG
+                ++nb_acquired_tets_;
+#endif
+                return true;
+            }
+            return false;
+        }
+
+        void release_tet(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(owns_tet(t));
+#ifdef GEO_DEBUG
+            --nb_acquired_tets_;
+#endif
+            cell_status_.release_cell(t);
+        }
+
+
+        bool owns_tet(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return (
+		cell_status_.cell_thread(t) ==
+		CellStatusArray::thread_index_t(id())
+	    );
+        }
+
+        index_t locate_inexact(
+            const double* p, index_t hint, index_t max_iter
+        ) const {
+            // If no hint specified, find a tetrahedron randomly
+            while(hint == NO_TETRAHEDRON) {
+                hint = thread_safe_random(max_used_t_);
+                if(tet_is_free(hint) || tet_thread(hint) != NO_THREAD) {
+                    hint = NO_TETRAHEDRON;
+                }
+            }
+
+            //  Always start from a real tet. If the tet is virtual,
+            // find its real neighbor (always opposite to the
+            // infinite vertex)
+            if(tet_is_virtual(hint)) {
+                for(index_t lf = 0; lf < 4; ++lf) {
+                    if(tet_vertex(hint, lf) == VERTEX_AT_INFINITY) {
+                        hint = tet_adjacent(hint, lf);
+
+                        // Yes, this can happen if the tetrahedron was
+                        // modified by another thread in the meanwhile.
+                        if(hint == NO_TETRAHEDRON) {
+                            return NO_TETRAHEDRON;
+                        }
+
+                        break;
+                    }
+                }
+            }
+
+            index_t t = hint;
+            index_t t_pred = NO_TETRAHEDRON;
+
+        still_walking:
+            {
+
+                // Lookup the vertices of the current tetrahedron.
+                const double* pv[4];
+                for(index_t lv=0; lv<4; ++lv) {
+                    index_t iv = tet_vertex(t,lv);
+
+                    // Since we did not acquire any lock,
+                    // it is possible that another threads made
+                    // this tetrahedron virtual (in this case
+                    // we exit immediately).
+                    if(iv == NO_INDEX) {
+                        return NO_TETRAHEDRON;
+                    }
+                    pv[lv] = vertex_ptr(iv);
+                }
+
+                for(index_t f = 0; f < 4; ++f) {
+
+                    index_t t_next = tet_adjacent(t,f);
+
+                    //  If the opposite tet is -1, then it means that
+                    // we are trying to locate() (e.g. called from
+                    // nearest_vertex) within a tetrahedralization
+                    // from which the infinite tets were removed.
+                    if(t_next == NO_INDEX) {
+                        return NO_TETRAHEDRON;
+                    }
+
+                    //   If the candidate next tetrahedron is the
+                    // one we came from, then we know already that
+                    // the orientation is positive, thus we examine
+                    // the next candidate (or exit the loop if they
+                    // are exhausted).
+                    if(t_next == t_pred) {
+                        continue ;
+                    }
+
+                    //   To test the orientation of p w.r.t. the facet f of
+                    // t, we replace vertex number f with p in t (same
+                    // convention as in CGAL).
+                    const double* pv_bkp = pv[f];
+                    pv[f] = p;
+                    Sign ori = PCK::orient_3d_inexact(
+                        pv[0], pv[1], pv[2], pv[3]
+                    );
+
+                    //   If the orientation is not negative, then we cannot
+                    // walk towards t_next, and examine the next candidate
+                    // (or exit the loop if they are exhausted).
+                    if(ori != NEGATIVE) {
+                        pv[f] = pv_bkp;
+                        continue;
+                    }
+
+                    //  If the opposite tet is a virtual tet, then
+                    // the point has a positive orientation relative
+                    // to the facet on the border of the convex hull,
+                    // thus t_next is a tet in conflict and we are
+                    // done.
+                    if(tet_is_virtual(t_next)) {
+                        return t_next;
+                    }
+
+                    //   If we reach this point, then t_next is a valid
+                    // successor, thus we are still walking.
+                    t_pred = t;
+                    t = t_next;
+                    if(--max_iter != 0) {
+                        goto still_walking;
+                    }
+                }
+            }
+
+            //   If we reach this point, we did not find a valid successor
+            // for walking (a face for which p has negative orientation),
+            // thus we reached the tet for which p has all positive
+            // face orientations (i.e. the tet that contains p).
+
+            return t;
+        }
+
+
+        bool tet_is_virtual(index_t t) const {
+            return
+                !tet_is_free(t) && (
+                    cell_to_v_store_[4 * t] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 1] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 2] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 3] == VERTEX_AT_INFINITY) ;
+        }
+
+
+        static index_t tet_facet_vertex(index_t f, index_t v) {
+            geo_debug_assert(f < 4);
+            geo_debug_assert(v < 3);
+            return index_t(tet_facet_vertex_[f][v]);
+        }
+
+        index_t tet_vertex(index_t t, index_t lv) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            return cell_to_v_store_[4 * t + lv];
+        }
+
+        index_t find_tet_vertex(index_t t, index_t v) const {
+            geo_debug_assert(t < max_t());
+            //   Find local index of v in tetrahedron t vertices.
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+            return find_4(T,v);
+        }
+
+
+        index_t finite_tet_vertex(index_t t, index_t lv) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            geo_debug_assert(cell_to_v_store_[4 * t + lv] != NO_INDEX);
+            return cell_to_v_store_[4 * t + lv];
+        }
+
+        void set_tet_vertex(index_t t, index_t lv, index_t v) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            geo_debug_assert(owns_tet(t));
+            cell_to_v_store_[4 * t + lv] = v;
+        }
+
+        index_t tet_adjacent(index_t t, index_t lf) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lf < 4);
+            index_t result = cell_to_cell_store_[4 * t + lf];
+            return result;
+        }
+
+        void set_tet_adjacent(index_t t1, index_t lf1, index_t t2) {
+            geo_debug_assert(t1 < max_t());
+            geo_debug_assert(t2 < max_t());
+            geo_debug_assert(lf1 < 4);
+            geo_debug_assert(owns_tet(t1));
+            geo_debug_assert(owns_tet(t2));
+            cell_to_cell_store_[4 * t1 + lf1] = t2;
+        }
+
+        index_t find_tet_adjacent(index_t t1, index_t t2) const {
+            geo_debug_assert(t1 < max_t());
+            geo_debug_assert(t2 < max_t());
+            geo_debug_assert(t1 != t2);
+
+            // Find local index of t2 in tetrahedron t1 adajcent tets.
+            const index_t* T = &(cell_to_cell_store_[4 * t1]);
+            index_t result = find_4(T,t2);
+
+            // Sanity check: make sure that t1 is adjacent to t2
+            // only once!
+            geo_debug_assert(tet_adjacent(t1,(result+1)%4) != t2);
+            geo_debug_assert(tet_adjacent(t1,(result+2)%4) != t2);
+            geo_debug_assert(tet_adjacent(t1,(result+3)%4) != t2);
+            return result;
+        }
+
+
+        index_t get_facet_by_halfedge(
+            index_t t, index_t v1, index_t v2
+        ) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(v1 != v2);
+            //   Find local index of v1 and v2 in tetrahedron t
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+            index_t lv1 = find_4(T,v1);
+            index_t lv2 = find_4(T,v2);
+            geo_debug_assert(lv1 != lv2);
+            return index_t(halfedge_facet_[lv1][lv2]);
+        }
+
+
+        void get_facets_by_halfedge(
+            index_t t, index_t v1, index_t v2,
+            index_t& f12, index_t& f21
+        ) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(v1 != v2);
+
+            //   Find local index of v1 and v2 in tetrahedron t
+            // The following expression is 10% faster than using
+            // if() statements (multiply by boolean result of test).
+            // Thank to Laurent Alonso for this idea.
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+
+            index_t lv1 =
+                index_t((T[1] == v1) | ((T[2] == v1) * 2) | ((T[3] == v1) * 3));
+
+            index_t lv2 =
+                index_t((T[1] == v2) | ((T[2] == v2) * 2) | ((T[3] == v2) * 3));
+
+            geo_debug_assert(lv1 != 0 || T[0] == v1);
+            geo_debug_assert(lv2 != 0 || T[0] == v2);
+            geo_debug_assert(lv1 != NO_INDEX);
+            geo_debug_assert(lv2 != NO_INDEX);
+            geo_debug_assert(lv1 != lv2);
+
+            f12 = index_t(halfedge_facet_[lv1][lv2]);
+            f21 = index_t(halfedge_facet_[lv2][lv1]);
+        }
+
+        static constexpr index_t END_OF_LIST = NO_INDEX;
+
+
+        static constexpr index_t NOT_IN_LIST = index_t(-2);
+
+	static constexpr index_t VERTEX_OF_DELETED_TET = index_t(-2);
+
+        index_t nb_vertices() const {
+            return nb_vertices_;
+        }
+
+        const double* vertex_ptr(index_t i) const {
+            geo_debug_assert(i < nb_vertices());
+            return vertices_ + vertex_stride_ * i;
+        }
+
+        bool tet_is_in_list(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return (cell_next_[t] != NOT_IN_LIST);
+        }
+
+        index_t tet_next(index_t t) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(tet_is_in_list(t));
+            return cell_next_[t];
+        }
+
+
+        index_t tet_thread(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return cell_status_.cell_thread(t);
+        }
+
+        void add_tet_to_list(index_t t, index_t& first, index_t& last) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(!tet_is_in_list(t));
+            geo_debug_assert(owns_tet(t));
+            if(last == END_OF_LIST) {
+                geo_debug_assert(first == END_OF_LIST);
+                first = last = t;
+                cell_next_[t] = END_OF_LIST;
+            } else {
+                cell_next_[t] = first;
+                first = t;
+            }
+        }
+
+        void remove_tet_from_list(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(tet_is_in_list(t));
+            geo_debug_assert(owns_tet(t));
+            cell_next_[t] = NOT_IN_LIST;
+        }
+
+
+        index_t new_tetrahedron() {
+
+            // If the memory pool is full, then we expand it.
+            // This cannot be done when running multiple threads.
+            if(first_free_ == END_OF_LIST) {
+                geo_debug_assert(!Process::is_running_threads());
+                master_->cell_to_v_store_.resize(
+                    master_->cell_to_v_store_.size() + 4, NO_INDEX
+                );
+                master_->cell_to_cell_store_.resize(
+                    master_->cell_to_cell_store_.size() + 4, NO_INDEX
+                );
+                master_->cell_next_.push_back(END_OF_LIST);
+                master_->cell_status_.grow();
+                ++nb_free_;
+                ++max_t_;
+                first_free_ = master_->cell_status_.size() - 1;
+            }
+
+            acquire_and_mark_tet_as_created(first_free_);
+            index_t result = first_free_;
+
+            first_free_ = tet_next(first_free_);
+            remove_tet_from_list(result);
+
+            cell_to_cell_store_[4 * result] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 1] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 2] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 3] = NO_INDEX;
+
+            max_used_t_ = std::max(max_used_t_, result);
+
+            --nb_free_;
+            return result;
+        }
+
+        index_t new_tetrahedron(index_t v1, index_t v2, index_t v3, index_t v4) {
+            index_t result = new_tetrahedron();
+            cell_to_v_store_[4 * result] = v1;
+            cell_to_v_store_[4 * result + 1] = v2;
+            cell_to_v_store_[4 * result + 2] = v3;
+            cell_to_v_store_[4 * result + 3] = v4;
+            return result;
+        }
+
+        static index_t find_4(const index_t* T, index_t v) {
+            // The following expression is 10% faster than using
+            // if() statements. This uses the C++ norm, that
+            // ensures that the 'true' boolean value converted to
+            // an int is always 1. With most compilers, this avoids
+            // generating branching instructions.
+            // Thank to Laurent Alonso for this idea.
+            // Note: Laurent also has this version:
+            //    (T[0] != v)+(T[2]==v)+2*(T[3]==v)
+            // that avoids a *3 multiply, but it is not faster in
+            // practice.
+            index_t result = index_t(
+                (T[1] == v) | ((T[2] == v) * 2) | ((T[3] == v) * 3)
+            );
+            // Sanity check, important if it was T[0], not explicitly
+            // tested (detects input that does not meet the precondition).
+            geo_debug_assert(T[result] == v);
+            return result;
+        }
+
+        void send_event() {
+            cond_.notify_all();
+        }
+
+        void wait_for_event(index_t t) {
+            // Fixed by Hiep Vu: enlarged critical section (contains
+            // now the test (!thrd->finished)
+            Delaunay3dThread* thrd = thread(t);
+            // RAII: ctor locks, dtor unlocks
+            std::unique_lock<std::mutex> L(thrd->mutex_);
+            if(!thrd->finished_) {
+                thrd->cond_.wait(L);
+            }
+        }
+
+        
+
+        class StellateConflictStack {
+        public:
+
+            void push(index_t t1, index_t t1fbord, index_t t1fprev) {
+                store_.resize(store_.size()+1);
+                top().t1 = t1;
+                top().t1fbord = Numeric::uint8(t1fbord);
+                top().t1fprev = Numeric::uint8(t1fprev);
+            }
+
+            void save_locals(index_t new_t, index_t t1ft2, index_t t2ft1) {
+                geo_debug_assert(!empty());
+                top().new_t = new_t;
+                top().t1ft2 = Numeric::uint8(t1ft2);
+                top().t2ft1 = Numeric::uint8(t2ft1);
+            }
+
+            void get_parameters(
+                index_t& t1, index_t& t1fbord, index_t& t1fprev
+            ) const {
+                geo_debug_assert(!empty());
+                t1      = top().t1;
+                t1fbord = index_t(top().t1fbord);
+                t1fprev = index_t(top().t1fprev);
+            }
+
+
+            void get_locals(
+                index_t& new_t, index_t& t1ft2, index_t& t2ft1
+            ) const {
+                geo_debug_assert(!empty());
+                new_t = top().new_t;
+                t1ft2 = index_t(top().t1ft2);
+                t2ft1 = index_t(top().t2ft1);
+            }
+
+            void pop() {
+                geo_debug_assert(!empty());
+                store_.pop_back();
+            }
+
+            bool empty() const {
+                return store_.empty();
+            }
+
+        private:
+
+            struct Frame {
+                // Parameters
+                index_t t1;
+                index_t new_t;
+                Numeric::uint8 t1fbord ;
+
+                // Local variables
+                Numeric::uint8 t1fprev ;
+                Numeric::uint8 t1ft2   ;
+                Numeric::uint8 t2ft1   ;
+            };
+
+            Frame& top() {
+                geo_debug_assert(!empty());
+                return *store_.rbegin();
+            }
+
+            const Frame& top() const {
+                geo_debug_assert(!empty());
+                return *store_.rbegin();
+            }
+
+            std::vector<Frame> store_;
+        };
+
+        index_t stellate_conflict_zone_iterative(
+            index_t v, index_t t1, index_t t1fbord,
+            index_t t1fprev = NO_INDEX
+        ) {
+            //   This function is de-recursified because some degenerate
+            // inputs can cause stack overflow (system stack is limited to
+            // a few megs). For instance, it can happen when a large number
+            // of points are on the same sphere exactly.
+
+            //   To de-recursify, it uses class StellateConflictStack
+            // that emulates system's stack for storing functions's
+            // parameters and local variables in all the nested stack
+            // frames.
+
+            S2_.push(t1, t1fbord, t1fprev);
+
+            index_t new_t;   // the newly created tetrahedron.
+
+            index_t t1ft2;   // traverses the 4 facets of t1.
+
+            index_t t2;      // the tetrahedron on the border of
+                             // the conflict zone that shares an
+                             // edge with t1 along t1ft2.
+
+            index_t t2fbord; // the facet of t2 on the border of
+                             // the conflict zone.
+
+            index_t t2ft1;   // the facet of t2 that is incident to t1.
+
+        entry_point:
+            S2_.get_parameters(t1, t1fbord, t1fprev);
+
+
+            geo_debug_assert(owns_tet(t1));
+            geo_debug_assert(tet_adjacent(t1,t1fbord) != NO_INDEX);
+            geo_debug_assert(owns_tet(tet_adjacent(t1,t1fbord)));
+            geo_debug_assert(tet_is_marked_as_conflict(t1));
+            geo_debug_assert(
+		!tet_is_marked_as_conflict(tet_adjacent(t1,t1fbord))
+            );
+
+            // Create new tetrahedron with same vertices as t_bndry
+            new_t = new_tetrahedron(
+                tet_vertex(t1,0),
+                tet_vertex(t1,1),
+                tet_vertex(t1,2),
+                tet_vertex(t1,3)
+            );
+
+            // Replace in new_t the vertex opposite to t1fbord with v
+            set_tet_vertex(new_t, t1fbord, v);
+
+            // Connect new_t with t1's neighbor accros t1fbord
+            {
+                index_t tbord = tet_adjacent(t1,t1fbord);
+                set_tet_adjacent(new_t, t1fbord, tbord);
+                set_tet_adjacent(tbord, find_tet_adjacent(tbord,t1), new_t);
+            }
+
+            //  Lookup new_t's neighbors accros its three other
+            // facets and connect them
+            for(t1ft2=0; t1ft2<4; ++t1ft2) {
+
+                if(t1ft2 == t1fprev || tet_adjacent(new_t,t1ft2) != NO_INDEX) {
+                    continue;
+                }
+
+                // Get t1's neighbor along the border of the conflict zone
+                if(!get_neighbor_along_conflict_zone_border(
+                       t1,t1fbord,t1ft2, t2,t2fbord,t2ft1
+                   )) {
+                    //   If t1's neighbor is not a new tetrahedron,
+                    // create a new tetrahedron through a recursive call.
+                    S2_.save_locals(new_t, t1ft2, t2ft1);
+                    S2_.push(t2, t2fbord, t2ft1);
+                    goto entry_point;
+
+                return_point:
+                    // This is the return value of the called function.
+                    index_t result = new_t;
+                    S2_.pop();
+
+                    // Special case: we were in the outermost frame,
+                    // then we (truly) return from the function.
+                    if(S2_.empty()) {
+                        return result;
+                    }
+
+                    S2_.get_parameters(t1, t1fbord, t1fprev);
+                    S2_.get_locals(new_t, t1ft2, t2ft1);
+                    t2 = result;
+                }
+
+                set_tet_adjacent(t2, t2ft1, new_t);
+                set_tet_adjacent(new_t, t1ft2, t2);
+            }
+
+            // Except for the initial call (see "Special case" above),
+            // the nested calls all come from the same location,
+            // thus there is only one possible return point
+            // (no need to push any return address).
+            goto return_point;
+        }
+
+        bool get_neighbor_along_conflict_zone_border(
+            index_t t1,
+            index_t t1fborder,
+            index_t t1ft2,
+            index_t& t2,
+            index_t& t2fborder,
+            index_t& t2ft1
+        ) const {
+
+            // Note: this function is a bit long for an inline function,
+            // but I observed a (modest) performance gain doing so.
+
+            //   Find two vertices that are both on facets new_f and f1
+            //  (the edge around which we are turning)
+            //  This uses duality as follows:
+            //  Primal form (not used here):
+            //    halfedge_facet_[v1][v2] returns a facet that is incident
+            //    to both v1 and v2.
+            //  Dual form (used here):
+            //    halfedge_facet_[f1][f2] returns a vertex that both
+            //    f1 and f2 are incident to.
+            index_t ev1 =
+                tet_vertex(t1, index_t(halfedge_facet_[t1ft2][t1fborder]));
+            index_t ev2 =
+                tet_vertex(t1, index_t(halfedge_facet_[t1fborder][t1ft2]));
+
+            //   Turn around edge [ev1,ev2] inside the conflict zone
+            // until we reach again the boundary of the conflict zone.
+            // Traversing inside the conflict zone is faster (as compared
+            // to outside) since it traverses a smaller number of tets.
+            index_t cur_t = t1;
+            index_t cur_f = t1ft2;
+            index_t next_t = tet_adjacent(cur_t,cur_f);
+            while(tet_is_marked_as_conflict(next_t)) {
+                geo_debug_assert(next_t != t1);
+                cur_t = next_t;
+                cur_f = get_facet_by_halfedge(cur_t,ev1,ev2);
+                next_t = tet_adjacent(cur_t, cur_f);
+            }
+
+            //  At this point, cur_t is in conflict zone and
+            // next_t is outside the conflict zone.
+            index_t f12,f21;
+            get_facets_by_halfedge(next_t, ev1, ev2, f12, f21);
+            t2 = tet_adjacent(next_t,f21);
+            index_t v_neigh_opposite = tet_vertex(next_t,f12);
+            t2ft1 = find_tet_vertex(t2, v_neigh_opposite);
+            t2fborder = cur_f;
+
+            //  Test whether the found neighboring tet was created
+            //  (then return true) or is an old tet in conflict
+            //  (then return false).
+            return(t2 != cur_t);
+        }
+
+        StellateConflictStack S2_;
+
+        
+
+        void show_tet_adjacent(index_t t, index_t lf) const {
+            index_t adj = tet_adjacent(t, lf);
+            if(adj != NO_INDEX) {
+                std::cerr << (tet_is_in_list(adj) ? '*' : ' ');
+            }
+            std::cerr << adj;
+            std::cerr << ' ';
+        }
+
+
+        void show_tet(index_t t) const {
+            std::cerr << "tet"
+                      << (tet_is_in_list(t) ? '*' : ' ')
+                      << t
+                      << ", v=["
+                      << tet_vertex(t, 0)
+                      << ' '
+                      << tet_vertex(t, 1)
+                      << ' '
+                      << tet_vertex(t, 2)
+                      << ' '
+                      << tet_vertex(t, 3)
+                      << "]  adj=[";
+            show_tet_adjacent(t, 0);
+            show_tet_adjacent(t, 1);
+            show_tet_adjacent(t, 2);
+            show_tet_adjacent(t, 3);
+            std::cerr << "] ";
+
+            for(index_t f = 0; f < 4; ++f) {
+                std::cerr << 'f' << f << ':';
+                for(index_t v = 0; v < 3; ++v) {
+                    std::cerr << tet_vertex(t, tet_facet_vertex(f,v))
+                              << ',';
+                }
+                std::cerr << ' ';
+            }
+            std::cerr << std::endl;
+        }
+
+    public:
+
+        void check_combinatorics(bool verbose) const {
+            if(verbose) {
+                std::cerr << std::endl;
+            }
+            bool ok = true;
+            std::vector<bool> v_has_tet(nb_vertices(), false);
+            for(index_t t = 0; t < max_t(); ++t) {
+                if(tet_is_free(t)) {
+                    if(verbose) {
+                        std::cerr << "-Deleted tet: ";
+                        show_tet(t);
+                    }
+                } else {
+                    if(verbose) {
+                        std::cerr << "Checking tet: ";
+                        show_tet(t);
+                    }
+                    for(index_t lf = 0; lf < 4; ++lf) {
+                        if(tet_adjacent(t, lf) == NO_INDEX) {
+                            std::cerr << lf << ":Missing adjacent tet"
+                                      << std::endl;
+                            ok = false;
+                        } else if(tet_adjacent(t, lf) == t) {
+                            std::cerr << lf << ":Tet is adjacent to itself"
+                                      << std::endl;
+                            ok = false;
+                        } else {
+                            index_t t2 = tet_adjacent(t, lf);
+                            bool found = false;
+                            for(index_t lf2 = 0; lf2 < 4; ++lf2) {
+                                if(tet_adjacent(t2, lf2) == t) {
+                                    found = true;
+                                }
+                            }
+                            if(!found) {
+                                std::cerr
+                                    << lf
+                                    << ":Adjacent link is not bidirectional"
+                                    << std::endl;
+                                ok = false;
+                            }
+                        }
+                    }
+                    index_t nb_infinite = 0;
+                    for(index_t lv = 0; lv < 4; ++lv) {
+                        if(tet_vertex(t, lv) == NO_INDEX) {
+                            ++nb_infinite;
+                        }
+                    }
+                    if(nb_infinite > 1) {
+                        ok = false;
+                        std::cerr << "More than one infinite vertex"
+                                  << std::endl;
+                    }
+                }
+                for(index_t lv = 0; lv < 4; ++lv) {
+                    index_t v = tet_vertex(t, lv);
+                    if(v != NO_INDEX && v != VERTEX_OF_DELETED_TET) {
+                        v_has_tet[v] = true;
+                    }
+                }
+            }
+            for(index_t v = 0; v < nb_vertices(); ++v) {
+                if(!v_has_tet[v]) {
+                    if(verbose) {
+                        std::cerr << "Vertex " << v
+                                  << " is isolated (duplicated ?)" << std::endl;
+                    }
+                }
+            }
+            geo_assert(ok);
+            if(verbose) {
+                std::cerr << std::endl;
+            }
+            std::cerr << std::endl << "Delaunay Combi OK" << std::endl;
+        }
+
+
+        void check_geometry(bool verbose) const {
+            bool ok = true;
+            for(index_t t = 0; t < max_t(); ++t) {
+                if(!tet_is_free(t)) {
+                    index_t v0 = tet_vertex(t, 0);
+                    index_t v1 = tet_vertex(t, 1);
+                    index_t v2 = tet_vertex(t, 2);
+                    index_t v3 = tet_vertex(t, 3);
+                    for(index_t v = 0; v < nb_vertices(); ++v) {
+                        if(v == v0 || v == v1 || v == v2 || v == v3) {
+                            continue;
+                        }
+                        if(tet_is_in_conflict(t, vertex_ptr(v))) {
+                            ok = false;
+                            if(verbose) {
+                                std::cerr << "Tet " << t <<
+                                    " is in conflict with vertex " << v
+                                          << std::endl;
+
+                                std::cerr << "  offending tet: ";
+                                show_tet(t);
+                            }
+                        }
+                    }
+                }
+            }
+            geo_assert(ok);
+            std::cerr << std::endl << "Delaunay Geo OK" << std::endl;
+        }
+
+    private:
+        ParallelDelaunay3d* master_;
+        index_t nb_vertices_;
+        const double* vertices_;
+        const double* heights_;
+        index_t* reorder_;
+        index_t dimension_;
+        index_t vertex_stride_;
+        bool weighted_;
+        index_t max_t_;
+        index_t max_used_t_;
+
+        vector<index_t>& cell_to_v_store_;
+        vector<index_t>& cell_to_cell_store_;
+        vector<index_t>& cell_next_;
+        CellStatusArray& cell_status_;
+
+        index_t first_free_;
+        index_t nb_free_;
+        bool memory_overflow_;
+
+        index_t v1_,v2_,v3_,v4_; // The first four vertices
+
+        vector<index_t> S_;
+        index_t nb_tets_to_create_;
+        index_t t_boundary_; // index of a tet,facet on the bndry
+        index_t f_boundary_; // of the conflict zone.
+
+        bool direction_;
+        index_t work_begin_;
+        index_t work_end_;
+        index_t b_hint_;
+        index_t e_hint_;
+        bool finished_;
+
+        //  Whenever acquire_tet() is unsuccessful, contains
+        // the index of the thread that was interfering
+        // (shifted to the left by 1 !!)
+	CellStatusArray::thread_index_t interfering_thread_;
+
+#ifdef GEO_DEBUG
+        index_t nb_acquired_tets_;
+#endif
+
+        vector<index_t> tets_to_delete_;
+        vector<index_t> tets_to_release_;
+
+        index_t nb_rollbacks_;
+        index_t nb_failed_locate_;
+
+        std::condition_variable cond_;
+        std::mutex mutex_;
+
+        static char tet_facet_vertex_[4][3];
+
+        static char halfedge_facet_[4][4];
+
+        Cavity cavity_;
+    };
+
+
+    char Delaunay3dThread::halfedge_facet_[4][4] = {
+        {4, 2, 3, 1},
+        {3, 4, 0, 2},
+        {1, 3, 4, 0},
+        {2, 0, 1, 4}
+    };
+
+    // tet facet vertex is such that the tetrahedron
+    // formed with:
+    //  vertex lv
+    //  tet_facet_vertex[lv][0]
+    //  tet_facet_vertex[lv][1]
+    //  tet_facet_vertex[lv][2]
+    // has the same orientation as the original tetrahedron for
+    // any vertex lv.
+
+    char Delaunay3dThread::tet_facet_vertex_[4][3] = {
+        {1, 2, 3},
+        {0, 3, 2},
+        {3, 0, 1},
+        {1, 0, 2}
+    };
+
+
+    
+
+    ParallelDelaunay3d::ParallelDelaunay3d(
+        coord_index_t dimension
+    ) : Delaunay(dimension) {
+        if(dimension != 3 && dimension != 4) {
+            throw InvalidDimension(dimension, "Delaunay3d", "3 or 4");
+        }
+
+        geo_cite_with_info(
+            "DBLP:journals/cj/Bowyer81",
+            "One of the two initial references to the algorithm, "
+            "discovered independently and simultaneously by Bowyer and Watson."
+        );
+        geo_cite_with_info(
+            "journals/cj/Watson81",
+            "One of the two initial references to the algorithm, "
+            "discovered independently and simultaneously by Bowyer and Watson."
+        );
+        geo_cite_with_info(
+            "DBLP:conf/compgeom/AmentaCR03",
+            "Using spatial sorting has a dramatic impact on the performances."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/comgeo/FunkeMN05",
+            "Initializing \\verb|locate()| with a non-exact version "
+            " (structural filtering) gains (a bit of) performance."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/comgeo/BoissonnatDPTY02",
+            "The idea of traversing the cavity from inside "
+            " used in GEOGRAM is inspired by the implementation of "
+            " \\verb|Delaunay_triangulation_3| in CGAL."
+        );
+        geo_cite_with_info(
+            "DBLP:conf/imr/Si06",
+            "The triangulation data structure used in GEOGRAM is inspired "
+            "by Tetgen."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/ijfcs/DevillersPT02",
+            "Analysis of the different versions of the line walk algorithm "
+            " used by \\verb|locate()|."
+        );
+
+        weighted_ = (dimension == 4);
+        // In weighted mode, vertices are 4d but combinatorics is 3d.
+        if(weighted_) {
+            cell_size_ = 4;
+            cell_v_stride_ = 4;
+            cell_neigh_stride_ = 4;
+        }
+        debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay");
+        verbose_debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay_verbose");
+        debug_mode_ = (debug_mode_ || verbose_debug_mode_);
+        benchmark_mode_ = CmdLine::get_arg_bool("dbg:delaunay_benchmark");
+    }
+
+    void ParallelDelaunay3d::set_vertices(
+        index_t nb_vertices, const double* vertices
+    ) {
+        Stopwatch* W = nullptr ;
+        if(benchmark_mode_) {
+            W = new Stopwatch("DelInternal");
+        }
+
+        if(weighted_) {
+            heights_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                // Client code uses 4d embedding with ti = sqrt(W - wi)
+                //   where W = max(wi)
+                // We recompute the standard "shifted" lifting on
+                // the paraboloid from it.
+                // (we use wi - W, everything is shifted by W, but
+                // we do not care since the power diagram is invariant
+                // by a translation of all weights).
+                double w = -geo_sqr(vertices[4 * i + 3]);
+                heights_[i] = -w +
+                    geo_sqr(vertices[4 * i]) +
+                    geo_sqr(vertices[4 * i + 1]) +
+                    geo_sqr(vertices[4 * i + 2]);
+            }
+        }
+        Delaunay::set_vertices(nb_vertices, vertices);
+
+        index_t expected_tetra = nb_vertices * 7;
+
+        // Allocate the tetrahedra
+        cell_to_v_store_.assign(expected_tetra * 4,NO_INDEX);
+        cell_to_cell_store_.assign(expected_tetra * 4,NO_INDEX);
+        cell_next_.assign(expected_tetra,NO_INDEX);
+        cell_status_.resize(expected_tetra);
+
+        // Reorder the points
+        if(do_reorder_) {
+            compute_BRIO_order(
+                nb_vertices, vertex_ptr(0), reorder_,
+                3, dimension(),
+                64, 0.125,
+                &levels_
+            );
+        } else {
+            reorder_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                reorder_[i] = i;
+            }
+            geo_debug_assert(levels_[0] == 0);
+            geo_debug_assert(levels_[levels_.size()-1] == nb_vertices);
+        }
+
+        double sorting_time = 0;
+        if(benchmark_mode_) {
+            sorting_time = W->elapsed_time();
+            Logger::out("DelInternal1") << "BRIO sorting:"
+                                        << sorting_time
+                                        << std::endl;
+        }
+
+        // Create the threads
+	// The maximum number of threads is limited by the number of bits used by
+	// cell_status_ (see delaunay_sync.h)
+        index_t nb_threads = std::min(
+	    Process::maximum_concurrent_threads(),
+	    CellStatusArray::MAX_THREADS
+	);
+        index_t pool_size = expected_tetra / nb_threads;
+        if (pool_size == 0) {
+            // There are more threads than expected_tetra
+            pool_size = 1;
+            nb_threads = expected_tetra;
+        }
+        index_t pool_begin = 0;
+        threads_.clear();
+        for(index_t t=0; t<nb_threads; ++t) {
+            index_t pool_end =
+                (t == nb_threads - 1) ? expected_tetra : pool_begin + pool_size;
+            threads_.push_back(
+                new Delaunay3dThread(this, pool_begin, pool_end)
+            );
+            pool_begin = pool_end;
+        }
+
+
+        // Create first tetrahedron and triangulate first set of points
+        // in sequential mode.
+
+
+        index_t lvl = 1;
+        while(lvl < (levels_.size() - 1) && levels_[lvl] < 1000) {
+            ++lvl;
+        }
+
+        if(benchmark_mode_) {
+            Logger::out("PDEL")
+                << "Using " << levels_.size()-1 << " levels" << std::endl;
+            Logger::out("PDEL")
+                << "Levels 0 - " << lvl-1
+                << ": bootstraping with first levels in sequential mode"
+                << std::endl;
+        }
+        Delaunay3dThread* thread0 =
+            static_cast<Delaunay3dThread*>(threads_[0].get());
+        thread0->create_first_tetrahedron();
+        thread0->set_work(levels_[0], levels_[lvl]);
+        thread0->run();
+
+        index_t first_lvl = lvl;
+
+        // Insert points in all BRIO levels
+        for(; lvl<levels_.size()-1; ++lvl) {
+
+            if(benchmark_mode_) {
+                Logger::out("PDEL") << "Level "
+                                    << lvl << " : start" << std::endl;
+            }
+
+            index_t lvl_b = levels_[lvl];
+            index_t lvl_e = levels_[lvl+1];
+            index_t work_size = (lvl_e - lvl_b)/index_t(threads_.size());
+
+            // Initialize threads
+            index_t b = lvl_b;
+            for(index_t t=0; t<threads_.size(); ++t) {
+                index_t e = t == threads_.size()-1 ? lvl_e : b+work_size;
+                Delaunay3dThread* thread =
+                    static_cast<Delaunay3dThread*>(threads_[t].get());
+
+                // Copy the indices of the first created tetrahedron
+                // and the maximum valid tetrahedron index max_t_
+                if(lvl == first_lvl && t!=0) {
+                    thread->initialize_from(thread0);
+                }
+                thread->set_work(b,e);
+                b = e;
+            }
+            Process::run_threads(threads_);
+        }
+
+
+        if(benchmark_mode_) {
+            index_t tot_rollbacks = 0 ;
+            index_t tot_failed_locate = 0 ;
+            for(index_t t=0; t<threads_.size(); ++t) {
+                Delaunay3dThread* thread =
+                    static_cast<Delaunay3dThread*>(threads_[t].get());
+                Logger::out("PDEL")
+                    << "thread " << std::setw(3) << t << " : "
+                    << std::setw(3)
+		    << thread->nb_rollbacks() << " rollbacks  "
+                    << std::setw(3)
+		    << thread->nb_failed_locate() << " restarted locate"
+                    << std::endl;
+                tot_rollbacks += thread->nb_rollbacks();
+                tot_failed_locate += thread->nb_failed_locate();
+            }
+            Logger::out("PDEL") << "------------------" << std::endl;
+            Logger::out("PDEL") << "total: "
+                                << tot_rollbacks << " rollbacks  "
+                                << tot_failed_locate << " restarted locate"
+                                << std::endl;
+        }
+
+        // Run threads sequentialy, to insert missing points if
+        // memory overflow was encountered (in sequential mode,
+        // dynamic memory growing works)
+
+        index_t nb_sequential_points = 0;
+        for(index_t t=0; t<threads_.size(); ++t) {
+            Delaunay3dThread* t1 =
+                static_cast<Delaunay3dThread*>(threads_[t].get());
+
+            nb_sequential_points += t1->work_size();
+
+            if(t != 0) {
+                // We need to copy max_t_ from previous thread,
+                // since the memory pool may have grown.
+                Delaunay3dThread* t2 =
+                    static_cast<Delaunay3dThread*>(threads_[t-1].get());
+                t1->initialize_from(t2);
+            }
+            t1->run();
+        }
+
+        //  If some tetrahedra were created in sequential mode, then
+        // the maximum valid tetrahedron index was increased by all
+        // the threads in increasing number, so we copy it from the
+        // last thread into thread0 since we use thread0 afterwards
+        // to do the "compaction" afterwards.
+
+        if(nb_sequential_points != 0) {
+            Delaunay3dThread* t0 =
+                static_cast<Delaunay3dThread*>(threads_[0].get());
+            Delaunay3dThread* tn =
+                static_cast<Delaunay3dThread*>(
+                    threads_[threads_.size()-1].get()
+                );
+            t0->initialize_from(tn);
+        }
+
+
+
+        if(benchmark_mode_) {
+            if(nb_sequential_points != 0) {
+                Logger::out("PDEL") << "Local thread memory overflow occurred:"
+                                    << std::endl;
+                Logger::out("PDEL") << nb_sequential_points
+                                    << " points inserted in sequential mode"
+                                    << std::endl;
+            } else {
+                Logger::out("PDEL")
+                    << "All the points were inserted in parallel mode"
+                    << std::endl;
+            }
+        }
+
+        if(benchmark_mode_) {
+            Logger::out("DelInternal2") << "Core insertion algo:"
+                                        << W->elapsed_time() - sorting_time
+                                        << std::endl;
+        }
+        delete W;
+
+        if(debug_mode_) {
+            for(index_t i=0; i<threads_.size(); ++i) {
+                std::cerr << i << " : " <<
+                    static_cast<Delaunay3dThread*>(threads_[i].get())
+                    ->max_t() << std::endl;
+            }
+
+            thread0->check_combinatorics(verbose_debug_mode_);
+            thread0->check_geometry(verbose_debug_mode_);
+        }
+
+        if(benchmark_mode_) {
+            W = new Stopwatch("DelCompress");
+        }
+
+        //   Compress cell_to_v_store_ and cell_to_cell_store_
+        // (remove free and virtual tetrahedra).
+        //   Since cell_next_ is not used at this point,
+        // we reuse it for storing the conversion array that
+        // maps old tet indices to new tet indices
+        // Note: tet_is_real() uses the previous value of
+        // cell_next(), but we are processing indices
+        // in increasing order and since old2new[t] is always
+        // smaller or equal to t, we never overwrite a value
+        // before needing it.
+
+        vector<index_t>& old2new = cell_next_;
+        index_t nb_tets = 0;
+        index_t nb_tets_to_delete = 0;
+
+        {
+            for(index_t t = 0; t < thread0->max_t(); ++t) {
+                if(
+                    (keep_infinite_ && !thread0->tet_is_free(t)) ||
+                    thread0->tet_is_real(t)
+                ) {
+                    if(t != nb_tets) {
+                        Memory::copy(
+                            &cell_to_v_store_[nb_tets * 4],
+                            &cell_to_v_store_[t * 4],
+                            4 * sizeof(index_t)
+                        );
+                        Memory::copy(
+                            &cell_to_cell_store_[nb_tets * 4],
+                            &cell_to_cell_store_[t * 4],
+                            4 * sizeof(index_t)
+                        );
+                    }
+                    old2new[t] = nb_tets;
+                    ++nb_tets;
+                } else {
+                    old2new[t] = NO_INDEX;
+                    ++nb_tets_to_delete;
+                }
+            }
+
+            cell_to_v_store_.resize(4 * nb_tets);
+            cell_to_cell_store_.resize(4 * nb_tets);
+            for(index_t i = 0; i < 4 * nb_tets; ++i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                // Note: t can be equal to -1 when a real tet is
+                // adjacent to a virtual one (and this is how the
+                // rest of Vorpaline expects to see tets on the
+                // border).
+                geo_debug_assert(!(keep_infinite_ && t == NO_INDEX));
+                cell_to_cell_store_[i] = t;
+            }
+        }
+
+        // In "keep_infinite" mode, we reorder the cells in such
+        // a way that finite cells have indices [0..nb_finite_cells_-1]
+        // and infinite cells have indices [nb_finite_cells_ .. nb_cells_-1]
+
+        if(keep_infinite_) {
+            nb_finite_cells_ = 0;
+            index_t finite_ptr = 0;
+            index_t infinite_ptr = nb_tets - 1;
+            for(;;) {
+                while(thread0->tet_is_finite(finite_ptr)) {
+                    old2new[finite_ptr] = finite_ptr;
+                    ++finite_ptr;
+                    ++nb_finite_cells_;
+                }
+                while(!thread0->tet_is_finite(infinite_ptr)) {
+                    old2new[infinite_ptr] = infinite_ptr;
+                    --infinite_ptr;
+                }
+                if(finite_ptr > infinite_ptr) {
+                    break;
+                }
+                old2new[finite_ptr] = infinite_ptr;
+                old2new[infinite_ptr] = finite_ptr;
+                ++nb_finite_cells_;
+                for(index_t lf=0; lf<4; ++lf) {
+                    std::swap(
+                        cell_to_cell_store_[4*finite_ptr + lf],
+                        cell_to_cell_store_[4*infinite_ptr + lf]
+                    );
+                }
+                for(index_t lv=0; lv<4; ++lv) {
+                    std::swap(
+                        cell_to_v_store_[4*finite_ptr + lv],
+                        cell_to_v_store_[4*infinite_ptr + lv]
+                    );
+                }
+                ++finite_ptr;
+                --infinite_ptr;
+            }
+            for(index_t i = 0; i < 4 * nb_tets; ++i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                geo_debug_assert(t != NO_INDEX);
+                cell_to_cell_store_[i] = t;
+            }
+        }
+
+
+        if(benchmark_mode_) {
+            if(keep_infinite_) {
+                Logger::out("DelCompress")
+                    << "Removed " << nb_tets_to_delete
+                    << " tets (free list)" << std::endl;
+            } else {
+                Logger::out("DelCompress")
+                    << "Removed " << nb_tets_to_delete
+                    << " tets (free list and infinite)" << std::endl;
+            }
+        }
+
+        delete W;
+
+        set_arrays(
+            nb_tets,
+            cell_to_v_store_.data(),
+            cell_to_cell_store_.data()
+        );
+    }
+
+    index_t ParallelDelaunay3d::nearest_vertex(const double* p) const {
+        // TODO
+        return Delaunay::nearest_vertex(p);
+    }
+
+    void ParallelDelaunay3d::set_BRIO_levels(const vector<index_t>& levels) {
+        levels_ = levels;
+    }
+
+
+
+    //   Multithreaded 2d version, same design as Delaunay3dThread:
+    // each thread owns a pool of triangles (free list chained in
+    // cell_next_), locks the triangles it visits in cell_status_ and
+    // rolls back an insertion as soon as it meets a triangle owned
+    // by another thread. The conflict zone of a point is a
+    // topological disk, its boundary is traversed by turning around
+    // the new vertex (as in Delaunay2d::stellate_conflict_zone()).
+
+    class Delaunay2dThread : public GEO::Thread {
+    public:
+
+        static constexpr index_t NO_THREAD = CellStatusArray::FREE_CELL;
+
+        Delaunay2dThread(
+            ParallelDelaunay2d* master,
+            index_t pool_begin,
+            index_t pool_end
+        ) :
+            master_(master),
+            cell_to_v_store_(master_->cell_to_v_store_),
+            cell_to_cell_store_(master_->cell_to_cell_store_),
+            cell_next_(master_->cell_next_),
+            cell_status_(master_->cell_status_)
+            {
+
+                // max_used_t_ is initialized to 1 so that
+                // computing modulos does not trigger FPEs
+                // at the beginning.
+                max_used_t_ = 1;
+                max_t_ = master_->cell_next_.size();
+
+                nb_vertices_ = master_->nb_vertices();
+                vertices_ = master_->vertex_ptr(0);
+                weighted_ = master_->weighted_;
+                heights_ = weighted_ ? master_->heights_.data() : nullptr;
+                vertex_stride_ = master_->dimension();
+                reorder_ = master_->reorder_.data();
+
+                // Initialize free list in memory pool
+                first_free_ = pool_begin;
+                for(index_t t=pool_begin; t<pool_end-1; ++t) {
+                    cell_next_[t] = t+1;
+                }
+                cell_next_[pool_end-1] = END_OF_LIST;
+                nb_free_ = pool_end - pool_begin;
+                memory_overflow_ = false;
+
+                work_begin_ = NO_INDEX;
+                work_end_ = NO_INDEX;
+                finished_ = false;
+                b_hint_ = NO_TRIANGLE;
+                e_hint_ = NO_TRIANGLE;
+                direction_ = true;
+
+#ifdef GEO_DEBUG
+                nb_acquired_triangles_ = 0;
+#endif
+                interfering_thread_ = NO_THREAD;
+
+                nb_rollbacks_ = 0;
+                nb_failed_locate_ = 0;
+
+                nb_triangles_to_create_ = 0;
+                t_boundary_ = NO_TRIANGLE;
+                e_boundary_ = NO_INDEX;
+
+                v1_ = NO_INDEX;
+                v2_ = NO_INDEX;
+                v3_ = NO_INDEX;
+            }
+
+        void initialize_from(const Delaunay2dThread* rhs) {
+            max_used_t_ = rhs->max_used_t_;
+            max_t_ = rhs->max_t_;
+            v1_ = rhs->v1_;
+            v2_ = rhs->v2_;
+            v3_ = rhs->v3_;
+        }
+
+        index_t nb_rollbacks() const {
+            return nb_rollbacks_;
+        }
+
+        index_t nb_failed_locate() const {
+            return nb_failed_locate_;
+        }
+
+        void set_work(index_t b, index_t e) {
+            work_begin_ = b;
+            // e is one position past the last point index
+            // to insert.
+            work_end_ = e-1;
+        }
+
+        index_t work_size() const {
+            if(work_begin_ == NO_INDEX && work_end_ == NO_INDEX) {
+                return 0;
+            }
+            geo_debug_assert(work_begin_ != NO_INDEX);
+            geo_debug_assert(work_end_ != NO_INDEX);
+            return std::max(work_end_ - work_begin_ + 1, index_t(0));
+        }
+
+        Delaunay2dThread* thread(index_t t) {
+            return static_cast<Delaunay2dThread*>(master_->threads_[t].get());
+        }
+
+        void run() override {
+
+            finished_ = false;
+
+            if(work_begin_ == NO_INDEX || work_end_ == NO_INDEX) {
+                return ;
+            }
+
+            memory_overflow_ = false;
+
+            b_hint_ = NO_TRIANGLE;
+            e_hint_ = NO_TRIANGLE;
+
+            // If true, insert in b->e order,
+            // else insert in e->b order
+            direction_ = true;
+
+            while(work_end_ >= work_begin_ && !memory_overflow_) {
+                index_t v = direction_ ? work_begin_ : work_end_ ;
+                index_t& hint = direction_ ? b_hint_ : e_hint_;
+
+                // Try to insert v and update hint
+                bool success = insert(reorder_[v],hint);
+
+                //   Notify all threads that are waiting for
+                // this thread to release some triangles.
+                send_event();
+
+                if(success) {
+                    if(direction_) {
+                        ++work_begin_;
+                    } else {
+                        --work_end_;
+                    }
+                } else {
+                    ++nb_rollbacks_;
+                    if(interfering_thread_ != NO_THREAD) {
+                        if(id() < interfering_thread_) {
+                            // Higher priority: wait for the interfering
+                            // thread to release its triangles, then
+                            // retry the same vertex.
+                            wait_for_event(interfering_thread_);
+                        } else {
+                            // Lower priority: continue from the other
+                            // end of the points sequence.
+                            direction_ = !direction_;
+                        }
+                    }
+                }
+            }
+            finished_ = true;
+
+            // Wake up threads that potentially missed the
+            // previous wake ups.
+            mutex_.lock();
+            send_event();
+            mutex_.unlock();
+        }
+
+        static constexpr index_t NO_TRIANGLE = NO_INDEX;
+
+        static constexpr index_t VERTEX_AT_INFINITY = NO_INDEX;
+
+        index_t max_t() const {
+            return max_t_;
+        }
+
+        bool triangle_is_finite(index_t t) const {
+            return
+                cell_to_v_store_[3 * t]     != NO_INDEX &&
+                cell_to_v_store_[3 * t + 1] != NO_INDEX &&
+                cell_to_v_store_[3 * t + 2] != NO_INDEX ;
+        }
+
+        bool triangle_is_real(index_t t) const {
+            return !triangle_is_free(t) && triangle_is_finite(t);
+        }
+
+        bool triangle_is_free(index_t t) const {
+            return triangle_is_in_list(t);
+        }
+
+        bool triangle_is_virtual(index_t t) const {
+            return
+                !triangle_is_free(t) && (
+                    cell_to_v_store_[3 * t] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[3 * t + 1] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[3 * t + 2] == VERTEX_AT_INFINITY) ;
+        }
+
+        index_t create_first_triangle() {
+            if(nb_vertices() < 3) {
+                return NO_TRIANGLE;
+            }
+
+            index_t iv0 = 0;
+
+            index_t iv1 = 1;
+            while(
+                iv1 < nb_vertices() &&
+                PCK::points_are_identical_2d(
+                    vertex_ptr(iv0), vertex_ptr(iv1)
+                )
+            ) {
+                ++iv1;
+            }
+            if(iv1 == nb_vertices()) {
+                return NO_TRIANGLE;
+            }
+
+            index_t iv2 = iv1 + 1;
+            Sign s = ZERO;
+            while(
+                iv2 < nb_vertices() &&
+                (s = PCK::orient_2d(
+                    vertex_ptr(iv0), vertex_ptr(iv1), vertex_ptr(iv2)
+                )) == ZERO
+            ) {
+                ++iv2;
+            }
+            if(iv2 == nb_vertices()) {
+                return NO_TRIANGLE;
+            }
+
+            if(s == NEGATIVE) {
+                std::swap(iv1, iv2);
+            }
+
+            // Create the first triangle
+            index_t t0 = new_triangle(iv0, iv1, iv2);
+
+            // Create the first three virtual triangles surrounding it
+            index_t t[3];
+            for(index_t e = 0; e < 3; ++e) {
+                // In reverse order since it is an adjacent triangle
+                index_t v1 = triangle_vertex(t0, triangle_edge_vertex(e,1));
+                index_t v2 = triangle_vertex(t0, triangle_edge_vertex(e,0));
+                t[e] = new_triangle(VERTEX_AT_INFINITY, v1, v2);
+            }
+
+            // Connect the virtual triangles to the real one
+            for(index_t e=0; e<3; ++e) {
+                set_triangle_adjacent(t[e], 0, t0);
+                set_triangle_adjacent(t0, e, t[e]);
+            }
+
+            // Interconnect the three virtual triangles along their
+            // common edges
+            for(index_t e = 0; e < 3; ++e) {
+                index_t lv1 = triangle_edge_vertex(e,1);
+                index_t lv2 = triangle_edge_vertex(e,0);
+                set_triangle_adjacent(t[e], 1, t[lv1]);
+                set_triangle_adjacent(t[e], 2, t[lv2]);
+            }
+
+            v1_ = iv0;
+            v2_ = iv1;
+            v3_ = iv2;
+
+            release_triangles();
+
+            return t0;
+        }
+
+        bool insert(index_t v, index_t& hint) {
+
+            // If v is one of the vertices of the
+            // first triangle, nothing to do.
+            if(v == v1_ || v == v2_ || v == v3_) {
+                return true;
+            }
+
+            Sign orient[3];
+            index_t t = locate(vertex_ptr(v),hint,orient);
+
+            //   locate() may fail due to triangles already owned by
+            // other threads.
+            if(t == NO_TRIANGLE) {
+                ++nb_failed_locate_;
+                geo_debug_assert(nb_acquired_triangles_ == 0);
+                return false;
+            }
+
+            // The point already exists if it is located on two
+            // edges of the triangle returned by locate().
+            int nb_zero =
+                (orient[0] == ZERO) +
+                (orient[1] == ZERO) +
+                (orient[2] == ZERO) ;
+
+            if(nb_zero >= 2) {
+                release_triangle(t);
+                return true;
+            }
+
+            geo_debug_assert(nb_acquired_triangles_ == 1);
+
+            index_t t_bndry = NO_TRIANGLE;
+            index_t e_bndry = NO_INDEX;
+
+            bool ok = find_conflict_zone(v,t,t_bndry,e_bndry);
+
+            // When running threads, memory cannot grow and we use
+            // a fixed pool. If it is full, the thread exits and the
+            // missing points are inserted afterwards in sequential mode.
+            if(
+                nb_triangles_to_create_ > nb_free_ &&
+                Process::is_running_threads()
+            ) {
+                memory_overflow_ = true;
+                ok = false;
+            }
+
+            if(!ok) {
+                // Rollback: release everything acquired so far.
+                release_triangles();
+                geo_debug_assert(nb_acquired_triangles_ == 0);
+                return false;
+            }
+
+            // The conflict list can be empty if
+            //  the triangulation is weighted and v is not visible
+            if(triangles_to_delete_.size() == 0) {
+                release_triangles();
+                geo_debug_assert(nb_acquired_triangles_ == 0);
+                return true;
+            }
+
+            //   At this point, this thread owns all the triangles in
+            // conflict and their neighbors, therefore no other thread
+            // can interfere, and we can update the triangulation.
+
+            index_t new_t = stellate_conflict_zone(v,t_bndry,e_bndry);
+
+            // Recycle the triangles of the conflict zone.
+            for(index_t i=0; i+1<triangles_to_delete_.size(); ++i) {
+                cell_next_[triangles_to_delete_[i]] =
+                    triangles_to_delete_[i+1];
+            }
+            cell_next_[triangles_to_delete_[triangles_to_delete_.size()-1]] =
+                first_free_;
+            first_free_ = triangles_to_delete_[0];
+            nb_free_ += triangles_to_delete_.size();
+
+            // Return one of the newly created triangles
+            hint = new_t;
+
+            release_triangles();
+
+            geo_debug_assert(nb_acquired_triangles_ == 0);
+            return true;
+        }
+
+        bool find_conflict_zone(
+            index_t v, index_t t,
+            index_t& t_bndry, index_t& e_bndry
+        ) {
+            nb_triangles_to_create_ = 0;
+
+            geo_debug_assert(t != NO_TRIANGLE);
+            geo_debug_assert(owns_triangle(t));
+
+            const double* p = vertex_ptr(v);
+
+            //  Weighted triangulations can have dangling
+            // vertices, not in conflict with the triangle
+            // returned by locate().
+            if(weighted_ && !triangle_is_in_conflict(t,p)) {
+                release_triangle(t);
+                return true;
+            }
+
+            mark_triangle_as_conflict(t);
+
+            bool result = find_conflict_zone_iterative(p,t);
+            t_bndry = t_boundary_;
+            e_bndry = e_boundary_;
+            return result;
+        }
+
+        bool find_conflict_zone_iterative(const double* p, index_t t_in) {
+            geo_debug_assert(owns_triangle(t_in));
+            S_.push_back(t_in);
+
+            while(S_.size() != 0) {
+                index_t t = *(S_.rbegin());
+                S_.pop_back();
+
+                for(index_t le = 0; le < 3; ++le) {
+                    index_t t2 = triangle_adjacent(t, le);
+
+                    // If t2 is already owned by current thread, then
+                    // its status was previously determined.
+                    if(owns_triangle(t2)) {
+                        if(!triangle_is_marked_as_conflict(t2)) {
+                            ++nb_triangles_to_create_;
+                        }
+                        continue;
+                    }
+
+                    if(!acquire_triangle(t2)) {
+                        S_.resize(0);
+                        return false;
+                    }
+
+                    if(triangle_is_in_conflict(t2,p)) {
+                        mark_triangle_as_conflict(t2);
+                        S_.push_back(t2);
+                        continue;
+                    }
+
+                    //  t is in conflict and t2 is not: keep a reference
+                    // to an edge on the border of the conflict zone.
+                    mark_triangle_as_neighbor(t2);
+                    ++nb_triangles_to_create_;
+                    t_boundary_ = t;
+                    e_boundary_ = le;
+                }
+            }
+            return true;
+        }
+
+        bool finite_triangle_is_in_conflict(
+            index_t t, const double* p
+        ) const {
+            const double* p0 = vertex_ptr(finite_triangle_vertex(t,0));
+            const double* p1 = vertex_ptr(finite_triangle_vertex(t,1));
+            const double* p2 = vertex_ptr(finite_triangle_vertex(t,2));
+            if(weighted_) {
+                double h0 = heights_[finite_triangle_vertex(t, 0)];
+                double h1 = heights_[finite_triangle_vertex(t, 1)];
+                double h2 = heights_[finite_triangle_vertex(t, 2)];
+                index_t pindex = index_t(
+                    (p - vertex_ptr(0)) / int(vertex_stride_)
+                );
+                double h = heights_[pindex];
+                return (PCK::orient_2dlifted_SOS(
+                            p0,p1,p2,p,h0,h1,h2,h
+                        ) > 0) ;
+            }
+            return (PCK::in_circle_2d_SOS(p0, p1, p2, p) > 0);
+        }
+
+        bool triangle_is_in_conflict(index_t t, const double* p) const {
+
+            // Lookup triangle vertices
+            const double* pv[3];
+            for(index_t i=0; i<3; ++i) {
+                index_t v = triangle_vertex(t,i);
+                pv[i] = (v == NO_INDEX) ? nullptr : vertex_ptr(v);
+            }
+
+            // Check for virtual triangles (then in_circle()
+            // is replaced with orient2d())
+            for(index_t le = 0; le < 3; ++le) {
+                if(pv[le] == nullptr) {
+                    pv[le] = p;
+                    Sign sign = PCK::orient_2d(pv[0],pv[1],pv[2]);
+                    if(sign > 0) {
+                        return true;
+                    }
+                    if(sign < 0) {
+                        return false;
+                    }
+
+                    //  If sign is zero, we check the real triangle
+                    // adjacent to the edge on the convex hull.
+                    //  If t2 was already visited by this thread, then
+                    // it is in conflict if it is already marked.
+                    //  Else its vertices can be read without lock:
+                    // t is owned by this thread, and no other thread
+                    // can delete t2 without owning all its neighbors.
+                    index_t t2 = triangle_adjacent(t, le);
+                    geo_debug_assert(t2 != NO_INDEX);
+                    if(owns_triangle(t2)) {
+                        return triangle_is_marked_as_conflict(t2);
+                    }
+                    return finite_triangle_is_in_conflict(t2, p);
+                }
+            }
+
+            return finite_triangle_is_in_conflict(t, p);
+        }
+
+        index_t locate(
+            const double* p, index_t hint, Sign* orient
+        ) {
+            //   Improve the hint with the inexact walk (bounded
+            // number of steps, see Delaunay2d::locate()).
+            {
+                index_t new_hint = locate_inexact(p, hint, 2500);
+                if(new_hint == NO_TRIANGLE) {
+                    return NO_TRIANGLE;
+                }
+                hint = new_hint;
+            }
+
+            if(hint != NO_TRIANGLE) {
+                if(triangle_is_free(hint)) {
+                    hint = NO_TRIANGLE;
+                } else {
+                    if(!owns_triangle(hint) && !acquire_triangle(hint)) {
+                        hint = NO_TRIANGLE;
+                    }
+                    if((hint != NO_TRIANGLE) && triangle_is_free(hint)) {
+                        release_triangle(hint);
+                        hint = NO_TRIANGLE;
+                    }
+                }
+            }
+
+            // If no hint, find a triangle randomly, and always
+            // start from a real one.
+            do {
+                if(hint == NO_TRIANGLE) {
+                    hint = thread_safe_random(max_used_t_);
+                }
+                if(
+                    triangle_is_free(hint) ||
+                    (!owns_triangle(hint) && !acquire_triangle(hint))
+                ) {
+                    if(owns_triangle(hint)) {
+                        release_triangle(hint);
+                    }
+                    hint = NO_TRIANGLE;
+                } else {
+                    for(index_t le=0; le<3; ++le) {
+                        if(triangle_vertex(hint,le) == VERTEX_AT_INFINITY) {
+                            index_t new_hint = triangle_adjacent(hint,le);
+                            if(
+                                triangle_is_free(new_hint) ||
+                                !acquire_triangle(new_hint)
+                            ) {
+                                new_hint = NO_TRIANGLE;
+                            }
+                            release_triangle(hint);
+                            hint = new_hint;
+                            break;
+                        }
+                    }
+                }
+            } while(hint == NO_TRIANGLE) ;
+
+            index_t t = hint;
+            index_t t_pred = NO_TRIANGLE;
+
+        still_walking:
+            {
+                if(t_pred != NO_TRIANGLE) {
+                    release_triangle(t_pred);
+                }
+
+                if(triangle_is_free(t)) {
+                    return NO_TRIANGLE;
+                }
+
+                if(!owns_triangle(t) && !acquire_triangle(t)) {
+                    return NO_TRIANGLE;
+                }
+
+                if(!triangle_is_real(t)) {
+                    release_triangle(t);
+                    return NO_TRIANGLE;
+                }
+
+                const double* pv[3];
+                pv[0] = vertex_ptr(finite_triangle_vertex(t,0));
+                pv[1] = vertex_ptr(finite_triangle_vertex(t,1));
+                pv[2] = vertex_ptr(finite_triangle_vertex(t,2));
+
+                // Start from a random edge
+                index_t e0 = thread_safe_random(3);
+                for(index_t de = 0; de < 3; ++de) {
+                    index_t le = (e0 + de) % 3;
+
+                    index_t t_next = triangle_adjacent(t,le);
+
+                    if(t_next == NO_INDEX) {
+                        release_triangle(t);
+                        return NO_TRIANGLE;
+                    }
+
+                    if(t_next == t_pred) {
+                        orient[le] = POSITIVE ;
+                        continue ;
+                    }
+
+                    //   To test the orientation of p w.r.t. the edge le
+                    // of t, we replace vertex le with p in t.
+                    const double* pv_bkp = pv[le];
+                    pv[le] = p;
+                    orient[le] = PCK::orient_2d(pv[0], pv[1], pv[2]);
+
+                    if(orient[le] != NEGATIVE) {
+                        pv[le] = pv_bkp;
+                        continue;
+                    }
+
+                    //  If the opposite triangle is virtual, then p sees
+                    // the edge on the convex hull, thus t_next is in
+                    // conflict and we are done.
+                    if(triangle_is_virtual(t_next)) {
+                        release_triangle(t);
+                        if(!acquire_triangle(t_next)) {
+                            return NO_TRIANGLE;
+                        }
+                        for(index_t tle = 0; tle < 3; ++tle) {
+                            orient[tle] = POSITIVE;
+                        }
+                        return t_next;
+                    }
+
+                    t_pred = t;
+                    t = t_next;
+                    goto still_walking;
+                }
+            }
+
+            //   No edge with negative orientation: t contains p.
+            return t;
+        }
+
+    protected:
+
+        bool triangle_is_marked_as_conflict(index_t t) const {
+            geo_debug_assert(owns_triangle(t));
+            return cell_status_.cell_is_marked_as_conflict(t);
+        }
+
+        void mark_triangle_as_conflict(index_t t) {
+            geo_debug_assert(owns_triangle(t));
+            triangles_to_delete_.push_back(t);
+            cell_status_.mark_cell_as_conflict(t);
+        }
+
+        void mark_triangle_as_neighbor(index_t t) {
+            //   Note: nothing to change in cell_status_[t]
+            // since LSB=0 means neigbhor triangle.
+            triangles_to_release_.push_back(t);
+        }
+
+        void acquire_and_mark_triangle_as_created(index_t t) {
+            //  The triangle was created in this thread's pool,
+            // therefore there is no need to use sync
+            // primitives to acquire a lock on it.
+            geo_debug_assert(cell_status_.cell_thread(t) == NO_THREAD);
+            cell_status_.set_cell_status(
+                t, CellStatusArray::thread_index_t(id())
+            );
+#ifdef GEO_DEBUG
+            ++nb_acquired_triangles_;
+#endif
+            triangles_to_release_.push_back(t);
+        }
+
+        void release_triangles() {
+            for(index_t i=0; i<triangles_to_release_.size(); ++i) {
+                release_triangle(triangles_to_release_[i]);
+            }
+            triangles_to_release_.resize(0);
+            for(index_t i=0; i<triangles_to_delete_.size(); ++i) {
+                release_triangle(triangles_to_delete_[i]);
+            }
+            triangles_to_delete_.resize(0);
+        }
+
+        bool acquire_triangle(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(!owns_triangle(t));
+
+            interfering_thread_ = cell_status_.acquire_cell(
+                t, CellStatusArray::thread_index_t(id())
+            );
+
+            if(interfering_thread_ == NO_THREAD) {
+#ifdef GEO_DEBUG
+                ++nb_acquired_triangles_;
+#endif
+                return true;
+            }
+            return false;
+        }
+
+        void release_triangle(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(owns_triangle(t));
+#ifdef GEO_DEBUG
+            --nb_acquired_triangles_;
+#endif
+            cell_status_.release_cell(t);
+        }
+
+        bool owns_triangle(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return (
+                cell_status_.cell_thread(t) ==
+                CellStatusArray::thread_index_t(id())
+            );
+        }
+
+        index_t locate_inexact(
+            const double* p, index_t hint, index_t max_iter
+        ) const {
+            // If no hint specified, find a triangle randomly
+            while(hint == NO_TRIANGLE) {
+                hint = thread_safe_random(max_used_t_);
+                if(
+                    triangle_is_free(hint) ||
+                    cell_status_.cell_thread(hint) != NO_THREAD
+                ) {
+                    hint = NO_TRIANGLE;
+                }
+            }
+
+            //  Always start from a real triangle. If the triangle is
+            // virtual, find its real neighbor (always opposite to the
+            // infinite vertex)
+            if(triangle_is_virtual(hint)) {
+                for(index_t le = 0; le < 3; ++le) {
+                    if(triangle_vertex(hint, le) == VERTEX_AT_INFINITY) {
+                        hint = triangle_adjacent(hint, le);
+                        // Can happen if the triangle was modified by
+                        // another thread in the meanwhile.
+                        if(hint == NO_TRIANGLE) {
+                            return NO_TRIANGLE;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            index_t t = hint;
+            index_t t_pred = NO_TRIANGLE;
+
+        still_walking:
+            {
+                const double* pv[3];
+                for(index_t lv=0; lv<3; ++lv) {
+                    index_t iv = triangle_vertex(t,lv);
+                    // No lock was acquired, another thread may have
+                    // made this triangle virtual in the meanwhile.
+                    if(iv == NO_INDEX) {
+                        return NO_TRIANGLE;
+                    }
+                    pv[lv] = vertex_ptr(iv);
+                }
+
+                for(index_t le = 0; le < 3; ++le) {
+                    index_t t_next = triangle_adjacent(t,le);
+                    if(t_next == NO_INDEX) {
+                        return NO_TRIANGLE;
+                    }
+                    if(t_next == t_pred) {
+                        continue ;
+                    }
+                    const double* pv_bkp = pv[le];
+                    pv[le] = p;
+                    Sign ori = orient_2d_inexact(pv[0], pv[1], pv[2]);
+                    if(ori != NEGATIVE) {
+                        pv[le] = pv_bkp;
+                        continue;
+                    }
+                    if(triangle_is_virtual(t_next)) {
+                        return t_next;
+                    }
+                    t_pred = t;
+                    t = t_next;
+                    if(--max_iter != 0) {
+                        goto still_walking;
+                    }
+                }
+            }
+            return t;
+        }
+
+        index_t stellate_conflict_zone(
+            index_t v_in, index_t t1, index_t t1ebord
+        ) {
+            //   Same traversal as Delaunay2d::stellate_conflict_zone(),
+            // the conflict triangles are the ones marked in cell_status_
+            // (their adjacencies are not modified until they are
+            // recycled, so the walk can still use them).
+            index_t t = t1;
+            index_t e = t1ebord;
+            index_t t_adj = triangle_adjacent(t,e);
+            geo_debug_assert(t_adj != NO_INDEX);
+            geo_debug_assert(triangle_is_marked_as_conflict(t));
+            geo_debug_assert(!triangle_is_marked_as_conflict(t_adj));
+
+            index_t new_t_first = NO_INDEX;
+            index_t new_t_prev  = NO_INDEX;
+
+            do {
+                index_t v1 = triangle_vertex(t, (e+1)%3);
+                index_t v2 = triangle_vertex(t, (e+2)%3);
+
+                // Create new triangle
+                index_t new_t = new_triangle(v_in, v1, v2);
+
+                //   Connect new triangle to triangle on the other
+                // side of the conflict zone.
+                set_triangle_adjacent(new_t, 0, t_adj);
+                index_t adj_e = find_triangle_adjacent(t_adj, t);
+                set_triangle_adjacent(t_adj, adj_e, new_t);
+
+                // Move to next triangle
+                e = (e + 1)%3;
+                t_adj = triangle_adjacent(t,e);
+                while(triangle_is_marked_as_conflict(t_adj)) {
+                    t = t_adj;
+                    e = (find_triangle_vertex(t,v2) + 2)%3;
+                    t_adj = triangle_adjacent(t,e);
+                    geo_debug_assert(t_adj != NO_INDEX);
+                }
+
+                if(new_t_prev == NO_INDEX) {
+                    new_t_first = new_t;
+                } else {
+                    set_triangle_adjacent(new_t_prev, 1, new_t);
+                    set_triangle_adjacent(new_t, 2, new_t_prev);
+                }
+
+                new_t_prev = new_t;
+
+            } while((t != t1) || (e != t1ebord));
+
+            // Connect last triangle to first triangle
+            set_triangle_adjacent(new_t_prev, 1, new_t_first);
+            set_triangle_adjacent(new_t_first, 2, new_t_prev);
+
+            return new_t_prev;
+        }
+
+        static index_t triangle_edge_vertex(index_t e, index_t v) {
+            geo_debug_assert(e < 3);
+            geo_debug_assert(v < 2);
+            return index_t(triangle_edge_vertex_[e][v]);
+        }
+
+        index_t triangle_vertex(index_t t, index_t lv) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 3);
+            return cell_to_v_store_[3 * t + lv];
+        }
+
+        index_t finite_triangle_vertex(index_t t, index_t lv) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 3);
+            geo_debug_assert(cell_to_v_store_[3 * t + lv] != NO_INDEX);
+            return cell_to_v_store_[3 * t + lv];
+        }
+
+        index_t find_triangle_vertex(index_t t, index_t v) const {
+            geo_debug_assert(t < max_t());
+            const index_t* T = &(cell_to_v_store_[3 * t]);
+            return find_3(T,v);
+        }
+
+        index_t triangle_adjacent(index_t t, index_t le) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(le < 3);
+            return cell_to_cell_store_[3 * t + le];
+        }
+
+        void set_triangle_adjacent(index_t t1, index_t le1, index_t t2) {
+            geo_debug_assert(t1 < max_t());
+            geo_debug_assert(t2 < max_t());
+            geo_debug_assert(le1 < 3);
+            geo_debug_assert(owns_triangle(t1));
+            geo_debug_assert(owns_triangle(t2));
+            cell_to_cell_store_[3 * t1 + le1] = t2;
+        }
+
+        index_t find_triangle_adjacent(index_t t1, index_t t2) const {
+            geo_debug_assert(t1 < max_t());
+            geo_debug_assert(t2 < max_t());
+            geo_debug_assert(t1 != t2);
+            const index_t* T = &(cell_to_cell_store_[3 * t1]);
+            return find_3(T,t2);
+        }
+
+        static index_t find_3(const index_t* T, index_t v) {
+            // Branchless, see Delaunay2d::find_3()
+            index_t result = index_t( (T[1] == v) | ((T[2] == v) * 2) );
+            geo_debug_assert(T[result] == v);
+            return result;
+        }
+
+        static constexpr index_t END_OF_LIST = NO_INDEX;
+
+        static constexpr index_t NOT_IN_LIST = index_t(-2);
+
+        index_t nb_vertices() const {
+            return nb_vertices_;
+        }
+
+        const double* vertex_ptr(index_t i) const {
+            geo_debug_assert(i < nb_vertices());
+            return vertices_ + vertex_stride_ * i;
+        }
+
+        bool triangle_is_in_list(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return (cell_next_[t] != NOT_IN_LIST);
+        }
+
+        index_t triangle_next(index_t t) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(triangle_is_in_list(t));
+            return cell_next_[t];
+        }
+
+        void remove_triangle_from_list(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(triangle_is_in_list(t));
+            geo_debug_assert(owns_triangle(t));
+            cell_next_[t] = NOT_IN_LIST;
+        }
+
+        index_t new_triangle() {
+
+            // If the memory pool is full, then we expand it.
+            // This cannot be done when running multiple threads.
+            if(first_free_ == END_OF_LIST) {
+                geo_debug_assert(!Process::is_running_threads());
+                master_->cell_to_v_store_.resize(
+                    master_->cell_to_v_store_.size() + 3, NO_INDEX
+                );
+                master_->cell_to_cell_store_.resize(
+                    master_->cell_to_cell_store_.size() + 3, NO_INDEX
+                );
+                master_->cell_next_.push_back(END_OF_LIST);
+                master_->cell_status_.grow();
+                ++nb_free_;
+                ++max_t_;
+                first_free_ = master_->cell_status_.size() - 1;
+            }
+
+            acquire_and_mark_triangle_as_created(first_free_);
+            index_t result = first_free_;
+
+            first_free_ = triangle_next(first_free_);
+            remove_triangle_from_list(result);
+
+            cell_to_cell_store_[3 * result] = NO_INDEX;
+            cell_to_cell_store_[3 * result + 1] = NO_INDEX;
+            cell_to_cell_store_[3 * result + 2] = NO_INDEX;
+
+            max_used_t_ = std::max(max_used_t_, result);
+
+            --nb_free_;
+            return result;
+        }
+
+        index_t new_triangle(index_t v1, index_t v2, index_t v3) {
+            index_t result = new_triangle();
+            cell_to_v_store_[3 * result] = v1;
+            cell_to_v_store_[3 * result + 1] = v2;
+            cell_to_v_store_[3 * result + 2] = v3;
+            return result;
+        }
+
+        void send_event() {
+            cond_.notify_all();
+        }
+
+        void wait_for_event(index_t t) {
+            Delaunay2dThread* thrd = thread(t);
+            // RAII: ctor locks, dtor unlocks
+            std::unique_lock<std::mutex> L(thrd->mutex_);
+            if(!thrd->finished_) {
+                thrd->cond_.wait(L);
+            }
+        }
+
+    public:
+
+        void check_combinatorics() const {
+            bool ok = true;
+            for(index_t t = 0; t < max_t(); ++t) {
+                if(triangle_is_free(t)) {
+                    continue;
+                }
+                for(index_t le = 0; le < 3; ++le) {
+                    index_t t2 = triangle_adjacent(t, le);
+                    if(t2 == NO_INDEX || t2 == t) {
+                        std::cerr << "Triangle " << t << " edge " << le
+                                  << ": invalid adjacent triangle"
+                                  << std::endl;
+                        ok = false;
+                    } else if(
+                        cell_to_cell_store_[3*t2] != t &&
+                        cell_to_cell_store_[3*t2+1] != t &&
+                        cell_to_cell_store_[3*t2+2] != t
+                    ) {
+                        std::cerr << "Triangle " << t << " edge " << le
+                                  << ": adjacent link is not bidirectional"
+                                  << std::endl;
+                        ok = false;
+                    }
+                }
+            }
+            geo_assert(ok);
+            std::cerr << std::endl << "Delaunay Combi OK" << std::endl;
+        }
+
+        void check_geometry() const {
+            bool ok = true;
+            for(index_t t = 0; t < max_t(); ++t) {
+                if(!triangle_is_real(t)) {
+                    continue;
+                }
+                for(index_t v = 0; v < nb_vertices(); ++v) {
+                    if(
+                        v == triangle_vertex(t,0) ||
+                        v == triangle_vertex(t,1) ||
+                        v == triangle_vertex(t,2)
+                    ) {
+                        continue;
+                    }
+                    if(finite_triangle_is_in_conflict(t, vertex_ptr(v))) {
+                        std::cerr << "Triangle " << t
+                                  << " is in conflict with vertex " << v
+                                  << std::endl;
+                        ok = false;
+                    }
+                }
+            }
+            geo_assert(ok);
+            std::cerr << std::endl << "Delaunay Geo OK" << std::endl;
+        }
+
+    private:
+        ParallelDelaunay2d* master_;
+        index_t nb_vertices_;
+        const double* vertices_;
+        const double* heights_;
+        index_t* reorder_;
+        index_t vertex_stride_;
+        bool weighted_;
+        index_t max_t_;
+        index_t max_used_t_;
+
+        vector<index_t>& cell_to_v_store_;
+        vector<index_t>& cell_to_cell_store_;
+        vector<index_t>& cell_next_;
+        CellStatusArray& cell_status_;
+
+        index_t first_free_;
+        index_t nb_free_;
+        bool memory_overflow_;
+
+        index_t v1_,v2_,v3_; // The first three vertices
+
+        vector<index_t> S_;
+        index_t nb_triangles_to_create_;
+        index_t t_boundary_; // index of a triangle,edge on the bndry
+        index_t e_boundary_; // of the conflict zone.
+
+        bool direction_;
+        index_t work_begin_;
+        index_t work_end_;
+        index_t b_hint_;
+        index_t e_hint_;
+        bool finished_;
+
+        //  Whenever acquire_triangle() is unsuccessful, contains
+        // the index of the thread that was interfering
+        CellStatusArray::thread_index_t interfering_thread_;
+
+#ifdef GEO_DEBUG
+        index_t nb_acquired_triangles_;
+#endif
+
+        vector<index_t> triangles_to_delete_;
+        vector<index_t> triangles_to_release_;
+
+        index_t nb_rollbacks_;
+        index_t nb_failed_locate_;
+
+        std::condition_variable cond_;
+        std::mutex mutex_;
+
+        static char triangle_edge_vertex_[3][2];
+    };
+
+    // Same convention as Delaunay2d::triangle_edge_vertex_
+    char Delaunay2dThread::triangle_edge_vertex_[3][2] = {
+        {1,2},
+        {2,0},
+        {0,1}
+    };
+
+
+
+    ParallelDelaunay2d::ParallelDelaunay2d(
+        coord_index_t dimension
+    ) : Delaunay(dimension) {
+        if(dimension != 2 && dimension != 3) {
+            throw InvalidDimension(dimension, "ParallelDelaunay2d", "2 or 3");
+        }
+        weighted_ = (dimension == 3);
+        // In weighted mode, vertices are 3d but combinatorics is 2d.
+        if(weighted_) {
+            cell_size_ = 3;
+            cell_v_stride_ = 3;
+            cell_neigh_stride_ = 3;
+        }
+        debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay");
+        verbose_debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay_verbose");
+        debug_mode_ = (debug_mode_ || verbose_debug_mode_);
+        benchmark_mode_ = CmdLine::get_arg_bool("dbg:delaunay_benchmark");
+    }
+
+    void ParallelDelaunay2d::set_vertices(
+        index_t nb_vertices, const double* vertices
+    ) {
+        Stopwatch W("DelInternal", benchmark_mode_);
+
+        if(weighted_) {
+            heights_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                // Same lifting as in Delaunay2d::set_vertices()
+                double w = -geo_sqr(vertices[3 * i + 2]);
+                heights_[i] = -w +
+                    geo_sqr(vertices[3 * i]) +
+                    geo_sqr(vertices[3 * i + 1]);
+            }
+        }
+        Delaunay::set_vertices(nb_vertices, vertices);
+
+        threads_.clear();
+        if(nb_vertices < 3) {
+            Logger::warn("ParallelDelaunay2d") << "Less than 3 points"
+                                               << std::endl;
+            set_arrays(0, nullptr, nullptr);
+            return;
+        }
+
+        //   A triangulation has about 2n triangles, the pools get
+        // 50% more for the triangles of the conflict zones being
+        // recycled and for the imbalance between threads.
+        index_t expected_triangles = nb_vertices * 3;
+
+        // Allocate the triangles
+        cell_to_v_store_.assign(expected_triangles * 3,NO_INDEX);
+        cell_to_cell_store_.assign(expected_triangles * 3,NO_INDEX);
+        cell_next_.assign(expected_triangles,NO_INDEX);
+        cell_status_.resize(expected_triangles);
+
+        // Reorder the points
+        if(do_reorder_) {
+            compute_BRIO_order(
+                nb_vertices, vertex_ptr(0), reorder_,
+                2, dimension(),
+                64, 0.125,
+                &levels_
+            );
+        } else {
+            reorder_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                reorder_[i] = i;
+            }
+            geo_debug_assert(levels_[0] == 0);
+            geo_debug_assert(levels_[levels_.size()-1] == nb_vertices);
+        }
+
+        double sorting_time = 0;
+        if(benchmark_mode_) {
+            sorting_time = W.elapsed_time();
+            Logger::out("DelInternal1") << "BRIO sorting:"
+                                        << sorting_time
+                                        << std::endl;
+        }
+
+        // Create the threads (limited by the bits of cell_status_)
+        index_t nb_threads = std::min(
+            Process::maximum_concurrent_threads(),
+            CellStatusArray::MAX_THREADS
+        );
+        index_t pool_size = expected_triangles / nb_threads;
+        if (pool_size == 0) {
+            pool_size = 1;
+            nb_threads = expected_triangles;
+        }
+        index_t pool_begin = 0;
+        for(index_t t=0; t<nb_threads; ++t) {
+            index_t pool_end =
+                (t == nb_threads - 1) ?
+                expected_triangles : pool_begin + pool_size;
+            threads_.push_back(
+                new Delaunay2dThread(this, pool_begin, pool_end)
+            );
+            pool_begin = pool_end;
+        }
+
+        // Create first triangle and triangulate first set of points
+        // in sequential mode.
+
+        index_t lvl = 1;
+        while(lvl < (levels_.size() - 1) && levels_[lvl] < 1000) {
+            ++lvl;
+        }
+
+        if(benchmark_mode_) {
+            Logger::out("PDEL2d")
+                << "Using " << levels_.size()-1 << " levels" << std::endl;
+            Logger::out("PDEL2d")
+                << "Levels 0 - " << lvl-1
+                << ": bootstraping with first levels in sequential mode"
+                << std::endl;
+        }
+        Delaunay2dThread* thread0 =
+            static_cast<Delaunay2dThread*>(threads_[0].get());
+        if(thread0->create_first_triangle() == NO_INDEX) {
+            Logger::warn("ParallelDelaunay2d") << "All the points are colinear"
+                                               << std::endl;
+            threads_.clear();
+            set_arrays(0, nullptr, nullptr);
+            return;
+        }
+        thread0->set_work(levels_[0], levels_[lvl]);
+        thread0->run();
+
+        index_t first_lvl = lvl;
+
+        // Insert points in all BRIO levels
+        for(; lvl<levels_.size()-1; ++lvl) {
+
+            if(benchmark_mode_) {
+                Logger::out("PDEL2d") << "Level "
+                                      << lvl << " : start" << std::endl;
+            }
+
+            index_t lvl_b = levels_[lvl];
+            index_t lvl_e = levels_[lvl+1];
+            index_t work_size = (lvl_e - lvl_b)/index_t(threads_.size());
+
+            // Initialize threads
+            index_t b = lvl_b;
+            for(index_t t=0; t<threads_.size(); ++t) {
+                index_t e = t == threads_.size()-1 ? lvl_e : b+work_size;
+                Delaunay2dThread* thread =
+                    static_cast<Delaunay2dThread*>(threads_[t].get());
+
+                // Copy the indices of the first created triangle
+                // and the maximum valid triangle index max_t_
+                if(lvl == first_lvl && t!=0) {
+                    thread->initialize_from(thread0);
+                }
+                thread->set_work(b,e);
+                b = e;
+            }
+            Process::run_threads(threads_);
+        }
+
+        if(benchmark_mode_) {
+            index_t tot_rollbacks = 0 ;
+            index_t tot_failed_locate = 0 ;
+            for(index_t t=0; t<threads_.size(); ++t) {
+                Delaunay2dThread* thread =
+                    static_cast<Delaunay2dThread*>(threads_[t].get());
+                Logger::out("PDEL2d")
+                    << "thread " << std::setw(3) << t << " : "
+                    << std::setw(3)
+                    << thread->nb_rollbacks() << " rollbacks  "
+                    << std::setw(3)
+                    << thread->nb_failed_locate() << " restarted locate"
+                    << std::endl;
+                tot_rollbacks += thread->nb_rollbacks();
+                tot_failed_locate += thread->nb_failed_locate();
+            }
+            Logger::out("PDEL2d") << "------------------" << std::endl;
+            Logger::out("PDEL2d") << "total: "
+                                  << tot_rollbacks << " rollbacks  "
+                                  << tot_failed_locate << " restarted locate"
+                                  << std::endl;
+        }
+
+        // Run threads sequentialy, to insert missing points if
+        // memory overflow was encountered (in sequential mode,
+        // dynamic memory growing works)
+
+        index_t nb_sequential_points = 0;
+        for(index_t t=0; t<threads_.size(); ++t) {
+            Delaunay2dThread* t1 =
+                static_cast<Delaunay2dThread*>(threads_[t].get());
+
+            nb_sequential_points += t1->work_size();
+
+            if(t != 0) {
+                // We need to copy max_t_ from previous thread,
+                // since the memory pool may have grown.
+                Delaunay2dThread* t2 =
+                    static_cast<Delaunay2dThread*>(threads_[t-1].get());
+                t1->initialize_from(t2);
+            }
+            t1->run();
+        }
+
+        //  thread0 is used for the compaction below, it needs the
+        // maximum valid triangle index, that may have been increased
+        // by the threads in sequential mode.
+        if(nb_sequential_points != 0) {
+            Delaunay2dThread* tn =
+                static_cast<Delaunay2dThread*>(
+                    threads_[threads_.size()-1].get()
+                );
+            thread0->initialize_from(tn);
+        }
+
+        if(benchmark_mode_) {
+            if(nb_sequential_points != 0) {
+                Logger::out("PDEL2d")
+                    << "Local thread memory overflow occurred:"
+                    << std::endl;
+                Logger::out("PDEL2d") << nb_sequential_points
+                                      << " points inserted in sequential mode"
+                                      << std::endl;
+            } else {
+                Logger::out("PDEL2d")
+                    << "All the points were inserted in parallel mode"
+                    << std::endl;
+            }
+            Logger::out("DelInternal2") << "Core insertion algo:"
+                                        << W.elapsed_time() - sorting_time
+                                        << std::endl;
+        }
+
+        if(debug_mode_) {
+            thread0->check_combinatorics();
+            thread0->check_geometry();
+        }
+
+        //   Compress cell_to_v_store_ and cell_to_cell_store_
+        // (remove free and virtual triangles), cell_next_ is reused
+        // for the old to new conversion array (see
+        // ParallelDelaunay3d::set_vertices()).
+
+        vector<index_t>& old2new = cell_next_;
+        index_t nb_triangles = 0;
+        index_t nb_triangles_to_delete = 0;
+
+        {
+            for(index_t t = 0; t < thread0->max_t(); ++t) {
+                if(
+                    (keep_infinite_ && !thread0->triangle_is_free(t)) ||
+                    thread0->triangle_is_real(t)
+                ) {
+                    if(t != nb_triangles) {
+                        Memory::copy(
+                            &cell_to_v_store_[nb_triangles * 3],
+                            &cell_to_v_store_[t * 3],
+                            3 * sizeof(index_t)
+                        );
+                        Memory::copy(
+                            &cell_to_cell_store_[nb_triangles * 3],
+                            &cell_to_cell_store_[t * 3],
+                            3 * sizeof(index_t)
+                        );
+                    }
+                    old2new[t] = nb_triangles;
+                    ++nb_triangles;
+                } else {
+                    old2new[t] = NO_INDEX;
+                    ++nb_triangles_to_delete;
+                }
+            }
+
+            cell_to_v_store_.resize(3 * nb_triangles);
+            cell_to_cell_store_.resize(3 * nb_triangles);
+            for(index_t i = 0; i < 3 * nb_triangles; ++i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                // -1 when a real triangle is adjacent to a virtual one
+                cell_to_cell_store_[i] = old2new[t];
+            }
+        }
+
+        // In "keep_infinite" mode, finite cells have indices
+        // [0..nb_finite_cells_-1] and infinite cells have indices
+        // [nb_finite_cells_ .. nb_cells_-1]
+
+        if(keep_infinite_) {
+            nb_finite_cells_ = 0;
+            index_t finite_ptr = 0;
+            index_t infinite_ptr = nb_triangles - 1;
+            for(;;) {
+                while(thread0->triangle_is_finite(finite_ptr)) {
+                    old2new[finite_ptr] = finite_ptr;
+                    ++finite_ptr;
+                    ++nb_finite_cells_;
+                }
+                while(!thread0->triangle_is_finite(infinite_ptr)) {
+                    old2new[infinite_ptr] = infinite_ptr;
+                    --infinite_ptr;
+                }
+                if(finite_ptr > infinite_ptr) {
+                    break;
+                }
+                old2new[finite_ptr] = infinite_ptr;
+                old2new[infinite_ptr] = finite_ptr;
+                ++nb_finite_cells_;
+                for(index_t le=0; le<3; ++le) {
+                    std::swap(
+                        cell_to_cell_store_[3*finite_ptr + le],
+                        cell_to_cell_store_[3*infinite_ptr + le]
+                    );
+                }
+                for(index_t lv=0; lv<3; ++lv) {
+                    std::swap(
+                        cell_to_v_store_[3*finite_ptr + lv],
+                        cell_to_v_store_[3*infinite_ptr + lv]
+                    );
+                }
+                ++finite_ptr;
+                --infinite_ptr;
+            }
+            for(index_t i = 0; i < 3 * nb_triangles; ++i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                geo_debug_assert(t != NO_INDEX);
+                cell_to_cell_store_[i] = t;
+            }
+        }
+
+        if(benchmark_mode_) {
+            Logger::out("DelCompress")
+                << "Removed " << nb_triangles_to_delete
+                << (keep_infinite_ ?
+                    " triangles (free list)" :
+                    " triangles (free list and infinite)")
+                << std::endl;
+        }
+
+        set_arrays(
+            nb_triangles,
+            cell_to_v_store_.data(),
+            cell_to_cell_store_.data()
+        );
+    }
+
+    index_t ParallelDelaunay2d::nearest_vertex(const double* p) const {
+
+        //   Greedy walk on the Delaunay graph: move to a neighbor closer
+        // to p as long as there is one. It stops at the nearest vertex (the
+        // segment from any other vertex to p leaves its Voronoi cell through
+        // the bisector with a closer neighbor). It needs the triangles
+        // around the vertices; without them, or in weighted mode (power
+        // cells do not answer Euclidean queries), linear search.
+        if(weighted_ || !stores_cicl() || nb_cells() == 0) {
+            return Delaunay::nearest_vertex(p);
+        }
+
+        index_t v = NO_INDEX;
+        for(index_t lv = 0; lv < 3 && v == NO_INDEX; ++lv) {
+            v = cell_vertex(0, lv);
+        }
+        double sq_dist = Geom::distance2(p, vertex_ptr(v), 2);
+        for(;;) {
+            index_t best = v;
+            index_t t0 = vertex_cell(v);
+            index_t t = t0;
+            do {
+                for(index_t lv = 0; lv < 3; ++lv) {
+                    index_t w = cell_vertex(t, lv);
+                    if(w == NO_INDEX || w == v) {
+                        continue;
+                    }
+                    double cur_sq_dist = Geom::distance2(p, vertex_ptr(w), 2);
+                    if(cur_sq_dist < sq_dist) {
+                        sq_dist = cur_sq_dist;
+                        best = w;
+                    }
+                }
+                t = next_around_vertex(t, index(t, v));
+            } while(t != t0);
+            if(best == v) {
+                return v;
+            }
+            v = best;
+        }
+    }
+
+    void ParallelDelaunay2d::set_BRIO_levels(const vector<index_t>& levels) {
+        levels_ = levels;
+    }
+
+}
+
+#endif
+
+/******* extracted from ../voronoi/convex_cell.cpp *******/
+
+
+#ifndef STANDALONE_CONVEX_CELL
+#endif
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <stack>
+#include <algorithm>
+
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+namespace {
+    using namespace VBW;
+
+    class SmallStack_ushort {
+    public:
+
+        SmallStack_ushort(
+            ushort* buffer, int capacity
+        ) : buffer_(buffer),
+            index_(-1),
+            capacity_(capacity) {
+        }
+
+        bool empty() const {
+            return (index_ == -1);
+        }
+
+        void push(ushort val) {
+            ++index_;
+            vbw_assert(index_ < capacity_);
+            (void)capacity_; // To silence a warning.
+            buffer_[index_] = val;
+        }
+
+        void pop() {
+            vbw_assert(!empty());
+            --index_;
+        }
+
+        ushort top() const {
+            vbw_assert(!empty());
+            return buffer_[index_];
+        }
+    private:
+        ushort* buffer_;
+        int index_;
+        int capacity_;
+    };
+}
+
+
+
+namespace VBW {
+
+    ConvexCell::ConvexCell(ConvexCellFlags flags) :
+        max_t_(64),
+        max_v_(32),
+        t_(max_t_),
+        t_adj_(max_t_),
+        plane_eqn_(max_v_),
+        v2t_(max_v_),
+        v2e_(max_v_)
+    {
+#ifndef STANDALONE_CONVEX_CELL
+        use_exact_predicates_ = true;
+#endif
+        nb_t_ = 0;
+        nb_v_ = 0;
+        first_free_ = END_OF_LIST;
+        first_valid_ = END_OF_LIST;
+        geometry_dirty_ = true;
+        triangle_duals_valid_ = false;
+        has_vglobal_ = ((flags & WithVGlobal) != 0);
+        if(has_vglobal_) {
+            vglobal_.assign(max_v_,index_t(-1));
+        }
+        has_tflags_  = ((flags & WithTFlags)  != 0);
+        if(has_tflags_) {
+            tflags_.assign(max_t_,0);
+        }
+        v2t_.assign(max_v_,ushort(-1));
+        v2e_.assign(max_v_,uchar(-1));
+    }
+
+    
+
+    void ConvexCell::clear() {
+        nb_t_ = 0;
+        nb_v_ = 0;
+        first_free_ = END_OF_LIST;
+        first_valid_ = END_OF_LIST;
+        geometry_dirty_ = true;
+        triangle_duals_valid_ = false;
+#ifdef VBW_DEBUG
+        // Initialize all triangle flags with something
+        // different from VALID_TRIANGLE.
+        for(index_t t=0; t<max_t(); ++t) {
+            set_triangle_flags(t, END_OF_LIST);
+        }
+#endif
+    }
+
+    
+
+    void ConvexCell::init_with_box(
+        double xmin, double ymin, double zmin,
+        double xmax, double ymax, double zmax
+    ) {
+        clear();
+
+        // The vertex at infinity.
+        plane_eqn_[0] = make_vec4(0,0,0,0);
+
+        // Offset for the 6 bounding box plane equations.
+        // Here they come first (offset is zero).
+        index_t boff = 1;
+
+        // The equations of the six faces of the bounding box.
+        plane_eqn_[boff  ] = make_vec4( 1.0, 0.0, 0.0, -xmin);
+        plane_eqn_[boff+1] = make_vec4(-1.0, 0.0, 0.0,  xmax);
+        plane_eqn_[boff+2] = make_vec4( 0.0, 1.0, 0.0, -ymin);
+        plane_eqn_[boff+3] = make_vec4( 0.0,-1.0, 0.0,  ymax);
+        plane_eqn_[boff+4] = make_vec4( 0.0, 0.0, 1.0, -zmin);
+        plane_eqn_[boff+5] = make_vec4( 0.0, 0.0,-1.0,  zmax);
+
+        //   Create the 8 triangles that correspond to the
+        // 8 vertices of the bounding box.
+        //   (Unused) adjacency info. ----------------.
+        //   Triangle vertices -.                     |
+        //                      v                     v
+        new_triangle(         boff+2,boff+5,boff+0, 1,4,2);
+        new_triangle(         boff+5,boff+3,boff+0, 5,0,3);
+        new_triangle(         boff+1,boff+5,boff+2, 0,6,3);
+        new_triangle(         boff+5,boff+1,boff+3, 7,1,2);
+        new_triangle(         boff+4,boff+2,boff+0, 0,5,6);
+        new_triangle(         boff+4,boff+0,boff+3, 1,7,4);
+        new_triangle(         boff+2,boff+4,boff+1, 7,2,4);
+        new_triangle(         boff+4,boff+3,boff+1, 3,6,5);
+
+        // We already created 6 vertices (for the 6 bounding box
+        // plane equations) plus the vertex at infinity.
+        nb_v_ = 7;
+
+        geometry_dirty_ = true;
+    }
+
+
+    void ConvexCell::init_with_tet(
+        vec4 P0, vec4 P1, vec4 P2, vec4 P3
+    ) {
+        clear();
+
+        // The vertex at infinity.
+        plane_eqn_[0] = make_vec4(0,0,0,0);
+
+        // Offset for the 4 plane equations.
+        // Plane 0 is vertex at infinity.
+        index_t boff = 1;
+
+        plane_eqn_[boff  ] = P0;
+        plane_eqn_[boff+1] = P1;
+        plane_eqn_[boff+2] = P2;
+        plane_eqn_[boff+3] = P3;
+
+        //   Create the 4 triangles (that correspond to
+        //          the 4 vertices of the tetrahedron)
+        //   (Unused) adjacency info. ----------.
+        //   Triangle vertices -.               |
+        //                      v               v
+        new_triangle(boff+3, boff+2, boff+1, 3, 2, 1);
+        new_triangle(boff+3, boff+0, boff+2, 3, 0, 2);
+        new_triangle(boff+3, boff+1, boff+0, 3, 1, 0);
+        new_triangle(boff+2, boff+0, boff+1, 2, 0, 1);
+
+        // We already created 4 vertices (for the 4 facets
+        // plane equations) plus the vertex at infinity.
+        nb_v_ = 5;
+
+        geometry_dirty_ = true;
+    }
+
+
+    void ConvexCell::init_with_tet(
+        vec4 P0, vec4 P1, vec4 P2, vec4 P3,
+        global_index_t P0_global_index,
+        global_index_t P1_global_index,
+        global_index_t P2_global_index,
+        global_index_t P3_global_index
+    ) {
+        geo_debug_assert(has_vglobal_);
+        init_with_tet(P0, P1, P2, P3);
+
+        // Offset for the 4 plane equations.
+        // Plane 0 is vertex at infinity.
+        index_t boff = 1;
+
+        vglobal_[boff  ] = P0_global_index;
+        vglobal_[boff+1] = P1_global_index;
+        vglobal_[boff+2] = P2_global_index;
+        vglobal_[boff+3] = P3_global_index;
+    }
+
+
+    
+
+    void ConvexCell::save(const std::string& filename, double shrink) const {
+        std::ofstream out(filename.c_str());
+        save(out, 1, shrink);
+    }
+
+
+    index_t ConvexCell::save(
+        std::ostream& out, global_index_t v_offset,
+        double shrink, bool borders_only
+    ) const {
+
+        vec3 g = make_vec3(0.0, 0.0, 0.0);
+        if(shrink != 0.0) {
+            const_cast<ConvexCell*>(this)->compute_geometry();
+            g = barycenter();
+        }
+
+        vector<index_t> v2t(nb_v(),index_t(-1));
+        vector<index_t> t_index(nb_t(),index_t(-1));
+        index_t nt=0;
+
+        {
+            index_t t = first_valid_;
+            while(t != END_OF_LIST) {
+                TriangleWithFlags T = get_triangle_and_flags(t);
+                vec4 p;
+                if(geometry_dirty_) {
+                    p = compute_triangle_point(t);
+                    p.x /= p.w;
+                    p.y /= p.w;
+                    p.z /= p.w;
+                    p.w = 1.0;
+                } else {
+                    p.x = triangle_point_[t].x;
+                    p.y = triangle_point_[t].y;
+                    p.z = triangle_point_[t].z;
+                    p.w = 1.0;
+                }
+
+                if(shrink != 0.0) {
+                    p.x = shrink * g.x + (1.0 - shrink) * p.x;
+                    p.y = shrink * g.y + (1.0 - shrink) * p.y;
+                    p.z = shrink * g.z + (1.0 - shrink) * p.z;
+                }
+                out << "v " << p.x << " " << p.y << " " << p.z << std::endl;
+                t_index[t] = nt;
+                ++nt;
+                v2t[T.i] = t;
+                v2t[T.j] = t;
+                v2t[T.k] = t;
+                t = index_t(T.flags);
+            }
+        }
+
+        for(index_t v=1; v<nb_v(); ++v) {
+            if(borders_only &&
+               has_vglobal() &&
+               v_global_index(v) != global_index_t(-1) &&
+               v_global_index(v) != global_index_t(-2)
+               // index_t(-2) is for fluid free bndry
+              ) {
+                continue;
+            }
+            if(v2t[v] != index_t(-1)) {
+                index_t t = v2t[v];
+                out << "f ";
+                do {
+                    out << (t_index[t]+v_offset) << " ";
+                    index_t lv = triangle_find_vertex(t,v);
+                    t = triangle_adjacent(t, (lv + 1)%3);
+                } while(t != v2t[v]);
+                out << std::endl;
+            }
+        }
+
+        return nt;
+    }
+
+    void ConvexCell::for_each_Voronoi_vertex(
+        index_t v,
+        std::function<void(index_t)> vertex
+    ) {
+        geo_debug_assert(!geometry_dirty_);
+        if(v2t_[v] != END_OF_LIST) {
+            index_t t = index_t(v2t_[v]);
+            do {
+                vertex(t);
+                index_t lv = triangle_find_vertex(t,v);
+                t = triangle_adjacent(t, (lv + 1)%3);
+            } while(t != v2t_[v]);
+        }
+    }
+
+#if !defined(STANDALONE_CONVEX_CELL) && !defined(GEOGRAM_PSM)
+
+    void ConvexCell::append_to_mesh(
+        GEO::Mesh* mesh, double shrink, bool borders_only,
+        GEO::Attribute<GEO::index_t>* facet_attr
+    ) const {
+
+        global_index_t v_offset = mesh->vertices.nb();
+
+        vec3 g = make_vec3(0.0, 0.0, 0.0);
+        if(shrink != 0.0) {
+            const_cast<ConvexCell*>(this)->compute_geometry();
+            g = barycenter();
+        }
+
+        vector<index_t> v2t(nb_v(),index_t(-1));
+        vector<index_t> t_index(nb_t(),index_t(-1));
+        index_t nt=0;
+
+        {
+            index_t t = first_valid_;
+            while(t != END_OF_LIST) {
+                TriangleWithFlags T = get_triangle_and_flags(t);
+                vec4 p = compute_triangle_point(t);
+                p.x /= p.w;
+                p.y /= p.w;
+                p.z /= p.w;
+                p.w = 1.0;
+                if(shrink != 0.0) {
+                    p.x = shrink * g.x + (1.0 - shrink) * p.x;
+                    p.y = shrink * g.y + (1.0 - shrink) * p.y;
+                    p.z = shrink * g.z + (1.0 - shrink) * p.z;
+                }
+                mesh->vertices.create_vertex(p.data());
+                t_index[t] = nt;
+                ++nt;
+                v2t[T.i] = t;
+                v2t[T.j] = t;
+                v2t[T.k] = t;
+                t = index_t(T.flags);
+            }
+        }
+
+        for(index_t v=1; v<nb_v(); ++v) {
+            if(borders_only &&
+               has_vglobal() &&
+               v_global_index(v) != global_index_t(-1) &&
+               v_global_index(v) != global_index_t(-2) // This one for
+               // fluid free bndry
+              ) {
+                continue;
+            }
+            std::vector<global_index_t> facet_vertices;
+            if(v2t[v] != index_t(-1)) {
+                index_t t = v2t[v];
+                do {
+                    facet_vertices.push_back(t_index[t]+v_offset);
+                    index_t lv = triangle_find_vertex(t,v);
+                    t = triangle_adjacent(t, (lv + 1)%3);
+                } while(t != v2t[v]);
+            }
+            if(facet_vertices.size() < 3) {
+                continue;
+            }
+            global_index_t f = mesh->facets.create_polygon(
+                GEO::index_t(facet_vertices.size())
+            );
+            for(index_t i=0; i<facet_vertices.size(); ++i) {
+                mesh->facets.set_vertex(f, i, facet_vertices[i]);
+            }
+            if(facet_attr != nullptr && facet_attr->is_bound()) {
+                (*facet_attr)[f] = v_global_index(v);
+            }
+        }
+
+    }
+
+#endif
+
+    
+
+    bool ConvexCell::has_v_global_index(global_index_t v) const {
+        vbw_assert(has_vglobal_);
+        for(index_t i=0; i<nb_v(); ++i) {
+            if(vglobal_[i] == v) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+
+    void ConvexCell::clip_by_plane(vec4 eqn, global_index_t j) {
+        vbw_assert(has_vglobal_);
+        clip_by_plane(eqn);
+        vglobal_[nb_v()-1] = j;
+    }
+
+    void ConvexCell::clip_by_plane(vec4 eqn) {
+        geometry_dirty_ = true;
+        triangle_duals_valid_ = false;
+
+        index_t lv = nb_v_;
+        if(lv == max_v()) {
+            grow_v();
+        }
+        plane_eqn_[lv] = eqn;
+        vbw_assert(lv < max_v());
+        ++nb_v_;
+
+        // Step 1: Find conflict zone and link conflicted triangles
+        // (to recycle them in free list).
+
+        index_t conflict_head = END_OF_LIST;
+        index_t conflict_tail = END_OF_LIST;
+
+        // Classify triangles, compute conflict list and valid list.
+        // Note: This could be done by climbing from a random triangle,
+        // but here we prefer complete linear scan for several reasons:
+        //   - it is more robust to numerical errors (here we are not
+        //     using exact predicates).
+        //   - the code is simpler.
+        //   - and more importantly, we got no more than a few tenths of
+        //     vertices.
+        // The 'climbing from a random triangle' strategy is implemented
+        // in clip_by_plane_fast(). We keep both implementations for now,
+        // until we make sure than one is more efficient than the other one.
+
+        index_t t = first_valid_;
+        first_valid_ = END_OF_LIST;
+        while(t != END_OF_LIST) {
+            TriangleWithFlags T = get_triangle_and_flags(t);
+            if(triangle_is_in_conflict(T,eqn)) {
+                set_triangle_flags(
+                    t, ushort(conflict_head) | ushort(CONFLICT_MASK)
+                );
+                conflict_head = t;
+                if(conflict_tail == END_OF_LIST) {
+                    conflict_tail = t;
+                }
+            } else {
+                set_triangle_flags(t, ushort(first_valid_));
+                first_valid_ = t;
+            }
+            t = index_t(T.flags);
+        }
+
+        triangulate_conflict_zone(lv, conflict_head, conflict_tail);
+    }
+
+    // This version of clip_by_plane(), with a user-defined predicate,
+    // is duplicated from the standard version above. May be fixed by
+    // moving it to the header file (to have faster invokation of the
+    // predicate) and make the default version call it with PCK, but
+    // I do not want to do that because:
+    //    - will make the header more heavy, longer compilation time
+    //    - not sure about the impact on performance
+    //    - the function is short, not a big drama to duplicate it...
+    void ConvexCell::clip_by_plane(
+        vec4 eqn, global_index_t global_index,
+        std::function<bool(ushort,ushort)> triangle_conflict_predicate
+    ) {
+        geometry_dirty_ = true;
+        triangle_duals_valid_ = false;
+
+        index_t lv = nb_v_;
+        if(lv == max_v()) {
+            grow_v();
+        }
+        plane_eqn_[lv] = eqn;
+        vbw_assert(lv < max_v());
+        ++nb_v_;
+
+        // Note: it is unlikely that this function is used without
+        // global indices (because without global indices, it would
+        // mean we are only using geometry, then we should use the
+        // default predicate), so we could probably make it mandatory
+        // to have global indices here.
+        if(has_vglobal_) {
+            vglobal_[nb_v()-1] = global_index;
+        }
+
+
+        // Step 1: Find conflict zone and link conflicted triangles
+        // (to recycle them in free list).
+
+        index_t conflict_head = END_OF_LIST;
+        index_t conflict_tail = END_OF_LIST;
+
+        // Classify triangles, compute conflict list and valid list.
+        // Note: This could be done by climbing from a random triangle,
+        // but here we prefer complete linear scan for several reasons:
+        //   - it is more robust to numerical errors (here we are not
+        //     using exact predicates).
+        //   - the code is simpler.
+        //   - and more importantly, we got no more than a few tenths of
+        //     vertices.
+        // The 'climbing from a random triangle' strategy is implemented
+        // in clip_by_plane_fast(). We keep both implementations for now,
+        // until we make sure than one is more efficient than the other one
+        // (and clip_by_plane_fast() does not have a version with the user-
+        // defined predicate for now).
+
+        index_t t = first_valid_;
+        first_valid_ = END_OF_LIST;
+        while(t != END_OF_LIST) {
+            TriangleWithFlags T = get_triangle_and_flags(t);
+            if(triangle_conflict_predicate(ushort(t), ushort(nb_v()-1))) {
+                set_triangle_flags(
+                    t, ushort(conflict_head) | ushort(CONFLICT_MASK)
+                );
+                conflict_head = t;
+                if(conflict_tail == END_OF_LIST) {
+                    conflict_tail = t;
+                }
+            } else {
+                set_triangle_flags(t, ushort(first_valid_));
+                first_valid_ = t;
+            }
+            t = index_t(T.flags);
+        }
+
+        triangulate_conflict_zone(lv, conflict_head, conflict_tail);
+    }
+
+
+    void ConvexCell::clip_by_plane_fast(vec4 P, global_index_t j) {
+        vbw_assert(has_vglobal_);
+        clip_by_plane_fast(P);
+        vglobal_[nb_v()-1] = j;
+    }
+
+    void ConvexCell::clip_by_plane_fast(vec4 P) {
+        geometry_dirty_ = true;
+        triangle_duals_valid_ = false;
+        index_t lv = nb_v_;
+        if(lv == max_v()) {
+            grow_v();
+        }
+        plane_eqn_[lv] = P;
+        vbw_assert(lv < max_v());
+        ++nb_v_;
+
+        // Step 1: Find a good seed triangle (likely to
+        // be in conflict). If it is not in conflict,
+        // it is not a big problem (it will be just a
+        // bit slower), so we use inexact predicates
+        // here.
+
+        index_t t_init = END_OF_LIST;
+
+        {
+            index_t t_pred = END_OF_LIST;
+            index_t t = first_valid_;
+            if(t == END_OF_LIST) {
+                return;
+            }
+
+            auto triangle_distance = [this](index_t t_in, vec4 P_in) {
+                Triangle T = get_triangle(t_in);
+                vbw_assert(T.i != VERTEX_AT_INFINITY);
+                vbw_assert(T.j != VERTEX_AT_INFINITY);
+                vbw_assert(T.k != VERTEX_AT_INFINITY);
+                vec4 p1 = vertex_plane(T.i);
+                vec4 p2 = vertex_plane(T.j);
+                vec4 p3 = vertex_plane(T.k);
+                return det4x4(
+                    p1.x, p2.x, p3.x, P_in.x,
+                    p1.y, p2.y, p3.y, P_in.y,
+                    p1.z, p2.z, p3.z, P_in.z,
+                    p1.w, p2.w, p3.w, P_in.w
+                );
+            };
+
+            index_t count = 100;
+            double  t_dist = triangle_distance(t,P);
+
+        still_walking:
+            for(index_t le=0; le<3; ++le) {
+                index_t t_next = triangle_adjacent(t, le);
+                if(t_next == t_pred) {
+                    continue;
+                }
+                double t_next_dist = triangle_distance(t_next,P);
+                if(t_next_dist < t_dist) {
+                    continue;
+                }
+                --count;
+                t_pred = t;
+                t = t_next;
+                t_dist = t_next_dist;
+                if(count > 0 && t_dist < 0.0) {
+                    goto still_walking;
+                }
+            }
+            t_init = t;
+        }
+
+        // note: t_init is now one triangle, probably in conflict
+        // (but not always: there can be degenerate cases where count
+        //  reach zero). When t_init is in conflict, it is in general
+        //  not the "highest" triangle (as one expect in a Delaunay
+        //  triangulation code, but here it is different).
+
+
+        // Step 2: mark all the triangles that have the same
+        // conflict status as t_init with CONFLICT_MASK
+        // (even if t_init was not in conflict, then we will
+        //  swap confict mask)
+
+        bool t_init_is_in_conflict = triangle_is_in_conflict(
+            get_triangle_and_flags(t_init), P
+        );
+
+        {
+            ushort* buff = (ushort*)alloca(max_t_*sizeof(ushort));
+            SmallStack_ushort S(buff, int(max_t_));
+            S.push(ushort(t_init));
+            set_triangle_flags(
+                t_init,
+                get_triangle_flags(t_init) |
+                ushort(CONFLICT_MASK) |
+                ushort(MARKED_MASK)
+            );
+            while(!S.empty()) {
+                index_t t = index_t(S.top());
+                S.pop();
+                for(index_t le=0; le<3; ++le) {
+                    index_t t_neigh = triangle_adjacent(t,le);
+                    if(
+                        (get_triangle_flags(t_neigh) & ushort(MARKED_MASK))
+                        == 0
+                    ) {
+                        if( triangle_is_in_conflict(
+                                get_triangle_and_flags(t_neigh), P
+                            ) == t_init_is_in_conflict
+                          ) {
+                            set_triangle_flags(
+                                t_neigh,
+                                get_triangle_flags(t_neigh) |
+                                ushort(CONFLICT_MASK) |
+                                ushort(MARKED_MASK)
+                            );
+                            S.push(ushort(t_neigh));
+                        } else {
+                            set_triangle_flags(
+                                t_neigh,
+                                get_triangle_flags(t_neigh) |
+                                ushort(MARKED_MASK)
+                            );
+                        }
+                    }
+                }
+            }
+        }
+
+        // Step 3: update conflict list and active triangles list
+        index_t conflict_head = END_OF_LIST;
+        index_t conflict_tail = END_OF_LIST;
+        {
+            index_t new_first_valid = END_OF_LIST;
+            index_t t = first_valid_;
+            while(t != END_OF_LIST) {
+                bool t_is_in_conflict = triangle_is_marked_as_conflict(t);
+                index_t t_next =
+                    index_t(
+                        get_triangle_flags(t) &
+                        ~(CONFLICT_MASK | MARKED_MASK)
+                    );
+                // Flip conflict flag if t_init was not in conflict.
+                if(!t_init_is_in_conflict) {
+                    t_is_in_conflict = !t_is_in_conflict;
+                }
+                if(t_is_in_conflict) {
+                    set_triangle_flags(
+                        t, ushort(conflict_head) | ushort(CONFLICT_MASK)
+                    );
+                    conflict_head = t;
+                    if(conflict_tail == END_OF_LIST) {
+                        conflict_tail = t;
+                    }
+                } else {
+                    set_triangle_flags(t, ushort(new_first_valid));
+                    new_first_valid = t;
+                }
+                t = t_next;
+            }
+            first_valid_ = new_first_valid;
+        }
+
+        triangulate_conflict_zone(lv, conflict_head, conflict_tail);
+    }
+
+    
+
+    void ConvexCell::update_triangle_dual(index_t t) {
+        TriangleWithFlags T = get_triangle_and_flags(t);
+        if(
+            T.i == VERTEX_AT_INFINITY ||
+            T.j == VERTEX_AT_INFINITY ||
+            T.k == VERTEX_AT_INFINITY
+        ) {
+            // Left to triangle_is_in_conflict()
+            double nan = std::numeric_limits<double>::quiet_NaN();
+            for(index_t c=0; c<8; ++c) {
+                triangle_dual_[c][t] = nan;
+            }
+            return;
+        }
+
+        //   Same minors as det4x4() in triangle_is_in_conflict(), with the
+        // plane equation in the last column: the determinant is
+        //   m234*E.x - m134*E.y + m124*E.z - m123*E.w
+        // and is evaluated in the same order, so that the inexact mode
+        // gives the same result bit for bit. The permanents (same
+        // expressions with absolute values) bound the rounding errors.
+        vec4 p1 = vertex_plane(T.i);
+        vec4 p2 = vertex_plane(T.j);
+        vec4 p3 = vertex_plane(T.k);
+
+        double m12 = p1.y*p2.x - p1.x*p2.y;
+        double m13 = p1.z*p2.x - p1.x*p2.z;
+        double m14 = p1.w*p2.x - p1.x*p2.w;
+        double m23 = p1.z*p2.y - p1.y*p2.z;
+        double m24 = p1.w*p2.y - p1.y*p2.w;
+        double m34 = p1.w*p2.z - p1.z*p2.w;
+
+        double m123 = m23*p3.x - m13*p3.y + m12*p3.z;
+        double m124 = m24*p3.x - m14*p3.y + m12*p3.w;
+        double m134 = m34*p3.x - m14*p3.z + m13*p3.w;
+        double m234 = m34*p3.y - m24*p3.z + m23*p3.w;
+
+        triangle_dual_[0][t] = m234;
+        triangle_dual_[1][t] = -m134;
+        triangle_dual_[2][t] = m124;
+        triangle_dual_[3][t] = -m123;
+
+        vec4 a1 = make_vec4(
+            std::fabs(p1.x), std::fabs(p1.y), std::fabs(p1.z), std::fabs(p1.w)
+        );
+        vec4 a2 = make_vec4(
+            std::fabs(p2.x), std::fabs(p2.y), std::fabs(p2.z), std::fabs(p2.w)
+        );
+        vec4 a3 = make_vec4(
+            std::fabs(p3.x), std::fabs(p3.y), std::fabs(p3.z), std::fabs(p3.w)
+        );
+
+        double q12 = a1.y*a2.x + a1.x*a2.y;
+        double q13 = a1.z*a2.x + a1.x*a2.z;
+        double q14 = a1.w*a2.x + a1.x*a2.w;
+        double q23 = a1.z*a2.y + a1.y*a2.z;
+        double q24 = a1.w*a2.y + a1.y*a2.w;
+        double q34 = a1.w*a2.z + a1.z*a2.w;
+
+        triangle_dual_[4][t] = q34*a3.y + q24*a3.z + q23*a3.w;
+        triangle_dual_[5][t] = q34*a3.x + q14*a3.z + q13*a3.w;
+        triangle_dual_[6][t] = q24*a3.x + q14*a3.y + q12*a3.w;
+        triangle_dual_[7][t] = q23*a3.x + q13*a3.y + q12*a3.z;
+    }
+
+    void ConvexCell::update_triangle_duals() {
+        if(triangle_dual_[0].size() < max_t()) {
+            for(index_t c=0; c<8; ++c) {
+                triangle_dual_[c].resize(max_t());
+            }
+            triangle_status_.resize(max_t());
+        }
+        if(triangle_duals_valid_) {
+            return;
+        }
+        for(
+            index_t t = first_valid_; t != END_OF_LIST;
+            t = index_t(get_triangle_flags(t))
+        ) {
+            update_triangle_dual(t);
+        }
+        triangle_duals_valid_ = true;
+    }
+
+    void ConvexCell::classify_triangles_vectorized(vec4 P) {
+        //   The determinants of all the triangles below nb_t_ are
+        // evaluated, free ones included (their status is not read).
+        //   With exact predicates, a determinant is trusted when larger
+        // than its error bound (about 9 ulps of the permanent for this
+        // expansion, taken with a margin) and than a floor below which
+        // underflow could dominate. Else (and for NaNs, i.e. infinite
+        // triangles) the triangle is undecided.
+        double scale = 0.0;
+        double floor = 0.0;
+#ifndef STANDALONE_CONVEX_CELL
+        if(use_exact_predicates_) {
+            scale = 1e-14;
+            floor = 1e-280;
+        }
+#endif
+        double E[4]  = { P.x, P.y, P.z, P.w };
+        double aE[4] = {
+            std::fabs(P.x)*scale, std::fabs(P.y)*scale,
+            std::fabs(P.z)*scale, std::fabs(P.w)*scale
+        };
+        const double* h0 = triangle_dual_[0].data();
+        const double* h1 = triangle_dual_[1].data();
+        const double* h2 = triangle_dual_[2].data();
+        const double* h3 = triangle_dual_[3].data();
+        const double* q0 = triangle_dual_[4].data();
+        const double* q1 = triangle_dual_[5].data();
+        const double* q2 = triangle_dual_[6].data();
+        const double* q3 = triangle_dual_[7].data();
+        uchar* status = triangle_status_.data();
+
+        index_t t = 0;
+#if defined(__wasm_simd128__)
+        {
+            v128_t vE0 = wasm_f64x2_splat(E[0]);
+            v128_t vE1 = wasm_f64x2_splat(E[1]);
+            v128_t vE2 = wasm_f64x2_splat(E[2]);
+            v128_t vE3 = wasm_f64x2_splat(E[3]);
+            v128_t vA0 = wasm_f64x2_splat(aE[0]);
+            v128_t vA1 = wasm_f64x2_splat(aE[1]);
+            v128_t vA2 = wasm_f64x2_splat(aE[2]);
+            v128_t vA3 = wasm_f64x2_splat(aE[3]);
+            v128_t vfloor = wasm_f64x2_splat(floor);
+            for(; t + 2 <= nb_t_; t += 2) {
+                v128_t d = wasm_f64x2_mul(wasm_v128_load(h0+t), vE0);
+                d = wasm_f64x2_add(d, wasm_f64x2_mul(wasm_v128_load(h1+t), vE1));
+                d = wasm_f64x2_add(d, wasm_f64x2_mul(wasm_v128_load(h2+t), vE2));
+                d = wasm_f64x2_add(d, wasm_f64x2_mul(wasm_v128_load(h3+t), vE3));
+                v128_t b = wasm_f64x2_mul(wasm_v128_load(q0+t), vA0);
+                b = wasm_f64x2_add(b, wasm_f64x2_mul(wasm_v128_load(q1+t), vA1));
+                b = wasm_f64x2_add(b, wasm_f64x2_mul(wasm_v128_load(q2+t), vA2));
+                b = wasm_f64x2_add(b, wasm_f64x2_mul(wasm_v128_load(q3+t), vA3));
+                b = wasm_f64x2_max(b, vfloor);
+                int in_conflict = int(wasm_i64x2_bitmask(wasm_f64x2_gt(d, b)));
+                int outside = int(wasm_i64x2_bitmask(
+                    wasm_f64x2_lt(d, wasm_f64x2_neg(b))
+                ));
+                int undecided = ~(in_conflict | outside);
+                status[t]   = uchar((in_conflict & 1) | ((undecided & 1) << 1));
+                status[t+1] = uchar(((in_conflict >> 1) & 1) | (undecided & 2));
+            }
+        }
+#elif defined(__SSE2__)
+        {
+            __m128d vE0 = _mm_set1_pd(E[0]);
+            __m128d vE1 = _mm_set1_pd(E[1]);
+            __m128d vE2 = _mm_set1_pd(E[2]);
+            __m128d vE3 = _mm_set1_pd(E[3]);
+            __m128d vA0 = _mm_set1_pd(aE[0]);
+            __m128d vA1 = _mm_set1_pd(aE[1]);
+            __m128d vA2 = _mm_set1_pd(aE[2]);
+            __m128d vA3 = _mm_set1_pd(aE[3]);
+            __m128d vfloor = _mm_set1_pd(floor);
+            __m128d zero = _mm_setzero_pd();
+            for(; t + 2 <= nb_t_; t += 2) {
+                __m128d d = _mm_mul_pd(_mm_loadu_pd(h0+t), vE0);
+                d = _mm_add_pd(d, _mm_mul_pd(_mm_loadu_pd(h1+t), vE1));
+                d = _mm_add_pd(d, _mm_mul_pd(_mm_loadu_pd(h2+t), vE2));
+                d = _mm_add_pd(d, _mm_mul_pd(_mm_loadu_pd(h3+t), vE3));
+                __m128d b = _mm_mul_pd(_mm_loadu_pd(q0+t), vA0);
+                b = _mm_add_pd(b, _mm_mul_pd(_mm_loadu_pd(q1+t), vA1));
+                b = _mm_add_pd(b, _mm_mul_pd(_mm_loadu_pd(q2+t), vA2));
+                b = _mm_add_pd(b, _mm_mul_pd(_mm_loadu_pd(q3+t), vA3));
+                // max() with the floor first: NaN bounds stay NaN
+                b = _mm_max_pd(vfloor, b);
+                int in_conflict = _mm_movemask_pd(_mm_cmpgt_pd(d, b));
+                int outside = _mm_movemask_pd(
+                    _mm_cmplt_pd(d, _mm_sub_pd(zero, b))
+                );
+                int undecided = ~(in_conflict | outside);
+                status[t]   = uchar((in_conflict & 1) | ((undecided & 1) << 1));
+                status[t+1] = uchar(((in_conflict >> 1) & 1) | (undecided & 2));
+            }
+        }
+#endif
+        for(; t < nb_t_; ++t) {
+            double d = h0[t]*E[0] + h1[t]*E[1] + h2[t]*E[2] + h3[t]*E[3];
+            double b = q0[t]*aE[0] + q1[t]*aE[1] + q2[t]*aE[2] + q3[t]*aE[3];
+            b = (b < floor) ? floor : b;
+            status[t] = (d > b) ? uchar(1) : ((d < -b) ? uchar(0) : uchar(2));
+        }
+    }
+
+    bool ConvexCell::clip_by_plane_with_duals(
+        vec4 P, bool skip_if_no_conflict
+    ) {
+        update_triangle_duals();
+        classify_triangles_vectorized(P);
+
+        // Resolve the undecided triangles
+        bool has_conflict = false;
+        for(
+            index_t t = first_valid_; t != END_OF_LIST;
+            t = index_t(get_triangle_flags(t))
+        ) {
+            if(triangle_status_[t] == 2) {
+                triangle_status_[t] = uchar(
+                    triangle_is_in_conflict(get_triangle_and_flags(t), P)
+                );
+            }
+            has_conflict = has_conflict || (triangle_status_[t] != 0);
+        }
+
+        if(!has_conflict && skip_if_no_conflict) {
+            return false;
+        }
+
+        geometry_dirty_ = true;
+        index_t lv = nb_v_;
+        if(lv == max_v()) {
+            grow_v();
+        }
+        plane_eqn_[lv] = P;
+        vbw_assert(lv < max_v());
+        ++nb_v_;
+
+        if(!has_conflict) {
+            return false;
+        }
+
+        // Same list split as clip_by_plane()
+        index_t conflict_head = END_OF_LIST;
+        index_t conflict_tail = END_OF_LIST;
+        index_t t = first_valid_;
+        first_valid_ = END_OF_LIST;
+        while(t != END_OF_LIST) {
+            TriangleWithFlags T = get_triangle_and_flags(t);
+            if(triangle_status_[t] != 0) {
+                set_triangle_flags(
+                    t, ushort(conflict_head) | ushort(CONFLICT_MASK)
+                );
+                conflict_head = t;
+                if(conflict_tail == END_OF_LIST) {
+                    conflict_tail = t;
+                }
+            } else {
+                set_triangle_flags(t, ushort(first_valid_));
+                first_valid_ = t;
+            }
+            t = index_t(T.flags);
+        }
+
+        index_t first_kept = first_valid_;
+        triangulate_conflict_zone(lv, conflict_head, conflict_tail);
+
+        //   The new triangles were pushed in front of the valid list, they
+        // may have grown the triangle arrays.
+        if(triangle_dual_[0].size() < max_t()) {
+            for(index_t c=0; c<8; ++c) {
+                triangle_dual_[c].resize(max_t());
+            }
+            triangle_status_.resize(max_t());
+        }
+        for(
+            t = first_valid_; t != first_kept;
+            t = index_t(get_triangle_flags(t))
+        ) {
+            update_triangle_dual(t);
+        }
+        return true;
+    }
+
+    void ConvexCell::clip_by_plane_vectorized(vec4 P) {
+        clip_by_plane_with_duals(P, false);
+    }
+
+    void ConvexCell::clip_by_plane_vectorized(vec4 P, global_index_t j) {
+        vbw_assert(has_vglobal_);
+        clip_by_plane_with_duals(P, false);
+        vglobal_[nb_v()-1] = j;
+    }
+
+    double ConvexCell::squared_radius_from_duals(vec3 center) const {
+        double result = 0.0;
+        for(
+            index_t t = first_valid_; t != END_OF_LIST;
+            t = index_t(get_triangle_flags(t))
+        ) {
+            double w = triangle_dual_[3][t];
+            // Unbounded cell (NaN for infinite triangles)
+            if(!(w != 0.0) || std::isnan(triangle_dual_[0][t])) {
+                return std::numeric_limits<double>::infinity();
+            }
+            double x = triangle_dual_[0][t] / w - center.x;
+            double y = triangle_dual_[1][t] / w - center.y;
+            double z = triangle_dual_[2][t] / w - center.z;
+            result = std::max(result, x*x + y*y + z*z);
+        }
+        return result;
+    }
+
+    index_t ConvexCell::clip_by_planes(
+        vec3 center, index_t nb_planes, const vec4* P,
+        const global_index_t* j
+    ) {
+        vbw_assert(j == nullptr || has_vglobal_);
+
+        //   Signed distance from center to each plane, negative when center
+        // is on the clipped side (such planes come first and are always
+        // tried).
+        vector<std::pair<double, index_t> >& order = clip_order_;
+        order.resize(nb_planes);
+        for(index_t k=0; k<nb_planes; ++k) {
+            vec4 E = P[k];
+            double n2 = E.x*E.x + E.y*E.y + E.z*E.z;
+            double s = E.x*center.x + E.y*center.y + E.z*center.z + E.w;
+            double d = (n2 > 0.0) ? s / ::sqrt(n2) :
+                -std::numeric_limits<double>::infinity();
+            order[k] = std::make_pair(d, k);
+        }
+        std::sort(order.begin(), order.end());
+
+        index_t result = 0;
+        update_triangle_duals();
+        double R2 = squared_radius_from_duals(center);
+        bool R2_is_stale = false;
+        for(index_t k=0; k<nb_planes; ++k) {
+            double d = order[k].first;
+            if(d > 0.0 && d*d > R2) {
+                //   The cell only shrinks, R2 can be recomputed once the
+                // next plane is beyond the stale bound.
+                if(R2_is_stale) {
+                    R2 = squared_radius_from_duals(center);
+                    R2_is_stale = false;
+                }
+                if(d*d > R2) {
+                    break;
+                }
+            }
+            index_t p = order[k].second;
+            if(clip_by_plane_with_duals(P[p], true)) {
+                if(j != nullptr) {
+                    vglobal_[nb_v()-1] = j[p];
+                }
+                R2_is_stale = true;
+                ++result;
+            }
+            if(empty()) {
+                break;
+            }
+        }
+        return result;
+    }
+
+    
+
+    void ConvexCell::triangulate_conflict_zone(
+        index_t lv, index_t conflict_head, index_t conflict_tail
+    ) {
+        // Special case: no triangle in conflict.
+        if(conflict_head == END_OF_LIST) {
+            return;
+        }
+
+
+        // Link the vertices on the border of the conflict zone.
+        // Consider the edge e of triangle t such that:
+        //    t is not marked as conflict
+        //    triangle_adjacent(t,e) is marked as conflict
+        // Let v1 = triangle_vertex(t, (e+1)%3)
+        //     v2 = triangle_vertex(t, (e+2)%3)
+        // We set:
+        //     v2t_[v1] = t
+        //     v2e_[v1] = e
+        // Once done for all the triangles, one can traverse the
+        // border of the conflict zone with:
+        //
+        // v = first_v_on_border]
+        // do {
+        //    t = v2t_[v];
+        //    e = v2t_[e];
+        //    do something with t,e
+        //    v = triangle_vertex(t, (e+2)%3);
+        // } while(v != first_v_on_border]);
+
+        geo_debug(index_t nb = 0); // for sanity check, nbr of vertices on border
+                                   // of conflict zone.
+
+        VBW::index_t first_v_on_border = END_OF_LIST;
+        for(
+            VBW::ushort t = first_triangle();
+            t != END_OF_LIST;
+            t = next_triangle(t)
+        ) {
+            vbw_assert(!triangle_is_marked_as_conflict(t));
+
+            if(triangle_is_marked_as_conflict(triangle_adjacent(t,0))) {
+                first_v_on_border = triangle_vertex(t,1);
+                v2t_[first_v_on_border] = t;
+                v2e_[first_v_on_border] = 0;
+                geo_debug(++nb);
+            }
+            if(triangle_is_marked_as_conflict(triangle_adjacent(t,1))) {
+                first_v_on_border = triangle_vertex(t,2);
+                v2t_[first_v_on_border] = t;
+                v2e_[first_v_on_border] = 1;
+                geo_debug(++nb);
+            }
+            if(triangle_is_marked_as_conflict(triangle_adjacent(t,2))) {
+                first_v_on_border = triangle_vertex(t,0);
+                v2t_[first_v_on_border] = t;
+                v2e_[first_v_on_border] = 2;
+                geo_debug(++nb);
+            }
+        }
+
+        geo_debug(index_t nb2 = 0); // for sanity check, number of vertices on border
+        // of conflict zone (should match nb).
+
+        // Traverse the list of edges on the border of the conflict zone
+        // (see previous comment block for explanations). For each edge
+        // on the border of the conflict zone, generate a new triangle.
+        // - Connect it to the triangle on the border of the conflict zone
+        // - Connect it to the previous new triangle
+        // - Special case: in the end, connect the first new triangle with
+        //    the last one.
+
+        // check we are not in the special case with all triangles in conflict
+        if(first_v_on_border != END_OF_LIST) {
+            VBW::index_t v = first_v_on_border;
+            VBW::ushort prev_new_t  = VBW::ushort(-1);
+            VBW::ushort first_new_t = VBW::ushort(-1);
+            do {
+                geo_debug(++nb2);
+                index_t t = v2t_[v];
+                index_t e = v2e_[v];
+                index_t v1 = triangle_vertex(t, (e+1)%3);
+                index_t v2 = triangle_vertex(t, (e+2)%3);
+                vbw_assert(v1 == v);
+                VBW::ushort new_t = VBW::ushort(new_triangle(lv, v2, v1));
+                set_triangle_adjacent(new_t, 0, t);
+                set_triangle_adjacent(t, e, new_t);
+                if(prev_new_t == VBW::ushort(-1)) {
+                    first_new_t = new_t;
+                } else {
+                    set_triangle_adjacent(prev_new_t, 2, new_t);
+                    set_triangle_adjacent(new_t, 1, prev_new_t);
+                }
+                prev_new_t = new_t;
+                v = v2;
+            } while (v != first_v_on_border);
+            set_triangle_adjacent(prev_new_t, 2, first_new_t);
+            set_triangle_adjacent(first_new_t, 1, prev_new_t);
+        }
+
+        vbw_assert(nb2 == nb);
+
+        // Recycle triangles in conflict zone
+        set_triangle_flags(conflict_tail, ushort(first_free_));
+        first_free_ = conflict_head;
+    }
+
+
+    
+
+    bool ConvexCell::triangle_is_in_conflict(
+        TriangleWithFlags T, const vec4& eqn
+    ) const {
+#ifndef STANDALONE_CONVEX_CELL
+        if(use_exact_predicates_) {
+            if(T.i == VERTEX_AT_INFINITY) {
+                vec3 E  = make_vec3(eqn.x, eqn.y, eqn.z);
+                vec3 n2 = vertex_plane_normal(T.j);
+                vec3 n3 = vertex_plane_normal(T.k);
+                return(GEO::PCK::det_3d(E.data(), n2.data(), n3.data()) <= 0);
+            }
+
+            if(T.j == VERTEX_AT_INFINITY) {
+                vec3 E  = make_vec3(eqn.x, eqn.y, eqn.z);
+                vec3 n3 = vertex_plane_normal(T.k);
+                vec3 n1 = vertex_plane_normal(T.i);
+                return(GEO::PCK::det_3d(n1.data(), E.data(), n3.data()) <= 0);
+            }
+
+            if(T.k == VERTEX_AT_INFINITY) {
+                vec3 E  = make_vec3(eqn.x, eqn.y, eqn.z);
+                vec3 n1 = vertex_plane_normal(T.i);
+                vec3 n2 = vertex_plane_normal(T.j);
+                return(GEO::PCK::det_3d(n1.data(), n2.data(), E.data()) <= 0);
+            }
+
+            //   The triangle is in conflict with eqn if the
+            // result of compute_triangle_point(t) injected in eqn
+            // has a negative sign.
+            //   Examining the formula in compute_triangle_point(),
+            // this corresponds to (minus) the 4x4 determinant of the
+            // 4 plane equations developed w.r.t. the 4th column.
+            // (see Edelsbrunner - Simulation of Simplicity for similar examples
+            //  of computations).
+
+            vec4 p1 = vertex_plane(T.i);
+            vec4 p2 = vertex_plane(T.j);
+            vec4 p3 = vertex_plane(T.k);
+
+            return(GEO::PCK::det_4d(
+                       p1.data(), p2.data(), p3.data(), eqn.data()) >= 0
+                  );
+        }
+#endif
+
+        double det = 0.0;
+
+        // If one of the vertices of the triangle is the
+        // vertex at infinity, then the triangle is in conflict
+        // with eqn if the oriented director vector of the intersection
+        // between the two planes of the two other vertices
+        // is opposite to the normal vector to eqn.
+
+        if(T.i == VERTEX_AT_INFINITY) {
+            vec3 n2 = vertex_plane_normal(T.j);
+            vec3 n3 = vertex_plane_normal(T.k);
+            det = -det3x3(
+                eqn.x, n2.x, n3.x,
+                eqn.y, n2.y, n3.y,
+                eqn.z, n2.z, n3.z
+            );
+        } else if(T.j == VERTEX_AT_INFINITY) {
+            vec3 n3 = vertex_plane_normal(T.k);
+            vec3 n1 = vertex_plane_normal(T.i);
+            det = -det3x3(
+                n1.x, eqn.x, n3.x,
+                n1.y, eqn.y, n3.y,
+                n1.z, eqn.z, n3.z
+            );
+        } else if(T.k == VERTEX_AT_INFINITY) {
+            vec3 n1 = vertex_plane_normal(T.i);
+            vec3 n2 = vertex_plane_normal(T.j);
+            det = -det3x3(
+                n1.x, n2.x, eqn.x,
+                n1.y, n2.y, eqn.y,
+                n1.z, n2.z, eqn.z
+            );
+        } else {
+
+            //   The triangle is in conflict with eqn if the
+            // result of compute_triangle_point(t) injected in eqn
+            // has a negative sign.
+            //   Examining the formula in compute_triangle_point(),
+            // this corresponds to (minus) the 4x4 determinant of the 4 plane
+            // equations developed w.r.t. the 4th column.
+            // (see Edelsbrunner - Simulation of Simplicity for similar examples
+            //  of computations).
+
+            vec4 p1 = vertex_plane(T.i);
+            vec4 p2 = vertex_plane(T.j);
+            vec4 p3 = vertex_plane(T.k);
+            det = det4x4(
+                p1.x, p2.x, p3.x, eqn.x,
+                p1.y, p2.y, p3.y, eqn.y,
+                p1.z, p2.z, p3.z, eqn.z,
+                p1.w, p2.w, p3.w, eqn.w
+            );
+        }
+        return (det > 0.0);
+    }
+
+    vec4 ConvexCell::compute_triangle_point(index_t t) const {
+
+        double infinite_len = 16.0;
+        TriangleWithFlags T = get_triangle_and_flags(t);
+
+        // Special cases with one of the three vertices at infinity.
+        if(T.i == VERTEX_AT_INFINITY) {
+            vec4 Pj = vertex_plane(T.j);
+            vec4 Pk = vertex_plane(T.k);
+            vec3 Njk = normalize(cross(
+                                     make_vec3(Pj.x, Pj.y, Pj.z),
+                                     make_vec3(Pk.x, Pk.y, Pk.z)
+                                 ));
+            index_t t_adj = t_adj_[t].i; // vv2t(T.k, T.j);
+            vbw_assert(!triangle_is_infinite(t_adj));
+            vec4 result = compute_triangle_point(t_adj);
+            result.x += result.w * Njk.x * infinite_len;
+            result.y += result.w * Njk.y * infinite_len;
+            result.z += result.w * Njk.z * infinite_len;
+            return result;
+        } else if(T.j == VERTEX_AT_INFINITY) {
+            vec4 Pk = vertex_plane(T.k);
+            vec4 Pi = vertex_plane(T.i);
+            vec3 Nki = normalize(cross(
+                                     make_vec3(Pk.x, Pk.y, Pk.z),
+                                     make_vec3(Pi.x, Pi.y, Pi.z)
+                                 ));
+            index_t t_adj = t_adj_[t].j; // vv2t(T.i, T.k);
+            vbw_assert(!triangle_is_infinite(t_adj));
+            vec4 result = compute_triangle_point(t_adj);
+            result.x += result.w * Nki.x * infinite_len;
+            result.y += result.w * Nki.y * infinite_len;
+            result.z += result.w * Nki.z * infinite_len;
+            return result;
+        } else if(T.k == VERTEX_AT_INFINITY) {
+            vec4 Pi = vertex_plane(T.i);
+            vec4 Pj = vertex_plane(T.j);
+            vec3 Nij = normalize(cross(
+                                     make_vec3(Pi.x, Pi.y, Pi.z),
+                                     make_vec3(Pj.x, Pj.y, Pj.z)
+                                 ));
+            index_t t_adj = t_adj_[t].k; // vv2t(T.j, T.i);
+            vbw_assert(!triangle_is_infinite(t_adj));
+            vec4 result = compute_triangle_point(t_adj);
+            result.x += result.w * Nij.x * infinite_len;
+            result.y += result.w * Nij.y * infinite_len;
+            result.z += result.w * Nij.z * infinite_len;
+            return result;
+        }
+
+        // Get the plane equations associated with each vertex of t
+
+        vec4 pi1 = vertex_plane(T.i);
+        vec4 pi2 = vertex_plane(T.j);
+        vec4 pi3 = vertex_plane(T.k);
+
+        // Find the intersection of the three planes using Cramer's formula.
+        // (see Edelsbrunner - Simulation of Simplicity for other examples).
+        //
+        // Cramer's formula: each component of the solution is obtained as
+        //  the ratio of two determinants:
+        //   - the determinant of the system where the ith column is replaced
+        //     with the rhs
+        //   divided by:
+        //   - the determinant of the system.
+        //
+        // System of equations to be solved:
+        // pi1.x * x + pi1.y * y + pi1.z * z = -pi1.w
+        // pi2.x * x + pi2.y * y + pi2.z * z = -pi2.w
+        // pi3.x * x + pi3.y * y + pi3.z * z = -pi3.w
+        //
+        // Expression of the solution given by Cramer's formula:
+        //     | -pi1.w   p1.y   pi1.z |   | pi1.x  pi1.y  pi1.z |
+        // x = | -pi2.w   p2.y   pi2.z | / | pi2.x  pi2.y  pi2.z |
+        //     | -pi3.w   p3.y   pi3.z |   | pi3.x  pi3.y  pi3.z |
+        //
+        //     |  pi1.x  -p1.w   pi1.z |   | pi1.x  pi1.y  pi1.z |
+        // y = |  pi2.x  -p2.w   pi2.z | / | pi2.x  pi2.y  pi2.z |
+        //     |  pi3.x  -p3.w   pi3.z |   | pi3.x  pi3.y  pi3.z |
+        //
+        //     |  pi1.x   p1.y  -pi1.w |   | pi1.x  pi1.y  pi1.z |
+        // z = |  pi2.x   p2.y  -pi2.w | / | pi2.x  pi2.y  pi2.z |
+        //     |  pi3.x   p3.y  -pi3.w |   | pi3.x  pi3.y  pi3.z |
+
+        vec4 result;
+
+        result.x = -det3x3(
+            pi1.w, pi1.y, pi1.z,
+            pi2.w, pi2.y, pi2.z,
+            pi3.w, pi3.y, pi3.z
+        );
+
+        result.y = -det3x3(
+            pi1.x, pi1.w, pi1.z,
+            pi2.x, pi2.w, pi2.z,
+            pi3.x, pi3.w, pi3.z
+        );
+
+        result.z = -det3x3(
+            pi1.x, pi1.y, pi1.w,
+            pi2.x, pi2.y, pi2.w,
+            pi3.x, pi3.y, pi3.w
+        );
+
+        result.w = det3x3(
+            pi1.x, pi1.y, pi1.z,
+            pi2.x, pi2.y, pi2.z,
+            pi3.x, pi3.y, pi3.z
+        );
+
+        return result;
+    }
+
+    
+
+    void ConvexCell::grow_v() {
+        max_v_ *= 2;
+        plane_eqn_.resize(max_v_);
+        vglobal_.resize(max_v_, global_index_t(-1));
+        v2t_.resize(max_v_, ushort(-1));
+        v2e_.resize(max_v_, uchar(-1));
+    }
+
+    void ConvexCell::grow_t() {
+        max_t_ *= 2;
+        t_.resize(max_t_);
+        t_adj_.resize(max_t_);
+        if(has_tflags_) {
+            tflags_.resize(max_t_,0);
+        }
+    }
+
+    
+
+    void ConvexCell::kill_vertex(index_t v) {
+        triangle_duals_valid_ = false;
+        for(index_t t=0; t<nb_t(); ++t) {
+            Triangle T = get_triangle(t);
+            if(T.i == v) {
+                T.i = VERTEX_AT_INFINITY;
+            }
+            if(T.j == v) {
+                T.j = VERTEX_AT_INFINITY;
+            }
+            if(T.k == v) {
+                T.k = VERTEX_AT_INFINITY;
+            }
+            t_[t].i = T.i;
+            t_[t].j = T.j;
+            t_[t].k = T.k;
+        }
+    }
+
+    
+
+    void ConvexCell::compute_geometry() {
+        if(!geometry_dirty_) {
+            return;
+        }
+
+        triangle_point_.resize(nb_t());
+        v2t_.assign(max_v(),END_OF_LIST);
+
+        index_t t = first_valid_;
+        while(t != END_OF_LIST) {
+            TriangleWithFlags T = get_triangle_and_flags(t);
+            vec4 p = compute_triangle_point(t);
+            triangle_point_[t] = make_vec3(p.x/p.w, p.y/p.w, p.z/p.w);
+            v2t_[T.i] = ushort(t);
+            v2t_[T.j] = ushort(t);
+            v2t_[T.k] = ushort(t);
+            t = index_t(T.flags);
+        }
+
+        geometry_dirty_ = false;
+    }
+
+    inline double triangle_area(vec3 p1, vec3 p2, vec3 p3) {
+        double Ux = p2.x - p1.x;
+        double Uy = p2.y - p1.y;
+        double Uz = p2.z - p1.z;
+        double Vx = p3.x - p1.x;
+        double Vy = p3.y - p1.y;
+        double Vz = p3.z - p1.z;
+        double Wx = Uy * Vz - Uz * Vy;
+        double Wy = Uz * Vx - Ux * Vz;
+        double Wz = Ux * Vy - Uy * Vx;
+        return 0.5 * ::sqrt(Wx*Wx + Wy*Wy + Wz*Wz);
+    }
+
+    double ConvexCell::facet_area(index_t v) const {
+        vbw_assert(v < nb_v());
+        vbw_assert(!geometry_dirty_);
+
+        ushort t1t2[2];
+        index_t cur=0;
+        double result = 0.0;
+
+        if(v2t_[v] != END_OF_LIST) {
+            index_t t = v2t_[v];
+            index_t count = 0;
+            do {
+                if(cur < 2) {
+                    t1t2[cur] = ushort(t);
+                } else {
+                    result += triangle_area(
+                        triangle_point_[t1t2[0]],
+                        triangle_point_[t1t2[1]],
+                        triangle_point_[t]
+                    );
+                    t1t2[1] = ushort(t);
+                }
+                ++cur;
+                index_t lv = triangle_find_vertex(t,v);
+                t = triangle_adjacent(t, (lv + 1)%3);
+                ++count;
+                geo_assert(count < 100000);
+            } while(t != v2t_[v]);
+        }
+
+        return result;
+    }
+
+    inline double tet_volume(vec3 p1, vec3 p2, vec3 p3, vec3 p4) {
+        double Ux = p2.x - p1.x;
+        double Uy = p2.y - p1.y;
+        double Uz = p2.z - p1.z;
+
+        double Vx = p3.x - p1.x;
+        double Vy = p3.y - p1.y;
+        double Vz = p3.z - p1.z;
+
+        double Wx = p4.x - p1.x;
+        double Wy = p4.y - p1.y;
+        double Wz = p4.z - p1.z;
+
+        double UVx = Uy * Vz - Uz * Vy;
+        double UVy = Uz * Vx - Ux * Vz;
+        double UVz = Ux * Vy - Uy * Vx;
+
+        return ::fabs(
+            UVx * Wx + UVy * Wy + UVz * Wz
+        ) / 6.0;
+    }
+
+    double ConvexCell::volume() const {
+        vbw_assert(!geometry_dirty_);
+        double result = 0.0;
+
+        ushort t_origin = END_OF_LIST;
+        for(index_t v=0; v<nb_v_; ++v) {
+            if(v2t_[v] == END_OF_LIST) {
+                continue;
+            }
+            if(t_origin == END_OF_LIST) {
+                t_origin = v2t_[v];
+                continue;
+            }
+            ushort t1t2[2];
+            index_t cur=0;
+            index_t t = v2t_[v];
+
+            index_t count = 0;
+            do {
+                if(cur < 2) {
+                    t1t2[cur] = ushort(t);
+                } else {
+                    result += tet_volume(
+                        triangle_point_[t_origin],
+                        triangle_point_[t1t2[0]],
+                        triangle_point_[t1t2[1]],
+                        triangle_point_[t]
+                    );
+                    t1t2[1] = ushort(t);
+                }
+                ++cur;
+                index_t lv = triangle_find_vertex(t,v);
+                t = triangle_adjacent(t, (lv + 1)%3);
+                ++count;
+                geo_assert(count < 100000);
+            } while(t != v2t_[v]);
+        }
+        return result;
+    }
+
+    vec3 ConvexCell::barycenter() const {
+        vec3 result;
+        double m;
+        compute_mg(m, result);
+        if(m != 0.0) {
+            result.x /= m;
+            result.y /= m;
+            result.z /= m;
+        }
+        return result;
+    }
+
+    void ConvexCell::compute_mg(double& m, vec3& result) const {
+        vbw_assert(!geometry_dirty_);
+        result = make_vec3(0.0, 0.0, 0.0);
+        m = 0.0;
+
+        ushort t_origin = END_OF_LIST;
+        for(index_t v=0; v<nb_v_; ++v) {
+            if(v2t_[v] == END_OF_LIST) {
+                continue;
+            }
+            if(t_origin == END_OF_LIST) {
+                t_origin = v2t_[v];
+                continue;
+            }
+            ushort t1t2[2];
+            index_t cur=0;
+            index_t t = v2t_[v];
+            index_t count = 0;
+            do {
+                if(cur < 2) {
+                    t1t2[cur] = ushort(t);
+                } else {
+                    vec3 p = triangle_point_[t_origin];
+                    vec3 q = triangle_point_[t1t2[0]];
+                    vec3 r = triangle_point_[t1t2[1]];
+                    vec3 s = triangle_point_[t];
+                    double cur_m = tet_volume(p,q,r,s);
+                    m += cur_m;
+                    result.x += cur_m*(p.x + q.x + r.x + s.x)/4.0;
+                    result.y += cur_m*(p.y + q.y + r.y + s.y)/4.0;
+                    result.z += cur_m*(p.z + q.z + r.z + s.z)/4.0;
+                    t1t2[1] = ushort(t);
+                }
+                ++cur;
+                index_t lv = triangle_find_vertex(t,v);
+                t = triangle_adjacent(t, (lv + 1)%3);
+                ++count;
+                geo_assert(count < 100000);
+            } while(t != v2t_[v]);
+        }
+    }
+
+    
+
+
+    void ConvexCell::compute_second_moments(
+        double& m, vec3& mg, double I[6]
+    ) const {
+        vbw_assert(!geometry_dirty_);
+        mg = make_vec3(0.0, 0.0, 0.0);
+        m = 0.0;
+        for(index_t c=0; c<6; ++c) {
+            I[c] = 0.0;
+        }
+
+        ushort t_origin = END_OF_LIST;
+        for(index_t v=0; v<nb_v_; ++v) {
+            if(v2t_[v] == END_OF_LIST) {
+                continue;
+            }
+            if(t_origin == END_OF_LIST) {
+                t_origin = v2t_[v];
+                continue;
+            }
+            ushort t1t2[2];
+            index_t cur=0;
+            index_t t = v2t_[v];
+            index_t count = 0;
+            do {
+                if(cur < 2) {
+                    t1t2[cur] = ushort(t);
+                } else {
+                    const vec3 P[4] = {
+                        triangle_point_[t_origin],
+                        triangle_point_[t1t2[0]],
+                        triangle_point_[t1t2[1]],
+                        triangle_point_[t]
+                    };
+                    double cur_m = tet_volume(P[0],P[1],P[2],P[3]);
+                    vec3 s = P[0] + P[1] + P[2] + P[3];
+                    m += cur_m;
+                    mg += (cur_m/4.0) * s;
+                    double pp[6] = {
+                        s.x*s.x, s.x*s.y, s.x*s.z, s.y*s.y, s.y*s.z, s.z*s.z
+                    };
+                    for(index_t k=0; k<4; ++k) {
+                        pp[0] += P[k].x*P[k].x;
+                        pp[1] += P[k].x*P[k].y;
+                        pp[2] += P[k].x*P[k].z;
+                        pp[3] += P[k].y*P[k].y;
+                        pp[4] += P[k].y*P[k].z;
+                        pp[5] += P[k].z*P[k].z;
+                    }
+                    for(index_t c=0; c<6; ++c) {
+                        I[c] += cur_m * pp[c] / 20.0;
+                    }
+                    t1t2[1] = ushort(t);
+                }
+                ++cur;
+                index_t lv = triangle_find_vertex(t,v);
+                t = triangle_adjacent(t, (lv + 1)%3);
+                ++count;
+                geo_assert(count < 100000);
+            } while(t != v2t_[v]);
+        }
+    }
+
+    double ConvexCell::squared_radius(vec3 center) const {
+        double result = 0.0;
+        index_t t = first_valid_;
+        while(t != END_OF_LIST) {
+            TriangleWithFlags T = get_triangle_and_flags(t);
+            if(geometry_dirty_) {
+                vec4 p4 = compute_triangle_point(t);
+                vec3 p3 = make_vec3(
+                    p4.x/p4.w, p4.y/p4.w, p4.z/p4.w
+                );
+                result = std::max(result, squared_distance(center,p3));
+            } else {
+                vec3 p = triangle_point_[t];
+                result = std::max(result, squared_distance(center,p));
+            }
+            t = index_t(T.flags);
+        }
+        return result;
+    }
+
+    double ConvexCell::squared_inner_radius(vec3 center) const {
+        double result = std::numeric_limits<double>::max();
+        for(index_t v=0; v<nb_v(); ++v) {
+            vec4 P = vertex_plane(v);
+            // Ignore vertex at infinity.
+            if(P.x == 0.0 && P.y == 0.0 && P.z == 0.0) {
+                continue;
+            }
+            result = std::min(
+                result, squared_point_plane_distance(center, P)
+            );
+        }
+        return result;
+    }
+
+
+    void ConvexCell::connect_triangles() {
+        triangle_duals_valid_ = false;
+
+        // create array that maps vertices pairs to triangles.
+        // size of the array is nb_v squared.
+        // If nb_v is small, allocate it on the stack, else
+        // allocate it on the heap (allocating on the stack is
+        // interesting for multithreading).
+
+        const index_t MAX_NV_ON_STACK = 50;
+        index_t NV = nb_v();
+        ushort* vv2t =
+            (NV <= MAX_NV_ON_STACK) ? (ushort*)alloca(NV*NV*sizeof(ushort))
+            : new ushort[NV*NV]
+            ;
+
+#ifdef GEO_DEBUG
+        for(index_t i=0; i<NV*NV; ++i) {
+            vv2t[i] = END_OF_LIST;
+        }
+#endif
+
+        // For each triangle t, remember
+        // that t is adjacent to the three
+        // oriented edges (j,k), (k,i), (i,j)
+        for(
+            ushort t = first_triangle();
+            t != END_OF_LIST;
+            t = next_triangle(t)
+        ) {
+            Triangle T = t_[t];
+            vbw_assert(T.i < nb_v());
+            vbw_assert(T.j < nb_v());
+            vbw_assert(T.k < nb_v());
+            vv2t[NV*T.j + T.k] = t;
+            vv2t[NV*T.k + T.i] = t;
+            vv2t[NV*T.i + T.j] = t;
+        }
+
+        // For each triangle t, find the
+        // three triangles adjacent to its
+        // three edges (k,j), (i,k), (j,i)
+        // (in reverse order because we
+        //  want to find the three triangles
+        //  on the other side of the edges)
+        for(
+            ushort t = first_triangle();
+            t != END_OF_LIST;
+            t = next_triangle(t)
+        ) {
+            Triangle T = t_[t];
+            vbw_assert(vv2t[NV*T.j + T.i] != END_OF_LIST);
+            vbw_assert(vv2t[NV*T.k + T.j] != END_OF_LIST);
+            vbw_assert(vv2t[NV*T.i + T.k] != END_OF_LIST);
+            t_adj_[t] = make_triangle(
+                vv2t[NV*T.k + T.j],
+                vv2t[NV*T.i + T.k],
+                vv2t[NV*T.j + T.i]
+            );
+        }
+
+        if(NV > MAX_NV_ON_STACK) {
+            delete[] vv2t;
+        }
+    }
+
+    
+
+
+}
+
+/******* extracted from periodic.cpp *******/
+
+
+
+namespace GEO {
+
+    int Periodic::translation[27][3] = {
+        {  0,  0,  0}, //13 -> 0   +   <-- zero displacement is first.
+        { -1, -1, -1}, //0  -> 1   -
+        { -1, -1,  0}, //1  -> 2   -
+        { -1, -1,  1}, //2  -> 3   -
+        { -1,  0, -1}, //3  -> 4   -
+        { -1,  0,  0}, //4  -> 5   -
+        { -1,  0,  1}, //5  -> 6   -
+        { -1,  1, -1}, //6  -> 7   -
+        { -1,  1,  0}, //7  -> 8   -
+        { -1,  1,  1}, //8  -> 9   -
+        {  0, -1, -1}, //9  -> 10  -
+        {  0, -1,  0}, //10 -> 11  -
+        {  0, -1,  1}, //11 -> 12  -
+        {  0,  0, -1}, //12 -> 13  -
+        // (zero displacement was there)
+        {  0,  0,  1}, //14 -> 14  +
+        {  0,  1, -1}, //15 -> 15  -
+        {  0,  1,  0}, //16 -> 16  +
+        {  0,  1,  1}, //17 -> 17  +
+        {  1, -1, -1}, //18 -> 18  -
+        {  1, -1,  0}, //19 -> 19  -
+        {  1, -1,  1}, //20 -> 20  -
+        {  1,  0, -1}, //21 -> 21  -
+        {  1,  0,  0}, //22 -> 22  +
+        {  1,  0,  1}, //23 -> 23  +
+        {  1,  1, -1}, //24 -> 24  -
+        {  1,  1,  0}, //25 -> 25  +
+        {  1,  1,  1}  //26 -> 26  +
+    };
+
+    int Periodic::reorder_instances[27] = {
+        1 , 2 , 3 , 4 , 5 , 6 , 7 , 8 , 9 ,
+        10, 11, 12, 13, 0 , 14, 15, 16, 17,
+        18, 19, 20, 21, 22, 23, 24, 25, 26
+    };
+
+    bool Periodic::instance_is_positive[27] = {
+        true,  false, false, false, false, false,
+        false, false, false, false, false, false,
+        false, false, true,  false, true,  true,
+        false, false, false, false, true,  true,
+        false, true,  true
+    };
+}
+
+/******* extracted from periodic_delaunay_3d.cpp *******/
+
+
+
+#include <stack>
+#include <algorithm>
+
+#include <mutex>
+#include <condition_variable>
+
+// ParallelDelaunayThread class, declared locally, has
+// no out-of-line virtual functions. It is not a
+// problem since they are only visible from this translation
+// unit, but clang will complain.
+#ifdef __clang__
+#pragma GCC diagnostic ignored "-Wweak-vtables"
+#endif
+
+namespace {
+
+    using namespace GEO;
+
+    GEO::index_t thread_safe_random_(GEO::index_t choices_in) {
+#ifdef GARGANTUA
+        typedef Numeric::int64 Int;
+#else
+        typedef long int Int;
+#endif
+        GEO::signed_index_t choices = signed_index_t(choices_in);
+        static thread_local Int randomseed = 1l ;
+        if (choices >= 714025l) {
+            Int newrandom = (randomseed * 1366l + 150889l) % 714025l;
+            randomseed = (newrandom * 1366l + 150889l) % 714025l;
+            newrandom = newrandom * (choices / 714025l) + randomseed;
+            if (newrandom >= choices) {
+                return GEO::index_t(newrandom - choices);
+            } else {
+                return GEO::index_t(newrandom);
+            }
+        } else {
+            randomseed = (randomseed * 1366l + 150889l) % 714025l;
+            return GEO::index_t(randomseed % choices);
+        }
+    }
+
+    GEO::index_t thread_safe_random_4_() {
+        static thread_local long int randomseed = 1l ;
+        randomseed = (randomseed * 1366l + 150889l) % 714025l;
+        return GEO::index_t(randomseed % 4);
+    }
+
+    inline VBW::index_t pop_count(Numeric::uint32 x) {
+#if defined(GEO_COMPILER_GCC_FAMILY)
+        return VBW::index_t(Numeric::uint32(__builtin_popcount(x)));
+#elif defined(GEO_COMPILER_MSVC)
+#if defined(_M_ARM64)
+        return VBW::index_t(_CountOneBits(x));
+#else
+        return VBW::index_t(__popcnt(x));
+#endif
+#else
+        int result = 0;
+        for(int b=0; b<32; ++b) {
+            result += ((x & 1) != 0);
+            x >>= 1;
+        }
+        return VBW::index_t(result);
+#endif
+    }
+
+    
+
+    // TODO: move these two functions to mesh_reorder.h
+
+    void compute_BRIO_order_periodic_recursive(
+        GEO::index_t nb_vertices, const double* vertices,
+        GEO::index_t dimension, GEO::index_t stride,
+        vector<GEO::index_t>& sorted_indices,
+        vector<GEO::index_t>::iterator b,
+        vector<GEO::index_t>::iterator e,
+        const vec3& period,
+        GEO::index_t threshold,
+        double ratio,
+        GEO::index_t& depth,
+        vector<GEO::index_t>* levels
+    ) {
+        geo_debug_assert(e > b);
+
+        vector<GEO::index_t>::iterator m = b;
+        if(GEO::index_t(e - b) > threshold) {
+            ++depth;
+            m = b + int(double(e - b) * ratio);
+            compute_BRIO_order_periodic_recursive(
+                nb_vertices, vertices,
+                dimension, stride,
+                sorted_indices, b, m,
+		period,
+                threshold, ratio, depth,
+                levels
+            );
+        }
+
+        Hilbert_sort_periodic(
+            nb_vertices, vertices,
+            sorted_indices,
+            dimension,
+            stride,
+            m,
+	    e,
+            period
+        );
+
+        if(levels != nullptr) {
+            levels->push_back(GEO::index_t(e - sorted_indices.begin()));
+        }
+    }
+
+    void compute_BRIO_order_periodic(
+        GEO::index_t nb_vertices, const double* vertices,
+        GEO::index_t dimension, GEO::index_t stride,
+        vector<GEO::index_t>& sorted_indices,
+        vector<GEO::index_t>::iterator first,
+        vector<GEO::index_t>::iterator last,
+        const vec3& period,
+        GEO::index_t threshold = 64,
+        double ratio = 0.125,
+        vector<GEO::index_t>* levels = nullptr
+    ) {
+        if(levels != nullptr) {
+            levels->clear();
+            levels->push_back(GEO::index_t(first - sorted_indices.begin()));
+        }
+        GEO::index_t depth = 0;
+	GEO::random_shuffle(first, last);
+
+        compute_BRIO_order_periodic_recursive(
+            nb_vertices, vertices,
+            dimension, stride,
+            sorted_indices,
+            first, last,
+            period, threshold, ratio, depth, levels
+        );
+    }
+
+    
+
+    void delaunay_citations() {
+        geo_cite_with_info(
+            "DBLP:journals/cj/Bowyer81",
+            "One of the two initial references to the algorithm, "
+            "discovered independently and simultaneously by Bowyer and Watson."
+        );
+        geo_cite_with_info(
+            "journals/cj/Watson81",
+            "One of the two initial references to the algorithm, "
+            "discovered independently and simultaneously by Bowyer and Watson."
+        );
+        geo_cite_with_info(
+            "DBLP:conf/compgeom/AmentaCR03",
+            "Using spatial sorting has a dramatic impact on the performances."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/comgeo/FunkeMN05",
+            "Initializing \\verb|locate()| with a non-exact version "
+            " (structural filtering) gains (a bit of) performance."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/comgeo/BoissonnatDPTY02",
+            "The idea of traversing the cavity from inside "
+            " used in GEOGRAM is inspired by the implementation of "
+            " \\verb|Delaunay_triangulation_3| in CGAL."
+        );
+        geo_cite_with_info(
+            "DBLP:conf/imr/Si06",
+            "The triangulation data structure used in GEOGRAM is inspired "
+            "by Tetgen."
+        );
+        geo_cite_with_info(
+            "DBLP:journals/ijfcs/DevillersPT02",
+            "Analysis of the different versions of the line walk algorithm "
+            " used by \\verb|locate()|."
+        );
+    }
+}
+
+
+
+// These two functions are missing when compiling in PSM mode.
+#ifdef GEOGRAM_PSM
+    namespace GEO {
+	namespace PCK {
+	    inline Sign det_3d(const vec3& p0, const vec3& p1, const vec3& p2) {
+		return det_3d(p0.data(), p1.data(), p2.data());
+	    }
+	    inline Sign det_4d(
+		const vec4& p0, const vec4& p1,	const vec4& p2, const vec4& p3
+	    ) {
+		return det_4d(p0.data(), p1.data(), p2.data(), p3.data());
+	    }
+	}
+    }
+#endif
+
+
+
+namespace GEO {
+
+    class PeriodicDelaunay3dThread : public GEO::Thread, public Periodic {
+    public:
+        friend class PeriodicDelaunay3d;
+
+        static constexpr index_t NO_THREAD = CellStatusArray::FREE_CELL;
+
+        PeriodicDelaunay3dThread(
+            PeriodicDelaunay3d* master,
+            index_t pool_begin,
+            index_t pool_end
+        ) :
+            master_(master),
+            periodic_(master->periodic_),
+            period_(master->period_),
+            cell_to_v_store_(master_->cell_to_v_store_),
+            cell_to_cell_store_(master_->cell_to_cell_store_),
+            cell_next_(master_->cell_next_),
+            cell_status_(master_->cell_status_),
+            has_empty_cells_(false) {
+
+	    max_t_ = master_->cell_next_.size();
+
+	    nb_vertices_ = master_->nb_vertices();
+	    nb_vertices_non_periodic_ = master_->nb_vertices_non_periodic_;
+	    vertices_ = master_->vertex_ptr(0);
+	    weights_ = master_->weights_;
+	    dimension_ = master_->dimension();
+	    reorder_ = master_->reorder_.data();
+
+	    b_hint_ = NO_TETRAHEDRON;
+	    e_hint_ = NO_TETRAHEDRON;
+
+	    nb_rollbacks_ = 0;
+	    nb_failed_locate_ = 0;
+
+	    set_pool(pool_begin, pool_end);
+	}
+
+	void reset_stats() {
+	    nb_rollbacks_ = 0;
+	    nb_failed_locate_ = 0;
+	}
+
+        void set_pool(index_t pool_begin, index_t pool_end) {
+	    pool_begin_ = pool_begin;
+	    pool_end_ = pool_end;
+            // Initialize free list in memory pool
+            first_free_ = pool_begin;
+            for(index_t t=pool_begin; t<pool_end-1; ++t) {
+                cell_next_[t] = t+1;
+            }
+            cell_next_[pool_end-1] = END_OF_LIST;
+            nb_free_ = pool_end - pool_begin;
+            memory_overflow_ = false;
+            work_begin_ = NO_INDEX;
+            work_rbegin_ = NO_INDEX;
+            finished_ = false;
+            direction_ = true;
+#ifdef GEO_DEBUG
+            nb_acquired_tets_ = 0;
+#endif
+            interfering_thread_ = NO_THREAD;
+            nb_tets_to_create_ = 0;
+            t_boundary_ = NO_TETRAHEDRON;
+            f_boundary_ = NO_INDEX;
+            used_tets_end_ = pool_begin;
+        }
+
+        bool has_empty_cells() {
+            return has_empty_cells_;
+        }
+
+	index_t pick_random_tet() const {
+	    // Shit happens [Forrest Gump]
+	    if(used_tets_end_ == pool_begin_) {
+		return NO_TETRAHEDRON;
+	    }
+	    return pool_begin_ + thread_safe_random_(
+		used_tets_end_ - pool_begin_
+	    );
+	}
+
+        index_t nb_rollbacks() const {
+            return nb_rollbacks_;
+        }
+
+        index_t nb_failed_locate() const {
+            return nb_failed_locate_;
+        }
+
+        index_t nb_traversed_tets() const {
+            return nb_traversed_tets_;
+        }
+
+        void set_work(index_t b, index_t e) {
+            work_begin_ = b;
+            // e is one position past the last point index
+            // to insert. Internally we store the last point index
+	    // to insert (like rbegin in STL containers). This is
+	    // because we manipulate the point sequence to insert
+	    // from both ends.
+            work_rbegin_ = e-1;
+	    // reorder_ may have changed if new vertices were
+	    // inserted into it
+	    reorder_ = master_->reorder_.data();
+        }
+
+        index_t work_size() const {
+            if(work_begin_ == NO_INDEX && work_rbegin_ == NO_INDEX) {
+                return 0;
+            }
+            geo_debug_assert(work_begin_ != NO_INDEX);
+            geo_debug_assert(work_rbegin_ != NO_INDEX);
+            return std::max(work_rbegin_ - work_begin_ + 1, index_t(0));
+        }
+
+        index_t nb_threads() const {
+            return index_t(master_->threads_.size());
+        }
+
+        PeriodicDelaunay3dThread* thread(index_t t) {
+            return static_cast<PeriodicDelaunay3dThread*>(
+                master_->threads_[t].get()
+            );
+        }
+
+        void run() override {
+            has_empty_cells_ = false;
+            finished_ = false;
+
+            if(work_begin_ == NO_INDEX || work_rbegin_ == NO_INDEX) {
+                return ;
+            }
+
+            memory_overflow_ = false;
+
+            // Current hint associated with b
+            b_hint_ = NO_TETRAHEDRON;
+
+            // Current hint associated with e
+            e_hint_ = NO_TETRAHEDRON;
+
+            // If true, insert in b->e order,
+            // else insert in e->b order
+            direction_ = true;
+
+            while(
+                work_rbegin_ >= work_begin_ &&
+                !memory_overflow_ &&
+                !has_empty_cells_ &&
+                !master_->has_empty_cells_
+            ) {
+                index_t v = direction_ ? work_begin_ : work_rbegin_ ;
+                index_t& hint = direction_ ? b_hint_ : e_hint_ ;
+
+                // Try to insert v and update hint
+                bool success = insert(reorder_[v],hint);
+
+                //   Notify all threads that are waiting for
+                // this thread to release some tetrahedra.
+                send_event();
+
+                if(success) {
+                    if(direction_) {
+                        ++work_begin_;
+                    } else {
+                        --work_rbegin_;
+                    }
+                } else {
+                    ++nb_rollbacks_;
+                    if(interfering_thread_ != NO_THREAD) {
+                        if(id() < interfering_thread_) {
+                            // If this thread has a higher priority than
+                            // the one that interfered, wait for the
+                            // interfering thread to release the tets that
+                            // it holds (then the loop will retry to insert
+                            // the same vertex).
+                            wait_for_event(interfering_thread_);
+                        } else {
+                            // If this thread has a lower priority than
+                            // the interfering thread, try inserting
+                            // from the other end of the points sequence.
+                            direction_ = !direction_;
+                        }
+                    }
+                }
+            }
+
+            if(has_empty_cells_) {
+                master_->has_empty_cells_ = true;
+            }
+
+            //   Fix by Hiep Vu: wake up threads that potentially missed
+            // the previous wake ups.
+            mutex_.lock();
+	    finished_ = true;
+            send_event();
+            mutex_.unlock();
+        }
+
+        static constexpr index_t NO_TETRAHEDRON = NO_INDEX;
+
+        static constexpr index_t VERTEX_AT_INFINITY = NO_INDEX;
+
+
+        index_t max_t() const {
+            return max_t_;
+        }
+
+	void set_max_t(index_t max_t) {
+	    max_t_ = max_t;
+	}
+
+        bool tet_is_finite(index_t t) const {
+            return
+                cell_to_v_store_[4 * t]     != NO_INDEX &&
+                cell_to_v_store_[4 * t + 1] != NO_INDEX &&
+                cell_to_v_store_[4 * t + 2] != NO_INDEX &&
+                cell_to_v_store_[4 * t + 3] != NO_INDEX ;
+        }
+
+        bool tet_is_real(index_t t) const {
+            return !tet_is_free(t) && tet_is_finite(t);
+        }
+
+        bool tet_is_real_non_periodic(index_t t) const {
+            return !tet_is_free(t) && tet_is_finite(t) && (
+                finite_tet_vertex(t,0) < nb_vertices_non_periodic_ ||
+                finite_tet_vertex(t,1) < nb_vertices_non_periodic_ ||
+                finite_tet_vertex(t,2) < nb_vertices_non_periodic_ ||
+                finite_tet_vertex(t,3) < nb_vertices_non_periodic_ ) ;
+        }
+
+        bool tet_is_free(index_t t) const {
+            return tet_is_in_list(t);
+        }
+
+        bool tet_is_in_list(index_t t, index_t first) const {
+            for(
+                index_t cur = first; cur != END_OF_LIST;
+                cur = tet_next(cur)
+            ) {
+                if(cur == t) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+
+        index_t create_first_tetrahedron() {
+            index_t iv0,iv1,iv2,iv3;
+            if(nb_vertices() < 4) {
+                return NO_TETRAHEDRON;
+            }
+
+            iv0 = 0;
+
+            iv1 = 1;
+            while(
+                iv1 < nb_vertices_non_periodic_ &&
+                PCK::points_are_identical_3d(
+                    non_periodic_vertex_ptr(iv0),
+                    non_periodic_vertex_ptr(iv1)
+                )
+            ) {
+                ++iv1;
+            }
+            if(iv1 == nb_vertices()) {
+                return NO_TETRAHEDRON;
+            }
+
+            iv2 = iv1 + 1;
+            while(
+                iv2 < nb_vertices_non_periodic_ &&
+                PCK::points_are_colinear_3d(
+                    non_periodic_vertex_ptr(iv0),
+                    non_periodic_vertex_ptr(iv1),
+                    non_periodic_vertex_ptr(iv2)
+                )
+            ) {
+                ++iv2;
+            }
+            if(iv2 == nb_vertices()) {
+                return NO_TETRAHEDRON;
+            }
+
+            iv3 = iv2 + 1;
+            Sign s = ZERO;
+            while(
+                iv3 < nb_vertices_non_periodic_ &&
+                (s = PCK::orient_3d(
+                    non_periodic_vertex_ptr(iv0),
+                    non_periodic_vertex_ptr(iv1),
+                    non_periodic_vertex_ptr(iv2),
+                    non_periodic_vertex_ptr(iv3)
+                )) == ZERO
+            ) {
+                ++iv3;
+            }
+
+            if(iv3 == nb_vertices()) {
+                return NO_TETRAHEDRON;
+            }
+
+            geo_debug_assert(s != ZERO);
+
+            if(s == NEGATIVE) {
+                std::swap(iv2, iv3);
+            }
+
+            // Create the first tetrahedron
+            index_t t0 = new_tetrahedron(iv0, iv1, iv2, iv3);
+
+            // Create the first four virtual tetrahedra surrounding it
+            index_t t[4];
+            for(index_t f = 0; f < 4; ++f) {
+                // In reverse order since it is an adjacent tetrahedron
+                index_t v1 = tet_vertex(t0, tet_facet_vertex(f,2));
+                index_t v2 = tet_vertex(t0, tet_facet_vertex(f,1));
+                index_t v3 = tet_vertex(t0, tet_facet_vertex(f,0));
+                t[f] = new_tetrahedron(VERTEX_AT_INFINITY, v1, v2, v3);
+            }
+
+            // Connect the virtual tetrahedra to the real one
+            for(index_t f=0; f<4; ++f) {
+                set_tet_adjacent(t[f], 0, t0);
+                set_tet_adjacent(t0, f, t[f]);
+            }
+
+            // Interconnect the four virtual tetrahedra along their common
+            // faces
+            for(index_t f = 0; f < 4; ++f) {
+                // In reverse order since it is an adjacent tetrahedron
+                index_t lv1 = tet_facet_vertex(f,2);
+                index_t lv2 = tet_facet_vertex(f,1);
+                index_t lv3 = tet_facet_vertex(f,0);
+                set_tet_adjacent(t[f], 1, t[lv1]);
+                set_tet_adjacent(t[f], 2, t[lv2]);
+                set_tet_adjacent(t[f], 3, t[lv3]);
+            }
+
+            release_tets();
+
+            return t0;
+        }
+
+
+        index_t stellate_cavity(index_t v) {
+            index_t new_tet = NO_INDEX;
+
+            for(index_t f=0; f<cavity_.nb_facets(); ++f) {
+                index_t old_tet = cavity_.facet_tet(f);
+                index_t lf = cavity_.facet_facet(f);
+                index_t t_neigh = tet_adjacent(old_tet, lf);
+                index_t v1 = cavity_.facet_vertex(f,0);
+                index_t v2 = cavity_.facet_vertex(f,1);
+                index_t v3 = cavity_.facet_vertex(f,2);
+                new_tet = new_tetrahedron(v, v1, v2, v3);
+                set_tet_adjacent(new_tet, 0, t_neigh);
+                set_tet_adjacent(
+                    t_neigh, find_tet_adjacent(t_neigh,old_tet), new_tet
+                );
+                cavity_.set_facet_tet(f, new_tet);
+            }
+
+            for(index_t f=0; f<cavity_.nb_facets(); ++f) {
+                new_tet = cavity_.facet_tet(f);
+                index_t neigh1, neigh2, neigh3;
+                cavity_.get_facet_neighbor_tets(f, neigh1, neigh2, neigh3);
+                set_tet_adjacent(new_tet, 1, neigh1);
+                set_tet_adjacent(new_tet, 2, neigh2);
+                set_tet_adjacent(new_tet, 3, neigh3);
+            }
+
+            return new_tet;
+        }
+
+
+        bool insert(index_t v, index_t& hint) {
+
+            vec3 p = vertex(v);
+
+            Sign orient[4];
+            index_t t = locate(v,p,hint,orient);
+
+            //   locate() may fail due to tets already owned by
+            // other threads.
+            if(t == NO_TETRAHEDRON) {
+                ++nb_failed_locate_;
+                geo_debug_assert(nb_acquired_tets_ == 0);
+                return false;
+            }
+
+            //  At this point, t is a valid tetrahedron,
+            // and this thread acquired a lock on it.
+
+            // Test whether the point already exists in
+            // the triangulation. The point already exists
+            // if it's located on three faces of the
+            // tetrahedron returned by locate().
+            int nb_zero =
+                (orient[0] == ZERO) +
+                (orient[1] == ZERO) +
+                (orient[2] == ZERO) +
+                (orient[3] == ZERO) ;
+
+            if(nb_zero >= 3) {
+                release_tet(t);
+                return true;
+            }
+
+            geo_debug_assert(nb_acquired_tets_ == 1);
+
+            index_t t_bndry = NO_TETRAHEDRON;
+            index_t f_bndry = NO_INDEX;
+
+            vec4 p_lifted = lifted_vertex(v,p);
+
+            cavity_.clear();
+
+            bool ok = find_conflict_zone(v,p_lifted,t,t_bndry,f_bndry);
+
+            // When in multithreading mode, we cannot allocate memory
+            // dynamically and we use a fixed pool. If the fixed pool
+            // is full, then we exit the thread (and the missing points
+            // are inserted after, in sequential mode).
+            if(
+                nb_tets_to_create_ > nb_free_ &&
+                Process::is_running_threads()
+            ) {
+                memory_overflow_ = true;
+                ok = false;
+            }
+
+            if(!ok) {
+                //  At this point, this thread did not successfully
+                // acquire all the tets in the conflict zone, so
+                // we need to rollback.
+                release_tets();
+                geo_debug_assert(nb_acquired_tets_ == 0);
+                return false;
+            }
+
+            // The conflict list can be empty if
+            //  the triangulation is weighted and v is not visible
+            if(tets_to_delete_.size() == 0) {
+                release_tets();
+                geo_debug_assert(nb_acquired_tets_ == 0);
+                has_empty_cells_ = true;
+                return true;
+            }
+
+
+            geo_debug_assert(
+                nb_acquired_tets_ ==
+                tets_to_delete_.size() + tets_to_release_.size()
+            );
+
+#ifdef GEO_DEBUG
+            // Sanity check: make sure this threads owns all the tets
+            // in conflict and their neighbors.
+            for(index_t i=0; i<tets_to_delete_.size(); ++i) {
+                index_t tdel = tets_to_delete_[i];
+                geo_debug_assert(owns_tet(tdel));
+                for(index_t lf=0; lf<4; ++lf) {
+                    geo_debug_assert(tet_adjacent(tdel,lf) != NO_INDEX);
+                    geo_debug_assert(owns_tet(tet_adjacent(tdel,lf)));
+                }
+            }
+#endif
+            geo_debug_assert(owns_tet(t_bndry));
+            geo_debug_assert(owns_tet(tet_adjacent(t_bndry,f_bndry)));
+            geo_debug_assert(
+                !tet_is_marked_as_conflict(tet_adjacent(t_bndry,f_bndry))
+            );
+
+            //   At this point, this thread owns all the tets in conflict and
+            // their neighbors, therefore no other thread can interfere, and
+            // we can update the triangulation.
+
+            index_t new_tet = NO_INDEX;
+            if(cavity_.OK()) {
+                new_tet = stellate_cavity(v);
+            } else {
+                new_tet = stellate_conflict_zone_iterative(v,t_bndry,f_bndry);
+            }
+
+            // Recycle the tetrahedra of the conflict zone.
+            for(index_t i=0; i<tets_to_delete_.size()-1; ++i) {
+                cell_next_[tets_to_delete_[i]] = tets_to_delete_[i+1];
+            }
+            cell_next_[tets_to_delete_[tets_to_delete_.size()-1]] =
+                first_free_;
+            first_free_ = tets_to_delete_[0];
+            nb_free_ += nb_tets_in_conflict();
+
+            // Reset deleted tet.
+            // This is needed because we update_v_to_cell() in
+            // a transient state.
+            // Note: update_v_to_cell() is overloaded here,
+            // with a check on nb_vertices_non_periodic_,
+            // this is why the (-2) does not make everything crash.
+            for(index_t i=0; i<tets_to_delete_.size(); ++i) {
+                index_t tdel = tets_to_delete_[i];
+                set_tet_vertex(tdel, 0, VERTEX_OF_DELETED_TET);
+                set_tet_vertex(tdel, 1, VERTEX_OF_DELETED_TET);
+                set_tet_vertex(tdel, 2, VERTEX_OF_DELETED_TET);
+                set_tet_vertex(tdel, 3, VERTEX_OF_DELETED_TET);
+            }
+
+            // Return one of the newly created tets
+            hint=new_tet;
+            release_tets();
+            geo_debug_assert(nb_acquired_tets_ == 0);
+            return true;
+        }
+
+        bool find_conflict_zone(
+            index_t v, const vec4& p, index_t t,
+            index_t& t_bndry, index_t& f_bndry
+        ) {
+            nb_tets_to_create_ = 0;
+
+            geo_debug_assert(t != NO_TETRAHEDRON);
+            geo_debug_assert(owns_tet(t));
+
+            // Pointer to the coordinates of the point to be inserted
+            //const double* p = vertex_ptr(v);
+
+            //  Weighted triangulations can have dangling
+            // vertices. Such vertices p are characterized by
+            // the fact that p is not in conflict with the
+            // tetrahedron returned by locate().
+            if(!tet_is_in_conflict(t,v,p)) {
+                release_tet(t);
+                return true;
+            }
+
+            mark_tet_as_conflict(t);
+
+            //   Sanity check: the vertex to be inserted should
+            // not correspond to one of the vertices of t.
+            geo_debug_assert(v != tet_vertex(t,0));
+            geo_debug_assert(v != tet_vertex(t,1));
+            geo_debug_assert(v != tet_vertex(t,2));
+            geo_debug_assert(v != tet_vertex(t,3));
+
+            // Note: points on edges and on facets are
+            // handled by the way tet_is_in_conflict()
+            // is implemented, that naturally inserts
+            // the correct tetrahedra in the conflict list.
+
+            // Determine the conflict list by greedy propagation from t.
+            bool result = find_conflict_zone_iterative(v, p,t);
+            t_bndry = t_boundary_;
+            f_bndry = f_boundary_;
+            return result;
+        }
+
+
+        bool find_conflict_zone_iterative(
+            index_t v_in, const vec4& p_in, index_t t_in
+        ) {
+            geo_debug_assert(owns_tet(t_in));
+            S_.push_back(SFrame(t_in, v_in, p_in));
+
+            while(S_.size() != 0) {
+                index_t t = S_.rbegin()->t;
+                index_t v = S_.rbegin()->v;
+                vec4    p = S_.rbegin()->p;
+                S_.pop_back();
+
+                geo_debug_assert(owns_tet(t));
+
+                for(index_t lf = 0; lf < 4; ++lf) {
+                    index_t v2=v;
+                    vec4 p2=p;
+
+                    index_t t2 = tet_adjacent(t, lf);
+
+                    // If t2 is already owned by current thread, then
+                    // its status was previously determined.
+                    if(owns_tet(t2)) {
+
+                        geo_debug_assert(
+                            tet_is_marked_as_conflict(t2) ==
+                            tet_is_in_conflict(t2,v2,p2)
+                        );
+
+                        // If t2 is not in conflict list, then t has a facet
+                        // on the border of the conflict zone, and there is
+                        // a tet to create.
+                        if(!tet_is_marked_as_conflict(t2)) {
+                            ++nb_tets_to_create_;
+                            cavity_.new_facet(
+                                t, lf,
+                                tet_vertex(t, tet_facet_vertex(lf,0)),
+                                tet_vertex(t, tet_facet_vertex(lf,1)),
+                                tet_vertex(t, tet_facet_vertex(lf,2))
+                            );
+                        }
+                        continue;
+                    }
+
+                    if(!acquire_tet(t2)) {
+                        S_.resize(0);
+                        return false;
+                    }
+
+                    geo_debug_assert(owns_tet(t2));
+
+                    if(!tet_is_in_conflict(t2,v2,p2)) {
+                        mark_tet_as_neighbor(t2);
+                        // If t2 is not in conflict list, then t has a facet
+                        // on the border of the conflict zone, and there is
+                        // a tet to create.
+                        ++nb_tets_to_create_;
+                    } else {
+                        mark_tet_as_conflict(t2);
+                        geo_debug_assert(owns_tet(t2));
+                        S_.push_back(SFrame(t2,v2,p2));
+                        continue;
+                    }
+
+                    //  At this point, t is in conflict
+                    // and t2 is not in conflict.
+                    // We keep a reference to a tet on the boundary
+                    t_boundary_ = t;
+                    f_boundary_ = lf;
+                    cavity_.new_facet(
+                        t, lf,
+                        tet_vertex(t, tet_facet_vertex(lf,0)),
+                        tet_vertex(t, tet_facet_vertex(lf,1)),
+                        tet_vertex(t, tet_facet_vertex(lf,2))
+                    );
+                    geo_debug_assert(tet_adjacent(t,lf) == t2);
+                    geo_debug_assert(owns_tet(t));
+                    geo_debug_assert(owns_tet(t2));
+                }
+            }
+            return true;
+        }
+
+        const double* non_periodic_vertex_ptr(index_t i) const {
+            geo_debug_assert(i < nb_vertices_non_periodic_);
+            return vertices_ + i*3;
+        }
+
+        double non_periodic_weight(index_t i) const {
+            geo_debug_assert(i < nb_vertices_non_periodic_);
+            return (weights_ == nullptr) ? 0.0 : weights_[i];
+        }
+
+
+        void get_vertex(index_t v, double* result) const {
+            if(!periodic_) {
+                result[0] = vertices_[3*v];
+                result[1] = vertices_[3*v+1];
+                result[2] = vertices_[3*v+2];
+                return;
+            }
+            index_t instance = periodic_vertex_instance(v);
+            v = periodic_vertex_real(v);
+            result[0] = vertices_[3*v];
+            result[1] = vertices_[3*v+1];
+            result[2] = vertices_[3*v+2];
+            result[0] += double(translation[instance][0]) * period_.x;
+            result[1] += double(translation[instance][1]) * period_.y;
+            result[2] += double(translation[instance][2]) * period_.z;
+        }
+
+        vec3 vertex(index_t v) const {
+            vec3 result;
+            get_vertex(v, result.data());
+            return result;
+        }
+
+        void get_lifted_vertex(index_t v, double* result) const {
+            index_t instance = 0;
+            if(periodic_) {
+                instance = periodic_vertex_instance(v);
+                v = periodic_vertex_real(v);
+            }
+            result[0] = vertices_[3*v];
+            result[1] = vertices_[3*v+1];
+            result[2] = vertices_[3*v+2];
+            result[3] = -non_periodic_weight(v);
+            if(periodic_) {
+                result[0] += double(translation[instance][0]) * period_.x;
+                result[1] += double(translation[instance][1]) * period_.y;
+                result[2] += double(translation[instance][2]) * period_.z;
+            }
+            result[3] +=
+                geo_sqr(result[0]) + geo_sqr(result[1]) + geo_sqr(result[2]);
+        }
+
+        vec4 lifted_vertex(index_t v) const {
+            vec4 result;
+            get_lifted_vertex(v,result.data());
+            return result;
+        }
+
+        vec4 lifted_vertex(index_t v, const vec3& p) {
+            return vec4(
+                p.x, p.y, p.z,
+                geo_sqr(p.x) + geo_sqr(p.y) + geo_sqr(p.z)
+                - non_periodic_weight(periodic_vertex_real(v))
+            );
+        }
+
+        Sign orient_3d(index_t i, index_t j, index_t k, index_t l) const {
+            // No need to reorder since there is no SOS.
+            double V[4][3];
+            get_vertex(i,V[0]);
+            get_vertex(j,V[1]);
+            get_vertex(k,V[2]);
+            get_vertex(l,V[3]);
+            return PCK::orient_3d(V[0], V[1], V[2], V[3]);
+        }
+
+        Sign in_circle_3dlifted_SOS(
+            index_t i, index_t j, index_t k, index_t l
+        ) const {
+
+            // In non-periodic mode, directly access vertices.
+            if(!periodic_) {
+                const double* pi = non_periodic_vertex_ptr(i);
+                const double* pj = non_periodic_vertex_ptr(j);
+                const double* pk = non_periodic_vertex_ptr(k);
+                const double* pl = non_periodic_vertex_ptr(l);
+
+                double hi = geo_sqr(pi[0]) + geo_sqr(pi[1]) + geo_sqr(pi[2])
+                    - non_periodic_weight(i);
+
+                double hj = geo_sqr(pj[0]) + geo_sqr(pj[1]) + geo_sqr(pj[2])
+                    - non_periodic_weight(j);
+
+                double hk = geo_sqr(pk[0]) + geo_sqr(pk[1]) + geo_sqr(pk[2])
+                    - non_periodic_weight(k);
+
+                double hl = geo_sqr(pl[0]) + geo_sqr(pl[1]) + geo_sqr(pl[2])
+                    - non_periodic_weight(l);
+
+                return PCK::in_circle_3dlifted_SOS(
+                    pi, pj, pk, pl,
+                    hi, hj, hk, hl
+                );
+            }
+
+            // Note: in periodic mode, SOS mode is lexicographic.
+            double V[4][4];
+            get_lifted_vertex(i,V[0]);
+            get_lifted_vertex(j,V[1]);
+            get_lifted_vertex(k,V[2]);
+            get_lifted_vertex(l,V[3]);
+            return PCK::in_circle_3dlifted_SOS(
+                V[0],    V[1],    V[2],    V[3],
+                V[0][3], V[1][3], V[2][3], V[3][3]
+            );
+        }
+
+        Sign orient_3dlifted_SOS(
+            index_t i, index_t j, index_t k, index_t l, index_t m
+        ) const {
+
+            // In non-periodic mode, directly access vertices.
+            if(!periodic_) {
+                const double* pi = non_periodic_vertex_ptr(i);
+                const double* pj = non_periodic_vertex_ptr(j);
+                const double* pk = non_periodic_vertex_ptr(k);
+                const double* pl = non_periodic_vertex_ptr(l);
+                const double* pm = non_periodic_vertex_ptr(m);
+
+                double hi = geo_sqr(pi[0]) + geo_sqr(pi[1]) + geo_sqr(pi[2])
+                    - non_periodic_weight(i);
+
+                double hj = geo_sqr(pj[0]) + geo_sqr(pj[1]) + geo_sqr(pj[2])
+                    - non_periodic_weight(j);
+
+                double hk = geo_sqr(pk[0]) + geo_sqr(pk[1]) + geo_sqr(pk[2])
+                    - non_periodic_weight(k);
+
+                double hl = geo_sqr(pl[0]) + geo_sqr(pl[1]) + geo_sqr(pl[2])
+                    - non_periodic_weight(l);
+
+                double hm = geo_sqr(pm[0]) + geo_sqr(pm[1]) + geo_sqr(pm[2])
+                    - non_periodic_weight(m);
+
+                return PCK::orient_3dlifted_SOS(
+                    pi, pj, pk, pl, pm,
+                    hi, hj, hk, hl, hm
+                );
+            }
+
+            // Periodic mode.
+            // Note: in periodic mode, SOS mode is lexicographic.
+            double V[5][4];
+
+            /*
+              The code below is an inlined version of:
+              (gains a little bit)
+              get_lifted_vertex(i,V[0]);
+              get_lifted_vertex(j,V[1]);
+              get_lifted_vertex(k,V[2]);
+              get_lifted_vertex(l,V[3]);
+              get_lifted_vertex(m,V[4]);
+            */
+
+            index_t ii = periodic_vertex_instance(i);
+            index_t ij = periodic_vertex_instance(j);
+            index_t ik = periodic_vertex_instance(k);
+            index_t il = periodic_vertex_instance(l);
+            index_t im = periodic_vertex_instance(m);
+
+            i = periodic_vertex_real(i);
+            j = periodic_vertex_real(j);
+            k = periodic_vertex_real(k);
+            l = periodic_vertex_real(l);
+            m = periodic_vertex_real(m);
+
+            V[0][0] = vertices_[3*i  ] + double(translation[ii][0]) * period_.x;
+            V[0][1] = vertices_[3*i+1] + double(translation[ii][1]) * period_.y;
+            V[0][2] = vertices_[3*i+2] + double(translation[ii][2]) * period_.z;
+            V[1][0] = vertices_[3*j  ] + double(translation[ij][0]) * period_.x;
+            V[1][1] = vertices_[3*j+1] + double(translation[ij][1]) * period_.y;
+            V[1][2] = vertices_[3*j+2] + double(translation[ij][2]) * period_.z;
+            V[2][0] = vertices_[3*k  ] + double(translation[ik][0]) * period_.x;
+            V[2][1] = vertices_[3*k+1] + double(translation[ik][1]) * period_.y;
+            V[2][2] = vertices_[3*k+2] + double(translation[ik][2]) * period_.z;
+            V[3][0] = vertices_[3*l  ] + double(translation[il][0]) * period_.x;
+            V[3][1] = vertices_[3*l+1] + double(translation[il][1]) * period_.y;
+            V[3][2] = vertices_[3*l+2] + double(translation[il][2]) * period_.z;
+            V[4][0] = vertices_[3*m  ] + double(translation[im][0]) * period_.x;
+            V[4][1] = vertices_[3*m+1] + double(translation[im][1]) * period_.y;
+            V[4][2] = vertices_[3*m+2] + double(translation[im][2]) * period_.z;
+
+            // Beware the parentheses, they are necessary to ensure that computations
+            //               |                               give always the same result.
+            //               |________________________________________________________________________
+            //                                  |                                                     |
+            //                                  v                                                     v
+            V[0][3] = -non_periodic_weight(i) + (geo_sqr(V[0][0]) + geo_sqr(V[0][1]) + geo_sqr(V[0][2]));
+            V[1][3] = -non_periodic_weight(j) + (geo_sqr(V[1][0]) + geo_sqr(V[1][1]) + geo_sqr(V[1][2]));
+            V[2][3] = -non_periodic_weight(k) + (geo_sqr(V[2][0]) + geo_sqr(V[2][1]) + geo_sqr(V[2][2]));
+            V[3][3] = -non_periodic_weight(l) + (geo_sqr(V[3][0]) + geo_sqr(V[3][1]) + geo_sqr(V[3][2]));
+            V[4][3] = -non_periodic_weight(m) + (geo_sqr(V[4][0]) + geo_sqr(V[4][1]) + geo_sqr(V[4][2]));
+
+            return PCK::orient_3dlifted_SOS(
+                V[0],    V[1],    V[2],    V[3],    V[4],
+                V[0][3], V[1][3], V[2][3], V[3][3], V[4][3]
+            );
+        }
+
+        bool tet_is_in_conflict(index_t t, index_t v, const vec4& p) const {
+
+            geo_argused(p);
+
+            // Lookup tetrahedron vertices
+
+            index_t iv[4];
+            for(index_t i=0; i<4; ++i) {
+                iv[i] = tet_vertex(t,i);
+            }
+
+
+            // Check for virtual tetrahedra (then in_sphere()
+            // is replaced with orient3d())
+            for(index_t lf = 0; lf < 4; ++lf) {
+
+                if(iv[lf] == NO_INDEX) {
+
+                    // Facet of a virtual tetrahedron opposite to
+                    // infinite vertex corresponds to
+                    // the triangle on the convex hull of the points.
+                    // Orientation is obtained by replacing vertex lf
+                    // with p.
+                    iv[lf] = v;
+
+                    // no SOS, we can directly use the PCK predicate
+                    Sign sign = orient_3d(iv[0], iv[1], iv[2], iv[3]);
+
+                    if(sign > 0) {
+                        return true;
+                    }
+
+                    if(sign < 0) {
+                        return false;
+                    }
+
+                    // If sign is zero, we check the real tetrahedron
+                    // adjacent to the facet on the convex hull.
+                    geo_debug_assert(tet_adjacent(t, lf) != NO_INDEX);
+                    index_t t2 = tet_adjacent(t, lf);
+                    geo_debug_assert(!tet_is_virtual(t2));
+
+                    //   If t2 was already visited by this thread, then
+                    // it is in conflict if it is already marked.
+                    if(owns_tet(t2)) {
+                        return tet_is_marked_as_conflict(t2);
+                    }
+
+                    //  If t2 was not already visited, then we need to
+                    // switch to the in_circum_circle_3d() predicate.
+
+                    index_t iq0 = iv[(lf+1)%4];
+                    index_t iq1 = iv[(lf+2)%4];
+                    index_t iq2 = iv[(lf+3)%4];
+
+                    return (in_circle_3dlifted_SOS(iq0, iq1, iq2, v) > 0);
+                }
+            }
+
+            //   If the tetrahedron is a finite one, it is in conflict
+            // if its circumscribed sphere contains the point (this is
+            // the standard case).
+
+            return (orient_3dlifted_SOS(iv[0], iv[1], iv[2], iv[3], v) > 0);
+        }
+
+
+        index_t locate(
+            index_t& v, vec3& p, index_t hint = NO_TETRAHEDRON,
+            Sign* orient = nullptr
+        ) {
+            geo_argused(v);
+            nb_traversed_tets_ = 0;
+
+            // If no hint specified, find a tetrahedron randomly
+
+            if(hint != NO_TETRAHEDRON) {
+                if(tet_is_free(hint)) {
+                    hint = NO_TETRAHEDRON;
+                } else {
+                    if( !owns_tet(hint) && !acquire_tet(hint) ) {
+                        hint = NO_TETRAHEDRON;
+                    }
+                    if((hint != NO_TETRAHEDRON) && tet_is_free(hint)) {
+                        release_tet(hint);
+                        hint = NO_TETRAHEDRON;
+                    }
+                }
+            }
+
+            do {
+                while(hint == NO_TETRAHEDRON) {
+                    hint = master_->thread(0)->pick_random_tet();
+		    // we could also pick from a random thread,
+		    // but at initialization only thread0 has tets,
+		    // so let us keep thread0 for now
+                }
+                if(
+                    tet_is_free(hint) || (!owns_tet(hint) && !acquire_tet(hint))
+                ) {
+                    if(owns_tet(hint)) {
+                        release_tet(hint);
+                    }
+                    hint = NO_TETRAHEDRON;
+                } else {
+                    for(index_t f=0; f<4; ++f) {
+                        if(tet_vertex(hint,f) == VERTEX_AT_INFINITY) {
+                            index_t new_hint = tet_adjacent(hint,f);
+                            if(
+                                tet_is_free(new_hint) ||
+                                !acquire_tet(new_hint)
+                            ) {
+                                new_hint = NO_TETRAHEDRON;
+                            }
+                            release_tet(hint);
+                            hint = new_hint;
+                            break;
+                        }
+                    }
+                }
+            } while(hint == NO_TETRAHEDRON) ;
+
+            index_t t = hint;
+            index_t t_pred = NO_TETRAHEDRON;
+            Sign orient_local[4];
+            if(orient == nullptr) {
+                orient = orient_local;
+            }
+
+
+        still_walking:
+            {
+                if(t_pred != NO_TETRAHEDRON) {
+                    release_tet(t_pred);
+                }
+
+                if(tet_is_free(t)) {
+                    return NO_TETRAHEDRON;
+                }
+
+                if(!owns_tet(t) && !acquire_tet(t)) {
+                    return NO_TETRAHEDRON;
+                }
+
+
+                if(!tet_is_real(t)) {
+                    release_tet(t);
+                    return NO_TETRAHEDRON;
+                }
+
+                vec3 pv[4];
+                pv[0] = vertex(finite_tet_vertex(t,0));
+                pv[1] = vertex(finite_tet_vertex(t,1));
+                pv[2] = vertex(finite_tet_vertex(t,2));
+                pv[3] = vertex(finite_tet_vertex(t,3));
+
+                // Start from a random facet
+                index_t f0 = thread_safe_random_4_();
+                for(index_t df = 0; df < 4; ++df) {
+                    index_t f = (f0 + df) % 4;
+
+                    index_t t_next = tet_adjacent(t,f);
+
+                    //  If the opposite tet is -1, then it means that
+                    // we are trying to locate() (e.g. called from
+                    // nearest_vertex) within a tetrahedralization
+                    // from which the infinite tets were removed.
+                    if(t_next == NO_INDEX) {
+                        release_tet(t);
+                        return NO_TETRAHEDRON;
+                    }
+
+                    //   If the candidate next tetrahedron is the
+                    // one we came from, then we know already that
+                    // the orientation is positive, thus we examine
+                    // the next candidate (or exit the loop if they
+                    // are exhausted).
+                    if(t_next == t_pred) {
+                        orient[f] = POSITIVE ;
+                        continue ;
+                    }
+
+                    //   To test the orientation of p w.r.t. the facet f of
+                    // t, we replace vertex number f with p in t (same
+                    // convention as in CGAL).
+                    // This is equivalent to tet_facet_point_orient3d(t,f,p)
+                    // (but less costly, saves a couple of lookups)
+                    vec3 pv_bkp = pv[f];
+                    pv[f] = p;
+                    orient[f] = PCK::orient_3d(
+                        pv[0].data(), pv[1].data(), pv[2].data(), pv[3].data()
+                    );
+
+                    //   If the orientation is not negative, then we cannot
+                    // walk towards t_next, and examine the next candidate
+                    // (or exit the loop if they are exhausted).
+                    if(orient[f] != NEGATIVE) {
+                        pv[f] = pv_bkp;
+                        continue;
+                    }
+
+                    //  If the opposite tet is a virtual tet, then
+                    // the point has a positive orientation relative
+                    // to the facet on the border of the convex hull,
+                    // thus t_next is a tet in conflict and we are
+                    // done.
+                    if(tet_is_virtual(t_next)) {
+                        release_tet(t);
+                        if(!acquire_tet(t_next)) {
+                            return NO_TETRAHEDRON;
+                        }
+                        for(index_t lf = 0; lf < 4; ++lf) {
+                            orient[lf] = POSITIVE;
+                        }
+                        return t_next;
+                    }
+
+                    ++nb_traversed_tets_;
+
+                    //   If we reach this point, then t_next is a valid
+                    // successor, thus we are still walking.
+                    t_pred = t;
+                    t = t_next;
+                    goto still_walking;
+                }
+            }
+
+            //   If we reach this point, we did not find a valid successor
+            // for walking (a face for which p has negative orientation),
+            // thus we reached the tet for which p has all positive
+            // face orientations (i.e. the tet that contains p).
+
+#ifdef GEO_DEBUG
+            geo_debug_assert(tet_is_real(t));
+
+            vec3 pv[4];
+            Sign signs[4];
+            pv[0] = vertex(finite_tet_vertex(t,0));
+            pv[1] = vertex(finite_tet_vertex(t,1));
+            pv[2] = vertex(finite_tet_vertex(t,2));
+            pv[3] = vertex(finite_tet_vertex(t,3));
+            for(index_t f=0; f<4; ++f) {
+                vec3 pv_bkp = pv[f];
+                pv[f] = vec3(p.x, p.y, p.z);
+                signs[f] = PCK::orient_3d(
+		    pv[0].data(), pv[1].data(), pv[2].data(), pv[3].data()
+		);
+                geo_debug_assert(signs[f] >= 0);
+                pv[f] = pv_bkp;
+            }
+#endif
+
+            return t;
+        }
+
+
+    protected:
+
+        bool tet_is_marked_as_conflict(index_t t) const {
+            geo_debug_assert(owns_tet(t));
+            return cell_status_.cell_is_marked_as_conflict(t);
+        }
+
+
+        index_t nb_tets_in_conflict() const {
+            return tets_to_delete_.size();
+        }
+
+        void mark_tet_as_conflict(index_t t) {
+            geo_debug_assert(owns_tet(t));
+            tets_to_delete_.push_back(t);
+            cell_status_.mark_cell_as_conflict(t);
+            geo_debug_assert(owns_tet(t));
+            geo_debug_assert(tet_is_marked_as_conflict(t));
+        }
+
+        void mark_tet_as_neighbor(index_t t) {
+            //   Note: nothing to change in cell_status_[t]
+            // since MSB=0 means neigbhor tet.
+            tets_to_release_.push_back(t);
+        }
+
+        void acquire_and_mark_tet_as_created(index_t t) {
+            //  The tet was created in this thread's tet pool,
+            // therefore there is no need to use sync
+            // primitives to acquire a lock on it.
+            geo_debug_assert(cell_status_.cell_thread(t) == NO_THREAD);
+            cell_status_.set_cell_status(
+		t, CellStatusArray::thread_index_t(id())
+	    );
+
+#ifdef GEO_DEBUG
+            ++nb_acquired_tets_;
+#endif
+            tets_to_release_.push_back(t);
+        }
+
+
+        void release_tets() {
+            for(index_t i=0; i<tets_to_release_.size(); ++i) {
+                release_tet(tets_to_release_[i]);
+            }
+            tets_to_release_.resize(0);
+            for(index_t i=0; i<tets_to_delete_.size(); ++i) {
+                release_tet(tets_to_delete_[i]);
+            }
+            tets_to_delete_.resize(0);
+        }
+
+        bool acquire_tet(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(!owns_tet(t));
+
+            interfering_thread_ = cell_status_.acquire_cell(
+                t, CellStatusArray::thread_index_t(id())
+            );
+
+            if(interfering_thread_ == NO_THREAD) {
+                geo_debug_assert(t == first_free_ || !tet_is_in_list(t));
+#ifdef GEO_DEBUG
+                ++nb_acquired_tets_;
+#endif
+                return true;
+            }
+            return false;
+        }
+
+        void release_tet(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(owns_tet(t));
+#ifdef GEO_DEBUG
+            --nb_acquired_tets_;
+#endif
+            cell_status_.release_cell(t);
+        }
+
+
+        bool owns_tet(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return (
+		cell_status_.cell_thread(t) ==
+		CellStatusArray::thread_index_t(id())
+	    );
+        }
+
+        bool tet_is_virtual(index_t t) const {
+            return
+                !tet_is_free(t) && (
+                    cell_to_v_store_[4 * t] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 1] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 2] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 3] == VERTEX_AT_INFINITY) ;
+        }
+
+
+        static index_t tet_facet_vertex(index_t f, index_t v) {
+            geo_debug_assert(f < 4);
+            geo_debug_assert(v < 3);
+            return index_t(tet_facet_vertex_[f][v]);
+        }
+
+        index_t tet_vertex(index_t t, index_t lv) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            return cell_to_v_store_[4 * t + lv];
+        }
+
+        index_t find_tet_vertex(index_t t, index_t v) const {
+            geo_debug_assert(t < max_t());
+            //   Find local index of v in tetrahedron t vertices.
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+            return find_4(T,v);
+        }
+
+
+        index_t finite_tet_vertex(index_t t, index_t lv) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            geo_debug_assert(cell_to_v_store_[4 * t + lv] != NO_INDEX);
+            return cell_to_v_store_[4 * t + lv];
+        }
+
+        void set_tet_vertex(index_t t, index_t lv, index_t v) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            geo_debug_assert(owns_tet(t));
+            cell_to_v_store_[4 * t + lv] = v;
+        }
+
+        index_t tet_adjacent(index_t t, index_t lf) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lf < 4);
+            index_t result = cell_to_cell_store_[4 * t + lf];
+            return result;
+        }
+
+        void set_tet_adjacent(index_t t1, index_t lf1, index_t t2) {
+            geo_debug_assert(t1 < max_t());
+            geo_debug_assert(t2 < max_t());
+            geo_debug_assert(lf1 < 4);
+            geo_debug_assert(owns_tet(t1));
+            geo_debug_assert(owns_tet(t2));
+            cell_to_cell_store_[4 * t1 + lf1] = t2;
+        }
+
+        index_t find_tet_adjacent(index_t t1, index_t t2) const {
+            geo_debug_assert(t1 < max_t());
+            geo_debug_assert(t2 < max_t());
+            geo_debug_assert(t1 != t2);
+
+            // Find local index of t2 in tetrahedron t1 adajcent tets.
+            const index_t* T = &(cell_to_cell_store_[4 * t1]);
+            index_t result = find_4(T,t2);
+
+            // Sanity check: make sure that t1 is adjacent to t2
+            // only once!
+            geo_debug_assert(tet_adjacent(t1,(result+1)%4) != t2);
+            geo_debug_assert(tet_adjacent(t1,(result+2)%4) != t2);
+            geo_debug_assert(tet_adjacent(t1,(result+3)%4) != t2);
+            return result;
+        }
+
+        index_t get_facet_by_halfedge(index_t t, index_t v1, index_t v2) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(v1 != v2);
+            //   Find local index of v1 and v2 in tetrahedron t
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+
+            index_t lv1, lv2;
+            lv1 = find_4(T,v1);
+            lv2 = find_4(T,v2);
+            geo_debug_assert(lv1 != lv2);
+            return index_t(halfedge_facet_[lv1][lv2]);
+        }
+
+
+        void get_facets_by_halfedge(
+            index_t t, index_t v1, index_t v2,
+            index_t& f12, index_t& f21
+        ) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(v1 != v2);
+
+            //   Find local index of v1 and v2 in tetrahedron t
+            // The following expression is 10% faster than using
+            // if() statements (multiply by boolean result of test).
+            // Thank to Laurent Alonso for this idea.
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+
+            index_t lv1,lv2;
+
+            lv1 = (T[1] == v1) | ((T[2] == v1) * 2) | ((T[3] == v1) * 3);
+            lv2 = (T[1] == v2) | ((T[2] == v2) * 2) | ((T[3] == v2) * 3);
+            geo_debug_assert(lv1 != 0 || T[0] == v1);
+            geo_debug_assert(lv2 != 0 || T[0] == v2);
+            geo_debug_assert(lv1 != lv2);
+
+            f12 = index_t(halfedge_facet_[lv1][lv2]);
+            f21 = index_t(halfedge_facet_[lv2][lv1]);
+        }
+
+        static constexpr index_t END_OF_LIST = NO_INDEX;
+
+        static constexpr index_t NOT_IN_LIST = index_t(-2);
+
+	static constexpr index_t VERTEX_OF_DELETED_TET = index_t(-2);
+
+        index_t nb_vertices() const {
+            return nb_vertices_;
+        }
+
+        bool tet_is_in_list(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return (cell_next_[t] != NOT_IN_LIST);
+        }
+
+        index_t tet_next(index_t t) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(tet_is_in_list(t));
+            return cell_next_[t];
+        }
+
+
+        index_t tet_thread(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return cell_status_.cell_thread(t);
+        }
+
+        void add_tet_to_list(index_t t, index_t& first, index_t& last) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(!tet_is_in_list(t));
+            geo_debug_assert(owns_tet(t));
+            if(last == END_OF_LIST) {
+                geo_debug_assert(first == END_OF_LIST);
+                first = last = t;
+                cell_next_[t] = END_OF_LIST;
+            } else {
+                cell_next_[t] = first;
+                first = t;
+            }
+        }
+
+        void remove_tet_from_list(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(tet_is_in_list(t));
+            geo_debug_assert(owns_tet(t));
+            cell_next_[t] = NOT_IN_LIST;
+        }
+
+
+        index_t new_tetrahedron() {
+            // If the memory pool is full, then we expand it.
+            // This cannot be done when running multiple threads.
+            if(first_free_ == END_OF_LIST) {
+                geo_debug_assert(!Process::is_running_threads());
+
+                if(
+                    master_->cell_to_v_store_.size() ==
+                    master_->cell_to_v_store_.capacity()
+                ) {
+                    master_->nb_reallocations_++;
+                }
+
+                master_->cell_to_v_store_.resize(
+                    master_->cell_to_v_store_.size() + 4, NO_INDEX
+                );
+                master_->cell_to_cell_store_.resize(
+                    master_->cell_to_cell_store_.size() + 4, NO_INDEX
+                );
+                master_->cell_next_.push_back(END_OF_LIST);
+                master_->cell_status_.grow();
+                ++nb_free_;
+                ++max_t_;
+                first_free_ = master_->cell_status_.size() - 1;
+            }
+
+            acquire_and_mark_tet_as_created(first_free_);
+            index_t result = first_free_;
+
+            first_free_ = tet_next(first_free_);
+            remove_tet_from_list(result);
+
+            cell_to_cell_store_[4 * result] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 1] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 2] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 3] = NO_INDEX;
+
+            used_tets_end_ = std::max(used_tets_end_, result+1);
+
+            --nb_free_;
+            return result;
+        }
+
+        index_t new_tetrahedron(
+            index_t v1, index_t v2,
+            index_t v3, index_t v4
+        ) {
+            index_t result = new_tetrahedron();
+            cell_to_v_store_[4 * result] = v1;
+            cell_to_v_store_[4 * result + 1] = v2;
+            cell_to_v_store_[4 * result + 2] = v3;
+            cell_to_v_store_[4 * result + 3] = v4;
+            return result;
+        }
+
+        static index_t find_4(const index_t* T, index_t v) {
+            // The following expression is 10% faster than using
+            // if() statements. This uses the C++ norm, that
+            // ensures that the 'true' boolean value converted to
+            // an int is always 1. With most compilers, this avoids
+            // generating branching instructions.
+            // Thank to Laurent Alonso for this idea.
+            // Note: Laurent also has this version:
+            //    (T[0] != v)+(T[2]==v)+2*(T[3]==v)
+            // that avoids a *3 multiply, but it is not faster in
+            // practice.
+            index_t result = index_t(
+                (T[1] == v) | ((T[2] == v) * 2) | ((T[3] == v) * 3)
+            );
+            // Sanity check, important if it was T[0], not explicitly
+            // tested (detects input that does not meet the precondition).
+            geo_debug_assert(T[result] == v);
+            return result;
+        }
+
+
+        index_t find_4_periodic(const index_t* T, index_t v) const {
+
+            // v needs to be a real vertex.
+            geo_debug_assert(periodic_vertex_instance(v) == 0);
+
+            geo_debug_assert(
+                T[0] != NO_INDEX && T[1] != NO_INDEX &&
+		T[2] != NO_INDEX && T[3] != NO_INDEX
+            );
+
+            // The following expression is 10% faster than using
+            // if() statements. This uses the C++ norm, that
+            // ensures that the 'true' boolean value converted to
+            // an int is always 1. With most compilers, this avoids
+            // generating branching instructions.
+            // Thank to Laurent Alonso for this idea.
+            // Note: Laurent also has this version:
+            //    (T[0] != v)+(T[2]==v)+2*(T[3]==v)
+            // that avoids a *3 multiply, but it is not faster in
+            // practice.
+            index_t result = index_t(
+                ( periodic_vertex_real(index_t(T[1])) == v)      |
+                ((periodic_vertex_real(index_t(T[2])) == v) * 2) |
+                ((periodic_vertex_real(index_t(T[3])) == v) * 3)
+            );
+
+            // Sanity check, important if it was T[0], not explicitly
+            // tested (detects input that does not meet the precondition).
+            geo_debug_assert(periodic_vertex_real(index_t(T[result])) == v);
+            return result;
+        }
+
+
+        void send_event() {
+            cond_.notify_all();
+        }
+
+        void wait_for_event(index_t t) {
+            // Fixed by Hiep Vu: enlarged critical section (contains
+            // now the test (!thrd->finished)
+            PeriodicDelaunay3dThread* thrd = thread(t);
+            // RAII: ctor locks, dtor unlocks
+            std::unique_lock<std::mutex> L(thrd->mutex_);
+            if(!thrd->finished_) {
+                thrd->cond_.wait(L);
+            }
+        }
+
+        
+
+        class StellateConflictStack {
+        public:
+
+            void push(index_t t1, index_t t1fbord, index_t t1fprev) {
+                store_.resize(store_.size()+1);
+                top().t1 = t1;
+                top().t1fbord = Numeric::uint8(t1fbord);
+                top().t1fprev = Numeric::uint8(t1fprev);
+            }
+
+            void save_locals(index_t new_t, index_t t1ft2, index_t t2ft1) {
+                geo_debug_assert(!empty());
+                top().new_t = new_t;
+                top().t1ft2 = Numeric::uint8(t1ft2);
+                top().t2ft1 = Numeric::uint8(t2ft1);
+            }
+
+            void get_parameters(
+                index_t& t1, index_t& t1fbord, index_t& t1fprev
+            ) const {
+                geo_debug_assert(!empty());
+                t1      = top().t1;
+                t1fbord = index_t(top().t1fbord);
+                t1fprev = index_t(top().t1fprev);
+            }
+
+
+            void get_locals(
+                index_t& new_t, index_t& t1ft2, index_t& t2ft1
+            ) const {
+                geo_debug_assert(!empty());
+                new_t = top().new_t;
+                t1ft2 = index_t(top().t1ft2);
+                t2ft1 = index_t(top().t2ft1);
+            }
+
+            void pop() {
+                geo_debug_assert(!empty());
+                store_.pop_back();
+            }
+
+            bool empty() const {
+                return store_.empty();
+            }
+
+        private:
+
+            struct Frame {
+                // Parameters
+                index_t t1;
+                index_t new_t;
+                Numeric::uint8 t1fbord ;
+
+                // Local variables
+                Numeric::uint8 t1fprev ;
+                Numeric::uint8 t1ft2   ;
+                Numeric::uint8 t2ft1   ;
+            };
+
+            Frame& top() {
+                geo_debug_assert(!empty());
+                return *store_.rbegin();
+            }
+
+            const Frame& top() const {
+                geo_debug_assert(!empty());
+                return *store_.rbegin();
+            }
+
+            std::vector<Frame> store_;
+        };
+
+        index_t stellate_conflict_zone_iterative(
+            index_t v, index_t t1, index_t t1fbord,
+            index_t t1fprev = NO_INDEX
+        ) {
+            //   This function is de-recursified because some degenerate
+            // inputs can cause stack overflow (system stack is limited to
+            // a few megs). For instance, it can happen when a large number
+            // of points are on the same sphere exactly.
+
+            //   To de-recursify, it uses class StellateConflictStack
+            // that emulates system's stack for storing functions's
+            // parameters and local variables in all the nested stack
+            // frames.
+
+            S2_.push(t1, t1fbord, t1fprev);
+
+            index_t new_t;   // the newly created tetrahedron.
+
+            index_t t1ft2;   // traverses the 4 facets of t1.
+
+            index_t t2;      // the tetrahedron on the border of
+                             // the conflict zone that shares an
+                             // edge with t1 along t1ft2.
+
+            index_t t2fbord; // the facet of t2 on the border of
+                             // the conflict zone.
+
+            index_t t2ft1;   // the facet of t2 that is incident to t1.
+
+        entry_point:
+            S2_.get_parameters(t1, t1fbord, t1fprev);
+
+
+            geo_debug_assert(owns_tet(t1));
+            geo_debug_assert(tet_adjacent(t1,t1fbord) != NO_INDEX);
+            geo_debug_assert(owns_tet(tet_adjacent(t1,t1fbord)));
+            geo_debug_assert(tet_is_marked_as_conflict(t1));
+            geo_debug_assert(
+                !tet_is_marked_as_conflict(tet_adjacent(t1,t1fbord))
+            );
+
+            // Create new tetrahedron with same vertices as t_bndry
+
+            new_t = new_tetrahedron(
+                tet_vertex(t1,0),
+                tet_vertex(t1,1),
+                tet_vertex(t1,2),
+                tet_vertex(t1,3)
+            );
+
+            index_t tbord = tet_adjacent(t1,t1fbord);
+
+            // We generate the tetrahedron with the three vertices
+            // of the tet outside the conflict zone and the newly
+            // created vertex in the local frame of the tet outside
+            // the conflict zone.
+
+            // Replace in new_t the vertex opposite to t1fbord with v
+            set_tet_vertex(new_t, t1fbord, v);
+
+            {
+                // Connect new_t with t1's neighbor across t1fbord
+                set_tet_adjacent(new_t, t1fbord, tbord);
+                set_tet_adjacent(tbord, find_tet_adjacent(tbord,t1), new_t);
+            }
+
+            //  Lookup new_t's neighbors across its three other
+            // facets and connect them
+            for(t1ft2=0; t1ft2<4; ++t1ft2) {
+
+                if(t1ft2 == t1fprev || tet_adjacent(new_t,t1ft2) != NO_INDEX) {
+                    continue;
+                }
+
+                // Get t1's neighbor along the border of the conflict zone
+                if(!get_neighbor_along_conflict_zone_border(
+                       t1,t1fbord,t1ft2, t2,t2fbord,t2ft1
+                   )) {
+                    //   If t1's neighbor is not a new tetrahedron,
+                    // create a new tetrahedron through a recursive call.
+                    S2_.save_locals(new_t, t1ft2, t2ft1);
+                    S2_.push(t2, t2fbord, t2ft1);
+                    goto entry_point;
+
+                return_point:
+                    // This is the return value of the called function.
+                    index_t result = new_t;
+                    S2_.pop();
+
+                    // Special case: we were in the outermost frame,
+                    // then we (truly) return from the function.
+                    if(S2_.empty()) {
+                        return result;
+                    }
+
+                    S2_.get_parameters(t1, t1fbord, t1fprev);
+                    S2_.get_locals(new_t, t1ft2, t2ft1);
+                    t2 = result;
+                }
+
+                set_tet_adjacent(t2, t2ft1, new_t);
+                set_tet_adjacent(new_t, t1ft2, t2);
+            }
+
+            // Except for the initial call (see "Special case" above),
+            // the nested calls all come from the same location,
+            // thus there is only one possible return point
+            // (no need to push any return address).
+            goto return_point;
+        }
+
+        bool get_neighbor_along_conflict_zone_border(
+            index_t t1,
+            index_t t1fborder,
+            index_t t1ft2,
+            index_t& t2,
+            index_t& t2fborder,
+            index_t& t2ft1
+        ) const {
+
+            // Note: this function is a bit long for an inline function,
+            // but I observed a (modest) performance gain doing so.
+
+            //   Find two vertices that are both on facets new_f and f1
+            //  (the edge around which we are turning)
+            //  This uses duality as follows:
+            //  Primal form (not used here):
+            //    halfedge_facet_[v1][v2] returns a facet that is incident
+            //    to both v1 and v2.
+            //  Dual form (used here):
+            //    halfedge_facet_[f1][f2] returns a vertex that both
+            //    f1 and f2 are incident to.
+            index_t ev1 =
+                tet_vertex(t1, index_t(halfedge_facet_[t1ft2][t1fborder]));
+            index_t ev2 =
+                tet_vertex(t1, index_t(halfedge_facet_[t1fborder][t1ft2]));
+
+            //   Turn around edge [ev1,ev2] inside the conflict zone
+            // until we reach again the boundary of the conflict zone.
+            // Traversing inside the conflict zone is faster (as compared
+            // to outside) since it traverses a smaller number of tets.
+            index_t cur_t = t1;
+            index_t cur_f = t1ft2;
+            index_t next_t = tet_adjacent(cur_t,cur_f);
+            while(tet_is_marked_as_conflict(next_t)) {
+                geo_debug_assert(next_t != t1);
+                cur_t = next_t;
+                cur_f = get_facet_by_halfedge(cur_t,ev1,ev2);
+                next_t = tet_adjacent(cur_t, cur_f);
+            }
+
+            //  At this point, cur_t is in conflict zone and
+            // next_t is outside the conflict zone.
+            index_t f12,f21;
+            get_facets_by_halfedge(next_t, ev1, ev2, f12, f21);
+            t2 = tet_adjacent(next_t,f21);
+            index_t v_neigh_opposite = tet_vertex(next_t,f12);
+            t2ft1 = find_tet_vertex(t2, v_neigh_opposite);
+            t2fborder = cur_f;
+
+            //  Test whether the found neighboring tet was created
+            //  (then return true) or is an old tet in conflict
+            //  (then return false).
+            return(t2 != cur_t);
+        }
+
+        StellateConflictStack S2_;
+
+        
+
+        void show_tet_adjacent(index_t t, index_t lf) const {
+            index_t adj = tet_adjacent(t, lf);
+            if(adj != NO_INDEX) {
+                std::cerr << (tet_is_in_list(adj) ? '*' : ' ');
+            }
+            std::cerr << adj;
+            std::cerr << ' ';
+        }
+
+
+        void show_tet(index_t t) const {
+            std::cerr << "tet"
+                      << (tet_is_in_list(t) ? '*' : ' ')
+                      << t
+                      << ", v=["
+                      << tet_vertex(t, 0)
+                      << ' '
+                      << tet_vertex(t, 1)
+                      << ' '
+                      << tet_vertex(t, 2)
+                      << ' '
+                      << tet_vertex(t, 3)
+                      << "]  adj=[";
+            show_tet_adjacent(t, 0);
+            show_tet_adjacent(t, 1);
+            show_tet_adjacent(t, 2);
+            show_tet_adjacent(t, 3);
+            std::cerr << "] ";
+
+            for(index_t f = 0; f < 4; ++f) {
+                std::cerr << 'f' << f << ':';
+                for(index_t v = 0; v < 3; ++v) {
+                    std::cerr << tet_vertex(t, tet_facet_vertex(f,v))
+                              << ',';
+                }
+                std::cerr << ' ';
+            }
+            std::cerr << std::endl;
+        }
+
+    public:
+
+        void check_combinatorics(bool verbose) const {
+            if(verbose) {
+                std::cerr << std::endl;
+            }
+            bool ok = true;
+            std::vector<bool> v_has_tet(nb_vertices(), false);
+            for(index_t t = 0; t < max_t(); ++t) {
+                if(tet_is_free(t)) {
+                    if(verbose) {
+                        std::cerr << "-Deleted tet: ";
+                        show_tet(t);
+                    }
+                } else {
+                    if(verbose) {
+                        std::cerr << "Checking tet: ";
+                        show_tet(t);
+                    }
+                    for(index_t lf = 0; lf < 4; ++lf) {
+                        if(tet_adjacent(t, lf) == NO_INDEX) {
+                            std::cerr << lf << ":Missing adjacent tet"
+                                      << std::endl;
+                            ok = false;
+                        } else if(tet_adjacent(t, lf) == t) {
+                            std::cerr << lf << ":Tet is adjacent to itself"
+                                      << std::endl;
+                            ok = false;
+                        } else {
+                            index_t t2 = tet_adjacent(t, lf);
+                            bool found = false;
+                            for(index_t lf2 = 0; lf2 < 4; ++lf2) {
+                                if(tet_adjacent(t2, lf2) == t) {
+                                    found = true;
+                                }
+                            }
+                            if(!found) {
+                                std::cerr
+                                    << lf
+                                    << ":Adjacent link is not bidirectional"
+                                    << std::endl;
+                                ok = false;
+                            }
+                        }
+                    }
+                    index_t nb_infinite = 0;
+                    for(index_t lv = 0; lv < 4; ++lv) {
+                        if(tet_vertex(t, lv) == NO_INDEX) {
+                            ++nb_infinite;
+                        }
+                    }
+                    if(nb_infinite > 1) {
+                        ok = false;
+                        std::cerr << "More than one infinite vertex"
+                                  << std::endl;
+                    }
+                }
+                for(index_t lv = 0; lv < 4; ++lv) {
+                    index_t v = tet_vertex(t, lv);
+                    if(v != NO_INDEX && v != NOT_IN_LIST) {
+                        v_has_tet[periodic_vertex_real(v)] = true;
+                    }
+                }
+            }
+
+            index_t nb_v = nb_vertices();
+            for(index_t v = 0; v < nb_v; ++v) {
+                if(!v_has_tet[v]) {
+                    if(verbose) {
+                        std::cerr << "Vertex " << v
+                                  << " is isolated (duplicated ?)" << std::endl;
+                    }
+                }
+            }
+            geo_assert(ok);
+            if(verbose) {
+                std::cerr << std::endl;
+            }
+            std::cerr << std::endl << "Delaunay Combi OK" << std::endl;
+        }
+
+
+        void check_geometry(bool verbose) const {
+            bool ok = true;
+            for(index_t t = 0; t < max_t(); ++t) {
+                if(!tet_is_free(t)) {
+                    index_t v0 = tet_vertex(t, 0);
+                    index_t v1 = tet_vertex(t, 1);
+                    index_t v2 = tet_vertex(t, 2);
+                    index_t v3 = tet_vertex(t, 3);
+                    for(index_t v = 0; v < nb_vertices(); ++v) {
+                        vec4 p = lifted_vertex(v);
+                        if(v == v0 || v == v1 || v == v2 || v == v3) {
+                            continue;
+                        }
+                        if(tet_is_in_conflict(t, v, p)) {
+                            ok = false;
+                            if(verbose) {
+                                std::cerr << "Tet " << t <<
+                                    " is in conflict with vertex " << v
+                                          << std::endl;
+
+                                std::cerr << "  offending tet: ";
+                                show_tet(t);
+                            }
+                        }
+                    }
+                }
+            }
+            geo_assert(ok);
+            std::cerr << std::endl << "Delaunay Geo OK" << std::endl;
+        }
+
+    private:
+        PeriodicDelaunay3d* master_;
+        bool periodic_;
+        vec3 period_;
+        index_t nb_vertices_;
+        const double* vertices_;
+        const double* weights_;
+        index_t* reorder_;
+        index_t dimension_;
+	index_t pool_begin_;
+	index_t pool_end_;
+        index_t max_t_;
+        index_t used_tets_end_;
+
+        vector<index_t>& cell_to_v_store_;
+        vector<index_t>& cell_to_cell_store_;
+        vector<index_t>& cell_next_;
+        CellStatusArray& cell_status_;
+
+        index_t first_free_;
+        index_t nb_free_;
+        bool memory_overflow_;
+
+	
+        struct SFrame {
+
+            SFrame() {
+            }
+
+            SFrame(
+                index_t t_in,
+                index_t v_in,
+                const vec4& p_in
+            ) :
+                t(t_in),
+                v(v_in),
+                p(p_in) {
+            }
+
+            SFrame(
+                const SFrame& rhs
+            ):
+                t(rhs.t),
+                v(rhs.v),
+                p(rhs.p) {
+            }
+
+            SFrame& operator=(const SFrame& rhs) {
+                t = rhs.t;
+                v = rhs.v;
+                p = rhs.p;
+                return *this;
+            }
+
+            index_t t;
+            index_t v;
+            vec4 p;
+        };
+
+        vector<SFrame> S_;
+        index_t nb_tets_to_create_;
+        index_t t_boundary_; // index of a tet,facet on the bndry
+        index_t f_boundary_; // of the conflict zone.
+
+        bool direction_;
+        index_t work_begin_;
+        index_t work_rbegin_;
+        index_t b_hint_;
+        index_t e_hint_;
+        bool finished_;
+
+        //  Whenever acquire_tet() is unsuccessful, contains
+        // the index of the thread that was interfering
+        // (shifted to the left by 1 !!)
+	CellStatusArray::thread_index_t interfering_thread_;
+
+#ifdef GEO_DEBUG
+        index_t nb_acquired_tets_;
+#endif
+
+        vector<index_t> tets_to_delete_;
+        vector<index_t> tets_to_release_;
+
+        index_t nb_rollbacks_;
+        index_t nb_failed_locate_;
+
+        std::condition_variable cond_;
+        std::mutex mutex_;
+
+        bool has_empty_cells_;
+
+        static char tet_facet_vertex_[4][3];
+
+        static char halfedge_facet_[4][4];
+
+        Cavity cavity_;
+
+        index_t nb_traversed_tets_;
+    };
+
+
+    char PeriodicDelaunay3dThread::halfedge_facet_[4][4] = {
+        {4, 2, 3, 1},
+        {3, 4, 0, 2},
+        {1, 3, 4, 0},
+        {2, 0, 1, 4}
+    };
+
+    // tet facet vertex is such that the tetrahedron
+    // formed with:
+    //  vertex lv
+    //  tet_facet_vertex[lv][0]
+    //  tet_facet_vertex[lv][1]
+    //  tet_facet_vertex[lv][2]
+    // has the same orientation as the original tetrahedron for
+    // any vertex lv.
+
+    char PeriodicDelaunay3dThread::tet_facet_vertex_[4][3] = {
+        {1, 2, 3},
+        {0, 3, 2},
+        {3, 0, 1},
+        {1, 0, 2}
+    };
+
+
+    
+
+    PeriodicDelaunay3d::PeriodicDelaunay3d(
+        bool periodic, double period
+    ) :
+        Delaunay(3),
+        periodic_(periodic),
+        period_(period,period,period),
+        weights_(nullptr),
+        update_periodic_v_to_cell_(false),
+        has_empty_cells_(false),
+        nb_reallocations_(0),
+        convex_cell_exact_predicates_(true),
+        cell_order_(CELL_ORDER_NONE),
+        cell_order_key_(CELL_ORDER_KEY_CENTROID),
+        warm_start_instances_(nullptr),
+        warm_start_margin_(0.0)
+    {
+        debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay");
+        verbose_debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay_verbose");
+        debug_mode_ = (debug_mode_ || verbose_debug_mode_);
+	benchmark_mode_ = CmdLine::get_arg_bool("dbg:delaunay_benchmark");
+        detailed_benchmark_mode_ =
+	    CmdLine::get_arg_bool("dbg:detailed_delaunay_benchmark");
+        nb_vertices_non_periodic_ = 0;
+        delaunay_citations();
+    }
+
+    PeriodicDelaunay3d::PeriodicDelaunay3d(
+        const vec3& period
+    ) :
+        Delaunay(3),
+        periodic_(true),
+        period_(period),
+        weights_(nullptr),
+        update_periodic_v_to_cell_(false),
+        has_empty_cells_(false),
+        nb_reallocations_(0),
+        convex_cell_exact_predicates_(true),
+        cell_order_(CELL_ORDER_NONE),
+        cell_order_key_(CELL_ORDER_KEY_CENTROID),
+        warm_start_instances_(nullptr),
+        warm_start_margin_(0.0)
+    {
+        debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay");
+        verbose_debug_mode_ = CmdLine::get_arg_bool("dbg:delaunay_verbose");
+        debug_mode_ = (debug_mode_ || verbose_debug_mode_);
+        benchmark_mode_ = CmdLine::get_arg_bool("dbg:delaunay_benchmark");
+        detailed_benchmark_mode_ =
+	    CmdLine::get_arg_bool("dbg:detailed_delaunay_benchmark");
+        nb_vertices_non_periodic_ = 0;
+        delaunay_citations();
+    }
+
+    void PeriodicDelaunay3d::set_vertices(
+        index_t nb_vertices, const double* vertices
+    ) {
+        has_empty_cells_ = false;
+
+#ifndef GARGANTUA
+        {
+            Numeric::uint64 expected_max_index =
+                Numeric::uint64(nb_vertices) * 7 * 4;
+            if(periodic_) {
+                expected_max_index *= 2;
+            }
+            if(expected_max_index > Numeric::uint64(INT32_MAX)) {
+                Logger::err("OTM") << "indices will overflow" << std::endl;
+                Logger::err("OTM")
+                    << "recompile with -DGARGANTUA "
+                    << "to activate 64bit indices" << std::endl;
+                exit(0);
+            }
+        }
+#endif
+
+        if(periodic_) {
+            PCK::set_SOS_mode(PCK::SOS_LEXICO);
+        }
+
+        Stopwatch W("BRIO", benchmark_mode_);
+        nb_vertices_non_periodic_ = nb_vertices;
+
+        Delaunay::set_vertices(nb_vertices, vertices);
+        // Reorder the points
+        if(do_reorder_) {
+            compute_BRIO_order(
+                nb_vertices, vertex_ptr(0), reorder_,
+                3, dimension(),
+                64, 0.125,
+                &levels_
+            );
+        } else {
+            reorder_.resize(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                reorder_[i] = i;
+            }
+            geo_debug_assert(levels_[0] == 0);
+            geo_debug_assert(levels_[levels_.size()-1] == nb_vertices);
+        }
+    }
+
+    void PeriodicDelaunay3d::set_weights(const double* weights) {
+        has_empty_cells_ = false;
+        weights_ = weights;
+    }
+
+    void PeriodicDelaunay3d::compute() {
+
+	stats_.reset();
+
+	Stopwatch W_tot("total",false);
+
+        has_empty_cells_ = false;
+
+        if(periodic_) {
+            reorder_.resize(nb_vertices_non_periodic_);
+        }
+
+	{
+	    Stopwatch W("DelInternal", detailed_benchmark_mode_);
+
+	    index_t expected_tetra = nb_vertices() * 7;
+
+	    // Everything is allocated here, including for handling
+	    // periodic boundary conditions, much later. We need to
+	    // allocate sufficient space to have good chances of
+	    // inserting most of the additional points in parallel
+	    // (in insert_with_BRIO())
+
+	    if(periodic_) {
+		expected_tetra = index_t(double(expected_tetra)* 1.2);
+	    }
+
+	    // Allocate the tetrahedra
+	    cell_to_v_store_.assign(expected_tetra * 4, NO_INDEX);
+	    cell_to_cell_store_.assign(expected_tetra * 4, NO_INDEX);
+	    cell_next_.assign(expected_tetra,NO_INDEX);
+	    cell_status_.resize(expected_tetra);
+
+	    // Create the threads
+	    // The maximum number of threads is limited by the number
+	    // of bits used by cell_status_ (see delaunay_sync.h)
+	    index_t nb_threads = std::min(
+		Process::maximum_concurrent_threads(),
+		CellStatusArray::MAX_THREADS
+	    );
+	    index_t pool_size = expected_tetra / nb_threads;
+	    if (pool_size == 0) {
+		// There are more threads than expected_tetra
+		pool_size = 1;
+		nb_threads = expected_tetra;
+	    }
+	    index_t pool_begin = 0;
+	    threads_.clear();
+	    for(index_t t=0; t<nb_threads; ++t) {
+		index_t pool_end =
+		    (t == nb_threads - 1) ? expected_tetra
+		                          : pool_begin + pool_size;
+		threads_.push_back(
+		    new PeriodicDelaunay3dThread(this, pool_begin, pool_end)
+		);
+		pool_begin = pool_end;
+	    }
+
+
+	    // Create first tetrahedron and triangulate first set of points
+	    // in sequential mode.
+
+	    PeriodicDelaunay3dThread* thread0 = thread(0);
+	    thread0->create_first_tetrahedron();
+	    {
+		Stopwatch Wmain("DelMain", detailed_benchmark_mode_);
+		insert_vertices_with_BRIO("DelMain", levels_);
+		stats_.phase_0_t_ = Wmain.elapsed_time();
+	    }
+
+	    if(has_empty_cells_) {
+		return;
+	    }
+
+	    if(periodic_ && warm_start_instances_ != nullptr) {
+		Stopwatch W12("DelWarmStart", detailed_benchmark_mode_);
+		handle_periodic_boundaries_warm_start();
+	    } else if(periodic_) {
+		Stopwatch W12("DelPhaseI-II", detailed_benchmark_mode_);
+		handle_periodic_boundaries();
+	    }
+
+	    if(has_empty_cells_) {
+		return;
+	    }
+	}
+
+        if(debug_mode_) {
+            for(index_t i=0; i<threads_.size(); ++i) {
+                std::cerr << i << " : " <<
+                    static_cast<PeriodicDelaunay3dThread*>(threads_[i].get())
+                    ->max_t() << std::endl;
+            }
+
+            thread(0)->check_combinatorics(verbose_debug_mode_);
+            thread(0)->check_geometry(verbose_debug_mode_);
+        }
+
+	index_t nb_tets = 0;
+	{
+	    nb_tets = compress();
+
+	    if(cell_order_ != CELL_ORDER_NONE) {
+		reorder_cells(nb_tets);
+	    }
+
+	    set_arrays(
+		nb_tets,
+		cell_to_v_store_.data(),
+		cell_to_cell_store_.data()
+	    );
+
+	    // We need v_to_cell even if CICL is not stored.
+	    if(!stores_cicl()) {
+		update_v_to_cell();
+	    }
+	}
+
+        if(periodic_) {
+#ifdef GEO_DEBUG
+            FOR(v, nb_vertices_non_periodic_) {
+                index_t t = v_to_cell_[v];
+                geo_assert(t == NO_INDEX || t < nb_tets);
+            }
+#endif
+        }
+	stats_.total_t_ = W_tot.elapsed_time();
+	if(benchmark_mode_) {
+	    Logger::out("Delaunay") << stats_.to_string() << std::endl;
+	}
+    }
+
+    index_t PeriodicDelaunay3d::compress(bool shrink) {
+
+	Stopwatch W("Compress",detailed_benchmark_mode_);
+
+        //   Compress cell_to_v_store_ and cell_to_cell_store_
+        // (remove free and virtual tetrahedra).
+        //   Since cell_next_ is not used at this point,
+        // we reuse it for storing the conversion array that
+        // maps old tet indices to new tet indices
+        // Note: tet_is_real() uses the previous value of
+        // cell_next(), but we are processing indices
+        // in increasing order and since old2new[t] is always
+        // smaller or equal to t, we never overwrite a value
+        // before needing it.
+
+
+        PeriodicDelaunay3dThread* thread0 = thread(0);
+        vector<index_t>& old2new = cell_next_;
+        index_t nb_tets = 0;
+        index_t nb_tets_to_delete = 0;
+
+        {
+	    // Classify tets in parallel (on very large data sets,
+	    // >= 100M points, it gains a little bit of time)
+	    parallel_for(0, thread0->max_t(), [&,this](index_t t) {
+		if(
+                    (keep_infinite_ && !thread0->tet_is_free(t)) ||
+                    (periodic_ && thread0->tet_is_real_non_periodic(t)) ||
+                    (!periodic_ && thread0->tet_is_real(t))
+                ) {
+		    old2new[t] = 0; // keep tetrahedron
+		} else {
+		    old2new[t] = NO_INDEX; // discard tetrahedron
+		}
+	    });
+
+	    // Compress the tet array
+            for(index_t t = 0; t < thread0->max_t(); ++t) {
+                if(old2new[t] != NO_INDEX) {
+                    if(t != nb_tets) {
+                        Memory::copy(
+                            &cell_to_v_store_[nb_tets * 4],
+                            &cell_to_v_store_[t * 4],
+                            4 * sizeof(index_t)
+                        );
+                        Memory::copy(
+                            &cell_to_cell_store_[nb_tets * 4],
+                            &cell_to_cell_store_[t * 4],
+                            4 * sizeof(index_t)
+                        );
+                    }
+                    old2new[t] = nb_tets;
+                    ++nb_tets;
+                } else {
+                    ++nb_tets_to_delete;
+                }
+            }
+
+            if(shrink) {
+                cell_to_v_store_.resize(4 * nb_tets);
+                cell_to_cell_store_.resize(4 * nb_tets);
+            }
+
+	    // Apply permutation to cell_to_cell_ array
+	    parallel_for(0, 4*nb_tets, [this, &old2new](index_t i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                // Note: t can be equal to -1 when a real tet is
+                // adjacent to a virtual one (and this is how the
+                // rest of Vorpaline expects to see tets on the
+                // border).
+                geo_debug_assert(!(keep_infinite_ && (t == NO_INDEX)));
+                cell_to_cell_store_[i] = t;
+            });
+        }
+
+        // In "keep_infinite" mode, we reorder the cells in such
+        // a way that finite cells have indices [0..nb_finite_cells_-1]
+        // and infinite cells have indices [nb_finite_cells_ .. nb_cells_-1]
+
+        if(keep_infinite_) {
+            nb_finite_cells_ = 0;
+            index_t finite_ptr = 0;
+            index_t infinite_ptr = nb_tets - 1;
+            for(;;) {
+                while(thread0->tet_is_finite(finite_ptr)) {
+                    old2new[finite_ptr] = finite_ptr;
+                    ++finite_ptr;
+                    ++nb_finite_cells_;
+                }
+                while(!thread0->tet_is_finite(infinite_ptr)) {
+                    old2new[infinite_ptr] = infinite_ptr;
+                    --infinite_ptr;
+                }
+                if(finite_ptr > infinite_ptr) {
+                    break;
+                }
+                old2new[finite_ptr] = infinite_ptr;
+                old2new[infinite_ptr] = finite_ptr;
+                ++nb_finite_cells_;
+                for(index_t lf=0; lf<4; ++lf) {
+                    std::swap(
+                        cell_to_cell_store_[4*finite_ptr + lf],
+                        cell_to_cell_store_[4*infinite_ptr + lf]
+                    );
+                }
+                for(index_t lv=0; lv<4; ++lv) {
+                    std::swap(
+                        cell_to_v_store_[4*finite_ptr + lv],
+                        cell_to_v_store_[4*infinite_ptr + lv]
+                    );
+                }
+                ++finite_ptr;
+                --infinite_ptr;
+            }
+	    parallel_for(0, 4*nb_tets, [this, &old2new](index_t i) {
+                index_t t = cell_to_cell_store_[i];
+                geo_debug_assert(t != NO_INDEX);
+                t = old2new[t];
+                geo_debug_assert(t != NO_INDEX);
+                cell_to_cell_store_[i] = t;
+            });
+        }
+
+
+        if(detailed_benchmark_mode_) {
+            Logger::out("DelCompress")
+                << "max tets " << thread0->max_t()
+                << std::endl;
+
+            Logger::out("DelCompress")
+                << "Final number of tets " << nb_tets
+                << std::endl;
+            if(keep_infinite_) {
+                Logger::out("DelCompress")
+                    << "Removed " << nb_tets_to_delete
+                    << " tets (free list)"
+		    << " : "
+		    << double(nb_tets_to_delete)*100.0/double(nb_tets) << "%"
+		    << std::endl;
+            } else {
+                Logger::out("DelCompress")
+                    << "Removed " << nb_tets_to_delete
+                    << " tets (free list and infinite)"
+		    << " : "
+		    << double(nb_tets_to_delete)*100.0/double(nb_tets) << "%"
+		    << std::endl;
+            }
+        }
+
+        for(index_t t=0; t<nb_tets; ++t) {
+            cell_next_[t] = PeriodicDelaunay3dThread::NOT_IN_LIST;
+        }
+
+	// Disconnect tets that were connected to infinite tets
+        if(periodic_) {
+	    parallel_for(0, 4*nb_tets, [this,nb_tets](index_t i) {
+                if(cell_to_cell_store_[i] >= nb_tets) {
+                    cell_to_cell_store_[i] = NO_INDEX;
+                }
+	    });
+#ifdef GEO_DEBUG
+            for(index_t i=0; i<4*nb_tets; ++i) {
+                geo_debug_assert(cell_to_v_store_[i] != NO_INDEX);
+            }
+#endif
+        }
+        return nb_tets;
+    }
+
+    void PeriodicDelaunay3d::reorder_cells(index_t nb_tets) {
+
+	Stopwatch W("Reorder",detailed_benchmark_mode_);
+
+        // In "keep_infinite" mode, only the finite cells are sorted,
+        // the infinite ones stay at the end.
+        index_t nb = keep_infinite_ ? nb_finite_cells_ : nb_tets;
+        if(nb <= 1) {
+            return;
+        }
+
+        // Sort key of each cell. Periodic vertices are taken with their
+        // translation, so that the centroid of a cell that crosses the
+        // boundary stays next to the cell.
+        vector<double> keys(3 * nb);
+	parallel_for(0, nb, [&,this](index_t t) {
+            const index_t* T = &cell_to_v_store_[4 * t];
+            vec3 key;
+            if(cell_order_key_ == CELL_ORDER_KEY_LOWEST_VERTEX) {
+                index_t lowest = T[0];
+                for(index_t lv=1; lv<4; ++lv) {
+                    if(
+                        periodic_vertex_real(T[lv]) <
+                        periodic_vertex_real(lowest)
+                    ) {
+                        lowest = T[lv];
+                    }
+                }
+                key = vertex(periodic_vertex_real(lowest));
+            } else {
+                key = 0.25 * (
+                    vertex(T[0]) + vertex(T[1]) + vertex(T[2]) + vertex(T[3])
+                );
+            }
+            keys[3 * t] = key.x;
+            keys[3 * t + 1] = key.y;
+            keys[3 * t + 2] = key.z;
+        });
+
+        vector<index_t> new2old(nb);
+        for(index_t t=0; t<nb; ++t) {
+            new2old[t] = t;
+        }
+        if(cell_order_ == CELL_ORDER_MORTON) {
+            compute_Morton_order(nb, keys.data(), new2old, 0, nb, 3);
+        } else {
+            compute_Hilbert_order(nb, keys.data(), new2old, 0, nb, 3);
+        }
+
+        // Cells past nb (infinite ones) and NO_INDEX keep their number
+        vector<index_t> old2new(nb_tets);
+        for(index_t t=0; t<nb_tets; ++t) {
+            old2new[t] = t;
+        }
+        for(index_t t=0; t<nb; ++t) {
+            old2new[new2old[t]] = t;
+        }
+
+        vector<index_t> cell_to_v(cell_to_v_store_.size());
+        vector<index_t> cell_to_cell(cell_to_cell_store_.size());
+	parallel_for(0, nb_tets, [&,this](index_t t) {
+            index_t old_t = (t < nb) ? new2old[t] : t;
+            for(index_t lf=0; lf<4; ++lf) {
+                cell_to_v[4 * t + lf] = cell_to_v_store_[4 * old_t + lf];
+                index_t adj = cell_to_cell_store_[4 * old_t + lf];
+                cell_to_cell[4 * t + lf] =
+                    (adj == NO_INDEX) ? NO_INDEX : old2new[adj];
+            }
+        });
+        cell_to_v_store_.swap(cell_to_v);
+        cell_to_cell_store_.swap(cell_to_cell);
+    }
+
+    index_t PeriodicDelaunay3d::nearest_vertex(const double* p) const {
+        // TODO
+        return Delaunay::nearest_vertex(p);
+    }
+
+    void PeriodicDelaunay3d::set_BRIO_levels(const vector<index_t>& levels) {
+        levels_ = levels;
+    }
+
+    void PeriodicDelaunay3d::update_v_to_cell() {
+        geo_assert(!is_locked_);  // Not thread-safe
+        is_locked_ = true;
+
+	// Optimized version for large scale optimal transport,
+	// can be removed (all cases treated)
+	if(!update_periodic_v_to_cell_ && !keeps_infinite()) {
+            v_to_cell_.assign(nb_vertices(), NO_INDEX);
+	    parallel_for(0, nb_cells(), [this](index_t c) {
+                for(index_t lv = 0; lv < 4; lv++) {
+                    index_t v = cell_vertex(c, lv);
+		    // discriminates both vertex at infinity (NO_INDEX)
+		    // and VERTEX_OF_DELETED_TET (index_t(-2)).
+                    if(v < nb_vertices_non_periodic_) {
+                        v_to_cell_[v] = c;
+		    }
+		}
+	    });
+	    is_locked_ = false; // Do not forget to unlock !
+	    return;
+	}
+
+
+        // Note: if keeps_infinite is set, then infinite vertex
+        // tet chaining is at t2v_[nb_vertices].
+
+        // Create periodic_v_to_cell_ structure in compressed row
+        // storage format.
+
+	// It was used in previous version for handling periodic boundary
+	// conditions based on ConvexCell, it is no longer the case, new
+	// code solely uses tetrahedra. It is kept here for reference for
+	// implementing the distributed version (using ConvexCell can save
+	// points tranfers).
+
+        if(update_periodic_v_to_cell_) {
+            periodic_v_to_cell_rowptr_.resize(nb_vertices_non_periodic_ + 1);
+            periodic_v_to_cell_rowptr_[0] = 0;
+            index_t cur = 0;
+            for(index_t v=0; v<nb_vertices_non_periodic_; ++v) {
+                cur += pop_count(vertex_instances_[v])-1;
+                periodic_v_to_cell_rowptr_[v+1] = cur;
+            }
+            periodic_v_to_cell_data_.assign(cur, NO_INDEX);
+        }
+
+        if(keeps_infinite()) {
+            geo_assert(!periodic_);
+            v_to_cell_.assign(nb_vertices()+1, NO_INDEX);
+            for(index_t c = 0; c < nb_cells(); c++) {
+                for(index_t lv = 0; lv < 4; lv++) {
+                    index_t v = cell_vertex(c, lv);
+                    if(v == NO_INDEX) {
+                        v = nb_vertices();
+                    }
+                    v_to_cell_[v] = c;
+                }
+            }
+        } else {
+            v_to_cell_.assign(nb_vertices(), NO_INDEX);
+            for(index_t c = 0; c < nb_cells(); c++) {
+                for(index_t lv = 0; lv < 4; lv++) {
+                    index_t v = cell_vertex(c, lv);
+                    if(v < nb_vertices_non_periodic_) {
+                        v_to_cell_[v] = c;
+                    } else if(
+                        update_periodic_v_to_cell_ &&
+                        v != NO_INDEX &&
+			v != PeriodicDelaunay3dThread::VERTEX_OF_DELETED_TET
+                    ) {
+                        index_t v_real = periodic_vertex_real(v);
+                        index_t v_instance = periodic_vertex_instance(v);
+
+                        geo_debug_assert(
+                            (vertex_instances_[v_real] & (1u << v_instance)) != 0
+                        );
+
+                        index_t slot = pop_count(
+                            vertex_instances_[v_real] & ((1u << v_instance)-1)
+                        ) - 1;
+
+                        periodic_v_to_cell_data_[
+                            periodic_v_to_cell_rowptr_[v_real] + slot
+                        ] = c;
+                    }
+                }
+            }
+        }
+
+        is_locked_ = false;
+    }
+
+    void PeriodicDelaunay3d::update_cicl() {
+        // Note: updates CICL information only for the
+        // corners that correspond to real vertices
+        // (anyway, in the API we will be always
+        // starting from a real vertex !)
+
+        geo_assert(!is_locked_);  // Not thread-safe
+        is_locked_ = true;
+        cicl_.resize(4 * nb_cells());
+
+        for(index_t v = 0; v < nb_vertices_non_periodic_; ++v) {
+            index_t t = v_to_cell_[v];
+            if(t != NO_INDEX) {
+                index_t lv = index(t, v);
+                set_next_around_vertex(t, lv, t);
+            }
+        }
+
+        if(keeps_infinite()) {
+
+            {
+                // Process the infinite vertex at index nb_vertices().
+                index_t t = v_to_cell_[nb_vertices()];
+                if(t != NO_INDEX) {
+                    index_t lv = index(t, NO_INDEX);
+                    set_next_around_vertex(t, lv, t);
+                }
+            }
+
+            for(index_t t = 0; t < nb_cells(); ++t) {
+                for(index_t lv = 0; lv < 4; ++lv) {
+                    index_t v = cell_vertex(t, lv);
+                    index_t vv = (v == NO_INDEX) ? nb_vertices() : v;
+                    if(v_to_cell_[vv] != t) {
+                        index_t t1 = v_to_cell_[vv];
+                        index_t lv1 = index(t1, v);
+                        index_t t2 = next_around_vertex(t1, lv1);
+                        set_next_around_vertex(t1, lv1, t);
+                        set_next_around_vertex(t, lv, t2);
+                    }
+                }
+            }
+
+
+        } else {
+            for(index_t t = 0; t < nb_cells(); ++t) {
+                for(index_t lv = 0; lv < 4; ++lv) {
+                    index_t v = cell_vertex(t, lv);
+                    if(v < nb_vertices_non_periodic_ && v_to_cell_[v] != t) {
+                        index_t t1 = v_to_cell_[v];
+                        index_t lv1 = index(t1, v);
+                        index_t t2 = next_around_vertex(t1, lv1);
+                        set_next_around_vertex(t1, lv1, t);
+                        set_next_around_vertex(t, lv, t2);
+                    }
+                }
+            }
+        }
+
+        is_locked_ = false;
+    }
+
+    void PeriodicDelaunay3d::get_incident_tets(
+	index_t v, IncidentTetrahedra& W
+    ) const {
+
+        geo_debug_assert(
+            periodic_ || v < nb_vertices_non_periodic_
+        );
+
+        W.clear_incident_tets();
+
+        index_t t = NO_INDEX;
+        if(v < nb_vertices_non_periodic_) {
+            t = v_to_cell_[v];
+        } else {
+            index_t v_real = periodic_vertex_real(v);
+            index_t v_instance = periodic_vertex_instance(v);
+
+            geo_debug_assert(
+                (vertex_instances_[v_real] & (1u << v_instance))!=0
+            );
+
+            index_t slot = pop_count(
+                vertex_instances_[v_real] & ((1u << v_instance)-1)
+            ) - 1;
+
+            t = periodic_v_to_cell_data_[
+                periodic_v_to_cell_rowptr_[v_real] + slot
+            ];
+        }
+
+        // Can happen: empty power cell.
+        if(t == NO_INDEX) {
+            return;
+        }
+
+        // TODO: different version if CICL is stored ?
+        {
+            W.add_incident_tet(t);
+            W.S.push(t);
+            while(!W.S.empty()) {
+                t = W.S.top();
+                W.S.pop();
+                const index_t* T = &(cell_to_v_store_[4 * t]);
+                index_t lv = PeriodicDelaunay3dThread::find_4(T,v);
+                index_t neigh = cell_to_cell_store_[4*t + (lv + 1)%4];
+                if(neigh != NO_INDEX && !W.has_incident_tet(neigh)) {
+                    W.add_incident_tet(neigh);
+                    W.S.push(neigh);
+                }
+                neigh = cell_to_cell_store_[4*t + (lv + 2)%4];
+                if(neigh != NO_INDEX && !W.has_incident_tet(neigh)) {
+                    W.add_incident_tet(neigh);
+                    W.S.push(neigh);
+                }
+                neigh = cell_to_cell_store_[4*t + (lv + 3)%4];
+                if(neigh != NO_INDEX && !W.has_incident_tet(neigh)) {
+                    W.add_incident_tet(neigh);
+                    W.S.push(neigh);
+                }
+            }
+        }
+    }
+
+    inline double dist2(const double* p, const double* q) {
+        return
+            geo_sqr(p[0]-q[0]) +
+            geo_sqr(p[1]-q[1]) +
+            geo_sqr(p[2]-q[2]) ;
+    }
+
+    void PeriodicDelaunay3d::copy_Laguerre_cell_from_Delaunay(
+        GEO::index_t i,
+        ConvexCell& C,
+        IncidentTetrahedra& W
+    ) const {
+        // Create global vertex indices if not present.
+        C.create_vglobal();
+        C.clear();
+
+        // Create the vertex at infinity.
+        C.create_vertex(vec4(0.0, 0.0, 0.0, 0.0), NO_INDEX);
+
+        GEO::vec3 Pi = vertex(i);
+        double wi = weight(i);
+        double Pi_len2 = Pi[0]*Pi[0] + Pi[1]*Pi[1] + Pi[2]*Pi[2];
+
+        if(stores_cicl()) {
+            // Get neighbors and initialize cell from the tetrahedra in
+            // 1-ring neighborhood of vertex.
+            GEO::index_t t = GEO::index_t(vertex_cell(i));
+            // Special case: Laguerre cell is empty (vertex has
+            // no incident tet).
+            if(t == NO_INDEX) {
+                return;
+            }
+            do {
+                GEO::index_t f = copy_Laguerre_cell_facet_from_Delaunay(
+                    i, Pi, wi, Pi_len2, t, C, W
+                );
+                t = GEO::index_t(next_around_vertex(t,f));
+            } while(t != GEO::index_t(vertex_cell(i)));
+        } else {
+            get_incident_tets(i,W);
+            for(index_t t: W) {
+                copy_Laguerre_cell_facet_from_Delaunay(
+                    i, Pi, wi, Pi_len2, t, C, W
+                );
+            }
+        }
+        C.connect_triangles();
+    }
+
+    GEO::index_t PeriodicDelaunay3d::copy_Laguerre_cell_facet_from_Delaunay(
+        GEO::index_t i,
+        const GEO::vec3& Pi,
+        double wi,
+        double Pi_len2,
+        GEO::index_t t,
+        ConvexCell& C,
+        IncidentTetrahedra& W
+    ) const {
+        geo_argused(W);
+
+        // Local tet vertex indices from facet
+        // and vertex in facet indices.
+        static GEO::index_t fv[4][3] = {
+            {2,3,1},
+            {3,2,0},
+            {0,1,3},
+            {2,1,0}
+        };
+
+        GEO::index_t f = index(t,GEO::index_t(i));
+        GEO::index_t jkl[3];  // Global index (in Delaunay) of triangle vertices
+        VBW::index_t l_jkl[3];// Local index (in C) of triangle vertices
+
+
+        // Find or create the three vertices of the facet.
+        for(int lfv=0; lfv<3; ++lfv) {
+
+            jkl[lfv] = GEO::index_t(cell_vertex(t, fv[f][lfv]));
+            l_jkl[lfv] = VBW::index_t(-1);
+
+            // Vertex already created in C (note:
+            // also works for vertex at infinity)
+            for(VBW::index_t u=0; u<C.nb_v(); ++u) {
+                if(C.v_global_index(u) == jkl[lfv]) {
+                    l_jkl[lfv] = VBW::index_t(u);
+                    break;
+                }
+            }
+
+            // vertex not found, create vertex in C
+            if(l_jkl[lfv] == VBW::index_t(-1)) {
+                l_jkl[lfv] = C.nb_v();
+                vec3 Pj = vertex(jkl[lfv]);
+		double Pj_len2 = length2(Pj);
+                double wj = weight(jkl[lfv]);
+                double a = 2.0 * (Pi[0] - Pj[0]);
+                double b = 2.0 * (Pi[1] - Pj[1]);
+                double c = 2.0 * (Pi[2] - Pj[2]);
+                double d = ((wi - Pi_len2) - (wj - Pj_len2));
+                C.create_vertex(vec4(a,b,c,d), jkl[lfv]);
+            }
+        }
+
+        C.create_triangle(l_jkl[0], l_jkl[1], l_jkl[2]);
+
+        return f;
+    }
+
+    
+
+    void PeriodicDelaunay3d::insert_vertices(
+	const char* phase, index_t b, index_t e
+    ) {
+
+	Stopwatch W(phase,detailed_benchmark_mode_);
+
+        if(detailed_benchmark_mode_) {
+            Logger::out(phase) << "Inserting "    << (e-b)
+			       << " additional vertices" << std::endl;
+        }
+
+        has_empty_cells_ = false;
+
+        nb_vertices_ = reorder_.size();
+	vector<index_t> levels;
+
+	compute_BRIO_order_periodic(
+            nb_vertices_non_periodic_ * 27, // nb of possible periodic vertices
+            vertex_ptr(0),
+	    3, dimension(),
+	    reorder_,
+            reorder_.begin() + long(b),
+            reorder_.begin() + long(e),
+	    period_,
+	    64, 0.125,
+	    &levels
+	);
+
+
+#ifdef GEO_DEBUG
+	// Check that the same vertex was not inserted twice
+        for(index_t i=b; i+1<e; ++i) {
+            geo_debug_assert(reorder_[i] != reorder_[i+1]);
+        }
+#endif
+
+	insert_vertices_with_BRIO(phase, levels);
+        if(has_empty_cells_) {
+            return;
+        }
+        PeriodicDelaunay3dThread* thread0 = thread(0);
+	nb_vertices_ = reorder_.size();
+        set_arrays(
+            thread0->max_t(),
+            cell_to_v_store_.data(),
+            cell_to_cell_store_.data()
+        );
+
+	if(!strcmp(phase, "insert-I")) {
+	    stats_.phase_I_insert_t_ = W.elapsed_time();
+	    stats_.phase_I_insert_nb_ = e-b;
+	} else if(!strcmp(phase, "insert-II")) {
+	    stats_.phase_II_insert_t_ = W.elapsed_time();
+	    stats_.phase_II_insert_nb_ = e-b;
+	}
+    }
+
+    void PeriodicDelaunay3d::insert_vertices_with_BRIO(
+	const char* phase, const vector<index_t>& levels
+    ) {
+
+        for(index_t t=0; t<threads_.size(); ++t) {
+	    thread(t)->reset_stats();
+	}
+
+        PeriodicDelaunay3dThread* thread0 = thread(0);
+
+        index_t lvl = 1;
+        while(lvl < (levels.size() - 1) && (levels[lvl] - levels[0]) < 1000) {
+            ++lvl;
+        }
+
+        if(detailed_benchmark_mode_) {
+            Logger::out(phase)
+                << "Using " << levels.size()-1 << " levels" << std::endl;
+            Logger::out(phase)
+                << "Levels 0 - " << lvl-1
+                << ": bootstraping with first levels in sequential mode"
+                << std::endl;
+        }
+
+        thread0->set_work(levels[0], levels[lvl]);
+        thread0->run();
+
+        if(thread0->has_empty_cells()) {
+            has_empty_cells_ = true;
+            return;
+        }
+
+        index_t nb_sequential_points = 0;
+        index_t first_lvl = lvl;
+
+        // Insert points in all BRIO levels
+        for(; lvl<levels.size()-1; ++lvl) {
+
+            index_t lvl_b = levels[lvl];
+            index_t lvl_e = levels[lvl+1];
+
+            if(detailed_benchmark_mode_) {
+                Logger::out(phase) << "Level "
+				   << lvl << " : start "
+				   << " nbv = "
+				   << (lvl_e - lvl_b)
+				   << std::endl;
+            }
+
+            index_t work_size = (lvl_e - lvl_b)/index_t(threads_.size());
+
+            // Initialize threads
+            index_t b = lvl_b;
+            for(index_t t=0; t<threads_.size(); ++t) {
+                index_t e = (t == threads_.size()-1) ? lvl_e : b+work_size;
+
+                // Copy the indices of the first created tetrahedron
+                // and the maximum valid tetrahedron index max_t_
+                if(lvl == first_lvl && t!=0) {
+                    thread(t)->set_max_t(thread0->max_t());
+                }
+                thread(t)->set_work(b,e);
+                b = e;
+            }
+
+	    check_max_t();
+	    Process::run_threads(threads_);
+
+            for(index_t t=0; t<this->nb_threads(); ++t) {
+                if(thread(t)->has_empty_cells()) {
+                    has_empty_cells_ = true;
+                    return;
+                }
+            }
+
+	    // Run threads sequentialy, to insert missing points if
+	    // memory overflow was encountered (in sequential mode,
+	    // dynamic memory growing works)
+
+	    index_t this_level_nb_sequential_points = 0;
+
+	    for(index_t t=0; t<threads_.size(); ++t) {
+		PeriodicDelaunay3dThread* t1 = thread(t);
+		this_level_nb_sequential_points += t1->work_size();
+		if(t != 0) {
+		    // We need to copy max_t_ from previous thread,
+		    // since the memory pool may have grown.
+		    PeriodicDelaunay3dThread* t2 = thread(t-1);
+		    t1->set_max_t(t2->max_t());
+		}
+		t1->run();
+		if(t1->has_empty_cells()) {
+		    has_empty_cells_ = true;
+		    return;
+		}
+	    }
+
+	    //  If some tetrahedra were created in sequential mode, then
+	    // the maximum valid tetrahedron index was increased by all
+	    // the threads in increasing number, so we copy it from the
+	    // last thread into thread0 since we use thread0 afterwards
+	    // to get max_t()
+
+	    if(this_level_nb_sequential_points != 0) {
+		PeriodicDelaunay3dThread* t0 = thread(0);
+		PeriodicDelaunay3dThread* tn = thread(
+		    this->nb_threads()-1
+		);
+		t0->set_max_t(tn->max_t());
+	    }
+
+	    if(has_empty_cells_) {
+		return;
+	    }
+
+	    nb_sequential_points += this_level_nb_sequential_points;
+        }
+
+        if(detailed_benchmark_mode_) {
+            index_t tot_rollbacks = 0 ;
+            index_t tot_failed_locate = 0 ;
+            for(index_t t=0; t<threads_.size(); ++t) {
+		Logger::out(phase)
+		    << "thread " << std::setw(3) << t << " : "
+		    << std::setw(3) << thread(t)->nb_rollbacks()
+		    << " rollbacks  "
+		    << std::setw(3) << thread(t)->nb_failed_locate()
+		    << " restarted locate"
+		    << std::endl;
+                tot_rollbacks += thread(t)->nb_rollbacks();
+                tot_failed_locate += thread(t)->nb_failed_locate();
+            }
+	    Logger::out(phase) << "------------------" << std::endl;
+            Logger::out(phase) << "total: "
+			       << tot_rollbacks << " rollbacks  "
+			       << tot_failed_locate << " restarted locate"
+			       << std::endl;
+	    if(nb_sequential_points == 0) {
+		Logger::out(phase) << "All points where inserted in parallel"
+				    << std::endl;
+	    } else {
+		Logger::out(phase) << nb_sequential_points
+				   << " points inserted in sequential mode"
+				   << std::endl;
+	    }
+        }
+
+	nb_vertices_ = reorder_.size();
+        index_t nb_tets = thread0->max_t();
+
+	for(index_t i=0; i<nb_threads(); ++i) {
+	    geo_assert(thread(i)->max_t() <= nb_tets);
+	}
+    }
+
+    bool PeriodicDelaunay3d::Laguerre_vertex_is_in_conflict_with_plane(
+	index_t t, vec4 P
+    ) const {
+
+	// Note: facet orientations and signs follow:
+	// - ConvexCell
+	// - copy_Laguerre_facet_from()
+
+        // Local tet vertex indices from facet and vertex in facet indices.
+	// Carefully chosen in such a way that f[(lv+1)%4][2] == lv
+	// This is used in the code block below, that handles tets with
+	// a vertex at infinity
+        static GEO::index_t fv[4][3] = {
+            {1,2,3},
+            {3,2,0},
+            {3,0,1},
+            {1,0,2}
+        };
+
+	// Particular case, vertex at infinity
+	for(index_t lv=0; lv<4; ++lv) {
+	    if(cell_vertex(t,lv) == NO_INDEX) {
+		index_t li = (lv + 1) % 4; // this vertex is not at infty
+		// li is also the index of a facet with the vertex at infty
+		// as the last vertex (fv[][] was constructed so), so we
+		// are sure that vi, vj, vk are the not at infty
+		index_t vi = cell_vertex(t, li);
+		index_t vj = cell_vertex(t, fv[li][0]);
+		index_t vk = cell_vertex(t, fv[li][1]);
+		geo_debug_assert(fv[li][2] == lv); // we know that l == -1
+		vec3 pi = vertex(vi);
+		vec3 pj = vertex(vj);
+		vec3 pk = vertex(vk);
+		Sign s = PCK::det_3d(
+		    pi-pj,
+		    pi-pk,
+		    vec3(P.x,P.y,P.z)
+		);
+		return (s <= 0);
+	    }
+	}
+
+	index_t v1 = cell_vertex(t,0);
+	index_t v2 = cell_vertex(t,1);
+	index_t v3 = cell_vertex(t,2);
+	index_t v4 = cell_vertex(t,3);
+
+	vec3 p1 = vertex(v1);
+	vec3 p2 = vertex(v2);
+	vec3 p3 = vertex(v3);
+	vec3 p4 = vertex(v4);
+
+	double l1 = weight(v1) - length2(p1);
+	double l2 = weight(v2) - length2(p2);
+	double l3 = weight(v3) - length2(p3);
+	double l4 = weight(v4) - length2(p4);
+
+	Sign s = PCK::det_4d(
+	    vec4(2.0*(p1.x-p2.x), 2.0*(p1.y-p2.y), 2.0*(p1.z-p2.z), l1-l2),
+	    vec4(2.0*(p1.x-p3.x), 2.0*(p1.y-p3.y), 2.0*(p1.z-p3.z), l1-l3),
+	    vec4(2.0*(p1.x-p4.x), 2.0*(p1.y-p4.y), 2.0*(p1.z-p4.z), l1-l4),
+	    P
+	);
+
+	return (s >= 0);
+    }
+
+
+    void PeriodicDelaunay3d::compute_Laguerre_cell_status(
+	std::atomic<Numeric::uint16>* Lag_cell_status
+    ) {
+        PeriodicDelaunay3dThread* thread0 = thread(0);
+
+	// Lag_cell_status:
+	//
+	// each bit k in 0..5  indicate that cell has at least one vertex
+	//                     in conflict with plane Pk (outside central cube)
+	// each bit k in 6..11 indicate that cell has all its vertices
+	//                     in conflict with plane Pk (outside central cube)
+	// status = 0 -> cell is contained by central cube
+	// (status & conflict_mask) != 0 -> cell straddles bndr of central cube
+	// (status & all_conflict_mask) != 0 -> cell is outside central cube
+
+	// static Numeric::uint16 conflict_mask     = Numeric::uint16(63u);
+	static Numeric::uint16 all_conflict_mask = Numeric::uint16(63u << 6);
+
+	for(index_t i=0; i<nb_vertices_non_periodic_; ++i) {
+	    Lag_cell_status[i] = all_conflict_mask;
+	}
+
+	{
+	    vec4 cube_face[6] = {
+		vec4( 1.0, 0.0, 0.0,  0.0),
+		vec4(-1.0, 0.0, 0.0,  period_.x),
+		vec4( 0.0, 1.0, 0.0,  0.0),
+		vec4( 0.0,-1.0, 0.0,  period_.y),
+		vec4( 0.0, 0.0, 1.0,  0.0),
+		vec4( 0.0, 0.0,-1.0,  period_.z),
+	    };
+
+	    parallel_for(0, thread0->max_t(), [&](index_t t) {
+		if(thread0->tet_is_free(t)) {
+		    return;
+		}
+		// Tets of periodic copies only (warm start check) do
+		// not change the status of any real vertex
+		bool has_real_vertex = false;
+		for(index_t lv=0; lv<4; ++lv) {
+		    has_real_vertex = has_real_vertex ||
+			(cell_vertex(t,lv) < nb_vertices_non_periodic_);
+		}
+		if(!has_real_vertex) {
+		    return;
+		}
+		for(index_t k=0; k<6; ++k) {
+		    bool conflict = Laguerre_vertex_is_in_conflict_with_plane(
+			t, cube_face[k]
+		    );
+		    for(index_t lv=0; lv<4; ++lv) {
+			index_t v = cell_vertex(t,lv);
+			// (periodic copies, only in the warm start check)
+			if(v == NO_INDEX || v >= nb_vertices_non_periodic_) {
+			    continue;
+			}
+			if(conflict) {
+			    // set 'conflict' bit k
+			    Lag_cell_status[v].fetch_or(
+				Numeric::uint16(1u << k),
+				std::memory_order_relaxed
+			    );
+			} else {
+			    // reset 'all conflict' bit k
+			    Lag_cell_status[v].fetch_and(
+				Numeric::uint16(~(1u << (k+6))),
+				std::memory_order_relaxed
+			    );
+			}
+		    }
+		}
+	    }
+	    );
+	}
+    }
+
+    Numeric::uint32 PeriodicDelaunay3d::instances_from_conflict_status(
+	Numeric::uint16 status
+    ) const {
+	// Integer translations associated with the six plane equations
+	static int T[6][3]= {
+	    {-1, 0, 0},
+	    { 1, 0, 0},
+	    { 0,-1, 0},
+	    { 0, 1, 0},
+	    { 0, 0,-1},
+	    { 0, 0, 1}
+	};
+
+	// Detect the bounds of the sub-(rubic's) cube overlapped
+	// by the cell.
+
+	int TXmin = 2, TXmax = -2,
+	    TYmin = 2, TYmax = -2,
+	    TZmin = 2, TZmax = -2;
+
+	FOR(i,6) {
+	    if((status & Numeric::uint8(1u << i)) != 0) {
+		TXmin = std::min(TXmin, T[i][0]);
+		TXmax = std::max(TXmax, T[i][0]);
+		TYmin = std::min(TYmin, T[i][1]);
+		TYmax = std::max(TYmax, T[i][1]);
+		TZmin = std::min(TZmin, T[i][2]);
+		TZmax = std::max(TZmax, T[i][2]);
+	    }
+	}
+
+	Numeric::uint32 result = 0;
+	for(int TX = TXmin; TX <= TXmax; ++TX) {
+	    for(int TY = TYmin; TY <= TYmax; ++TY) {
+		for(int TZ = TZmin; TZ <= TZmax; ++TZ) {
+		    index_t instance = T_to_instance(-TX,-TY,-TZ);
+		    // Skip instance 0 (it is the vertex itself)
+		    if(instance != 0) {
+			result |= (1u << instance);
+		    }
+		}
+	    }
+	}
+	return result;
+    }
+
+    void PeriodicDelaunay3d::handle_periodic_boundaries_phase_I() {
+        Stopwatch W_classify_I("classify-I", detailed_benchmark_mode_);
+
+	static Numeric::uint16 all_conflict_mask = Numeric::uint16(63u << 6);
+
+	std::atomic<Numeric::uint16>* Lag_cell_status
+	    = new std::atomic<Numeric::uint16>[nb_vertices_non_periodic_];
+	compute_Laguerre_cell_status(Lag_cell_status);
+
+	// Count cells inside, crossing, outside
+	{
+	    stats_.phase_I_nb_inside_ = 0;
+	    stats_.phase_I_nb_cross_ = 0;
+	    stats_.phase_I_nb_outside_ = 0;
+	    for(index_t v=0; v<nb_vertices_non_periodic_; ++v) {
+		Numeric::uint16 status = Lag_cell_status[v];
+		if(status == 0) {
+		    ++stats_.phase_I_nb_inside_;
+		} else if((status & all_conflict_mask) != 0) {
+		    ++stats_.phase_I_nb_outside_;
+		} else {
+		    ++stats_.phase_I_nb_cross_;
+		}
+	    }
+
+	    if(detailed_benchmark_mode_) {
+		Logger::out("classify-I") << "Nb cells inside cube: "
+					  << stats_.phase_I_nb_inside_
+					  << std::endl;
+		Logger::out("classify-I") << "Nb cells on boundary: "
+					  << stats_.phase_I_nb_cross_
+					  << std::endl;
+		Logger::out("classify-I") << "Nb cells outside cube: "
+					  << stats_.phase_I_nb_outside_
+					  << std::endl;
+	    }
+	}
+
+        // Indicates for each real vertex the instances it has.
+        // Each bit of vertex_instances_[v] indicates which instance
+        // is used.
+        vertex_instances_.assign(nb_vertices_non_periodic_,1);
+
+	for(index_t v=0; v<nb_vertices_non_periodic_; ++v) {
+	    Numeric::uint16 status = Lag_cell_status[v];
+
+	    bool status_inside = (status == 0);
+
+	    // In the distributed version, we might need to distinguish
+	    // also the following two cases:
+	    // bool status_outside = ((status & all_conflict_mask) != 0);
+	    // bool status_crossing = !status_inside && !status_outside;
+
+	    // if cell is inside cube, no instance to create
+	    if(status_inside) {
+		continue;
+	    }
+
+	    Numeric::uint32 instances = instances_from_conflict_status(status);
+	    vertex_instances_[v] |= instances;
+	    for(index_t instance=1; instance<27; ++instance) {
+		if((instances & (1u << instance)) != 0) {
+		    reorder_.push_back(make_periodic_vertex(v,instance));
+		}
+	    }
+	}
+	delete[] Lag_cell_status;
+	stats_.phase_I_classify_t_ = W_classify_I.elapsed_time();
+    }
+
+    void PeriodicDelaunay3d::compute_translation_table(
+	Numeric::int8 table[27][27]
+    ) const {
+	// table[instance2][instance1] transforms
+	// instance2 into the frame of instance1
+	for(index_t instance1=0; instance1<27; ++instance1) {
+	    int Tx1 = translation[instance1][0];
+	    int Ty1 = translation[instance1][1];
+	    int Tz1 = translation[instance1][2];
+	    for(index_t instance2=0; instance2<27; ++instance2) {
+		int Tx2 = translation[instance2][0];
+		int Ty2 = translation[instance2][1];
+		int Tz2 = translation[instance2][2];
+
+		table[instance2][instance1] =
+		    Numeric::int8(instance2);
+
+		if(instance1 == instance2) {
+		    continue;
+		}
+
+		if(
+		    std::abs(Tx2 - Tx1) >= 2 ||
+		    std::abs(Ty2 - Ty1) >= 2 ||
+		    std::abs(Tz2 - Tz1) >= 2
+		) {
+		    // Here we could use -1 to encode large displacements,
+		    // and issue an error message (for now they are ignored)
+		    continue;
+		}
+
+		table[instance2][instance1] =
+		    Numeric::int8(T_to_instance(Tx2-Tx1,Ty2-Ty1,Tz2-Tz1));
+	    }
+	}
+    }
+
+    void PeriodicDelaunay3d::handle_periodic_boundaries_phase_II(
+	const vector<Numeric::uint32>* phase_I_instances
+    ) {
+	Stopwatch W_classify_II("classify-II", detailed_benchmark_mode_);
+	PeriodicDelaunay3dThread* thread0 = thread(0);
+
+	Numeric::int8 translation_table[27][27];
+	compute_translation_table(translation_table);
+
+	// In the warm start check, new_vertex_instances accumulates the
+	// required copies (some of them are already there).
+	std::atomic<Numeric::uint32>* new_vertex_instances =
+	    new std::atomic<Numeric::uint32>[vertex_instances_.size()];
+
+	for(index_t i=0; i<vertex_instances_.size(); ++i) {
+	    new_vertex_instances[i] = (phase_I_instances == nullptr) ?
+		vertex_instances_[i] : ((*phase_I_instances)[i] | 1u);
+	}
+
+	// The new vertices are collected in one buffer per slice of
+	// tets (no lock), then appended to reorder_ at the offsets
+	// given by a scan of the buffer sizes.
+	index_t max_t = thread0->max_t();
+	index_t nb_slices = std::max(
+	    index_t(1),
+	    std::min(max_t, Process::maximum_concurrent_threads())
+	);
+	vector<vector<index_t> > new_vertices(nb_slices);
+
+	parallel_for(0, nb_slices, [&,this](index_t slice) {
+	    index_t t_begin = index_t(Numeric::uint64(max_t)*slice/nb_slices);
+	    index_t t_end = index_t(Numeric::uint64(max_t)*(slice+1)/nb_slices);
+	    vector<index_t>& slice_vertices = new_vertices[slice];
+	    for(index_t t=t_begin; t<t_end; ++t) {
+		if(!thread0->tet_is_real(t)) {
+		    continue;
+		}
+		// Find the edges v1,v2 such that:
+		//   v1 is a vertex that was inserted in phase-I (instance != 0)
+		//   v2 is a vertex in an instance different from v1
+		for(index_t lv=0; lv<4; ++lv) {
+		    index_t v1 = thread0->finite_tet_vertex(t, lv);
+		    index_t v1_instance = periodic_vertex_instance(v1);
+		    if(v1_instance == 0) {
+			continue;
+		    }
+		    // Warm start check: v1 and v2 are among the vertices
+		    // phase II would see (real ones and phase I copies),
+		    // the other copies are ignored.
+		    if(
+			phase_I_instances != nullptr &&
+			((*phase_I_instances)[periodic_vertex_real(v1)] &
+			 (1u << v1_instance)) == 0
+		    ) {
+			continue;
+		    }
+		    for(index_t dlv=1; dlv<4; ++dlv) {
+			index_t v2 = thread0->finite_tet_vertex(t, (lv + dlv)%4);
+			index_t v2_real = periodic_vertex_real(v2);
+			index_t v2_instance = periodic_vertex_instance(v2);
+			if(
+			    phase_I_instances != nullptr && v2_instance != 0 &&
+			    ((*phase_I_instances)[v2_real] &
+			     (1u << v2_instance)) == 0
+			) {
+			    continue;
+			}
+
+			// transform v2_instance into the local frame of v1
+			v2_instance = index_t(
+			    translation_table[v2_instance][v1_instance]
+			);
+			if(v2_instance == v1_instance) {
+			    continue;
+			}
+
+			// create the transformed v2_instance if it does not
+			// already exist, and memorize it in the new list of
+			// vertices to create
+
+			Numeric::uint32 mask = (1u << v2_instance);
+			Numeric::uint32 prev_instances =
+			    new_vertex_instances[v2_real].fetch_or(
+				mask, std::memory_order_relaxed // only need atomic
+			    );
+
+			if(
+			    (prev_instances & mask) == 0 && (
+				phase_I_instances == nullptr ||
+				(vertex_instances_[v2_real] & mask) == 0
+			    )
+			) {
+			    slice_vertices.push_back(
+				make_periodic_vertex(v2_real, v2_instance)
+			    );
+			}
+		    }
+		}
+	    }
+	});
+
+	vector<index_t> slice_offset(nb_slices+1);
+	slice_offset[0] = reorder_.size();
+	for(index_t slice=0; slice<nb_slices; ++slice) {
+	    slice_offset[slice+1] =
+		slice_offset[slice] + new_vertices[slice].size();
+	}
+	reorder_.resize(slice_offset[nb_slices]);
+	parallel_for(0, nb_slices, [&](index_t slice) {
+	    std::copy(
+		new_vertices[slice].begin(), new_vertices[slice].end(),
+		reorder_.begin() + long(slice_offset[slice])
+	    );
+	});
+	if(phase_I_instances == nullptr) {
+	    for(index_t i=0; i<vertex_instances_.size(); ++i) {
+		vertex_instances_[i] = new_vertex_instances[i];
+	    }
+	    required_vertex_instances_ = vertex_instances_;
+	} else {
+	    required_vertex_instances_.resize(vertex_instances_.size());
+	    for(index_t i=0; i<vertex_instances_.size(); ++i) {
+		required_vertex_instances_[i] = new_vertex_instances[i];
+		vertex_instances_[i] |= new_vertex_instances[i];
+	    }
+	}
+	delete[] new_vertex_instances;
+	stats_.phase_II_classify_t_ = W_classify_II.elapsed_time();
+    }
+
+    void PeriodicDelaunay3d::handle_periodic_boundaries() {
+
+        // Update pointers so that queries function will work (even in our
+        // "transient state").
+        PeriodicDelaunay3dThread* thread0 = thread(0);
+
+        set_arrays(
+            thread0->max_t(),
+            cell_to_v_store_.data(),
+            cell_to_cell_store_.data()
+        );
+
+	// Test for empty cells
+	// TODO: I tested, it really occurs that there is still an empty
+	// cell here, why is it not detected before ? To be understood.
+        update_v_to_cell();
+        for(index_t v=0; v<nb_vertices_non_periodic_; ++v) {
+            if(v_to_cell_[v] == NO_INDEX) {
+                has_empty_cells_ = true;
+                return;
+            }
+        }
+
+        // Phase I: find the cells that intersect the boundaries, and
+        // create periodic vertices for each possible translation.
+	{
+	    Stopwatch W_phase_I("phase-I",false);
+	    handle_periodic_boundaries_phase_I();
+	    insert_vertices(
+		"insert-I", nb_vertices_non_periodic_, reorder_.size()
+	    );
+	    stats_.phase_I_t_ = W_phase_I.elapsed_time();
+	}
+
+        // Phase II: Insert the real neighbors of the virtual vertices,
+        // back-translated to the original position.
+	{
+	    index_t nb_vertices_phase_I = reorder_.size();
+	    Stopwatch W_phase_II("phase-II",false);
+	    handle_periodic_boundaries_phase_II();
+	    insert_vertices("insert-II", nb_vertices_phase_I, reorder_.size());
+	    stats_.phase_II_t_ = W_phase_II.elapsed_time();
+	}
+    }
+
+    void PeriodicDelaunay3d::handle_periodic_boundaries_warm_start() {
+	Stopwatch W_warm("warm-start", detailed_benchmark_mode_);
+        PeriodicDelaunay3dThread* thread0 = thread(0);
+
+        set_arrays(
+            thread0->max_t(),
+            cell_to_v_store_.data(),
+            cell_to_cell_store_.data()
+        );
+        update_v_to_cell();
+        for(index_t v=0; v<nb_vertices_non_periodic_; ++v) {
+            if(v_to_cell_[v] == NO_INDEX) {
+                has_empty_cells_ = true;
+                return;
+            }
+        }
+
+	// The copies of the previous run, and the copies of the vertices
+	// in a band of width margin along the faces (conflict bits as in
+	// phase I, the cell of such a vertex may now cross the face).
+	double m = warm_start_margin_;
+	vertex_instances_.resize(nb_vertices_non_periodic_);
+	for(index_t v=0; v<nb_vertices_non_periodic_; ++v) {
+	    Numeric::uint32 instances = warm_start_instances_[v] | 1u;
+	    if(m > 0.0) {
+		const double* p = vertex_ptr(v);
+		Numeric::uint16 status = 0;
+		for(index_t coord=0; coord<3; ++coord) {
+		    if(p[coord] < m) {
+			status |= Numeric::uint16(1u << (2*coord));
+		    }
+		    if(p[coord] > period_[coord] - m) {
+			status |= Numeric::uint16(1u << (2*coord+1));
+		    }
+		}
+		if(status != 0) {
+		    instances |= instances_from_conflict_status(status);
+		}
+	    }
+	    vertex_instances_[v] = instances;
+	    for(index_t instance=1; instance<27; ++instance) {
+		if((instances & (1u << instance)) != 0) {
+		    reorder_.push_back(make_periodic_vertex(v,instance));
+		}
+	    }
+	}
+
+	stats_.warm_start_insert_nb_ =
+	    reorder_.size() - nb_vertices_non_periodic_;
+	if(reorder_.size() > nb_vertices_non_periodic_) {
+	    insert_vertices(
+		"insert-warm", nb_vertices_non_periodic_, reorder_.size()
+	    );
+	    if(has_empty_cells_) {
+		return;
+	    }
+	}
+	stats_.warm_start_t_ = W_warm.elapsed_time();
+
+	// Check the copies with the criteria of phases I and II, and
+	// insert the missing ones (typically vertices that just entered
+	// the band along a face). As in phase II, the neighbors of the
+	// copies added by phase II are not needed, only the neighbors
+	// of new phase I copies need a second round.
+	Stopwatch W_check("warm-check", detailed_benchmark_mode_);
+	vector<Numeric::uint32> phase_I_instances;
+	index_t b = reorder_.size();
+	bool new_phase_I_copies = add_missing_phase_I_vertices(
+	    phase_I_instances
+	);
+	for(index_t round=0; round<2; ++round) {
+	    handle_periodic_boundaries_phase_II(&phase_I_instances);
+	    index_t e = reorder_.size();
+	    if(e > b) {
+		stats_.warm_start_repair_nb_ += e - b;
+		insert_vertices("insert-warm", b, e);
+		if(has_empty_cells_) {
+		    return;
+		}
+	    }
+	    if(!new_phase_I_copies) {
+		break;
+	    }
+	    new_phase_I_copies = false;
+	    b = reorder_.size();
+	}
+	stats_.warm_start_check_t_ = W_check.elapsed_time();
+    }
+
+    bool PeriodicDelaunay3d::add_missing_phase_I_vertices(
+	vector<Numeric::uint32>& phase_I_instances
+    ) {
+	// Phase I criterion: the Laguerre cells of the real vertices,
+	// computed with all the copies (they can only be smaller than
+	// the ones phase I sees, and stay valid when copies are added),
+	// need no other copy of them.
+	std::atomic<Numeric::uint16>* Lag_cell_status
+	    = new std::atomic<Numeric::uint16>[nb_vertices_non_periodic_];
+	compute_Laguerre_cell_status(Lag_cell_status);
+
+	bool result = false;
+	phase_I_instances.assign(nb_vertices_non_periodic_,0);
+	for(index_t v=0; v<nb_vertices_non_periodic_; ++v) {
+	    Numeric::uint16 status = Lag_cell_status[v];
+	    if(status == 0) {
+		continue;
+	    }
+	    Numeric::uint32 instances = instances_from_conflict_status(status);
+	    phase_I_instances[v] = instances;
+	    instances &= ~vertex_instances_[v];
+	    vertex_instances_[v] |= instances;
+	    for(index_t instance=1; instance<27; ++instance) {
+		if((instances & (1u << instance)) != 0) {
+		    reorder_.push_back(make_periodic_vertex(v,instance));
+		    result = true;
+		}
+	    }
+	}
+	delete[] Lag_cell_status;
+	return result;
+    }
+
+    void PeriodicDelaunay3d::check_volume() {
+        ConvexCell C;
+        C.use_exact_predicates(convex_cell_exact_predicates_);
+
+        Logger::out("Periodic") << "Checking total volume..." << std::endl;
+        double sumV = 0;
+        IncidentTetrahedra W;
+
+        FOR(v, nb_vertices_non_periodic_) {
+            copy_Laguerre_cell_from_Delaunay(v, C, W);
+#ifdef GEO_DEBUG
+            for(
+                VBW::ushort t = C.first_triangle();
+                t!=VBW::END_OF_LIST; t=C.next_triangle(t)
+            ) {
+                for(index_t lv=0; lv<3; ++lv) {
+                    // Make sure there is no vertex at infinity
+                    geo_debug_assert(
+                        C.triangle_v_local_index(t,VBW::index_t(lv)) != 0
+                    );
+                }
+            }
+#endif
+            C.compute_geometry();
+            sumV += C.volume();
+        }
+
+        double expectedV = period_.x*period_.y*period_.z;
+
+        Logger::out("Periodic") << "Sum volumes = " << sumV << std::endl;
+        Logger::out("Periodic") << "  (expected " <<  expectedV << ")"
+                                << std::endl;
+
+        if(::fabs(sumV - expectedV) / expectedV >= 1.0 / 10000.0) {
+            Logger::err("Periodic") << "FATAL, volume error is too large"
+                                    << std::endl;
+            exit(-1);
+        }
+
+    }
+
+    void PeriodicDelaunay3d::save_cells(
+        const std::string& basename, bool clipped
+    ) {
+        static int index = 1;
+
+        std::string index_string = String::to_string(index);
+        while(index_string.length() < 3) {
+            index_string = "0" + index_string;
+        }
+
+        std::ofstream out((basename+index_string+".obj").c_str());
+        index_t v_off = 1;
+
+        ConvexCell C;
+        C.use_exact_predicates(convex_cell_exact_predicates_);
+        IncidentTetrahedra W;
+        for(index_t vv=0; vv<nb_vertices_non_periodic_; ++vv) {
+            copy_Laguerre_cell_from_Delaunay(vv, C, W);
+            if(clipped) {
+                C.clip_by_plane(vec4( 1.0, 0.0, 0.0,  0.0));
+                C.clip_by_plane(vec4(-1.0, 0.0, 0.0,  period_.x));
+                C.clip_by_plane(vec4( 0.0, 1.0, 0.0,  0.0));
+                C.clip_by_plane(vec4( 0.0,-1.0, 0.0,  period_.y));
+                C.clip_by_plane(vec4( 0.0, 0.0, 1.0,  0.0));
+                C.clip_by_plane(vec4( 0.0, 0.0,-1.0,  period_.z));
+            }
+            v_off += C.save(out, v_off, 0.1);
+        }
+        ++index;
+    }
+
+    void PeriodicDelaunay3d::check_max_t() {
+	index_t max_t = 0;
+	for(index_t i=0; i<nb_threads(); ++i) {
+	    max_t = std::max(max_t, thread(i)->max_t());
+	}
+	for(index_t i=0; i<nb_threads(); ++i) {
+	    geo_assert(thread(i)->max_t() == max_t);
+	}
+    }
+
+
+
+    PeriodicDelaunay3d::Stats::Stats() {
+	reset();
+    }
+
+    void PeriodicDelaunay3d::Stats::reset() {
+	Memory::clear(this, sizeof(Stats));
+	raw_ = CmdLine::get_arg_bool("dbg:raw_logs");
+    }
+
+    std::string PeriodicDelaunay3d::Stats::to_string_raw() const {
+	return String::format(
+	    "%.1f %.1f %.1f %.1f %d %d %d %.1f %d %.1f %.1f %.1f %d"
+	    " %.1f %.1f %d %d",
+	    total_t_,
+
+	    phase_0_t_,
+
+	    phase_I_t_, phase_I_classify_t_,
+
+	    int(phase_I_nb_inside_), int(phase_I_nb_cross_),
+	    int(phase_I_nb_outside_),
+
+	    phase_I_insert_t_, int(phase_I_insert_nb_),
+
+	    phase_II_t_, phase_II_classify_t_, phase_II_insert_t_,
+	    int(phase_II_insert_nb_),
+
+	    warm_start_t_, warm_start_check_t_,
+	    int(warm_start_insert_nb_), int(warm_start_repair_nb_)
+	);
+    }
+
+
+    std::string PeriodicDelaunay3d::Stats::to_string_pretty() const {
+	return String::format(
+	    "total   | t:%.1f\n"
+	    "phase0  | t:%.1f\n"
+	    "phaseI  | t:%.1f t_cls:%.1f t_ins:%.1f nb_ins:%d\n"
+	    "        |   in:%d bndry:%d out:%d\n"
+	    "phaseII | t:%.1f t_cls:%.1f t_ins:%.1f nb_ins:%d\n"
+	    "warm    | t:%.1f t_chk:%.1f nb_ins:%d nb_fix:%d",
+	    total_t_,
+
+	    phase_0_t_,
+
+	    phase_I_t_, phase_I_classify_t_,
+	    phase_I_insert_t_, int(phase_I_insert_nb_),
+
+	    int(phase_I_nb_inside_), int(phase_I_nb_cross_),
+	    int(phase_I_nb_outside_),
+
+	    phase_II_t_, phase_II_classify_t_,
+	    phase_II_insert_t_, int(phase_II_insert_nb_),
+
+	    warm_start_t_, warm_start_check_t_,
+	    int(warm_start_insert_nb_), int(warm_start_repair_nb_)
+	);
+    }
+}
+
+/******* extracted from ../basic/common.cpp *******/
+
+
+
+#include <sstream>
+#include <iomanip>
+#include <optional>
+
+#ifdef GEO_OS_EMSCRIPTEN
+#include <emscripten.h>
+#endif
+
+namespace GEO {
+
+    namespace {
+
+        struct GeogramLibSingleton {
+
+            static std::optional<GeogramLibSingleton>& instance(int flags) {
+                static std::optional<GeogramLibSingleton> instance(flags);
+                return instance;
+            }
+
+            GeogramLibSingleton(int flags) {
+
+                // When locale is set to non-us countries,
+                // this may cause some problems when reading
+                // floating-point numbers (some locale expect
+                // a decimal ',' instead of a '.').
+                // This restores the default behavior for
+                // reading floating-point numbers.
+#ifdef GEO_OS_UNIX
+                if (flags & GEOGRAM_INSTALL_LOCALE) {
+                    setenv("LC_NUMERIC","POSIX",1);
+                }
+#endif
+
+#ifndef GEOGRAM_PSM
+                Environment* env = Environment::instance();
+                env->set_value("version", VORPALINE_VERSION);
+                env->set_value("release_date", VORPALINE_BUILD_DATE);
+                env->set_value("SVN revision", VORPALINE_SVN_REVISION);
+#endif
+                const bool minimal = (flags & GEOGRAM_INSTALL_MINIMAL) != 0;
+                if (!minimal) {
+                    FileSystem::initialize();
+                }
+                Logger::initialize();
+                Process::initialize(flags);
+                if (!minimal) {
+                    Progress::initialize();
+                }
+                CmdLine::initialize();
+                if (!minimal) {
+                    Stopwatch::initialize();
+                }
+                PCK::initialize();
+                Delaunay::initialize();
+
+#ifndef GEOGRAM_PSM
+                if (flags & GEOGRAM_INSTALL_BIBLIO) {
+                    Biblio::initialize();
+                }
+#endif
+
+#ifndef GEOGRAM_PSM
+                mesh_io_initialize();
+#endif
+
+                // Clear lastest system error
+                if (flags & GEOGRAM_INSTALL_ERRNO) {
+                    errno = 0;
+                }
+
+#ifndef GEOGRAM_PSM
+                // Register attribute types that can be saved into files.
+                geo_register_attribute_type<Numeric::uint8>("bool");
+                geo_register_attribute_type<char>("char");
+                geo_register_attribute_type<int>("int");
+                geo_register_attribute_type<unsigned int>("unsigned int");
+                geo_register_attribute_type<index_t>("index_t");
+                geo_register_attribute_type<signed_index_t>("signed_index_t");
+                geo_register_attribute_type<float>("float");
+                geo_register_attribute_type<double>("double");
+
+                geo_register_attribute_type<vec2>("vec2");
+                geo_register_attribute_type<vec3>("vec3");
+#endif
+
+#ifdef GEO_OS_EMSCRIPTEN
+
+                // This mounts the local file system when an emscripten-compiled
+                // program runs in node.js.
+                // Current working directory is mounted in /working,
+                // and root directory is mounted in /root
+
+                if (!minimal) {
+                    EM_ASM(
+                        if(typeof module !== 'undefined' && this.module !== module) {
+                            FS.mkdir('/working');
+                            FS.mkdir('/root');
+                            FS.mount(NODEFS, { root: '.' }, '/working');
+                            FS.mount(NODEFS, { root: '/' }, '/root');
+                        }
+                    );
+                }
+#endif
+
+#ifndef GEOGRAM_PSM
+                ImageLibrary::initialize() ;
+
+                geo_declare_image_serializer<ImageSerializerSTBReadWrite>("png");
+                geo_declare_image_serializer<ImageSerializerSTBReadWrite>("jpg");
+                geo_declare_image_serializer<ImageSerializerSTBReadWrite>("jpeg");
+                geo_declare_image_serializer<ImageSerializerSTBReadWrite>("tga");
+                geo_declare_image_serializer<ImageSerializerSTBReadWrite>("bmp");
+
+                geo_declare_image_serializer<ImageSerializer_xpm>("xpm") ;
+                geo_declare_image_serializer<ImageSerializer_pgm>("pgm") ;
+#endif
+            }
+
+            ~GeogramLibSingleton() {
+
+                if(
+                    CmdLine::arg_is_declared("sys:stats") &&
+                    CmdLine::get_arg_bool("sys:stats")
+                ) {
+                    Logger::div("System Statistics");
+                    PCK::show_stats();
+                    Process::show_stats();
+                }
+
+                PCK::terminate();
+
+#ifndef GEOGRAM_PSM
+                ImageLibrary::terminate() ;
+                Biblio::terminate();
+#endif
+
+                Progress::terminate();
+                Process::terminate();
+                CmdLine::terminate();
+                Logger::terminate();
+                FileSystem::terminate();
+                Environment::terminate();
+
+            }
+        };
+
+    }
+
+    void initialize(int flags) {
+        GeogramLibSingleton::instance(flags);
+    }
+
+    void terminate() {
+        GeogramLibSingleton::instance(GEOGRAM_INSTALL_NONE).reset();
+    }
+}
@@ -0,0 +1,3031 @@
+#ifndef GEOGRAM_PSM_PRIVATE
+#define GEOGRAM_PSM_PRIVATE
+
+// Internal Geogram headers shared by the Delaunay_psm*.cpp translation units.
+
+#include "Delaunay_psm.h"
+
+/*
+ *  Copyright (c) 2000-2022 Inria
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     https://www.inria.fr/fr/bruno-levy
+ *
+ *     Inria,
+ *     Domaine de Voluceau,
+ *     78150 Le Chesnay - Rocquencourt
+ *     FRANCE
+ *
+ */
+
+
+/*
+ *  This file is a PSM (pluggable software module)
+ *   generated from the distribution of Geogram.
+ *
+ *  See Geogram documentation on:
+ *   http://alice.loria.fr/software/geogram/doc/html/index.html
+ *
+ *  See documentation of the functions bundled in this PSM on:
+ *   http://alice.loria.fr/software/geogram/doc/html/classGEO_1_1Delaunay.html
+ */
+
+
+
+/******* extracted from ../basic/memory.h *******/
+
+#ifndef GEOGRAM_BASIC_MEMORY
+#define GEOGRAM_BASIC_MEMORY
+
+#include <vector>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef GEO_OS_WINDOWS
+
+#include <windows.h>
+#ifdef min
+#undef min
+#endif
+#ifdef max
+#undef max
+#endif
+
+#else
+
+#include <unistd.h>
+
+#endif
+
+// Stack size depending on OS:
+// Linux: 10 Mb
+// Windows: 1 Mb
+// Mac OSX: 512 Kb
+// GEO_HAS_BIG_STACK is defined under Linux
+// and lets some of the functions that
+// manipulate exact precision numbers
+// allocate temporaries on the stack.
+
+#ifdef GEO_OS_LINUX
+#define GEO_HAS_BIG_STACK
+#endif
+
+
+namespace GEO {
+
+    namespace Memory {
+        
+        typedef unsigned char byte;
+
+        
+        typedef unsigned char word8;
+
+        
+        typedef unsigned short word16;
+
+        
+        typedef unsigned int word32;
+
+        
+        typedef byte* pointer;
+
+        
+        typedef void (*function_pointer)();
+
+        inline void clear(void* addr, size_t size) {
+            ::memset(addr, 0, size);
+        }
+
+        inline void copy(void* to, const void* from, size_t size) {
+            ::memcpy(to, from, size);
+        }
+
+        inline pointer function_pointer_to_generic_pointer(
+            function_pointer fptr
+        ) {
+            // I know this is ugly, but I did not find a simpler warning-free
+            // way that is portable between all compilers.
+            pointer result = nullptr;
+            ::memcpy(&result, &fptr, sizeof(pointer));
+            return result;
+        }
+
+        inline function_pointer generic_pointer_to_function_pointer(
+            pointer ptr
+        ) {
+            // I know this is ugly, but I did not find a simpler warning-free
+            // way that is portable between all compilers.
+            function_pointer result = nullptr;
+            ::memcpy(&result, &ptr, sizeof(pointer));
+            return result;
+        }
+
+        inline function_pointer generic_pointer_to_function_pointer(void* ptr) {
+            // I know this is ugly, but I did not find a simpler warning-free
+            // way that is portable between all compilers.
+            function_pointer result = nullptr;
+            ::memcpy(&result, &ptr, sizeof(pointer));
+            return result;
+        }
+
+#define GEO_MEMORY_ALIGNMENT 64
+
+        template <int DIM>
+        struct PointAlignment {
+            static const size_t value = 1;
+        };
+
+        template <>
+        struct PointAlignment<2> {
+            static const size_t value = 16;
+        };
+
+        template <>
+        struct PointAlignment<3> {
+            static const size_t value = 8;
+        };
+
+        template <>
+        struct PointAlignment<4> {
+            static const size_t value = 32;
+        };
+
+        template <>
+        struct PointAlignment<6> {
+            static const size_t value = 16;
+        };
+
+        template <>
+        struct PointAlignment<8> {
+            static const size_t value = 64;
+        };
+
+#define geo_dim_alignment(dim) GEO::Memory::PointAlignment<dim>::value
+
+        inline void* aligned_malloc(
+            size_t size, size_t alignment = GEO_MEMORY_ALIGNMENT
+        ) {
+#if   defined(GEO_OS_ANDROID)
+            // Alignment not supported under Android.
+            geo_argused(alignment);
+            return malloc(size);
+#elif defined(GEO_COMPILER_INTEL)
+            return _mm_malloc(size, alignment);
+#elif defined(GEO_COMPILER_GCC) || defined(GEO_COMPILER_CLANG)
+            void* result;
+            return posix_memalign(&result, alignment, size) == 0
+                ? result : nullptr;
+#elif defined(GEO_COMPILER_MSVC)
+            return _aligned_malloc(size, alignment);
+#else
+            geo_argused(alignment);
+            return malloc(size);
+#endif
+        }
+
+        inline void aligned_free(void* p) {
+#if   defined(GEO_OS_ANDROID)
+            // Alignment not supported under Android.
+            free(p);
+#elif defined(GEO_COMPILER_INTEL)
+            _mm_free(p);
+#elif defined(GEO_COMPILER_GCC_FAMILY)
+            free(p);
+#elif defined(GEO_COMPILER_MSVC)
+            _aligned_free(p);
+#else
+            free(p);
+#endif
+        }
+
+#if   defined(GEO_OS_ANDROID)
+#define geo_decl_aligned(var) var
+#elif defined(GEO_COMPILER_INTEL)
+#define geo_decl_aligned(var) __declspec(aligned(GEO_MEMORY_ALIGNMENT)) var
+#elif defined(GEO_COMPILER_GCC_FAMILY)
+#define geo_decl_aligned(var) var __attribute__((aligned(GEO_MEMORY_ALIGNMENT)))
+#elif defined(GEO_COMPILER_MSVC)
+#define geo_decl_aligned(var) __declspec(align(GEO_MEMORY_ALIGNMENT)) var
+#elif defined(GEO_COMPILER_EMSCRIPTEN)
+#define geo_decl_aligned(var) var
+#endif
+
+#if   defined(GEO_OS_ANDROID)
+#define geo_assume_aligned(var, alignment)
+#elif defined(GEO_COMPILER_INTEL)
+#define geo_assume_aligned(var, alignment)      \
+        __assume_aligned(var, alignment)
+#elif defined(GEO_COMPILER_CLANG)
+#define geo_assume_aligned(var, alignment)
+        // GCC __builtin_assume_aligned is not yet supported by clang-3.3
+#elif defined(GEO_COMPILER_GCC)
+#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 7
+#define geo_assume_aligned(var, alignment)                              \
+        *(void**) (&var) = __builtin_assume_aligned(var, alignment)
+        // the GCC way of specifying that a pointer is aligned returns
+        // the aligned pointer (I can't figure out why). It needs to be
+        // affected otherwise it is not taken into account (verified by
+        // looking at the output of gcc -S)
+#else
+#define geo_assume_aligned(var, alignment)
+#endif
+#elif defined(GEO_COMPILER_MSVC)
+#define geo_assume_aligned(var, alignment)
+        // TODO: I do not know how to do that with MSVC
+#elif defined(GEO_COMPILER_EMSCRIPTEN)
+#define geo_assume_aligned(var, alignment)
+#elif defined(GEO_COMPILER_MINGW)
+#define geo_assume_aligned(var, alignment)
+#endif
+
+#if   defined(GEO_COMPILER_INTEL)
+#define geo_restrict __restrict
+#elif defined(GEO_COMPILER_GCC_FAMILY)
+#define geo_restrict __restrict__
+#elif defined(GEO_COMPILER_MSVC)
+#define geo_restrict __restrict
+#elif defined(GEO_COMPILER_EMSCRIPTEN)
+#define geo_restrict
+#endif
+
+        inline bool is_aligned(
+            void* p, size_t alignment = GEO_MEMORY_ALIGNMENT
+        ) {
+            return (reinterpret_cast<size_t>(p) & (alignment - 1)) == 0;
+        }
+
+        inline void* align(void* p) {
+            size_t offset = (
+                GEO_MEMORY_ALIGNMENT -
+                (reinterpret_cast<size_t>(p) & (GEO_MEMORY_ALIGNMENT - 1))
+            ) & (GEO_MEMORY_ALIGNMENT - 1);
+            return reinterpret_cast<char*>(p) + offset;
+        }
+
+#define geo_aligned_alloca(size)                                        \
+        GEO::Memory::align(alloca(size + GEO_MEMORY_ALIGNMENT - 1))
+
+        template <class T, int ALIGN = GEO_MEMORY_ALIGNMENT>
+        class aligned_allocator {
+        public:
+            
+            typedef T value_type;
+
+            
+            typedef T* pointer;
+
+            
+            typedef T& reference;
+
+            
+            typedef const T* const_pointer;
+
+            
+            typedef const T& const_reference;
+
+            
+            typedef ::std::size_t size_type;
+
+            
+            typedef ::std::ptrdiff_t difference_type;
+
+	    
+	    static constexpr int ALIGNMENT = ALIGN;
+
+            template <class U>
+            struct rebind {
+                
+                typedef aligned_allocator<U> other;
+            };
+
+            pointer address(reference x) {
+                return &x;
+            }
+
+            const_pointer address(const_reference x) {
+                return &x;
+            }
+
+            pointer allocate(
+                size_type nb_elt, const void* hint = nullptr
+            ) {
+		nb_elt = std::max(nb_elt,size_type(1));
+                geo_argused(hint);
+		while(true) {
+		    pointer result = static_cast<pointer>(
+			aligned_malloc(sizeof(T) * nb_elt, ALIGNMENT)
+		    );
+		    if(result != nullptr) {
+			return result;
+		    }
+		    // under Linux, a process requesting more mem than available
+		    // is killed (and there is nothing we can capture). Under
+		    // other OSes, the standard mechanism to let the runtime
+		    // know is as follows:
+		    // see: https://stackoverflow.com/questions/7194127/
+		    // how-should-i-write-iso-c-standard-conformant-custom-
+		    // new-and-delete-operators
+		    // (if there is a handler, call it repeatedly until
+		    // allocation succeeds, else throw a bad_alloc exception)
+		    std::new_handler handler = std::get_new_handler();
+		    if(handler != nullptr) {
+			(*handler)();
+		    } else {
+			throw std::bad_alloc();
+		    }
+		}
+            }
+
+            void deallocate(pointer p, size_type nb_elt) {
+                geo_argused(nb_elt);
+                aligned_free(p);
+            }
+
+            size_type max_size() const {
+                ::std::allocator<char> a;
+                return std::allocator_traits<decltype(a)>::max_size(a) /
+		    sizeof(T);
+            }
+
+            void construct(pointer p, const_reference val) {
+                new (static_cast<void*>(p))value_type(val);
+            }
+
+            void destroy(pointer p) {
+                p->~value_type();
+#ifdef GEO_COMPILER_MSVC
+                (void) p; // to avoid a "unreferenced variable" warning
+#endif
+            }
+
+            template <class T2, int A2> operator aligned_allocator<T2, A2>() {
+                return aligned_allocator<T2,A2>();
+            }
+        };
+
+        template <typename T1, int A1, typename T2, int A2>
+        inline bool operator== (
+            const aligned_allocator<T1, A1>&, const aligned_allocator<T2, A2>&
+        ) {
+            return true;
+        }
+
+        template <typename T1, int A1, typename T2, int A2>
+        inline bool operator!= (
+            const aligned_allocator<T1, A1>&, const aligned_allocator<T2, A2>&
+        ) {
+            return false;
+        }
+    }
+
+    
+
+    template <class T>
+    class vector : public ::std::vector<T, Memory::aligned_allocator<T> > {
+	typedef Memory::aligned_allocator<T> allocator;
+
+        typedef ::std::vector<T, Memory::aligned_allocator<T> > baseclass;
+
+
+
+    public:
+        vector() :
+            baseclass() {
+        }
+
+        explicit vector(index_t size) :
+            baseclass(size) {
+        }
+
+        explicit vector(index_t size, const T& val) :
+            baseclass(size, val) {
+        }
+
+        index_t size() const {
+            //   casts baseclass::size() from size_t (64 bits)
+            //   to index_t (32 bits), because all
+            //   indices in Vorpaline are supposed to fit in 32 bits (index_t).
+            // TODO: geo_debug_assert(baseclass::size() < max index_t)
+            return index_t(baseclass::size());
+        }
+
+        T& operator[] (index_t i) {
+            geo_debug_assert(i < size());
+            return baseclass::operator[] (i);
+        }
+
+        const T& operator[] (index_t i) const {
+            geo_debug_assert(i < size());
+            return baseclass::operator[] (i);
+        }
+
+        T& operator[] (signed_index_t i) {
+            geo_debug_assert(i >= 0 && index_t(i) < size());
+            return baseclass::operator[] (index_t(i));
+        }
+
+        const T& operator[] (signed_index_t i) const {
+            geo_debug_assert(i >= 0 && index_t(i) < size());
+            return baseclass::operator[] (index_t(i));
+        }
+
+
+#ifdef GARGANTUA // If compiled with 64 bits index_t
+
+        T& operator[] (int i) {
+            geo_debug_assert(i >= 0 && index_t(i) < size());
+            return baseclass::operator[] (index_t(i));
+        }
+
+        const T& operator[] (int i) const {
+            geo_debug_assert(i >= 0 && index_t(i) < size());
+            return baseclass::operator[] (index_t(i));
+        }
+
+        T& operator[] (unsigned int i) {
+            geo_debug_assert(index_t(i) < size());
+            return baseclass::operator[] (index_t(i));
+        }
+
+        const T& operator[] (unsigned int i) const {
+            geo_debug_assert(index_t(i) < size());
+            return baseclass::operator[] (index_t(i));
+        }
+#endif
+
+        T* data() {
+            T* result = baseclass::data();
+	    // Tell the compiler that the pointer is aligned, to enable AVX
+	    // vectorization, can be useful when using vector<double>
+	    // with blas-like operations. I hope the hint will propagate to
+	    // the caller (not sure...)
+	    geo_assume_aligned(result, allocator::ALIGNMENT);
+	    return result;
+        }
+
+        const T* data() const {
+            const T* result = baseclass::data();
+	    // Tell the compiler that the pointer is aligned, to enable AVX
+	    // vectorization, can be useful when using vector<double>
+	    // with blas-like operations. I hope the hint will propagate to
+	    // the caller (not sure...)
+	    geo_assume_aligned(result, allocator::ALIGNMENT);
+	    return result;
+        }
+
+
+	void clear_and_deallocate() {
+	    vector<T> other;
+	    this->swap(other);
+	}
+    };
+
+    template <>
+    class vector<bool> : public ::std::vector<bool> {
+        typedef ::std::vector<bool> baseclass;
+
+    public:
+        
+        vector() :
+            baseclass() {
+        }
+
+        
+        explicit vector(index_t size) :
+            baseclass(size) {
+        }
+
+        
+        explicit vector(index_t size, bool val) :
+            baseclass(size, val) {
+        }
+
+        
+        index_t size() const {
+            //   casts baseclass::size() from size_t (64 bits)
+            //   to index_t (32 bits), because all
+            //   indices in Vorpaline are supposed to fit in 32 bits (index_t).
+            // TODO: geo_debug_assert(baseclass::size() < max index_t)
+            return index_t(baseclass::size());
+        }
+
+        // TODO: operator[] with bounds checking (more complicated
+        // than just returning bool&, check implementation in STL).
+    };
+}
+
+#endif
+
+/******* extracted from ../basic/matrix.h *******/
+
+#ifndef GEOGRAM_BASIC_MATRIX
+#define GEOGRAM_BASIC_MATRIX
+
+#include <initializer_list>
+
+
+namespace GEO {
+
+    
+
+
+    template <index_t DIM, class FT>
+    class Matrix {
+    public:
+        
+        typedef Matrix<DIM, FT> matrix_type;
+
+        
+        typedef FT value_type;
+
+        
+        static constexpr index_t dim = DIM;
+
+        inline Matrix() {
+            load_identity();
+        }
+
+        explicit Matrix(const FT* vals) {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    coeff_[i][j] = *vals;
+                    ++vals;
+                }
+            }
+        }
+
+        Matrix(const std::initializer_list< std::initializer_list<FT> >& Mi) {
+            index_t i = 0;
+            for(auto& it: Mi) {
+                index_t j = 0;
+                for(auto& jt: it) {
+                    geo_debug_assert(i < DIM);
+                    geo_debug_assert(j < DIM);
+                    coeff_[i][j] = jt;
+                    ++j;
+                }
+                ++i;
+            }
+        }
+
+
+        inline index_t dimension() const {
+            return DIM;
+        }
+
+        inline void load_zero() {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    coeff_[i][j] = FT(0);
+                }
+            }
+        }
+
+        inline void load_identity() {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    coeff_[i][j] = (i == j) ? FT(1) : FT(0);
+                }
+            }
+        }
+
+        inline bool is_identity() const {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    FT rhs = ((i == j) ? FT(1) : FT(0));
+                    if(coeff_[i][j] != rhs) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        inline FT& operator() (index_t i, index_t j) {
+            geo_debug_assert(i < DIM);
+            geo_debug_assert(j < DIM);
+            return coeff_[i][j];
+        }
+
+        inline const FT& operator() (index_t i, index_t j) const {
+            geo_debug_assert(i < DIM);
+            geo_debug_assert(j < DIM);
+            return coeff_[i][j];
+        }
+
+        inline matrix_type& operator+= (const matrix_type& m) {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    coeff_[i][j] += m.coeff_[i][j];
+                }
+            }
+            return *this;
+        }
+
+        inline matrix_type& operator-= (const matrix_type& m) {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    coeff_[i][j] -= m.coeff_[i][j];
+                }
+            }
+            return *this;
+        }
+
+        inline matrix_type& operator*= (FT val) {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    coeff_[i][j] *= val;
+                }
+            }
+            return *this;
+        }
+
+        inline matrix_type& operator/= (FT val) {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    coeff_[i][j] /= val;
+                }
+            }
+            return *this;
+        }
+
+        inline matrix_type operator+ (const matrix_type& m) const {
+            matrix_type result = *this;
+            result += m;
+            return result;
+        }
+
+        inline matrix_type operator- (const matrix_type& m) const {
+            matrix_type result = *this;
+            result -= m;
+            return result;
+        }
+
+        inline matrix_type operator* (FT val) const {
+            matrix_type result = *this;
+            result *= val;
+            return result;
+        }
+
+        inline matrix_type operator/ (FT val) const {
+            matrix_type result = *this;
+            result /= val;
+            return result;
+        }
+
+        matrix_type operator* (const matrix_type& m) const {
+            matrix_type result;
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    result.coeff_[i][j] = FT(0);
+                    for(index_t k = 0; k < DIM; k++) {
+                        result.coeff_[i][j] += coeff_[i][k] * m.coeff_[k][j];
+                    }
+                }
+            }
+            return result;
+        }
+
+        matrix_type inverse() const {
+            matrix_type result;
+            bool invertible = compute_inverse(result);
+            geo_assert(invertible);
+            return result;
+        }
+
+
+        bool compute_inverse(matrix_type& result) const {
+            FT val=FT(0.0), val2=FT(0.0);
+            matrix_type tmp = (*this);
+
+            result.load_identity();
+
+            for(index_t i = 0; i != DIM; i++) {
+                val = tmp(i, i);                     /* find pivot */
+                index_t ind = i;
+                for(index_t j = i + 1; j != DIM; j++) {
+                    if(fabs(tmp(j, i)) > fabs(val)) {
+                        ind = j;
+                        val = tmp(j, i);
+                    }
+                }
+
+                if(ind != i) {
+                    for(index_t j = 0; j != DIM; j++) {
+                        val2 = result(i, j);
+                        result(i, j) = result(ind, j);
+                        result(ind, j) = val2;           /* swap columns */
+                        val2 = tmp(i, j);
+                        tmp(i, j) = tmp(ind, j);
+                        tmp(ind, j) = val2;
+                    }
+                }
+
+                if(val == 0.0) {
+                    return false;
+                }
+
+                for(index_t j = 0; j != DIM; j++) {
+                    tmp(i, j) /= val;
+                    result(i, j) /= val;
+                }
+
+                for(index_t j = 0; j != DIM; j++) {
+                    if(j == i) {
+                        continue;                       /* eliminate column */
+                    }
+                    val = tmp(j, i);
+                    for(index_t k = 0; k != DIM; k++) {
+                        tmp(j, k) -= tmp(i, k) * val;
+                        result(j, k) -= result(i, k) * val;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        matrix_type transpose() const {
+            matrix_type result;
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j < DIM; j++) {
+                    result(i, j) = (* this)(j, i);
+                }
+            }
+            return result;
+        }
+
+        
+
+        inline const FT* data() const {
+            return &(coeff_[0][0]);
+        }
+
+        
+
+        inline FT* data() {
+            return &(coeff_[0][0]);
+        }
+
+        void get_lower_triangle(FT* store) const {
+            for(index_t i = 0; i < DIM; i++) {
+                for(index_t j = 0; j <= i; j++) {
+                    *store++ = coeff_[i][j];
+                }
+            }
+        }
+
+    private:
+        FT coeff_[DIM][DIM];
+    };
+
+    
+
+    template <index_t DIM, class FT>
+    inline std::ostream& operator<< (
+        std::ostream& output, const Matrix<DIM, FT>& m
+    ) {
+        const char* sep = "";
+        for(index_t i = 0; i < DIM; i++) {
+            for(index_t j = 0; j < DIM; j++) {
+                output << sep << m(i, j);
+                sep = " ";
+            }
+        }
+        return output;
+    }
+
+    template <index_t DIM, class FT>
+    inline std::istream& operator>> (
+        std::istream& input, Matrix<DIM, FT>& m
+    ) {
+        for(index_t i = 0; i < DIM; i++) {
+            for(index_t j = 0; j < DIM; j++) {
+                input >> m(i, j);
+            }
+        }
+        return input;
+    }
+
+    
+
+    template <index_t DIM, class FT> inline
+    void mult(const Matrix<DIM, FT>& M, const FT* x, FT* y) {
+        for(index_t i = 0; i < DIM; i++) {
+            y[i] = 0;
+            for(index_t j = 0; j < DIM; j++) {
+                y[i] += M(i, j) * x[j];
+            }
+        }
+    }
+
+    
+
+    template <index_t DIM, class FT> inline
+    vecng<DIM,FT> operator*(
+        const Matrix<DIM, FT>& M, const vecng<DIM,FT>& x
+    ) {
+        vecng<DIM,FT> y;
+        for(index_t i = 0; i < DIM; i++) {
+            y[i] = 0;
+            for(index_t j = 0; j < DIM; j++) {
+                y[i] += M(i, j) * x[j];
+            }
+        }
+        return y;
+    }
+
+    template <index_t DIM, class FT> inline
+    vecng<DIM,FT> mult(
+        const Matrix<DIM, FT>& M, const vecng<DIM,FT>& x
+    ) {
+        vecng<DIM,FT> y;
+        for(index_t i = 0; i < DIM; i++) {
+            y[i] = 0;
+            for(index_t j = 0; j < DIM; j++) {
+                y[i] += M(i, j) * x[j];
+            }
+        }
+        return y;
+    }
+
+    
+
+}
+
+#endif
+
+/******* extracted from ../basic/geometry_nd.h *******/
+
+#ifndef GEOGRAM_BASIC_GEOMETRY_ND
+#define GEOGRAM_BASIC_GEOMETRY_ND
+
+
+
+namespace GEO {
+
+    namespace Geom {
+
+        template <class COORD_T>
+        inline double distance2(
+            const COORD_T* p1, const COORD_T* p2, coord_index_t dim
+        ) {
+            double result = 0.0;
+            for(coord_index_t i = 0; i < dim; i++) {
+                result += GEO::geo_sqr(double(p2[i]) - double(p1[i]));
+            }
+            return result;
+        }
+
+        template <class COORD_T>
+        inline double distance(
+            const COORD_T* p1, const COORD_T* p2, coord_index_t dim
+        ) {
+            return ::sqrt(distance2(p1, p2, dim));
+        }
+
+        template <class VEC>
+        inline double distance2(
+            const VEC& p1, const VEC& p2
+        ) {
+            geo_debug_assert(p1.dimension() == p2.dimension());
+            return distance2(
+                p1.data(), p2.data(), coord_index_t(p1.dimension())
+            );
+        }
+
+        template <class VEC>
+        inline double distance(
+            const VEC& p1, const VEC& p2
+        ) {
+            geo_debug_assert(p1.dimension() == p2.dimension());
+            return distance(p1.data(), p2.data(), coord_index_t(p1.dimension()));
+        }
+
+        template <class COORD_T>
+        inline double triangle_area(
+            const COORD_T* p1,
+            const COORD_T* p2,
+            const COORD_T* p3,
+            coord_index_t dim
+        ) {
+            double a = distance(p1, p2, dim);
+            double b = distance(p2, p3, dim);
+            double c = distance(p3, p1, dim);
+            double s = double(0.5) * (a + b + c);
+            double A2 = s * (s - a) * (s - b) * (s - c);
+            // the max is there to avoid some numerical problems.
+            return ::sqrt(std::max(A2, 0.0));
+        }
+
+        template <class COORD_T>
+        inline void triangle_centroid(
+            const COORD_T* p,
+            const COORD_T* q,
+            const COORD_T* r,
+            COORD_T a, COORD_T b, COORD_T c,
+            double* Vg,
+            double& V,
+            coord_index_t dim
+        ) {
+            double abc = a + b + c;
+            double area = Geom::triangle_area(p, q, r, dim);
+            V = area / 3.0 * abc;
+            double wp = a + abc;
+            double wq = b + abc;
+            double wr = c + abc;
+            double s = area / 12.0;
+            for(coord_index_t i = 0; i < dim; i++) {
+                Vg[i] = s * (wp * p[i] + wq * q[i] + wr * r[i]);
+            }
+        }
+
+        
+
+        template <class VEC>
+        inline double triangle_area(
+            const VEC& p1, const VEC& p2, const VEC& p3
+        ) {
+            // Heron formula
+            double a = distance(p1, p2);
+            double b = distance(p2, p3);
+            double c = distance(p3, p1);
+            double s = double(0.5) * (a + b + c);
+            return ::sqrt(s * (s - a) * (s - b) * (s - c));
+        }
+
+        template <class VEC>
+        inline double triangle_mass(
+            const VEC& p, const VEC& q, const VEC& r,
+            double a, double b, double c
+        ) {
+            // TODO: try to better understand the formula and
+            // determine why there are these sqrt's
+            // (probably due to the relation between the
+            //  user-provided density and the one achieved
+            //  by CVT), but I'm pretty sure that the formula
+            //  is correct (at least, dimensions match).
+            // Note: the ::fabs() are there to avoid numerical
+            // errors.
+            return Geom::triangle_area(p, q, r) / 3.0 * (
+                ::sqrt(::fabs(a)) + sqrt(::fabs(b)) + sqrt(::fabs(c))
+            );
+        }
+
+        template <class POINT>
+        POINT triangle_circumcenter(
+            const POINT& Q1,
+            const POINT& Q2,
+            const POINT& Q3,
+            double* denom = nullptr
+        ) {
+            const POINT q2 = Q2 - Q1;
+            const POINT q3 = Q3 - Q1;
+
+            double l2 = length2(q2);
+            double l3 = length2(q3);
+
+            double a12 = -2.0 * dot(q2, q2);
+            double a13 = -2.0 * dot(q3, q2);
+            double a22 = -2.0 * dot(q2, q3);
+            double a23 = -2.0 * dot(q3, q3);
+
+            double c31 = (a23 * a12 - a22 * a13);
+            double d = c31;
+            double s = 1.0 / d;
+            double lambda1 = s * ((a23 - a22) * l2 + (a12 - a13) * l3 + c31);
+            double lambda2 = s * ((-a23) * l2 + (a13) * l3);
+            double lambda3 = s * ((a22) * l2 + (-a12) * l3);
+            if(denom != nullptr) {
+                *denom = d;
+            }
+            return lambda1 * Q1 + lambda2 * Q2 + lambda3 * Q3;
+        }
+
+        template <class VEC>
+        inline void triangle_centroid(
+            const VEC& p, const VEC& q, const VEC& r,
+            double a, double b, double c,
+            VEC& Vg, double& V
+        ) {
+            double abc = a + b + c;
+            double area = Geom::triangle_area(p, q, r);
+            V = area / 3.0 * abc;
+            double wp = a + abc;
+            double wq = b + abc;
+            double wr = c + abc;
+            double s = area / 12.0;
+            Vg = s * (wp * p + wq * q + wr * r);
+        }
+
+        template <class VEC>
+        inline VEC random_point_in_triangle(
+            const VEC& p1, const VEC& p2, const VEC& p3
+        ) {
+            double l1 = Numeric::random_float64();
+            double l2 = Numeric::random_float64();
+            if(l1 + l2 > 1.0) {
+                l1 = 1.0 - l1;
+                l2 = 1.0 - l2;
+            }
+            double l3 = 1.0 - l1 - l2;
+            return l1 * p1 + l2 * p2 + l3 * p3;
+        }
+
+        template <class VEC>
+        inline VEC random_point_in_tetra(
+            const VEC& p1, const VEC& p2, const VEC& p3, const VEC& p4
+        ) {
+            double s = Numeric::random_float64();
+            double t = Numeric::random_float64();
+            double u = Numeric::random_float64();
+            if(s + t > 1.0) {
+                s = 1.0 - s;
+                t = 1.0 - t;
+            }
+            if(t + u > 1.0) {
+                double tmp = u;
+                u = 1.0 - s - t;
+                t = 1.0 - tmp;
+            } else if(s + t + u > 1.0) {
+                double tmp = u;
+                u = s + t + u - 1.0;
+                s = 1.0 - t - tmp;
+            }
+            double a = 1.0 - s - t - u;
+            return a * p1 + s * p2 + t * p3 + u * p4;
+        }
+
+        template <class VEC>
+        inline double point_segment_squared_distance(
+            const VEC& point,
+            const VEC& V0,
+            const VEC& V1,
+            VEC& closest_point,
+            double& lambda0,
+            double& lambda1
+        ) {
+            double l2 = distance2(V0,V1);
+            double t = dot(point - V0, V1 - V0);
+            if(t <= 0.0 || l2 == 0.0) {
+                closest_point = V0;
+                lambda0 = 1.0;
+                lambda1 = 0.0;
+                return distance2(point, V0);
+            } else if(t > l2) {
+                closest_point = V1;
+                lambda0 = 0.0;
+                lambda1 = 1.0;
+                return distance2(point, V1);
+            }
+            lambda1 = t / l2;
+            lambda0 = 1.0-lambda1;
+            closest_point = lambda0 * V0 + lambda1 * V1;
+            return distance2(point, closest_point);
+        }
+
+
+        template <class VEC>
+        inline double point_segment_squared_distance(
+            const VEC& point,
+            const VEC& V0,
+            const VEC& V1
+        ) {
+            VEC closest_point;
+            double lambda0;
+            double lambda1;
+            return point_segment_squared_distance(
+                point, V0, V1, closest_point, lambda0, lambda1
+            );
+        }
+
+        template <class VEC>
+        inline double point_triangle_squared_distance(
+            const VEC& point,
+            const VEC& V0,
+            const VEC& V1,
+            const VEC& V2,
+            VEC& closest_point,
+            double& lambda0, double& lambda1, double& lambda2
+        ) {
+            VEC diff = V0 - point;
+            VEC edge0 = V1 - V0;
+            VEC edge1 = V2 - V0;
+            double a00 = length2(edge0);
+            double a01 = dot(edge0, edge1);
+            double a11 = length2(edge1);
+            double b0 = dot(diff, edge0);
+            double b1 = dot(diff, edge1);
+            double c = length2(diff);
+            double det = ::fabs(a00 * a11 - a01 * a01);
+            double s = a01 * b1 - a11 * b0;
+            double t = a01 * b0 - a00 * b1;
+            double sqrDistance;
+
+            // If the triangle is degenerate
+            if(det < 1e-30) {
+                double cur_l1, cur_l2;
+                VEC cur_closest;
+                double result;
+                double cur_dist = point_segment_squared_distance(
+		    point, V0, V1, cur_closest, cur_l1, cur_l2
+		);
+                result = cur_dist;
+                closest_point = cur_closest;
+                lambda0 = cur_l1;
+                lambda1 = cur_l2;
+                lambda2 = 0.0;
+                cur_dist = point_segment_squared_distance(
+		    point, V0, V2, cur_closest, cur_l1, cur_l2
+		);
+                if(cur_dist < result) {
+                    result = cur_dist;
+                    closest_point = cur_closest;
+                    lambda0 = cur_l1;
+                    lambda2 = cur_l2;
+                    lambda1 = 0.0;
+                }
+                cur_dist = point_segment_squared_distance(
+		    point, V1, V2, cur_closest, cur_l1, cur_l2
+		);
+                if(cur_dist < result) {
+                    result = cur_dist;
+                    closest_point = cur_closest;
+                    lambda1 = cur_l1;
+                    lambda2 = cur_l2;
+                    lambda0 = 0.0;
+                }
+                return result;
+            }
+
+            if(s + t <= det) {
+                if(s < 0.0) {
+                    if(t < 0.0) {   // region 4
+                        if(b0 < 0.0) {
+                            t = 0.0;
+                            if(-b0 >= a00) {
+                                s = 1.0;
+                                sqrDistance = a00 + 2.0 * b0 + c;
+                            } else {
+                                s = -b0 / a00;
+                                sqrDistance = b0 * s + c;
+                            }
+                        } else {
+                            s = 0.0;
+                            if(b1 >= 0.0) {
+                                t = 0.0;
+                                sqrDistance = c;
+                            } else if(-b1 >= a11) {
+                                t = 1.0;
+                                sqrDistance = a11 + 2.0 * b1 + c;
+                            } else {
+                                t = -b1 / a11;
+                                sqrDistance = b1 * t + c;
+                            }
+                        }
+                    } else {  // region 3
+                        s = 0.0;
+                        if(b1 >= 0.0) {
+                            t = 0.0;
+                            sqrDistance = c;
+                        } else if(-b1 >= a11) {
+                            t = 1.0;
+                            sqrDistance = a11 + 2.0 * b1 + c;
+                        } else {
+                            t = -b1 / a11;
+                            sqrDistance = b1 * t + c;
+                        }
+                    }
+                } else if(t < 0.0) {  // region 5
+                    t = 0.0;
+                    if(b0 >= 0.0) {
+                        s = 0.0;
+                        sqrDistance = c;
+                    } else if(-b0 >= a00) {
+                        s = 1.0;
+                        sqrDistance = a00 + 2.0 * b0 + c;
+                    } else {
+                        s = -b0 / a00;
+                        sqrDistance = b0 * s + c;
+                    }
+                } else {  // region 0
+                    // minimum at interior point
+                    double invDet = double(1.0) / det;
+                    s *= invDet;
+                    t *= invDet;
+                    sqrDistance = s * (a00 * s + a01 * t + 2.0 * b0) +
+                        t * (a01 * s + a11 * t + 2.0 * b1) + c;
+                }
+            } else {
+                double tmp0, tmp1, numer, denom;
+
+                if(s < 0.0) {   // region 2
+                    tmp0 = a01 + b0;
+                    tmp1 = a11 + b1;
+                    if(tmp1 > tmp0) {
+                        numer = tmp1 - tmp0;
+                        denom = a00 - 2.0 * a01 + a11;
+                        if(numer >= denom) {
+                            s = 1.0;
+                            t = 0.0;
+                            sqrDistance = a00 + 2.0 * b0 + c;
+                        } else {
+                            s = numer / denom;
+                            t = 1.0 - s;
+                            sqrDistance = s * (a00 * s + a01 * t + 2.0 * b0) +
+                                t * (a01 * s + a11 * t + 2.0 * b1) + c;
+                        }
+                    } else {
+                        s = 0.0;
+                        if(tmp1 <= 0.0) {
+                            t = 1.0;
+                            sqrDistance = a11 + 2.0 * b1 + c;
+                        }
+                        else if(b1 >= 0.0) {
+                            t = 0.0;
+                            sqrDistance = c;
+                        } else {
+                            t = -b1 / a11;
+                            sqrDistance = b1 * t + c;
+                        }
+                    }
+                } else if(t < 0.0) {  // region 6
+                    tmp0 = a01 + b1;
+                    tmp1 = a00 + b0;
+                    if(tmp1 > tmp0) {
+                        numer = tmp1 - tmp0;
+                        denom = a00 - 2.0 * a01 + a11;
+                        if(numer >= denom) {
+                            t = 1.0;
+                            s = 0.0;
+                            sqrDistance = a11 + 2.0 * b1 + c;
+                        } else {
+                            t = numer / denom;
+                            s = 1.0 - t;
+                            sqrDistance = s * (a00 * s + a01 * t + 2.0 * b0) +
+                                t * (a01 * s + a11 * t + 2.0 * b1) + c;
+                        }
+                    } else {
+                        t = 0.0;
+                        if(tmp1 <= 0.0) {
+                            s = 1.0;
+                            sqrDistance = a00 + 2.0 * b0 + c;
+                        } else if(b0 >= 0.0) {
+                            s = 0.0;
+                            sqrDistance = c;
+                        } else {
+                            s = -b0 / a00;
+                            sqrDistance = b0 * s + c;
+                        }
+                    }
+                } else { // region 1
+                    numer = a11 + b1 - a01 - b0;
+                    if(numer <= 0.0) {
+                        s = 0.0;
+                        t = 1.0;
+                        sqrDistance = a11 + 2.0 * b1 + c;
+                    } else {
+                        denom = a00 - 2.0 * a01 + a11;
+                        if(numer >= denom) {
+                            s = 1.0;
+                            t = 0.0;
+                            sqrDistance = a00 + 2.0 * b0 + c;
+                        } else {
+                            s = numer / denom;
+                            t = 1.0 - s;
+                            sqrDistance = s * (a00 * s + a01 * t + 2.0 * b0) +
+                                t * (a01 * s + a11 * t + 2.0 * b1) + c;
+                        }
+                    }
+                }
+            }
+
+            // Account for numerical round-off error.
+            if(sqrDistance < 0.0) {
+                sqrDistance = 0.0;
+            }
+
+            closest_point = V0 + s * edge0 + t * edge1;
+            lambda0 = 1.0 - s - t;
+            lambda1 = s;
+            lambda2 = t;
+            return sqrDistance;
+        }
+
+
+        template <class VEC>
+        inline double point_triangle_squared_distance(
+            const VEC& p, const VEC& q1, const VEC& q2, const VEC& q3
+        ) {
+            VEC closest_point;
+            double lambda1, lambda2, lambda3;
+            return point_triangle_squared_distance(
+                p, q1, q2, q3, closest_point, lambda1, lambda2, lambda3
+            );
+        }
+
+        inline double tetra_volume_from_edge_lengths(
+            double u, double U,
+            double v, double V,
+            double w, double W
+        ) {
+            double X = (w - U + v) * (U + v + w);
+            double x = (U - v + w) * (v - w + U);
+            double Y = (u - V + w) * (V + w + u);
+            double y = (V - w + u) * (w - u + V);
+            double Z = (v - W + u) * (W + u + v);
+            double z = (W - u + v) * (u - v + W);
+            double a = ::sqrt(::fabs(x * Y * Z));
+            double b = ::sqrt(::fabs(y * Z * X));
+            double c = ::sqrt(::fabs(z * X * Y));
+            double d = ::sqrt(::fabs(x * y * z));
+            return ::sqrt(::fabs(
+                              (-a + b + c + d) *
+                              (a - b + c + d) *
+                              (a + b - c + d) *
+                              (a + b + c - d)
+                          )) / (192.0 * u * v * w);
+        }
+
+        template <class VEC>
+        inline double tetra_volume(
+            const VEC& p1, const VEC& p2, const VEC& p3, const VEC& p4
+        ) {
+            double U = distance(p1, p2);
+            double u = distance(p3, p4);
+            double V = distance(p2, p3);
+            double v = distance(p1, p4);
+            double W = distance(p3, p1);
+            double w = distance(p2, p4);
+            return tetra_volume_from_edge_lengths(u, U, v, V, w, W);
+        }
+
+        template <int DIM>
+        inline double tetra_volume(
+            const double* p1, const double* p2,
+            const double* p3, const double* p4
+        ) {
+            double U = distance(p1, p2, DIM);
+            double u = distance(p3, p4, DIM);
+            double V = distance(p2, p3, DIM);
+            double v = distance(p1, p4, DIM);
+            double W = distance(p3, p1, DIM);
+            double w = distance(p2, p4, DIM);
+            return tetra_volume_from_edge_lengths(u, U, v, V, w, W);
+        }
+
+        template <>
+        inline double tetra_volume<3>(
+            const double* p1, const double* p2,
+            const double* p3, const double* p4
+        ) {
+            return tetra_volume(
+                *reinterpret_cast<const vec3*>(p1),
+                *reinterpret_cast<const vec3*>(p2),
+                *reinterpret_cast<const vec3*>(p3),
+                *reinterpret_cast<const vec3*>(p4)
+            );
+        }
+    }
+}
+
+#endif
+
+/******* extracted from ../basic/algorithm.h *******/
+
+#ifndef GEOGRAM_BASIC_ALGORITHM
+#define GEOGRAM_BASIC_ALGORITHM
+
+
+#if defined(GEO_OS_LINUX) && defined(GEO_OPENMP)
+#if (__GNUC__ >= 4) && (__GNUC_MINOR__ >= 4) && !defined(GEO_OS_ANDROID)
+#include <parallel/algorithm>
+#define GEO_USE_GCC_PARALLEL_STL
+#endif
+#elif defined(GEO_OS_WINDOWS)
+#if (_MSC_VER >= 1700)
+#include <ppl.h>
+#define GEO_USE_MSVC_PARALLEL_STL
+#endif
+#endif
+
+#include <algorithm>
+#include <random>
+
+
+namespace GEO {
+
+    bool GEOGRAM_API uses_parallel_algorithm();
+
+    template <typename ITERATOR>
+    inline void sort(
+        const ITERATOR& begin, const ITERATOR& end
+    ) {
+        if(uses_parallel_algorithm()) {
+#if defined(GEO_USE_GCC_PARALLEL_STL)
+            __gnu_parallel::sort(begin, end);
+#elif defined(GEO_USE_MSVC_PARALLEL_STL)
+            concurrency::parallel_sort(begin, end);
+#else
+            std::sort(begin, end);
+#endif
+        } else {
+            std::sort(begin, end);
+        }
+    }
+
+    template <typename ITERATOR, typename CMP>
+    inline void sort(
+        const ITERATOR& begin, const ITERATOR& end, const CMP& cmp
+    ) {
+        if(uses_parallel_algorithm()) {
+#if defined(GEO_USE_GCC_PARALLEL_STL)
+            __gnu_parallel::sort(begin, end, cmp);
+#elif defined(GEO_USE_MSVC_PARALLEL_STL)
+            concurrency::parallel_sort(begin, end, cmp);
+#else
+            std::sort(begin, end, cmp);
+#endif
+        } else {
+            std::sort(begin, end, cmp);
+        }
+    }
+
+
+    template <typename VECTOR> inline void sort_unique(VECTOR& v) {
+        std::sort(v.begin(), v.end());
+        // Note that std::unique leaves a 'queue' of duplicated elements
+        // at the end of the vector, and returns an iterator that
+        // indicates where to stop.
+        v.erase(
+            std::unique(v.begin(), v.end()), v.end()
+        );
+    }
+
+    template <typename ITERATOR> inline void sort_3(ITERATOR items) {
+        if (items[0]> items[1]) {
+            std::swap(items[0], items[1]);
+        }
+        if (items[1]> items[2]) {
+            std::swap(items[1], items[2]);
+        }
+        if (items[0]> items[1]) {
+            std::swap(items[0], items[1]);
+        }
+    }
+
+    template <typename ITERATOR> inline void sort_4(ITERATOR items) {
+        if (items[1] < items[0]) {
+            std::swap(items[0], items[1]);
+        }
+        if (items[3] < items[2]) {
+            std::swap(items[2], items[3]);
+        }
+        if (items[2] < items[0]) {
+            std::swap(items[0], items[2]);
+            std::swap(items[1], items[3]);
+        }
+        if (items[2] < items[1]) {
+            std::swap(items[1], items[2]);
+        }
+        if (items[3] < items[2]) {
+            std::swap(items[2], items[3]);
+        }
+    }
+
+    template <typename ITERATOR>
+    inline void random_shuffle(
+        const ITERATOR& begin, const ITERATOR& end
+    ) {
+	std::random_device rng;
+	std::mt19937 urng(rng());
+	std::shuffle(begin, end, urng);
+    }
+
+}
+
+#endif
+
+/******* extracted from ../basic/file_system.h *******/
+
+#ifndef GEOGRAM_BASIC_FILE_SYSTEM
+#define GEOGRAM_BASIC_FILE_SYSTEM
+
+
+#include <string>
+#include <vector>
+#include <map>
+
+
+namespace GEO {
+
+    namespace FileSystem {
+
+        class GEOGRAM_API Node : public Counted {
+        public:
+            Node();
+
+            ~Node() override;
+
+            
+
+            virtual bool is_file(const std::string& path);
+
+            virtual bool is_directory(const std::string& path);
+
+            virtual bool create_directory(const std::string& path);
+
+            virtual bool delete_directory(const std::string& path);
+
+            virtual bool delete_file(const std::string& path);
+
+            virtual bool get_directory_entries(
+                const std::string& path, std::vector<std::string>& result
+            );
+
+            virtual std::string get_current_working_directory();
+
+            virtual bool set_current_working_directory(
+                const std::string& path
+            );
+
+            virtual bool rename_file(
+                const std::string& old_name, const std::string& new_name
+            );
+
+            virtual Numeric::uint64 get_time_stamp(const std::string& path);
+
+            virtual bool set_executable_flag(const std::string& filename);
+
+
+            virtual bool touch(const std::string& filename);
+
+            virtual std::string normalized_path(const std::string& path);
+
+
+            virtual std::string home_directory();
+
+            virtual std::string documents_directory();
+
+
+            virtual std::string load_file_as_string(const std::string& path);
+
+            
+
+            virtual std::string extension(const std::string& path);
+
+            virtual std::string base_name(
+                const std::string& path, bool remove_extension = true
+            );
+
+            virtual std::string dir_name(const std::string& path);
+
+            virtual void get_directory_entries(
+                const std::string& path,
+                std::vector<std::string>& result, bool recursive
+            );
+
+            virtual void get_files(
+                const std::string& path,
+                std::vector<std::string>& result, bool recursive = false
+            );
+
+            virtual void get_subdirectories(
+                const std::string& path,
+                std::vector<std::string>& result, bool recursive = false
+            );
+
+            virtual void flip_slashes(std::string& path);
+
+            virtual bool copy_file(
+                const std::string& from, const std::string& to
+            );
+        };
+
+        class GEOGRAM_API MemoryNode : public Node {
+        public:
+
+            MemoryNode(const std::string& path="/") : path_(path) {
+            }
+
+            
+            bool copy_file(
+                const std::string& from, const std::string& to
+            ) override ;
+
+            
+            std::string load_file_as_string(const std::string& path) override;
+
+            
+            virtual bool is_file(const std::string& path) override;
+
+            
+            virtual bool is_directory(const std::string& path) override;
+
+            
+            virtual bool create_directory(const std::string& path) override;
+
+            
+            virtual bool delete_directory(const std::string& path) override;
+
+            
+            virtual bool delete_file(const std::string& path) override;
+
+            
+            bool get_directory_entries(
+                const std::string& path, std::vector<std::string>& result
+            ) override;
+
+
+            
+            bool rename_file(
+                const std::string& old_name, const std::string& new_name
+            ) override;
+
+            const char* get_file_contents(const std::string& path);
+
+            bool create_file(const std::string& path, const char* content);
+
+        protected:
+            static void split_path(
+                const std::string& path, std::string& leadingsubdir,
+                std::string& rest
+            );
+
+        private:
+            std::string path_;
+            std::map<std::string, SmartPointer<MemoryNode> > subnodes_;
+            std::map<std::string, const char*> files_;
+        };
+
+        typedef SmartPointer<Node> Node_var;
+
+        
+
+        void GEOGRAM_API initialize();
+
+        void GEOGRAM_API terminate();
+
+        
+        bool GEOGRAM_API is_file(const std::string& path);
+
+        
+        bool GEOGRAM_API is_directory(const std::string& path);
+
+        bool GEOGRAM_API can_read_directory(const std::string& path);
+
+        bool GEOGRAM_API can_write_directory(
+            const std::string& path, bool create_missing_directories = false
+        );
+
+        
+        bool GEOGRAM_API create_directory(const std::string& path);
+
+        
+        bool GEOGRAM_API delete_directory(const std::string& path);
+
+        
+        bool GEOGRAM_API delete_file(const std::string& path);
+
+        
+        bool GEOGRAM_API get_directory_entries(
+            const std::string& path, std::vector<std::string>& result
+        );
+
+        
+        std::string GEOGRAM_API get_current_working_directory();
+        bool GEOGRAM_API set_current_working_directory(
+            const std::string& path
+        );
+
+        
+        bool GEOGRAM_API rename_file(
+            const std::string& old_name, const std::string& new_name
+        );
+
+        
+        Numeric::uint64 GEOGRAM_API get_time_stamp(
+            const std::string& path
+        );
+
+        
+        std::string GEOGRAM_API extension(const std::string& path);
+
+        
+        std::string GEOGRAM_API base_name(
+            const std::string& path, bool remove_extension = true
+        );
+
+        
+        std::string GEOGRAM_API dir_name(const std::string& path);
+
+        
+        void GEOGRAM_API get_directory_entries(
+            const std::string& path,
+            std::vector<std::string>& result, bool recursive
+        );
+
+        
+        void GEOGRAM_API get_files(
+            const std::string& path,
+            std::vector<std::string>& result, bool recursive = false
+        );
+
+        
+        void GEOGRAM_API get_subdirectories(
+            const std::string& path,
+            std::vector<std::string>& result, bool recursive = false
+        );
+
+        
+        void GEOGRAM_API flip_slashes(std::string& path);
+
+        
+        bool GEOGRAM_API copy_file(
+            const std::string& from, const std::string& to
+        );
+
+        
+        bool GEOGRAM_API set_executable_flag(const std::string& filename);
+
+        
+        bool GEOGRAM_API touch(const std::string& filename);
+
+        
+        std::string GEOGRAM_API normalized_path(const std::string& path);
+
+        
+        std::string GEOGRAM_API absolute_path(const std::string& path);
+
+        
+        std::string GEOGRAM_API home_directory();
+
+        
+        std::string GEOGRAM_API documents_directory();
+
+        void GEOGRAM_API get_root(Node*& root);
+
+#ifdef GEO_OS_EMSCRIPTEN
+        void set_file_system_changed_callback(void(*callback)());
+#endif
+
+    }
+}
+
+#endif
+
+/******* extracted from ../basic/process_private.h *******/
+
+
+#ifndef GEOGRAM_BASIC_PROCESS_PRIVATE
+#define GEOGRAM_BASIC_PROCESS_PRIVATE
+
+
+
+namespace GEO {
+    namespace Process {
+        bool os_init_threads();
+
+        index_t os_number_of_cores();
+
+        size_t os_used_memory();
+
+        size_t os_max_used_memory();
+
+        bool os_enable_FPE(bool flag);
+
+        bool os_enable_cancel(bool flag);
+
+        void os_install_signal_handlers();
+
+        std::string os_executable_filename();
+
+        void os_brute_force_kill();
+
+        void os_print_stack_trace();
+    }
+}
+
+
+#endif
+
+/******* extracted from ../basic/boolean_expression.h *******/
+
+#ifndef GEOGRAM_BASIC_BOOLEAN_EXPRESSION
+#define GEOGRAM_BASIC_BOOLEAN_EXPRESSION
+
+#include <string>
+
+
+namespace GEO {
+
+    class GEOGRAM_API BooleanExpression {
+    public:
+
+    BooleanExpression(const std::string& expr);
+
+    bool operator()(index_t x);
+
+    protected:
+    bool parse_or();
+    bool parse_and();
+    bool parse_factor();
+    bool parse_variable();
+    char cur_char() const;
+    void next_char();
+
+    private:
+    std::string expr_;
+    std::string::iterator ptr_;
+    index_t x_;
+    };
+
+
+}
+
+#endif
+
+/******* extracted from ../mesh/mesh_reorder.h *******/
+
+#ifndef GEOGRAM_MESH_MESH_REORDER
+#define GEOGRAM_MESH_MESH_REORDER
+
+
+#ifndef GEOGRAM_PSM
+#endif
+
+
+namespace GEO {
+
+
+#ifndef GEOGRAM_PSM
+
+    enum MeshOrder {
+        MESH_ORDER_HILBERT,
+        MESH_ORDER_MORTON
+    };
+
+    void GEOGRAM_API mesh_reorder(
+        Mesh& M, MeshOrder order = MESH_ORDER_HILBERT
+    );
+
+    void GEOGRAM_API compute_mesh_elements_spatial_order(
+	const Mesh& M, MeshElementsFlags elements, vector<index_t>& permutation,
+	MeshOrder order = MESH_ORDER_HILBERT
+    );
+
+#endif
+
+    void GEOGRAM_API compute_Hilbert_order(
+        index_t total_nb_vertices, const double* vertices,
+        vector<index_t>& sorted_indices,
+        index_t first,
+        index_t last,
+        index_t dimension, index_t stride = 3
+    );
+
+    void GEOGRAM_API compute_Morton_order(
+        index_t total_nb_vertices, const double* vertices,
+        vector<index_t>& sorted_indices,
+        index_t first,
+        index_t last,
+        index_t dimension, index_t stride = 3
+    );
+
+    void GEOGRAM_API compute_BRIO_order(
+        index_t nb_vertices, const double* vertices,
+        vector<index_t>& sorted_indices,
+        index_t dimension,
+        index_t stride = 3,
+        index_t threshold = 64,
+        double ratio = 0.125,
+        vector<index_t>* levels = nullptr
+    );
+
+    void GEOGRAM_API Hilbert_sort_periodic(
+        index_t nb_vertices, const double* vertices,
+        vector<index_t>& sorted_indices,
+        index_t dimension,
+        index_t stride,
+        vector<index_t>::iterator first,
+        vector<index_t>::iterator last,
+        const vec3& period
+    );
+
+    inline void Hilbert_sort_periodic(
+        index_t nb_vertices, const double* vertices,
+        vector<index_t>& sorted_indices,
+        index_t dimension,
+        index_t stride,
+        vector<index_t>::iterator first,
+        vector<index_t>::iterator last,
+        double period = 1.0
+    ) {
+        Hilbert_sort_periodic(
+            nb_vertices, vertices,
+            sorted_indices,
+            dimension,
+            stride,
+            first,
+            last,
+            vec3(period, period, period)
+        );
+    }
+}
+
+#endif
+
+/******* extracted from cavity.h *******/
+
+
+#ifndef GEOGRAM_DELAUNAY_CAVITY
+#define GEOGRAM_DELAUNAY_CAVITY
+
+#include <string.h>
+
+// Uncomment to display histogram of
+// number of collisions per set() and
+// get() operations.
+// There is probably room for improvement
+// in my hash function, but for large
+// pointsets, more then 99% of queries are
+// in the first slot (seems to be good enough).
+//#define CAVITY_WITH_STATS
+#ifdef CAVITY_WITH_STATS
+#define CAVITY_STATS(x) x
+#else
+#define CAVITY_STATS(x)
+#endif
+
+namespace GEO {
+
+    class Cavity {
+
+    public:
+
+        typedef Numeric::uint8 local_index_t;
+
+        Cavity() {
+            clear();
+#ifdef CAVITY_WITH_STATS
+            Memory::clear(stats_set_, sizeof(stats_set_));
+            Memory::clear(stats_get_, sizeof(stats_get_));
+#endif
+        }
+
+        void clear() {
+            nb_f_ = 0;
+            OK_ = true;
+            ::memset(h2t_, END_OF_LIST, sizeof(h2t_));
+        }
+
+        ~Cavity() {
+#ifdef CAVITY_WITH_STATS
+            for(index_t i=0; i<MAX_H; ++i) {
+                std::cerr << i  << ": get=" << stats_get_[i]
+                          << "   set=" << stats_set_[i] << std::endl;
+            }
+#endif
+        }
+
+        bool OK() const {
+            return OK_;
+        }
+
+        void new_facet(
+            index_t tglobal, index_t boundary_f,
+            index_t v0, index_t v1, index_t v2
+        ) {
+            if(!OK_) {
+                return;
+            }
+
+            geo_debug_assert(v0 != v1);
+            geo_debug_assert(v1 != v2);
+            geo_debug_assert(v2 != v0);
+
+            local_index_t new_t = local_index_t(nb_f_);
+
+            if(nb_f_ == MAX_F) {
+                OK_ = false;
+                return;
+            }
+
+            set_vv2t(v0, v1, new_t);
+            set_vv2t(v1, v2, new_t);
+            set_vv2t(v2, v0, new_t);
+
+            if(!OK_) {
+                return;
+            }
+
+            ++nb_f_;
+            tglobal_[new_t] = tglobal;
+            boundary_f_[new_t] = boundary_f;
+            f2v_[new_t][0] = v0;
+            f2v_[new_t][1] = v1;
+            f2v_[new_t][2] = v2;
+        }
+
+        index_t nb_facets() const {
+            return nb_f_;
+        }
+
+        index_t facet_tet(index_t f) const {
+            geo_debug_assert(f < nb_facets());
+            return tglobal_[f];
+        }
+
+        void set_facet_tet(index_t f, index_t t) {
+            geo_debug_assert(f < nb_facets());
+            tglobal_[f] = t;
+        }
+
+        index_t facet_facet(index_t f) const {
+            geo_debug_assert(f < nb_facets());
+            return boundary_f_[f];
+        }
+
+        index_t facet_vertex(index_t f, index_t lv) const {
+            geo_debug_assert(f < nb_facets());
+            geo_debug_assert(lv < 3);
+            return f2v_[f][lv];
+        }
+
+        void get_facet_neighbor_tets(
+            index_t f, index_t& t0, index_t& t1, index_t& t2
+        ) const {
+            index_t v0 = f2v_[f][0];
+            index_t v1 = f2v_[f][1];
+            index_t v2 = f2v_[f][2];
+            t0 = tglobal_[get_vv2t(v2,v1)];
+            t1 = tglobal_[get_vv2t(v0,v2)];
+            t2 = tglobal_[get_vv2t(v1,v0)];
+        }
+
+    private:
+        static constexpr index_t        MAX_H = 1033;
+        static constexpr local_index_t  END_OF_LIST = 255;
+        static constexpr index_t        MAX_F = 128;
+
+        index_t hash(index_t v1, index_t v2) const {
+            return (
+		((index_t(v1+1) * 73856093) ^
+		 (index_t(v2+1) * 83492791)) % MAX_H
+	    );
+        }
+
+        void set_vv2t(
+            index_t v1, index_t v2, local_index_t f
+        ) {
+            CAVITY_STATS(index_t cnt = 0;)
+                index_t h = hash(v1,v2);
+            index_t cur = h;
+            do {
+                if(h2t_[cur] == END_OF_LIST) {
+                    h2t_[cur] = f;
+#ifdef GARGANTUA
+                    h2v_[cur][0] = v1;
+                    h2v_[cur][1] = v2;
+#else
+                    h2v_[cur] = (Numeric::uint64(v1+1) << 32) |
+                        Numeric::uint64(v2+1);
+#endif
+                    CAVITY_STATS(++stats_set_[cnt];)
+                        return;
+                }
+                cur = (cur+1)%MAX_H;
+                CAVITY_STATS(++cnt;)
+                    } while(cur != h);
+            OK_ = false;
+        }
+
+        local_index_t get_vv2t(index_t v1, index_t v2) const {
+#ifndef GARGANTUA
+            Numeric::uint64 K = (Numeric::uint64(v1+1) << 32) |
+                Numeric::uint64(v2+1);
+#endif
+            CAVITY_STATS(index_t cnt = 0;)
+                index_t h = hash(v1,v2);
+            index_t cur = h;
+            do {
+#ifdef GARGANTUA
+                if((h2v_[cur][0] == v1) && (h2v_[cur][1] == v2)) {
+#else
+                    if(h2v_[cur] == K) {
+#endif
+                        CAVITY_STATS(++stats_get_[cnt];)
+                            return h2t_[cur];
+                    }
+                    cur = (cur+1)%MAX_H;
+                    CAVITY_STATS(++cnt;)
+                        } while(cur != h);
+                geo_assert_not_reached;
+            }
+
+            
+            local_index_t  h2t_[MAX_H];
+
+            
+#ifdef GARGANTUA
+            index_t h2v_[MAX_H][2];
+#else
+            Numeric::uint64 h2v_[MAX_H];
+#endif
+
+            
+            index_t nb_f_;
+
+            
+            index_t tglobal_[MAX_F];
+
+            
+            index_t boundary_f_[MAX_F];
+
+            
+            index_t f2v_[MAX_F][3];
+
+
+            bool OK_;
+
+            CAVITY_STATS(mutable index_t stats_set_[MAX_H];)
+                CAVITY_STATS(mutable index_t stats_get_[MAX_H];)
+                };
+
+    }
+
+#endif
+
+/******* extracted from delaunay_3d.h *******/
+
+#ifndef GEOGRAM_DELAUNAY_DELAUNAY_3D
+#define GEOGRAM_DELAUNAY_DELAUNAY_3D
+
+
+#include <stack>
+
+
+namespace GEO {
+
+    class GEOGRAM_API Delaunay3d : public Delaunay {
+    public:
+        Delaunay3d(coord_index_t dimension = 3);
+
+        void set_vertices(index_t nb_vertices, const double* vertices) override;
+
+        index_t nearest_vertex(const double* p) const override;
+
+    protected:
+
+        static constexpr index_t NO_TETRAHEDRON = NO_INDEX;
+
+        bool create_first_tetrahedron(
+            index_t& iv0, index_t& iv1, index_t& iv2, index_t& iv3
+        );
+
+        index_t locate(
+            const double* p, index_t hint = NO_TETRAHEDRON,
+            bool thread_safe = false,
+            Sign* orient = nullptr
+        ) const;
+
+        index_t locate_inexact(
+            const double* p, index_t hint, index_t max_iter
+        ) const;
+
+        index_t insert(index_t v, index_t hint = NO_TETRAHEDRON);
+
+        index_t locate_hint(const double* p) const;
+
+        void find_conflict_zone(
+            index_t v,
+            index_t t, const Sign* orient,
+            index_t& t_bndry, index_t& f_bndry,
+            index_t& first, index_t& last
+        );
+
+        void find_conflict_zone_iterative(
+            const double* p, index_t t,
+            index_t& t_bndry, index_t& f_bndry,
+            index_t& first, index_t& last
+        );
+
+        index_t stellate_cavity(index_t v);
+
+
+        index_t stellate_conflict_zone_iterative(
+            index_t v,
+            index_t t_bndry, index_t f_bndry,
+            index_t prev_f=NO_INDEX
+        );
+
+        bool get_neighbor_along_conflict_zone_border(
+            index_t t1,
+            index_t t1fborder,
+            index_t t1ft2,
+            index_t& t2,
+            index_t& t2fborder,
+            index_t& t2ft1
+        ) const {
+
+            // Note: this function is a bit long for an inline function,
+            // but I observed a (modest) performance gain doing so.
+
+            //   Find two vertices that are both on facets new_f and f1
+            //  (the edge around which we are turning)
+            //  This uses duality as follows:
+            //  Primal form (not used here):
+            //    halfedge_facet_[v1][v2] returns a facet that is incident
+            //    to both v1 and v2.
+            //  Dual form (used here):
+            //    halfedge_facet_[f1][f2] returns a vertex that both
+            //    f1 and f2 are incident to.
+            index_t ev1 =
+                tet_vertex(t1, index_t(halfedge_facet_[t1ft2][t1fborder]));
+            index_t ev2 =
+                tet_vertex(t1, index_t(halfedge_facet_[t1fborder][t1ft2]));
+
+            //   Turn around edge [ev1,ev2] inside the conflict zone
+            // until we reach again the boundary of the conflict zone.
+            // Traversing inside the conflict zone is faster (as compared
+            // to outside) since it traverses a smaller number of tets.
+            index_t cur_t = t1;
+            index_t cur_f = t1ft2;
+            index_t next_t = tet_adjacent(cur_t,cur_f);
+            while(tet_is_in_list(next_t)) {
+                geo_debug_assert(next_t != t1);
+                cur_t = next_t;
+                cur_f = get_facet_by_halfedge(cur_t,ev1,ev2);
+                next_t = tet_adjacent(cur_t, cur_f);
+            }
+
+            //  At this point, cur_t is in conflict zone and
+            // next_t is outside the conflict zone.
+            index_t f12,f21;
+            get_facets_by_halfedge(next_t, ev1, ev2, f12, f21);
+            t2 = tet_adjacent(next_t,f21);
+            index_t v_neigh_opposite = tet_vertex(next_t,f12);
+            t2ft1 = find_tet_vertex(t2, v_neigh_opposite);
+            t2fborder = cur_f;
+
+            //  Test whether the found neighboring tet was created
+            //  (then return true) or is an old tet in conflict
+            //  (then return false).
+            return(t2 != cur_t);
+        }
+
+        
+
+        index_t max_t() const {
+            return cell_to_v_store_.size() / 4;
+        }
+
+        static constexpr index_t NOT_IN_LIST = ~index_t(0);
+
+        static constexpr index_t NOT_IN_LIST_BIT =
+	    index_t(1) << (sizeof(index_t)*8-1) ;
+
+        static constexpr index_t END_OF_LIST = ~NOT_IN_LIST_BIT;
+
+
+        bool tet_is_in_list(index_t t) const {
+            geo_debug_assert(t < max_t());
+            return (cell_next_[t] & NOT_IN_LIST_BIT) == 0;
+        }
+
+        index_t tet_next(index_t t) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(tet_is_in_list(t));
+            return cell_next_[t];
+        }
+
+        void add_tet_to_list(index_t t, index_t& first, index_t& last) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(!tet_is_in_list(t));
+            if(last == END_OF_LIST) {
+                geo_debug_assert(first == END_OF_LIST);
+                first = last = t;
+                cell_next_[t] = END_OF_LIST;
+            } else {
+                cell_next_[t] = first;
+                first = t;
+            }
+        }
+
+        void remove_tet_from_list(index_t t) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(tet_is_in_list(t));
+            cell_next_[t] = NOT_IN_LIST;
+        }
+
+        static constexpr index_t VERTEX_AT_INFINITY = NO_INDEX;
+
+        bool tet_is_finite(index_t t) const {
+            return
+                cell_to_v_store_[4 * t]     != NO_INDEX &&
+                cell_to_v_store_[4 * t + 1] != NO_INDEX &&
+                cell_to_v_store_[4 * t + 2] != NO_INDEX &&
+                cell_to_v_store_[4 * t + 3] != NO_INDEX;
+        }
+
+        bool tet_is_real(index_t t) const {
+            return !tet_is_free(t) && tet_is_finite(t);
+        }
+
+        bool tet_is_virtual(index_t t) const {
+            return
+                !tet_is_free(t) && (
+                    cell_to_v_store_[4 * t] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 1] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 2] == VERTEX_AT_INFINITY ||
+                    cell_to_v_store_[4 * t + 3] == VERTEX_AT_INFINITY) ;
+        }
+
+        bool tet_is_free(index_t t) const {
+            return tet_is_in_list(t);
+        }
+
+        index_t new_tetrahedron() {
+            index_t result;
+            if(first_free_ == END_OF_LIST) {
+                cell_to_v_store_.resize(
+		    cell_to_v_store_.size() + 4, NO_INDEX
+		);
+                cell_to_cell_store_.resize(
+		    cell_to_cell_store_.size() + 4, NO_INDEX
+		);
+                // index_t(NOT_IN_LIST) is necessary, else with
+                // NOT_IN_LIST alone the compiler tries to generate a
+                // reference to NOT_IN_LIST resulting in a link error.
+                cell_next_.push_back(index_t(NOT_IN_LIST));
+                result = max_t() - 1;
+            } else {
+                result = first_free_;
+                first_free_ = tet_next(first_free_);
+                remove_tet_from_list(result);
+            }
+
+            cell_to_cell_store_[4 * result] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 1] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 2] = NO_INDEX;
+            cell_to_cell_store_[4 * result + 3] = NO_INDEX;
+
+            return result;
+        }
+
+        index_t new_tetrahedron(
+            index_t v1, index_t v2,
+            index_t v3, index_t v4
+        ) {
+            index_t result = new_tetrahedron();
+            cell_to_v_store_[4 * result] = v1;
+            cell_to_v_store_[4 * result + 1] = v2;
+            cell_to_v_store_[4 * result + 2] = v3;
+            cell_to_v_store_[4 * result + 3] = v4;
+            return result;
+        }
+
+        void set_tet_mark_stamp(index_t stamp) {
+            cur_stamp_ = (stamp | NOT_IN_LIST_BIT);
+        }
+
+        bool tet_is_marked(index_t t) const {
+            return cell_next_[t] == cur_stamp_;
+        }
+
+        void mark_tet(index_t t) {
+            cell_next_[t] = cur_stamp_;
+        }
+
+        
+
+        static index_t tet_facet_vertex(index_t f, index_t v) {
+            geo_debug_assert(f < 4);
+            geo_debug_assert(v < 3);
+            return index_t(tet_facet_vertex_[f][v]);
+        }
+
+        index_t tet_vertex(index_t t, index_t lv) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            return cell_to_v_store_[4 * t + lv];
+        }
+
+        index_t find_tet_vertex(index_t t, index_t v) const {
+            geo_debug_assert(t < max_t());
+            //   Find local index of v in tetrahedron t vertices.
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+            return find_4(T,v);
+        }
+
+        index_t finite_tet_vertex(index_t t, index_t lv) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            geo_debug_assert(cell_to_v_store_[4 * t + lv] != NO_INDEX);
+            return cell_to_v_store_[4 * t + lv];
+        }
+
+        void set_tet_vertex(index_t t, index_t lv, index_t v) {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lv < 4);
+            cell_to_v_store_[4 * t + lv] = v;
+        }
+
+        index_t tet_adjacent(index_t t, index_t lf) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(lf < 4);
+            index_t result = cell_to_cell_store_[4 * t + lf];
+            return result;
+        }
+
+        void set_tet_adjacent(index_t t1, index_t lf1, index_t t2) {
+            geo_debug_assert(t1 < max_t());
+            geo_debug_assert(t2 < max_t());
+            geo_debug_assert(lf1 < 4);
+            cell_to_cell_store_[4 * t1 + lf1] = t2;
+        }
+
+        index_t find_tet_adjacent(index_t t1, index_t t2) const {
+            geo_debug_assert(t1 < max_t());
+            geo_debug_assert(t2 < max_t());
+            geo_debug_assert(t1 != t2);
+
+            // Find local index of t2 in tetrahedron t1 adajcent tets.
+            const index_t* T = &(cell_to_cell_store_[4 * t1]);
+            index_t result = find_4(T,t2);
+
+            // Sanity check: make sure that t1 is adjacent to t2
+            // only once!
+            geo_debug_assert(tet_adjacent(t1,(result+1)%4) != t2);
+            geo_debug_assert(tet_adjacent(t1,(result+2)%4) != t2);
+            geo_debug_assert(tet_adjacent(t1,(result+3)%4) != t2);
+            return result;
+        }
+
+        void set_tet(
+            index_t t,
+	    index_t v0, index_t v1, index_t v2, index_t v3,
+            index_t a0, index_t a1, index_t a2, index_t a3
+        ) {
+            geo_debug_assert(t < max_t());
+            cell_to_v_store_[4 * t] = v0;
+            cell_to_v_store_[4 * t + 1] = v1;
+            cell_to_v_store_[4 * t + 2] = v2;
+            cell_to_v_store_[4 * t + 3] = v3;
+            cell_to_cell_store_[4 * t] = a0;
+            cell_to_cell_store_[4 * t + 1] = a1;
+            cell_to_cell_store_[4 * t + 2] = a2;
+            cell_to_cell_store_[4 * t + 3] = a3;
+        }
+
+        
+
+        index_t get_facet_by_halfedge(index_t t, index_t v1, index_t v2) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(v1 != v2);
+            //   Find local index of v1 and v2 in tetrahedron t
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+            index_t lv1 = find_4(T,v1);
+            index_t lv2 = find_4(T,v2);
+            geo_debug_assert(lv1 != lv2);
+            return index_t(halfedge_facet_[lv1][lv2]);
+        }
+
+        void get_facets_by_halfedge(
+            index_t t, index_t v1, index_t v2,
+            index_t& f12, index_t& f21
+        ) const {
+            geo_debug_assert(t < max_t());
+            geo_debug_assert(v1 != v2);
+
+            //   Find local index of v1 and v2 in tetrahedron t
+            // The following expression is 10% faster than using
+            // if() statements (multiply by boolean result of test).
+            // Thank to Laurent Alonso for this idea.
+            const index_t* T = &(cell_to_v_store_[4 * t]);
+
+            index_t lv1 = index_t(
+                (T[1] == v1) | ((T[2] == v1) * 2) | ((T[3] == v1) * 3)
+	    );
+
+            index_t lv2 = index_t(
+                (T[1] == v2) | ((T[2] == v2) * 2) | ((T[3] == v2) * 3)
+	    );
+
+            geo_debug_assert(lv1 != 0 || T[0] == v1);
+            geo_debug_assert(lv2 != 0 || T[0] == v2);
+            geo_debug_assert(lv1 != lv2);
+
+            f12 = index_t(halfedge_facet_[lv1][lv2]);
+            f21 = index_t(halfedge_facet_[lv2][lv1]);
+        }
+
+
+        index_t next_around_halfedge(index_t& t, index_t v1, index_t v2) const {
+            return (index_t)tet_adjacent(
+                t, get_facet_by_halfedge(t, v1, v2)
+            );
+        }
+
+        
+
+        bool tet_is_conflict(index_t t, const double* p) const {
+
+            // Lookup tetrahedron vertices
+            const double* pv[4];
+            for(index_t i=0; i<4; ++i) {
+                index_t v = tet_vertex(t,i);
+                pv[i] = (v == NO_INDEX) ? nullptr : vertex_ptr(v);
+            }
+
+            // Check for virtual tetrahedra (then in_sphere()
+            // is replaced with orient3d())
+            for(index_t lf = 0; lf < 4; ++lf) {
+
+                if(pv[lf] == nullptr) {
+
+                    // Facet of a virtual tetrahedron opposite to
+                    // infinite vertex corresponds to
+                    // the triangle on the convex hull of the points.
+                    // Orientation is obtained by replacing vertex lf
+                    // with p.
+                    pv[lf] = p;
+                    Sign sign = PCK::orient_3d(pv[0],pv[1],pv[2],pv[3]);
+
+                    if(sign > 0) {
+                        return true;
+                    }
+
+                    if(sign < 0) {
+                        return false;
+                    }
+
+                    // If sign is zero, we check the real tetrahedron
+                    // adjacent to the facet on the convex hull.
+                    geo_debug_assert(tet_adjacent(t, lf) != NO_INDEX);
+                    index_t t2 = tet_adjacent(t, lf);
+                    geo_debug_assert(!tet_is_virtual(t2));
+
+                    //  If t2 is already chained in the conflict list,
+                    // then it is conflict
+                    if(tet_is_in_list(t2)) {
+                        return true;
+                    }
+
+                    //  If t2 is marked, then it is not in conflict.
+                    if(tet_is_marked(t2)) {
+                        return false;
+                    }
+
+                    return tet_is_conflict(t2, p);
+                }
+            }
+
+            //   If the tetrahedron is a finite one, it is in conflict
+            // if its circumscribed sphere contains the point (this is
+            // the standard case).
+
+            if(weighted_) {
+                double h0 = heights_[finite_tet_vertex(t, 0)];
+                double h1 = heights_[finite_tet_vertex(t, 1)];
+                double h2 = heights_[finite_tet_vertex(t, 2)];
+                double h3 = heights_[finite_tet_vertex(t, 3)];
+                index_t pindex = index_t(
+                    (p - vertex_ptr(0)) / int(vertex_stride_)
+                );
+                double h = heights_[pindex];
+                return (PCK::orient_3dlifted_SOS(
+                            pv[0],pv[1],pv[2],pv[3],p,h0,h1,h2,h3,h
+                        ) > 0) ;
+            }
+
+            return (PCK::in_sphere_3d_SOS(pv[0], pv[1], pv[2], pv[3], p) > 0);
+        }
+
+    protected:
+
+        static index_t find_4(const index_t* T, index_t v) {
+            // The following expression is 10% faster than using
+            // if() statements. This uses the C++ norm, that
+            // ensures that the 'true' boolean value converted to
+            // an int is always 1. With most compilers, this avoids
+            // generating branching instructions.
+            // Thank to Laurent Alonso for this idea.
+            // Note: Laurent also has this version:
+            //    (T[0] != v)+(T[2]==v)+2*(T[3]==v)
+            // that avoids a *3 multiply, but it is not faster in
+            // practice.
+            index_t result = index_t(
+                (T[1] == v) | ((T[2] == v) * 2) | ((T[3] == v) * 3)
+            );
+            // Sanity check, important if it was T[0], not explicitly
+            // tested (detects input that does not meet the precondition).
+            geo_debug_assert(T[result] == v);
+            return result;
+        }
+
+        ~Delaunay3d() override;
+
+        void show_tet(index_t t) const;
+
+        void show_tet_adjacent(index_t t, index_t lf) const;
+
+        void show_list(index_t first, const std::string& list_name) const;
+
+        void check_combinatorics(bool verbose = false) const;
+
+        void check_geometry(bool verbose = false) const;
+
+    private:
+        vector<index_t> cell_to_v_store_;
+        vector<index_t> cell_to_cell_store_;
+        vector<index_t> cell_next_;
+        vector<index_t> reorder_;
+        index_t cur_stamp_; // used for marking
+        index_t first_free_;
+        bool weighted_;
+        vector<double> heights_; // only used in weighted mode
+
+        bool debug_mode_;
+
+        bool verbose_debug_mode_;
+
+        bool benchmark_mode_;
+
+        static char tet_facet_vertex_[4][3];
+
+        static char halfedge_facet_[4][4];
+
+        std::stack<index_t> S_;
+
+        // Filled during insertion without reordering, then lazily from
+        // the final tets for nearest_vertex()
+        mutable LocateHintGrid hint_grid_;
+        mutable std::atomic<bool> hint_grid_is_valid_;
+
+        class StellateConflictStack {
+        public:
+
+            void push(index_t t1, index_t t1fbord, index_t t1fprev) {
+                store_.resize(store_.size()+1);
+                top().t1 = t1;
+                top().t1fbord = Numeric::uint8(t1fbord);
+                top().t1fprev = Numeric::uint8(t1fprev);
+            }
+
+            void save_locals(index_t new_t, index_t t1ft2, index_t t2ft1) {
+                geo_debug_assert(!empty());
+                top().new_t = new_t;
+                top().t1ft2 = Numeric::uint8(t1ft2);
+                top().t2ft1 = Numeric::uint8(t2ft1);
+            }
+
+            void get_parameters(
+                index_t& t1, index_t& t1fbord, index_t& t1fprev
+            ) const {
+                geo_debug_assert(!empty());
+                t1      = top().t1;
+                t1fbord = index_t(top().t1fbord);
+                t1fprev = index_t(top().t1fprev);
+            }
+
+
+            void get_locals(
+		index_t& new_t, index_t& t1ft2, index_t& t2ft1
+	    ) const {
+                geo_debug_assert(!empty());
+                new_t = top().new_t;
+                t1ft2 = index_t(top().t1ft2);
+                t2ft1 = index_t(top().t2ft1);
+            }
+
+            void pop() {
+                geo_debug_assert(!empty());
+                store_.pop_back();
+            }
+
+            bool empty() const {
+                return store_.empty();
+            }
+
+        private:
+
+            struct Frame {
+                // Parameters
+                index_t t1;
+                index_t new_t;
+                Numeric::uint8 t1fbord ;
+
+                // Local variables
+                Numeric::uint8 t1fprev ;
+                Numeric::uint8 t1ft2   ;
+                Numeric::uint8 t2ft1   ;
+            };
+
+            Frame& top() {
+                geo_debug_assert(!empty());
+                return *store_.rbegin();
+            }
+
+            const Frame& top() const {
+                geo_debug_assert(!empty());
+                return *store_.rbegin();
+            }
+
+            std::vector<Frame> store_;
+        };
+
+        StellateConflictStack S2_;
+
+        Cavity cavity_;
+    };
+
+    
+
+    class GEOGRAM_API RegularWeightedDelaunay3d : public Delaunay3d {
+    public:
+        RegularWeightedDelaunay3d(coord_index_t dimension = 4);
+
+    protected:
+        ~RegularWeightedDelaunay3d() override;
+    };
+}
+
+#endif
+
+/******* extracted from delaunay_sync.h *******/
+
+#ifndef DELAUNAY_SYNC_H
+#define DELAUNAY_SYNC_H
+
+#include <atomic>
+
+// In GARGANTUA mode (64-bit indices), we also enable
+// more than 127 concurrent threads (16-bits cell status,
+// that contain owner thread id).
+#ifdef GARGANTUA
+#define GEO_CONNECTION_MACHINE
+#endif
+
+
+namespace GEO {
+
+    class CellStatusArray {
+    public:
+#ifdef GEO_CONNECTION_MACHINE
+	// For machines that can run more than 127 concurrent threads
+        typedef uint16_t thread_index_t;
+        typedef uint16_t cell_status_t;
+        static constexpr cell_status_t FREE_CELL     = 32767;
+        static constexpr cell_status_t THREAD_MASK   = 32767;
+        static constexpr cell_status_t CONFLICT_MASK = 32768;
+#else
+        typedef uint8_t thread_index_t;
+        typedef uint8_t cell_status_t;
+        static constexpr cell_status_t FREE_CELL     = 127;
+        static constexpr cell_status_t THREAD_MASK   = 127;
+        static constexpr cell_status_t CONFLICT_MASK = 128;
+#endif
+
+	static constexpr index_t MAX_THREADS = index_t(THREAD_MASK)-1;
+
+        CellStatusArray() : cell_status_(nullptr), size_(0), capacity_(0) {
+        }
+
+        CellStatusArray(index_t size_in) :
+            cell_status_(nullptr), size_(0), capacity_(0) {
+            resize(size_in,size_in);
+        }
+
+        ~CellStatusArray() {
+            clear();
+        }
+
+        CellStatusArray(const CellStatusArray& rhs) = delete;
+
+        CellStatusArray& operator=(const CellStatusArray& rhs) = delete;
+
+        cell_status_t acquire_cell(index_t cell, cell_status_t status) {
+            geo_debug_assert(cell < size_);
+            cell_status_t expected = FREE_CELL;
+            // strong: acquire_cell is not used in a spinlock-like
+            // spinning loop (so we do not want to have "false negatives")
+            cell_status_[cell].compare_exchange_strong(
+                expected,status,
+                std::memory_order_acquire,std::memory_order_acquire
+            ); // this one could probably be relaxed ----^
+            // if compare_exchange was not sucessful, expected contains
+            // the current stored value.
+            return (expected & THREAD_MASK);
+        }
+
+        void release_cell(index_t cell) {
+            geo_debug_assert(cell < size_);
+            cell_status_[cell].store(FREE_CELL, std::memory_order_release);
+        }
+
+        cell_status_t cell_thread(index_t cell) const {
+            geo_debug_assert(cell < size_);
+            return (
+                cell_status_[cell].load(std::memory_order_relaxed) &
+                THREAD_MASK
+            );
+        }
+
+        bool cell_is_marked_as_conflict(index_t cell) const {
+            geo_debug_assert(cell < size_);
+            return(
+                (
+                    cell_status_[cell].load(std::memory_order_relaxed) &
+                    CONFLICT_MASK
+                ) != 0
+            );
+        }
+
+        void mark_cell_as_conflict(index_t cell) {
+	    // memory_order_relaxed because this function is always called from
+            // a thread that previously acquired the cell.
+	    cell_status_[cell].fetch_or(
+		CONFLICT_MASK, std::memory_order_relaxed
+	    );
+        }
+
+        void set_cell_status(index_t cell, cell_status_t status) {
+            geo_debug_assert(cell < size_);
+            cell_status_[cell].store(status, std::memory_order_relaxed);
+        }
+
+        void resize(index_t size_in, index_t capacity_in) {
+            geo_debug_assert(capacity_in >= size_in);
+            geo_debug_assert(!Process::is_running_threads());
+            if(capacity_in > capacity_) {
+                capacity_ = capacity_in;
+                std::atomic<cell_status_t>* old_cell_status = cell_status_;
+                cell_status_ = new std::atomic<cell_status_t>[capacity_];
+                for(index_t i=0; i<capacity_; ++i) {
+                    cell_status_t val = (i < size_) ?
+                        old_cell_status[i].load(std::memory_order_relaxed) :
+                        FREE_CELL;
+                    std::atomic_init(&cell_status_[i],val);
+                }
+                delete[] old_cell_status;
+            }
+            size_ = size_in;
+#ifdef __cpp_lib_atomic_is_always_lock_free
+            static_assert(std::atomic<cell_status_t>::is_always_lock_free);
+#else
+            geo_debug_assert(size_ == 0 || cell_status_[0].is_lock_free());
+#endif
+        }
+
+        void resize(index_t size_in) {
+            resize(size_in, size_in);
+        }
+
+        void reserve(index_t new_capacity) {
+            if(new_capacity > capacity_) {
+                resize(size_, new_capacity);
+            }
+        }
+
+        void grow() {
+            if(size_+1 >= capacity_) {
+                resize(size_+1, std::max(capacity_*2,size_+1));
+            } else {
+                resize(size_+1, capacity_);
+            }
+        }
+
+        index_t size() const {
+            return size_;
+        }
+
+        void clear() {
+            geo_debug_assert(!Process::is_running_threads());
+#ifdef GEO_DEBUG
+            for(index_t i=0; i<size_; ++i) {
+                geo_debug_assert(cell_thread(i) == FREE_CELL);
+            }
+#endif
+            delete[] cell_status_;
+	    cell_status_ = nullptr;
+            size_ = 0;
+            capacity_ = 0;
+        }
+
+    private:
+        std::atomic<cell_status_t>* cell_status_;
+        index_t size_;
+        index_t capacity_;
+    };
+}
+
+#endif
+
+/******* extracted from parallel_delaunay_3d.h *******/
+
+#ifndef GEOGRAM_PARALLEL_DELAUNAY_DELAUNAY_3D
+#define GEOGRAM_PARALLEL_DELAUNAY_DELAUNAY_3D
+
+#ifdef GEOGRAM_WITH_PDEL
+
+
+
+namespace GEO {
+
+    class GEOGRAM_API ParallelDelaunay3d : public Delaunay {
+    public:
+        ParallelDelaunay3d(coord_index_t dimension = 3);
+
+        void set_vertices(index_t nb_vertices, const double* vertices) override;
+
+        index_t nearest_vertex(const double* p) const override;
+
+        void set_BRIO_levels(const vector<index_t>& levels) override;
+
+    private:
+        vector<index_t> cell_to_v_store_;
+        vector<index_t> cell_to_cell_store_;
+        vector<index_t> cell_next_;
+        CellStatusArray cell_status_;
+        ThreadGroup threads_;
+        bool weighted_; // true for regular triangulation.
+        vector<double> heights_; // only used in weighted mode.
+        vector<index_t> reorder_;
+        vector<index_t> levels_;
+
+        bool debug_mode_;
+
+        bool verbose_debug_mode_;
+
+        bool benchmark_mode_;
+
+
+        friend class Delaunay3dThread;
+    };
+
+    class GEOGRAM_API ParallelDelaunay2d : public Delaunay {
+    public:
+        ParallelDelaunay2d(coord_index_t dimension = 2);
+
+        void set_vertices(index_t nb_vertices, const double* vertices) override;
+
+        index_t nearest_vertex(const double* p) const override;
+
+        void set_BRIO_levels(const vector<index_t>& levels) override;
+
+    private:
+        vector<index_t> cell_to_v_store_;
+        vector<index_t> cell_to_cell_store_;
+        vector<index_t> cell_next_;
+        CellStatusArray cell_status_;
+        ThreadGroup threads_;
+        bool weighted_; // true for regular triangulation.
+        vector<double> heights_; // only used in weighted mode.
+        vector<index_t> reorder_;
+        vector<index_t> levels_;
+
+        bool debug_mode_;
+
+        bool verbose_debug_mode_;
+
+        bool benchmark_mode_;
+
+
+        friend class Delaunay2dThread;
+    };
+
+
+}
+
+#endif
+
+#endif
+
+#endif
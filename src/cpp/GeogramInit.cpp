@@ -0,0 +1,31 @@
+#include "GeogramInit.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+std::atomic<double> g_init_seconds(0.0);
+
+} // namespace
+
+double initialize_geogram() {
+    // Function-local static: initialized exactly once, concurrent callers wait
+    static const double seconds = [] {
+        const auto start = std::chrono::steady_clock::now();
+        GEO::initialize(GEO::GEOGRAM_INSTALL_MINIMAL);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        g_init_seconds = elapsed.count();
+        std::cout << "Geogram initialized in " << elapsed.count() * 1000.0 << " ms." << std::endl;
+        return elapsed.count();
+    }();
+    return seconds;
+}
+
+double geogram_init_seconds() {
+    return g_init_seconds;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// Shared lazy Geogram initialization.
+//
+// Every entry point that needs Geogram (the embind wrappers, ParticleSystem)
+// calls initialize_geogram() before its first use of the library. The first
+// call runs GEO::initialize() with the minimal profile (GEOGRAM_INSTALL_MINIMAL:
+// logger, command line, thread manager, predicates and Delaunay factories);
+// later calls, from any thread, return immediately.
+
+// Initializes Geogram once, returns the time the initialization took in seconds.
+double initialize_geogram();
+
+// Time spent in the initialization in seconds, 0 before the first initialize_geogram().
+double geogram_init_seconds();
@@ -0,0 +1,296 @@
+#include "KnnVoronoi.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+// Uniform grid over [0,1)^3, points sorted by bin (counting sort)
+struct PointGrid {
+    int resolution = 1;
+    double binSize = 1.0;
+    std::vector<uint32_t> binStart; // resolution^3 + 1
+    std::vector<uint32_t> binPoints;
+
+    inline int binCoord(double x) const {
+        int b = static_cast<int>(x * resolution);
+        return b < 0 ? 0 : (b >= resolution ? resolution - 1 : b);
+    }
+
+    inline std::size_t binIndex(int bx, int by, int bz) const {
+        return (std::size_t(bx) * resolution + std::size_t(by)) * resolution + std::size_t(bz);
+    }
+
+    void build(const double* points, std::size_t n) {
+        // About two points per bin
+        resolution = std::max(1, static_cast<int>(std::cbrt(double(n) / 2.0)));
+        binSize = 1.0 / resolution;
+        const std::size_t nbBins = std::size_t(resolution) * resolution * resolution;
+        std::vector<uint32_t> pointBin(n);
+        binStart.assign(nbBins + 1, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t b = binIndex(binCoord(points[3 * i]), binCoord(points[3 * i + 1]), binCoord(points[3 * i + 2]));
+            pointBin[i] = uint32_t(b);
+            ++binStart[b + 1];
+        }
+        for (std::size_t b = 0; b < nbBins; ++b) binStart[b + 1] += binStart[b];
+        binPoints.resize(n);
+        std::vector<uint32_t> fill(binStart.begin(), binStart.end() - 1);
+        for (std::size_t i = 0; i < n; ++i) binPoints[fill[pointBin[i]]++] = uint32_t(i);
+    }
+};
+
+struct Candidate {
+    double dist2;
+    uint32_t index;
+    GEO::vec3 position; // ghost image position in periodic mode
+};
+
+struct SliceOutput {
+    GEO::index_t begin = 0;
+    std::vector<double> volumes;
+    std::vector<uint32_t> faceCounts;
+    std::vector<int32_t> faceNeighbors;
+    std::vector<double> faceAreas;
+};
+
+// See BoundedVoronoi.cpp: local vertices 1..6 are the walls of init_with_box()
+const VBW::index_t FIRST_CLIP_VERTEX = 7;
+
+// Number of clips between two refreshes of the cached cell vertices
+const int SECURITY_RADIUS_REFRESH = 8;
+
+// A plane is skipped only if all cached vertices are strictly on its
+// positive side (squared distance units of the unit domain)
+const double SKIP_PLANE_TOLERANCE = 1e-12;
+
+// Caches the cell vertices and their largest squared distance to the seed
+void refreshCellVertices(const GEO::ConvexCell& C, const GEO::vec3& seed,
+                         std::vector<GEO::vec3>& vertices, double& R2) {
+    vertices.clear();
+    R2 = 0.0;
+    for (VBW::ushort t = C.first_triangle(); t != VBW::END_OF_LIST; t = C.next_triangle(t)) {
+        const GEO::vec3 p = C.triangle_point(t);
+        vertices.push_back(p);
+        R2 = std::max(R2, GEO::distance2(seed, p));
+    }
+}
+
+} // namespace
+
+KnnVoronoi::KnnVoronoi() : averageClipCount(0.0) {}
+
+void KnnVoronoi::clear() {
+    volumes.clear();
+    faceOffsets.clear();
+    faceNeighbors.clear();
+    faceAreas.clear();
+    averageClipCount = 0.0;
+}
+
+bool KnnVoronoi::compute(const double* points, std::size_t numPoints, bool periodic) {
+    clear();
+    if (numPoints == 0 || points == nullptr) return false;
+
+    PointGrid grid;
+    grid.build(points, numPoints);
+    const int g = grid.resolution;
+    const double h = grid.binSize;
+
+    // Beyond this ring, every candidate is farther than twice the largest
+    // possible cell radius (half-diagonal of the initial box)
+    const int maxRing = periodic ? static_cast<int>(std::ceil(std::sqrt(3.0) * g)) + 1 : g;
+
+    std::vector<std::unique_ptr<SliceOutput>> slices;
+    GEO::Process::spinlock slicesLock = GEOGRAM_SPINLOCK_INIT;
+    std::atomic<uint64_t> totalClips(0);
+
+    GEO::parallel_for_slice(0, GEO::index_t(numPoints), [&](GEO::index_t b, GEO::index_t e) {
+        std::unique_ptr<SliceOutput> out = std::make_unique<SliceOutput>();
+        out->begin = b;
+        out->volumes.reserve(e - b);
+        out->faceCounts.reserve(e - b);
+
+        GEO::ConvexCell C;
+        std::vector<Candidate> pool;
+        std::vector<uint32_t> clipped;
+        std::vector<GEO::vec3> cellVertices;
+        double R2 = 0.0;
+        uint64_t sliceClips = 0;
+
+        for (GEO::index_t i = b; i < e; ++i) {
+            const GEO::vec3 Pi(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+            const double Pi_len2 = GEO::length2(Pi);
+            if (periodic) {
+                C.init_with_box(Pi.x - 0.5, Pi.y - 0.5, Pi.z - 0.5, Pi.x + 0.5, Pi.y + 0.5, Pi.z + 0.5);
+            } else {
+                C.init_with_box(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+            }
+
+            const int bx = grid.binCoord(Pi.x);
+            const int by = grid.binCoord(Pi.y);
+            const int bz = grid.binCoord(Pi.z);
+
+            pool.clear();
+            clipped.clear();
+            refreshCellVertices(C, Pi, cellVertices, R2);
+            int clipsSinceRefresh = 0;
+            bool done = false;
+
+            for (int ring = 0; ring <= maxRing && !done; ++ring) {
+                // Gather the points of the bins at Chebyshev distance 'ring'
+                for (int dx = -ring; dx <= ring; ++dx) {
+                    for (int dy = -ring; dy <= ring; ++dy) {
+                        for (int dz = -ring; dz <= ring; ++dz) {
+                            if (std::max(std::abs(dx), std::max(std::abs(dy), std::abs(dz))) != ring) continue;
+                            int cx = bx + dx;
+                            int cy = by + dy;
+                            int cz = bz + dz;
+                            GEO::vec3 shift(0.0, 0.0, 0.0);
+                            if (periodic) {
+                                // Floor division gives the ghost image translation
+                                const int sx = (cx >= 0) ? cx / g : -((-cx + g - 1) / g);
+                                const int sy = (cy >= 0) ? cy / g : -((-cy + g - 1) / g);
+                                const int sz = (cz >= 0) ? cz / g : -((-cz + g - 1) / g);
+                                cx -= sx * g;
+                                cy -= sy * g;
+                                cz -= sz * g;
+                                shift = GEO::vec3(double(sx), double(sy), double(sz));
+                            } else if (cx < 0 || cy < 0 || cz < 0 || cx >= g || cy >= g || cz >= g) {
+                                continue;
+                            }
+                            const std::size_t bin = grid.binIndex(cx, cy, cz);
+                            for (uint32_t k = grid.binStart[bin]; k < grid.binStart[bin + 1]; ++k) {
+                                const uint32_t j = grid.binPoints[k];
+                                const GEO::vec3 Pj = GEO::vec3(points[3 * j], points[3 * j + 1], points[3 * j + 2]) + shift;
+                                const double d2 = GEO::distance2(Pi, Pj);
+                                if (d2 == 0.0) continue; // the point itself (or a duplicate)
+                                pool.push_back(Candidate{ d2, j, Pj });
+                            }
+                        }
+                    }
+                }
+
+                // All points closer than 'covered' have been gathered
+                const bool lastRing = (ring == maxRing);
+                const double covered = ring * h;
+                const double covered2 = lastRing ? std::numeric_limits<double>::max() : covered * covered;
+
+                // Only the candidates inside the covered radius are used by this ring
+                const std::size_t nbCovered = std::size_t(std::partition(pool.begin(), pool.end(),
+                    [covered2](const Candidate& c) { return c.dist2 < covered2; }) - pool.begin());
+                std::sort(pool.begin(), pool.begin() + std::ptrdiff_t(nbCovered),
+                    [](const Candidate& a, const Candidate& c) { return a.dist2 < c.dist2; });
+
+                std::size_t k = 0;
+                for (; k < nbCovered; ++k) {
+                    // Security radius: a site farther than 2R cannot clip the cell
+                    if (pool[k].dist2 > 4.0 * R2) {
+                        if (clipsSinceRefresh == 0) {
+                            done = true;
+                            break;
+                        }
+                        refreshCellVertices(C, Pi, cellVertices, R2);
+                        clipsSinceRefresh = 0;
+                        if (pool[k].dist2 > 4.0 * R2) {
+                            done = true;
+                            break;
+                        }
+                    }
+
+                    // Bisector plane, positive on the side of Pi:
+                    // P.x + w = |x - Pj|^2 - |x - Pi|^2
+                    const GEO::vec3& Pj = pool[k].position;
+                    if (k > 0 && pool[k - 1].dist2 == pool[k].dist2 && GEO::distance2(pool[k - 1].position, Pj) == 0.0) {
+                        continue; // duplicated point, same plane
+                    }
+                    const GEO::vec4 P(
+                        2.0 * (Pi.x - Pj.x),
+                        2.0 * (Pi.y - Pj.y),
+                        2.0 * (Pi.z - Pj.z),
+                        GEO::length2(Pj) - Pi_len2
+                    );
+
+                    // Most candidates inside the security radius do not cut the cell.
+                    // The cached vertices span a polytope that contains the current
+                    // cell (it only shrinks), so if none of them is on the negative
+                    // side the plane can be skipped without the exact conflict flood
+                    // of clip_by_plane_fast.
+                    bool cuts = false;
+                    for (const GEO::vec3& x : cellVertices) {
+                        if (P.x * x.x + P.y * x.y + P.z * x.z + P.w < SKIP_PLANE_TOLERANCE) {
+                            cuts = true;
+                            break;
+                        }
+                    }
+                    if (!cuts) continue;
+
+                    C.clip_by_plane_fast(P);
+                    clipped.push_back(pool[k].index);
+                    if (++clipsSinceRefresh == SECURITY_RADIUS_REFRESH) {
+                        refreshCellVertices(C, Pi, cellVertices, R2);
+                        clipsSinceRefresh = 0;
+                    }
+                }
+                pool.erase(pool.begin(), pool.begin() + std::ptrdiff_t(k));
+
+                if (!done && clipsSinceRefresh != 0) {
+                    refreshCellVertices(C, Pi, cellVertices, R2);
+                    clipsSinceRefresh = 0;
+                }
+                if (lastRing || 4.0 * R2 < covered2) {
+                    done = true;
+                }
+            }
+            sliceClips += clipped.size();
+
+            if (C.empty()) {
+                out->volumes.push_back(0.0);
+                out->faceCounts.push_back(0);
+                continue;
+            }
+
+            C.compute_geometry();
+            out->volumes.push_back(C.volume());
+            uint32_t nbFaces = 0;
+            for (VBW::index_t v = 1; v < C.nb_v(); ++v) {
+                if (!C.vertex_is_contributing(v)) continue;
+                out->faceNeighbors.push_back((v < FIRST_CLIP_VERTEX)
+                    ? -int32_t(v)
+                    : int32_t(clipped[v - FIRST_CLIP_VERTEX]));
+                out->faceAreas.push_back(C.facet_area(v));
+                ++nbFaces;
+            }
+            out->faceCounts.push_back(nbFaces);
+        }
+
+        totalClips += sliceClips;
+        GEO::Process::acquire_spinlock(slicesLock);
+        slices.push_back(std::move(out));
+        GEO::Process::release_spinlock(slicesLock);
+    });
+
+    std::sort(slices.begin(), slices.end(), [](const std::unique_ptr<SliceOutput>& a,
+                                               const std::unique_ptr<SliceOutput>& b) {
+        return a->begin < b->begin;
+    });
+
+    volumes.reserve(numPoints);
+    faceOffsets.reserve(numPoints + 1u);
+    faceOffsets.push_back(0);
+    for (const std::unique_ptr<SliceOutput>& slice : slices) {
+        volumes.insert(volumes.end(), slice->volumes.begin(), slice->volumes.end());
+        for (uint32_t count : slice->faceCounts) faceOffsets.push_back(faceOffsets.back() + count);
+        faceNeighbors.insert(faceNeighbors.end(), slice->faceNeighbors.begin(), slice->faceNeighbors.end());
+        faceAreas.insert(faceAreas.end(), slice->faceAreas.begin(), slice->faceAreas.end());
+    }
+    averageClipCount = double(totalClips.load()) / double(numPoints);
+
+    return volumes.size() == numPoints;
+}
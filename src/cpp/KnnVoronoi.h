@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// KnnVoronoi computes Voronoi cells without a global tetrahedralization.
+//
+// Points are bucketed in a uniform grid (about two points per bin). Each cell
+// is then built independently: it starts as a box (the domain, or in periodic
+// mode the unit cube centered on the point, which bounds any cell of the flat
+// torus), and is clipped with VBW::ConvexCell::clip_by_plane_fast by its
+// nearest neighbors in order of increasing distance, gathered ring by ring
+// from the grid. In periodic mode, bins wrap around and neighbors are taken
+// as ghost images translated by the period. Clipping stops with the security
+// radius test: once the next candidate is farther than twice the maximum
+// distance from the point to the cell vertices, it cannot clip the cell.
+//
+// This is embarrassingly parallel and meant for large, well-spaced point
+// sets. Only the unweighted (Voronoi) case is supported.
+//
+// Results use the same CSR layout as BoundedVoronoi (without polygons):
+// - volumes:       one double per cell
+// - faceOffsets:   numCells+1 uint32
+// - faceNeighbors: one int32 per face, neighbor index or -1-k for wall k
+//                  of the initial box (only possible for non-periodic input)
+// - faceAreas:     one double per face
+
+class KnnVoronoi {
+public:
+    KnnVoronoi();
+
+    // Points x,y,z packed in [0,1)^3. Returns false on invalid input.
+    bool compute(const double* points, std::size_t numPoints, bool periodic);
+
+    std::size_t getCellCount() const { return volumes.size(); }
+    std::size_t getFaceCount() const { return faceNeighbors.size(); }
+
+    // Average number of clipping planes per cell in the last compute()
+    double getAverageClipCount() const { return averageClipCount; }
+
+    double* getVolumeBufferPtr() { return volumes.empty() ? nullptr : volumes.data(); }
+    uint32_t* getFaceOffsetBufferPtr() { return faceOffsets.empty() ? nullptr : faceOffsets.data(); }
+    int32_t* getFaceNeighborBufferPtr() { return faceNeighbors.empty() ? nullptr : faceNeighbors.data(); }
+    double* getFaceAreaBufferPtr() { return faceAreas.empty() ? nullptr : faceAreas.data(); }
+
+private:
+    void clear();
+
+    std::vector<double> volumes;
+    std::vector<uint32_t> faceOffsets;
+    std::vector<int32_t> faceNeighbors;
+    std::vector<double> faceAreas;
+    double averageClipCount;
+};
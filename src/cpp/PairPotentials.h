@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+// Pair potentials of the ParticleSystem force kernel, as policies: the pair
+// loop is a template over the potential, instantiated once per potential and
+// picked once per update (no call per pair). A potential provides:
+// - rangeFactor(): interaction range as a multiple of the contact distance
+//   ri + rj (pairs farther apart are skipped)
+// - force(dist, ri, rj): magnitude along the center line at 0 < dist < range,
+//   positive when repulsive
+// - force4(): the same for four pairs (ri splatted) in the simd128 builds
+//
+// strength is ParticleSystem's repulsionStrength; every potential is scaled
+// so that it compares to the linear spring at the same strength.
+
+// Linear spring: strength * overlap (the original Cherry Core contact)
+struct LinearSpringPotential {
+    float strength;
+
+    float rangeFactor() const { return 1.0f; }
+
+    float force(float dist, float ri, float rj) const { return strength * ((ri + rj) - dist); }
+
+#ifdef __wasm_simd128__
+    v128_t force4(v128_t dist, v128_t ri, v128_t rj) const {
+        return wasm_f32x4_mul(wasm_f32x4_splat(strength), wasm_f32x4_sub(wasm_f32x4_add(ri, rj), dist));
+    }
+#endif
+};
+
+// Hertzian contact: strength * overlap * sqrt(overlap / R), R = ri rj / (ri + rj)
+// the reduced radius (equal to the linear spring at an overlap of R)
+struct HertzPotential {
+    float strength;
+
+    float rangeFactor() const { return 1.0f; }
+
+    float force(float dist, float ri, float rj) const {
+        const float sumR = ri + rj;
+        const float overlap = sumR - dist;
+        if (!(ri * rj > 0.0f)) return 0.0f; // point particle
+        return strength * overlap * std::sqrt(overlap * sumR / (ri * rj));
+    }
+
+#ifdef __wasm_simd128__
+    v128_t force4(v128_t dist, v128_t ri, v128_t rj) const {
+        const v128_t sumR = wasm_f32x4_add(ri, rj);
+        const v128_t overlap = wasm_f32x4_sub(sumR, dist);
+        const v128_t reduced = wasm_f32x4_mul(ri, rj);
+        const v128_t root = wasm_f32x4_sqrt(wasm_f32x4_div(wasm_f32x4_mul(overlap, sumR), reduced));
+        return wasm_v128_and(wasm_f32x4_mul(wasm_f32x4_mul(wasm_f32x4_splat(strength), overlap), root),
+                             wasm_f32x4_gt(reduced, wasm_f32x4_splat(0.0f)));
+    }
+#endif
+};
+
+// Linear spring in contact, and a triangular cohesive well beyond it: the
+// attraction grows from 0 at contact to cohesion * strength * range * (ri + rj) / 2
+// halfway through the range, and goes back to 0 at (1 + range) (ri + rj)
+struct CohesivePotential {
+    float strength;
+    float cohesion; // peak attraction relative to the spring
+    float range;    // width of the well, fraction of ri + rj
+
+    float rangeFactor() const { return 1.0f + range; }
+
+    float force(float dist, float ri, float rj) const {
+        const float sumR = ri + rj;
+        const float overlap = sumR - dist;
+        if (overlap >= 0.0f) return strength * overlap;
+        const float well = std::min(-overlap, sumR * (1.0f + range) - dist);
+        return -strength * cohesion * well;
+    }
+
+#ifdef __wasm_simd128__
+    v128_t force4(v128_t dist, v128_t ri, v128_t rj) const {
+        const v128_t sumR = wasm_f32x4_add(ri, rj);
+        const v128_t overlap = wasm_f32x4_sub(sumR, dist);
+        const v128_t spring = wasm_f32x4_mul(wasm_f32x4_splat(strength), overlap);
+        const v128_t well = wasm_f32x4_min(
+            wasm_f32x4_neg(overlap),
+            wasm_f32x4_sub(wasm_f32x4_mul(sumR, wasm_f32x4_splat(1.0f + range)), dist));
+        const v128_t attraction = wasm_f32x4_mul(wasm_f32x4_splat(-strength * cohesion), well);
+        return wasm_v128_bitselect(spring, attraction, wasm_f32x4_ge(overlap, wasm_f32x4_splat(0.0f)));
+    }
+#endif
+};
+
+// Weeks-Chandler-Andersen: Lennard-Jones cut at its minimum, placed at the
+// contact distance (sigma = (ri + rj) / 2^(1/6)), with epsilon =
+// strength * (ri + rj)^2 / 24. The force is held at its value at sigma / 2
+// below that, so that overlapping random starts stay finite.
+struct WcaPotential {
+    float strength;
+
+    float rangeFactor() const { return 1.0f; }
+
+    float force(float dist, float ri, float rj) const {
+        const float sumR = ri + rj;
+        const float sigma = sumR * 0.8908987f; // 2^(-1/6)
+        const float r = std::max(dist, 0.5f * sigma);
+        const float s2 = (sigma * sigma) / (r * r);
+        const float s6 = s2 * s2 * s2;
+        return strength * sumR * sumR / r * (2.0f * s6 * s6 - s6);
+    }
+
+#ifdef __wasm_simd128__
+    v128_t force4(v128_t dist, v128_t ri, v128_t rj) const {
+        const v128_t sumR = wasm_f32x4_add(ri, rj);
+        const v128_t sigma = wasm_f32x4_mul(sumR, wasm_f32x4_splat(0.8908987f));
+        const v128_t r = wasm_f32x4_max(dist, wasm_f32x4_mul(sigma, wasm_f32x4_splat(0.5f)));
+        const v128_t s2 = wasm_f32x4_div(wasm_f32x4_mul(sigma, sigma), wasm_f32x4_mul(r, r));
+        const v128_t s6 = wasm_f32x4_mul(wasm_f32x4_mul(s2, s2), s2);
+        const v128_t shape = wasm_f32x4_sub(wasm_f32x4_mul(wasm_f32x4_splat(2.0f), wasm_f32x4_mul(s6, s6)), s6);
+        const v128_t scale = wasm_f32x4_div(wasm_f32x4_mul(wasm_f32x4_splat(strength), wasm_f32x4_mul(sumR, sumR)), r);
+        return wasm_f32x4_mul(scale, shape);
+    }
+#endif
+};
+
+// Tabulated: strength * (ri + rj) * f(dist / (ri + rj)), f sampled at count
+// evenly spaced ratios over [0, range] and interpolated linearly (the table is
+// small enough to stay in cache, see ParticleSystem::setPairPotentialTable).
+// f(x) = 1 - x with range 1 is the linear spring.
+struct TabulatedPotential {
+    float strength;
+    const float* table;
+    std::size_t count; // >= 2
+    float range;
+
+    float rangeFactor() const { return range; }
+
+    float force(float dist, float ri, float rj) const {
+        const float sumR = ri + rj;
+        const float t = std::min(dist / sumR * (float(count - 1) / range), float(count - 1));
+        const std::size_t k = std::min(std::size_t(t), count - 2);
+        const float f = t - float(k);
+        return strength * sumR * (table[k] + f * (table[k + 1] - table[k]));
+    }
+
+#ifdef __wasm_simd128__
+    v128_t force4(v128_t dist, v128_t ri, v128_t rj) const {
+        // Positions in the table in SIMD, the lookups per lane
+        const v128_t sumR = wasm_f32x4_add(ri, rj);
+        const v128_t t = wasm_f32x4_min(
+            wasm_f32x4_mul(wasm_f32x4_div(dist, sumR), wasm_f32x4_splat(float(count - 1) / range)),
+            wasm_f32x4_splat(float(count - 1)));
+        float lanes[4];
+        wasm_v128_store(lanes, t);
+        float values[4];
+        for (int l = 0; l < 4; ++l) {
+            // Masked lanes may hold NaN or garbage, keep their index in bounds
+            const float tl = (lanes[l] >= 0.0f) ? lanes[l] : 0.0f;
+            const std::size_t k = std::min(std::size_t(tl), count - 2);
+            const float f = tl - float(k);
+            values[l] = table[k] + f * (table[k + 1] - table[k]);
+        }
+        return wasm_f32x4_mul(wasm_f32x4_mul(wasm_f32x4_splat(strength), sumR), wasm_v128_load(values));
+    }
+#endif
+};
@@ -1,8 +1,12 @@
 #include "ParticleSystem.h"
+#include "GeogramInit.h"
+#include "PairPotentials.h"
 
 #include <random>
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <algorithm>
 
 // Geogram (PSM version vendored in this repo)
 #include "Delaunay_psm.h"
@@ -10,34 +14,386 @@
 // Eigen for PCA
 #include <Eigen/Dense>
 
-// Compute tetrahedron circumcenter using linear system approach.
-// Falls back to simple average if the system is ill-conditioned.
-static inline Eigen::Vector3f computeTetraCircumcenter(
-    const Eigen::Vector3f& a,
-    const Eigen::Vector3f& b,
-    const Eigen::Vector3f& c,
-    const Eigen::Vector3f& d
-) {
-    const Eigen::Vector3f u = b - a;
-    const Eigen::Vector3f v = c - a;
-    const Eigen::Vector3f w = d - a;
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
 
-    Eigen::Matrix3f A;
-    A.row(0) = u.transpose();
-    A.row(1) = v.transpose();
-    A.row(2) = w.transpose();
+// Circumcenters of a periodic tetrahedron, unwrapped around each of its vertices:
+// centers[k] is the circumcenter of the tet whose vertices are brought next to p[k]
+// with the minimum-image convention. Closed form relative to the first unwrapped
+// vertex; flat tets fall back to the vertex average (not geometrically exact, but stable).
+// The SIMD build computes the four unwraps in the four lanes.
+static inline void computeUnwrappedCircumcenters(const Eigen::Vector3f p[4], Eigen::Vector3f centers[4]) {
+    // Tets whose |det| is below this fraction of the product of the edge lengths are flat
+    const float flatTolerance2 = 1e-12f;
+#ifdef __wasm_simd128__
+    // Lane k holds the quantities of the tet unwrapped around p[k]
+    v128_t pivot[3];
+    for (int c = 0; c < 3; ++c) pivot[c] = wasm_f32x4_make(p[0][c], p[1][c], p[2][c], p[3][c]);
+    v128_t d[4][3];
+    for (int m = 0; m < 4; ++m) {
+        for (int c = 0; c < 3; ++c) {
+            const v128_t delta = wasm_f32x4_sub(wasm_f32x4_splat(p[m][c]), pivot[c]);
+            d[m][c] = wasm_f32x4_sub(delta, wasm_f32x4_nearest(delta));
+        }
+    }
+    v128_t a[3], b[3], e[3];
+    for (int c = 0; c < 3; ++c) {
+        a[c] = wasm_f32x4_sub(d[1][c], d[0][c]);
+        b[c] = wasm_f32x4_sub(d[2][c], d[0][c]);
+        e[c] = wasm_f32x4_sub(d[3][c], d[0][c]);
+    }
+    auto cross = [](const v128_t* u, const v128_t* v, v128_t* out) {
+        out[0] = wasm_f32x4_sub(wasm_f32x4_mul(u[1], v[2]), wasm_f32x4_mul(u[2], v[1]));
+        out[1] = wasm_f32x4_sub(wasm_f32x4_mul(u[2], v[0]), wasm_f32x4_mul(u[0], v[2]));
+        out[2] = wasm_f32x4_sub(wasm_f32x4_mul(u[0], v[1]), wasm_f32x4_mul(u[1], v[0]));
+    };
+    auto dot = [](const v128_t* u, const v128_t* v) {
+        return wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_mul(u[0], v[0]), wasm_f32x4_mul(u[1], v[1])),
+                              wasm_f32x4_mul(u[2], v[2]));
+    };
+    v128_t be[3], ea[3], ab[3];
+    cross(b, e, be);
+    cross(e, a, ea);
+    cross(a, b, ab);
+    const v128_t la2 = dot(a, a);
+    const v128_t lb2 = dot(b, b);
+    const v128_t le2 = dot(e, e);
+    const v128_t det = dot(a, be);
+    const v128_t flat = wasm_f32x4_le(wasm_f32x4_mul(det, det),
+                                      wasm_f32x4_mul(wasm_f32x4_splat(flatTolerance2),
+                                                     wasm_f32x4_mul(la2, wasm_f32x4_mul(lb2, le2))));
+    const v128_t inv = wasm_f32x4_div(wasm_f32x4_splat(0.5f), det);
+    float out[3][4];
+    for (int c = 0; c < 3; ++c) {
+        const v128_t offset = wasm_f32x4_mul(
+            wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_mul(la2, be[c]), wasm_f32x4_mul(lb2, ea[c])),
+                           wasm_f32x4_mul(le2, ab[c])),
+            inv);
+        const v128_t average = wasm_f32x4_mul(
+            wasm_f32x4_add(wasm_f32x4_add(d[0][c], d[1][c]), wasm_f32x4_add(d[2][c], d[3][c])),
+            wasm_f32x4_splat(0.25f));
+        const v128_t center = wasm_f32x4_add(pivot[c],
+                                             wasm_v128_bitselect(average, wasm_f32x4_add(d[0][c], offset), flat));
+        wasm_v128_store(out[c], center);
+    }
+    for (int k = 0; k < 4; ++k) centers[k] = Eigen::Vector3f(out[0][k], out[1][k], out[2][k]);
+#else
+    for (int k = 0; k < 4; ++k) {
+        Eigen::Vector3f d[4];
+        for (int m = 0; m < 4; ++m) {
+            d[m] = p[m] - p[k];
+            d[m].x() -= std::round(d[m].x());
+            d[m].y() -= std::round(d[m].y());
+            d[m].z() -= std::round(d[m].z());
+        }
+        const Eigen::Vector3f a = d[1] - d[0];
+        const Eigen::Vector3f b = d[2] - d[0];
+        const Eigen::Vector3f e = d[3] - d[0];
+        const Eigen::Vector3f be = b.cross(e);
+        const float det = a.dot(be);
+        const float la2 = a.squaredNorm();
+        const float lb2 = b.squaredNorm();
+        const float le2 = e.squaredNorm();
+        if (det * det <= flatTolerance2 * la2 * lb2 * le2) {
+            centers[k] = p[k] + (d[0] + d[1] + d[2] + d[3]) * 0.25f;
+        } else {
+            centers[k] = p[k] + d[0] + (la2 * be + lb2 * e.cross(a) + le2 * a.cross(b)) * (0.5f / det);
+        }
+    }
+#endif
+}
+
+namespace {
+
+// Fixed-point coordinates: one period is 2^32 units
+const double FIXED_SCALE = 4294967296.0;
+const float FIXED_TO_UNIT = 1.0f / 4294967296.0f;
+
+// One coordinate axis of the pair loop: floats in [0,1), or uint32 fractions
+// of the period in fixed-point mode (the other pointer is null)
+struct AxisArray {
+    const float* unit;
+    const uint32_t* fixed;
+};
+
+// Contact export of the pair loop (see ParticleSystem::setContactExport())
+struct ContactOutput {
+    std::vector<uint32_t>& pairs;
+    std::vector<float>& overlaps;
+    std::vector<float>& forces;
+    std::vector<int8_t>& offsets;
+    std::vector<uint32_t>& coordination;
+};
+
+// Pair loop inputs/outputs, structure of arrays
+struct PairArrays {
+    AxisArray axis[3];
+    const float* radius;
+    float* vx;
+    float* vy;
+    float* vz;
+    ContactOutput* contacts; // null unless exported
+};
+
+// Minimum-image displacement from i to j along one axis. In fixed point the
+// wrapped difference is the signed 32-bit difference, no rounding needed.
+template <bool FixedPoint>
+inline float axisDisplacement(const AxisArray& a, std::size_t i, std::size_t j) {
+    if (FixedPoint) {
+        return float(int32_t(a.fixed[j] - a.fixed[i])) * FIXED_TO_UNIT;
+    }
+    const float d = a.unit[j] - a.unit[i];
+    return d - std::round(d);
+}
+
+// Periodic translation of j next to i along one axis (the minimum image is
+// aj + translation), in periods
+template <bool FixedPoint>
+inline int8_t axisTranslation(const AxisArray& a, std::size_t i, std::size_t j) {
+    if (FixedPoint) {
+        const int64_t d = int64_t(a.fixed[j]) - int64_t(a.fixed[i]);
+        return int8_t((int64_t(int32_t(uint32_t(d))) - d) / int64_t(4294967296LL));
+    }
+    return int8_t(-std::round(a.unit[j] - a.unit[i]));
+}
+
+template <bool FixedPoint>
+void recordContact(const PairArrays& arrays, std::size_t i, std::size_t j, float overlap, float force) {
+    ContactOutput& out = *arrays.contacts;
+    out.pairs.push_back(uint32_t(i));
+    out.pairs.push_back(uint32_t(j));
+    out.overlaps.push_back(overlap);
+    out.forces.push_back(force);
+    for (int c = 0; c < 3; ++c) out.offsets.push_back(axisTranslation<FixedPoint>(arrays.axis[c], i, j));
+    ++out.coordination[i];
+    ++out.coordination[j];
+}
+
+#ifdef __wasm_simd128__
+template <bool FixedPoint>
+inline v128_t axisSplat(const AxisArray& a, std::size_t i) {
+    return FixedPoint ? wasm_i32x4_splat(int32_t(a.fixed[i])) : wasm_f32x4_splat(a.unit[i]);
+}
+
+// Displacements from i (splatted in ai) to j..j+3
+template <bool FixedPoint>
+inline v128_t axisDisplacement4(const AxisArray& a, v128_t ai, std::size_t j) {
+    if (FixedPoint) {
+        const v128_t d = wasm_i32x4_sub(wasm_v128_load(a.fixed + j), ai);
+        return wasm_f32x4_mul(wasm_f32x4_convert_i32x4(d), wasm_f32x4_splat(FIXED_TO_UNIT));
+    }
+    const v128_t d = wasm_f32x4_sub(wasm_v128_load(a.unit + j), ai);
+    return wasm_f32x4_sub(d, wasm_f32x4_nearest(d));
+}
+#endif
+
+// Soft-sphere forces: iterate pairs (O(N^2) to start; replace with NNS later), with
+// the pair potential as a policy (see PairPotentials.h)
+template <bool FixedPoint, class Potential>
+void repulsionPairs(const PairArrays& arrays, std::size_t n, const Potential& potential, float dt) {
+    const float* r = arrays.radius;
+    float* vx = arrays.vx;
+    float* vy = arrays.vy;
+    float* vz = arrays.vz;
+    const float rangeFactor = potential.rangeFactor();
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t j = i + 1;
+        float dvx = 0.0f;
+        float dvy = 0.0f;
+        float dvz = 0.0f;
+#ifdef __wasm_simd128__
+        // Four j's at a time; lanes out of range get a zero impulse
+        const v128_t xi = axisSplat<FixedPoint>(arrays.axis[0], i);
+        const v128_t yi = axisSplat<FixedPoint>(arrays.axis[1], i);
+        const v128_t zi = axisSplat<FixedPoint>(arrays.axis[2], i);
+        const v128_t ri = wasm_f32x4_splat(r[i]);
+        const v128_t step = wasm_f32x4_splat(dt);
+        const v128_t range = wasm_f32x4_splat(rangeFactor);
+        const v128_t zero = wasm_f32x4_splat(0.0f);
+        v128_t accX = zero;
+        v128_t accY = zero;
+        v128_t accZ = zero;
+        for (; j + 4 <= n; j += 4) {
+            const v128_t mx = axisDisplacement4<FixedPoint>(arrays.axis[0], xi, j);
+            const v128_t my = axisDisplacement4<FixedPoint>(arrays.axis[1], yi, j);
+            const v128_t mz = axisDisplacement4<FixedPoint>(arrays.axis[2], zi, j);
+            const v128_t dist2 = wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_mul(mx, mx), wasm_f32x4_mul(my, my)),
+                                                wasm_f32x4_mul(mz, mz));
+            const v128_t rj = wasm_v128_load(r + j);
+            const v128_t cutoff = wasm_f32x4_mul(wasm_f32x4_add(rj, ri), range);
+            const v128_t contact = wasm_v128_and(wasm_f32x4_gt(dist2, zero),
+                                                 wasm_f32x4_lt(dist2, wasm_f32x4_mul(cutoff, cutoff)));
+            if (!wasm_v128_any_true(contact)) continue;
+
+            // Impulse along the unit direction, scaled by the force (masked lanes may be NaN)
+            const v128_t dist = wasm_f32x4_sqrt(dist2);
+            const v128_t force = potential.force4(dist, ri, rj);
+            const v128_t scale = wasm_v128_and(wasm_f32x4_mul(wasm_f32x4_div(force, dist), step), contact);
+            if (arrays.contacts) {
+                float laneOverlap[4];
+                float laneForce[4];
+                wasm_v128_store(laneOverlap, wasm_f32x4_sub(wasm_f32x4_add(rj, ri), dist));
+                wasm_v128_store(laneForce, force);
+                const int mask = wasm_i32x4_bitmask(contact);
+                for (int l = 0; l < 4; ++l) {
+                    if ((mask & (1 << l)) && laneOverlap[l] > 0.0f) {
+                        recordContact<FixedPoint>(arrays, i, j + std::size_t(l), laneOverlap[l], laneForce[l]);
+                    }
+                }
+            }
+            const v128_t fx = wasm_f32x4_mul(mx, scale);
+            const v128_t fy = wasm_f32x4_mul(my, scale);
+            const v128_t fz = wasm_f32x4_mul(mz, scale);
+            accX = wasm_f32x4_add(accX, fx);
+            accY = wasm_f32x4_add(accY, fy);
+            accZ = wasm_f32x4_add(accZ, fz);
+            wasm_v128_store(vx + j, wasm_f32x4_add(wasm_v128_load(vx + j), fx));
+            wasm_v128_store(vy + j, wasm_f32x4_add(wasm_v128_load(vy + j), fy));
+            wasm_v128_store(vz + j, wasm_f32x4_add(wasm_v128_load(vz + j), fz));
+        }
+        dvx = wasm_f32x4_extract_lane(accX, 0) + wasm_f32x4_extract_lane(accX, 1) +
+              wasm_f32x4_extract_lane(accX, 2) + wasm_f32x4_extract_lane(accX, 3);
+        dvy = wasm_f32x4_extract_lane(accY, 0) + wasm_f32x4_extract_lane(accY, 1) +
+              wasm_f32x4_extract_lane(accY, 2) + wasm_f32x4_extract_lane(accY, 3);
+        dvz = wasm_f32x4_extract_lane(accZ, 0) + wasm_f32x4_extract_lane(accZ, 1) +
+              wasm_f32x4_extract_lane(accZ, 2) + wasm_f32x4_extract_lane(accZ, 3);
+#endif
+        for (; j < n; ++j) {
+            // Displacement using minimum image convention
+            const float mx = axisDisplacement<FixedPoint>(arrays.axis[0], i, j);
+            const float my = axisDisplacement<FixedPoint>(arrays.axis[1], i, j);
+            const float mz = axisDisplacement<FixedPoint>(arrays.axis[2], i, j);
+
+            const float dist2 = mx * mx + my * my + mz * mz;
+            if (dist2 <= 0.0f) continue;
 
-    Eigen::Vector3f rhs;
-    rhs[0] = 0.5f * (b.squaredNorm() - a.squaredNorm());
-    rhs[1] = 0.5f * (c.squaredNorm() - a.squaredNorm());
-    rhs[2] = 0.5f * (d.squaredNorm() - a.squaredNorm());
+            const float cutoff = (r[i] + r[j]) * rangeFactor;
+            if (dist2 < cutoff * cutoff) {
+                const float dist = std::sqrt(dist2);
+                const float force = potential.force(dist, r[i], r[j]);
+                if (arrays.contacts && r[i] + r[j] - dist > 0.0f) {
+                    recordContact<FixedPoint>(arrays, i, j, r[i] + r[j] - dist, force);
+                }
+                if (force != 0.0f) {
+                    // Impulse along the unit direction from i to j
+                    const float scale = force / dist * dt;
+                    const float fx = mx * scale;
+                    const float fy = my * scale;
+                    const float fz = mz * scale;
+
+                    // Apply equal and opposite impulses (unit mass)
+                    dvx += fx;
+                    dvy += fy;
+                    dvz += fz;
+                    vx[j] += fx;
+                    vy[j] += fy;
+                    vz[j] += fz;
+                }
+            }
+        }
+        vx[i] -= dvx;
+        vy[i] -= dvy;
+        vz[i] -= dvz;
+    }
+}
+
+// Same impulses as repulsionPairs() over a list of (i, j) pairs
+template <bool FixedPoint, class Potential>
+void repulsionPairList(const PairArrays& arrays, const uint32_t* pairs, std::size_t nbPairs, const Potential& potential,
+                       float dt) {
+    const float* r = arrays.radius;
+    const float rangeFactor = potential.rangeFactor();
+    for (std::size_t p = 0; p < nbPairs; ++p) {
+        const uint32_t i = pairs[2 * p];
+        const uint32_t j = pairs[2 * p + 1];
+        const float mx = axisDisplacement<FixedPoint>(arrays.axis[0], i, j);
+        const float my = axisDisplacement<FixedPoint>(arrays.axis[1], i, j);
+        const float mz = axisDisplacement<FixedPoint>(arrays.axis[2], i, j);
+        const float dist2 = mx * mx + my * my + mz * mz;
+        const float cutoff = (r[i] + r[j]) * rangeFactor;
+        if (dist2 <= 0.0f || dist2 >= cutoff * cutoff) continue;
+        const float dist = std::sqrt(dist2);
+        const float force = potential.force(dist, r[i], r[j]);
+        if (arrays.contacts && r[i] + r[j] - dist > 0.0f) {
+            recordContact<FixedPoint>(arrays, i, j, r[i] + r[j] - dist, force);
+        }
+        const float scale = force / dist * dt;
+        arrays.vx[i] -= mx * scale;
+        arrays.vy[i] -= my * scale;
+        arrays.vz[i] -= mz * scale;
+        arrays.vx[j] += mx * scale;
+        arrays.vy[j] += my * scale;
+        arrays.vz[j] += mz * scale;
+    }
+}
+
+// Extra face vertices reserved per particle slot (two triangles), so that a star
+// gaining a tet or two is rewritten in place
+const uint32_t FACE_SLOT_SLACK = 6;
+
+// Unit coordinate to fixed point, wrapped modulo the period
+inline uint32_t toFixed(double x) {
+    return uint32_t(uint64_t(int64_t(std::llround((x - std::floor(x)) * FIXED_SCALE))));
+}
+
+// Fixed point to a float in [0,1): the top 24 bits are exact in a float (never rounds up to 1)
+inline float fixedToUnit(uint32_t u) {
+    return float(u >> 8) * (1.0f / 16777216.0f);
+}
 
-    Eigen::ColPivHouseholderQR<Eigen::Matrix3f> solver(A);
-    if (solver.isInvertible()) {
-        return solver.solve(rhs);
+} // namespace
+
+bool principalAxis3d(const float* points, std::size_t count, float mean[3], float axis[3], float& deviation) {
+    if (count < 2) return false;
+    const Eigen::Map<const Eigen::Matrix<float, 3, Eigen::Dynamic>> cloud(points, 3, Eigen::Index(count));
+
+    // Compute mean
+    Eigen::Vector3f m(0.0f, 0.0f, 0.0f);
+    for (std::size_t k = 0; k < count; ++k) m += cloud.col(Eigen::Index(k));
+    m /= float(count);
+
+    // Covariance
+    Eigen::Matrix3f cov = Eigen::Matrix3f::Zero();
+    for (std::size_t k = 0; k < count; ++k) {
+        Eigen::Vector3f d = cloud.col(Eigen::Index(k)) - m;
+        cov += d * d.transpose();
+    }
+    cov /= std::max(1, int(count - 1));
+
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3f> solver(cov);
+    if (solver.info() != Eigen::Success) return false;
+    Eigen::Vector3f eigenvalues = solver.eigenvalues();
+    Eigen::Matrix3f eigenvectors = solver.eigenvectors();
+
+    // Index of max eigenvalue (largest principal component)
+    int idx = 0;
+    if (eigenvalues[1] > eigenvalues[idx]) idx = 1;
+    if (eigenvalues[2] > eigenvalues[idx]) idx = 2;
+
+    Eigen::Vector3f principalAxis = eigenvectors.col(idx).normalized();
+
+    // Square root of the eigenvalue: standard deviation along the axis
+    deviation = std::sqrt(std::max(0.0f, eigenvalues[idx]));
+
+    // Determine skewness/asymmetry by checking distribution of points along axis
+    float skewness = 0.0f;
+    for (std::size_t k = 0; k < count; ++k) {
+        Eigen::Vector3f d = cloud.col(Eigen::Index(k)) - m;
+        skewness += d.dot(principalAxis);
     }
-    // Fallback: average (not geometrically exact, but stable)
-    return (a + b + c + d) * 0.25f;
+    skewness /= float(count);
+
+    // Disambiguate direction: if skewness is negative, flip axis
+    if (skewness < 0.0f) {
+        principalAxis = -principalAxis;
+    }
+
+    for (int c = 0; c < 3; ++c) {
+        mean[c] = m[c];
+        axis[c] = principalAxis[c];
+    }
+    return true;
 }
 
 ParticleSystem::ParticleSystem()
@@ -47,7 +403,21 @@ ParticleSystem::ParticleSystem()
       steeringEveryNFrames(10),
       frameCounter(0),
       minSpeed(0.0f),
-      maxSpeed(2.0f) {}
+      maxSpeed(2.0f),
+      fixedPoint(false),
+      dimension(3),
+      periodicWarmStart(false),
+      steeringSource(STEERING_CIRCUMCENTERS),
+      delaunayPairList(false),
+      pairPotential(POTENTIAL_LINEAR),
+      cohesionStrength(0.1f),
+      cohesionRange(0.2f),
+      potentialTableRange(1.0f),
+      contactExport(false),
+      changedStarCount(0),
+      faceLayoutReset(false),
+      pairListFrames(0),
+      pairListFallbacks(0) {}
 
 void ParticleSystem::initialize(std::size_t numParticles, float defaultRadius, unsigned int seed) {
     particles.clear();
@@ -58,6 +428,18 @@ void ParticleSystem::initialize(std::size_t numParticles, float defaultRadius, u
     facePositions.clear();
     faceNormals.clear();
     faceAxes.clear();
+    fixedPositions.clear();
+    cellPolygonOffsets.clear();
+    cellPolygonVertices.clear();
+    periodicInstances.clear();
+    contactPairs.clear();
+    contactOverlaps.clear();
+    contactForces.clear();
+    contactOffsets.clear();
+    coordination.clear();
+    resetSteeringTopology();
+    changedStarCount = 0;
+    faceLayoutReset = false;
 
     particles.resize(numParticles);
     positions.resize(numParticles * 3u);
@@ -72,7 +454,7 @@ void ParticleSystem::initialize(std::size_t numParticles, float defaultRadius, u
         Particle p;
         p.x = uni(rng);
         p.y = uni(rng);
-        p.z = uni(rng);
+        p.z = (dimension == 2) ? 0.0f : uni(rng);
         p.vx = 0.0f;
         p.vy = 0.0f;
         p.vz = 0.0f;
@@ -85,6 +467,106 @@ void ParticleSystem::initialize(std::size_t numParticles, float defaultRadius, u
         positions[i * 3u + 2u] = p.z;
         radii[i] = p.radius;
     }
+
+    if (fixedPoint) {
+        fixedPoint = false;
+        setFixedPoint(true);
+    }
+}
+
+void ParticleSystem::setDimension(int dim) {
+    dim = (dim == 2) ? 2 : 3;
+    if (dim == dimension) return;
+    dimension = dim;
+    periodicInstances.clear();
+    resetSteeringTopology();
+    facePositions.clear();
+    faceNormals.clear();
+    faceAxes.clear();
+    cellPolygonOffsets.clear();
+    cellPolygonVertices.clear();
+    if (dimension != 2) return;
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+        particles[i].z = 0.0f;
+        particles[i].vz = 0.0f;
+        positions[3 * i + 2] = 0.0f;
+        axes[3 * i + 2] = 0.0f;
+        if (fixedPoint) fixedPositions[3 * i + 2] = 0u;
+    }
+}
+
+void ParticleSystem::resetSteeringTopology() {
+    tetKeys.clear();
+    starOffsets.clear();
+    starEntries.clear();
+    faceSlotOffsets.clear();
+    faceSlotCapacities.clear();
+    faceDirtyRanges.clear();
+    pairList.clear();
+}
+
+void ParticleSystem::setPeriodicWarmStart(bool enabled) {
+    periodicWarmStart = enabled;
+    periodicInstances.clear();
+}
+
+void ParticleSystem::setSteeringSource(int source) {
+    steeringSource = (source == STEERING_VORONOI_INERTIA || source == STEERING_LAGUERRE_INERTIA)
+                         ? source
+                         : STEERING_CIRCUMCENTERS;
+}
+
+void ParticleSystem::setDelaunayPairList(bool enabled) {
+    delaunayPairList = enabled;
+    pairList.clear();
+    pairListFrames = 0;
+    pairListFallbacks = 0;
+}
+
+void ParticleSystem::setPairPotential(int potential) {
+    pairPotential = (potential >= POTENTIAL_LINEAR && potential <= POTENTIAL_TABULATED) ? potential : POTENTIAL_LINEAR;
+}
+
+void ParticleSystem::setCohesion(float strength, float range) {
+    cohesionStrength = std::max(0.0f, strength);
+    cohesionRange = std::max(0.0f, range);
+}
+
+bool ParticleSystem::setPairPotentialTable(const float* values, std::size_t count, float range) {
+    if (values == nullptr || count < 2 || count > MAX_POTENTIAL_TABLE_SIZE || !(range > 0.0f)) return false;
+    potentialTable.assign(values, values + count);
+    potentialTableRange = range;
+    return true;
+}
+
+void ParticleSystem::setContactExport(bool enabled) {
+    contactExport = enabled;
+    if (enabled) return;
+    contactPairs.clear();
+    contactOverlaps.clear();
+    contactForces.clear();
+    contactOffsets.clear();
+    coordination.clear();
+}
+
+void ParticleSystem::setFixedPoint(bool enabled) {
+    if (enabled == fixedPoint) return;
+    fixedPoint = enabled;
+    if (!enabled) {
+        // The float positions are kept up to date, nothing to convert back
+        fixedPositions.clear();
+        return;
+    }
+    const std::size_t n = particles.size();
+    fixedPositions.resize(3u * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        fixedPositions[3 * i] = toFixed(particles[i].x);
+        fixedPositions[3 * i + 1] = toFixed(particles[i].y);
+        fixedPositions[3 * i + 2] = toFixed(particles[i].z);
+        particles[i].x = positions[3 * i] = fixedToUnit(fixedPositions[3 * i]);
+        particles[i].y = positions[3 * i + 1] = fixedToUnit(fixedPositions[3 * i + 1]);
+        particles[i].z = positions[3 * i + 2] = fixedToUnit(fixedPositions[3 * i + 2]);
+    }
 }
 
 void ParticleSystem::update(float dt) {
@@ -94,51 +576,16 @@ void ParticleSystem::update(float dt) {
     // Apply Long-Axis steering at a throttled cadence (expensive step)
     if (steeringStrength > 0.0f && steeringEveryNFrames > 0) {
         if ((frameCounter % steeringEveryNFrames) == 0) {
-            applyVoronoiSteering(dt);
+            if (dimension == 2) {
+                applyVoronoiSteering2d(dt);
+            } else {
+                applyVoronoiSteering(dt);
+            }
         }
         frameCounter++;
     }
 
-    // Soft-sphere repulsion: iterate pairs (O(N^2) to start; replace with NNS later)
-    for (std::size_t i = 0; i < n; ++i) {
-        for (std::size_t j = i + 1; j < n; ++j) {
-            // Displacement using minimum image convention
-            float dx = particles[j].x - particles[i].x;
-            float dy = particles[j].y - particles[i].y;
-            float dz = particles[j].z - particles[i].z;
-            float mx, my, mz;
-            minimumImage(dx, dy, dz, mx, my, mz);
-
-            const float dist2 = mx * mx + my * my + mz * mz;
-            if (dist2 <= 0.0f) continue;
-
-            const float sumR = particles[i].radius + particles[j].radius;
-            const float sumR2 = sumR * sumR;
-            if (dist2 < sumR2) {
-                const float dist = std::sqrt(dist2);
-                const float overlap = sumR - dist;
-                if (overlap > 0.0f) {
-                    // Normalized direction from i to j in minimum-image
-                    const float nx = mx / dist;
-                    const float ny = my / dist;
-                    const float nz = mz / dist;
-                    // Simple linear spring-like repulsion
-                    const float forceMag = repulsionStrength * overlap;
-                    const float fx = forceMag * nx;
-                    const float fy = forceMag * ny;
-                    const float fz = forceMag * nz;
-
-                    // Apply equal and opposite impulses (unit mass)
-                    particles[i].vx -= fx * dt;
-                    particles[i].vy -= fy * dt;
-                    particles[i].vz -= fz * dt;
-                    particles[j].vx += fx * dt;
-                    particles[j].vy += fy * dt;
-                    particles[j].vz += fz * dt;
-                }
-            }
-        }
-    }
+    applyRepulsion(dt);
 
     // Integrate and apply damping + periodic wrap; clamp speeds
     const float dampingFactor = std::pow(damping, dt * 60.0f); // roughly frame-rate independent
@@ -164,9 +611,20 @@ void ParticleSystem::update(float dt) {
             }
         }
 
-        particles[i].x = wrap01(particles[i].x + particles[i].vx * dt);
-        particles[i].y = wrap01(particles[i].y + particles[i].vy * dt);
-        particles[i].z = wrap01(particles[i].z + particles[i].vz * dt);
+        if (fixedPoint) {
+            // Wraps through the uint32 overflow; floats derived for interop
+            uint32_t* u = &fixedPositions[3 * i];
+            u[0] += toFixed(particles[i].vx * dt);
+            u[1] += toFixed(particles[i].vy * dt);
+            u[2] += toFixed(particles[i].vz * dt);
+            particles[i].x = fixedToUnit(u[0]);
+            particles[i].y = fixedToUnit(u[1]);
+            particles[i].z = fixedToUnit(u[2]);
+        } else {
+            particles[i].x = wrap01(particles[i].x + particles[i].vx * dt);
+            particles[i].y = wrap01(particles[i].y + particles[i].vy * dt);
+            particles[i].z = wrap01(particles[i].z + particles[i].vz * dt);
+        }
 
         positions[i * 3u + 0u] = particles[i].x;
         positions[i * 3u + 1u] = particles[i].y;
@@ -175,6 +633,112 @@ void ParticleSystem::update(float dt) {
     }
 }
 
+void ParticleSystem::applyRepulsion(float dt) {
+    const std::size_t n = particles.size();
+
+    // Structure-of-arrays copy, so that the pair loop runs over contiguous lanes
+    soaRadius.resize(n);
+    soaVx.resize(n); soaVy.resize(n); soaVz.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        soaRadius[i] = particles[i].radius;
+        soaVx[i] = particles[i].vx;
+        soaVy[i] = particles[i].vy;
+        soaVz[i] = particles[i].vz;
+    }
+    PairArrays arrays;
+    arrays.radius = soaRadius.data();
+    arrays.vx = soaVx.data();
+    arrays.vy = soaVy.data();
+    arrays.vz = soaVz.data();
+    ContactOutput contacts = { contactPairs, contactOverlaps, contactForces, contactOffsets, coordination };
+    arrays.contacts = nullptr;
+    if (contactExport) {
+        contactPairs.clear();
+        contactOverlaps.clear();
+        contactForces.clear();
+        contactOffsets.clear();
+        coordination.assign(n, 0u);
+        arrays.contacts = &contacts;
+    }
+
+    if (fixedPoint) {
+        soaFixedX.resize(n); soaFixedY.resize(n); soaFixedZ.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            soaFixedX[i] = fixedPositions[3 * i];
+            soaFixedY[i] = fixedPositions[3 * i + 1];
+            soaFixedZ[i] = fixedPositions[3 * i + 2];
+        }
+        arrays.axis[0] = { nullptr, soaFixedX.data() };
+        arrays.axis[1] = { nullptr, soaFixedY.data() };
+        arrays.axis[2] = { nullptr, soaFixedZ.data() };
+    } else {
+        soaX.resize(n); soaY.resize(n); soaZ.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            soaX[i] = particles[i].x;
+            soaY[i] = particles[i].y;
+            soaZ[i] = particles[i].z;
+        }
+        arrays.axis[0] = { soaX.data(), nullptr };
+        arrays.axis[1] = { soaY.data(), nullptr };
+        arrays.axis[2] = { soaZ.data(), nullptr };
+    }
+
+    // Delaunay pairs, plus the contacts they may miss, unless most particles moved
+    // too far (the list is then dropped until the next steering pass)
+    auto run = [&](const auto& potential) {
+        bool usePairList = false;
+        if (!pairList.empty()) {
+            usePairList = collectUncoveredContacts(potential.rangeFactor());
+            if (usePairList) {
+                ++pairListFrames;
+            } else {
+                ++pairListFallbacks;
+                pairList.clear();
+            }
+        }
+        if (usePairList && fixedPoint) {
+            repulsionPairList<true>(arrays, pairList.data(), pairList.size() / 2, potential, dt);
+            repulsionPairList<true>(arrays, pairExtra.data(), pairExtra.size() / 2, potential, dt);
+        } else if (usePairList) {
+            repulsionPairList<false>(arrays, pairList.data(), pairList.size() / 2, potential, dt);
+            repulsionPairList<false>(arrays, pairExtra.data(), pairExtra.size() / 2, potential, dt);
+        } else if (fixedPoint) {
+            repulsionPairs<true>(arrays, n, potential, dt);
+        } else {
+            repulsionPairs<false>(arrays, n, potential, dt);
+        }
+    };
+
+    // One kernel instantiation per potential, chosen once per update
+    switch (pairPotential) {
+    case POTENTIAL_HERTZ:
+        run(HertzPotential{ repulsionStrength });
+        break;
+    case POTENTIAL_COHESIVE:
+        run(CohesivePotential{ repulsionStrength, cohesionStrength, cohesionRange });
+        break;
+    case POTENTIAL_WCA:
+        run(WcaPotential{ repulsionStrength });
+        break;
+    case POTENTIAL_TABULATED:
+        if (potentialTable.size() >= 2) {
+            run(TabulatedPotential{ repulsionStrength, potentialTable.data(), potentialTable.size(), potentialTableRange });
+        } else {
+            run(LinearSpringPotential{ repulsionStrength }); // no table yet
+        }
+        break;
+    default:
+        run(LinearSpringPotential{ repulsionStrength });
+        break;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        particles[i].vx = soaVx[i];
+        particles[i].vy = soaVy[i];
+        particles[i].vz = soaVz[i];
+    }
+}
+
 std::size_t ParticleSystem::getParticleCount() const {
     return particles.size();
 }
@@ -199,136 +763,243 @@ float* ParticleSystem::getFacePositionBufferPtr() { return facePositions.empty()
 float* ParticleSystem::getFaceNormalBufferPtr() { return faceNormals.empty() ? nullptr : faceNormals.data(); }
 float* ParticleSystem::getFaceAxisBufferPtr() { return faceAxes.empty() ? nullptr : faceAxes.data(); }
 
+uint32_t* ParticleSystem::getFaceDirtyRangeBufferPtr() {
+    return faceDirtyRanges.empty() ? nullptr : faceDirtyRanges.data();
+}
+
+uint32_t* ParticleSystem::getCellPolygonOffsetBufferPtr() {
+    return cellPolygonOffsets.empty() ? nullptr : cellPolygonOffsets.data();
+}
+
+float* ParticleSystem::getCellPolygonVertexBufferPtr() {
+    return cellPolygonVertices.empty() ? nullptr : cellPolygonVertices.data();
+}
+
+uint32_t* ParticleSystem::getContactPairBufferPtr() {
+    return contactPairs.empty() ? nullptr : contactPairs.data();
+}
+
+float* ParticleSystem::getContactOverlapBufferPtr() {
+    return contactOverlaps.empty() ? nullptr : contactOverlaps.data();
+}
+
+float* ParticleSystem::getContactForceBufferPtr() {
+    return contactForces.empty() ? nullptr : contactForces.data();
+}
+
+int8_t* ParticleSystem::getContactOffsetBufferPtr() {
+    return contactOffsets.empty() ? nullptr : contactOffsets.data();
+}
+
+uint32_t* ParticleSystem::getCoordinationBufferPtr() {
+    return coordination.empty() ? nullptr : coordination.data();
+}
+
+uint32_t* ParticleSystem::getFixedPositionBufferPtr() {
+    return fixedPositions.empty() ? nullptr : fixedPositions.data();
+}
+
 void ParticleSystem::applyVoronoiSteering(float dt) {
     const std::size_t n = particles.size();
     if (n < 4) return; // Need tetrahedra
 
-    // Build point array for Geogram (double precision)
-    std::vector<double> verts;
-    verts.resize(n * 3);
-    for (std::size_t i = 0; i < n; ++i) {
-        verts[i * 3 + 0] = static_cast<double>(particles[i].x);
-        verts[i * 3 + 1] = static_cast<double>(particles[i].y);
-        verts[i * 3 + 2] = static_cast<double>(particles[i].z);
-    }
+    // Point array for Geogram (double precision), read in place from the particles,
+    // or the exact fixed-point coordinates
+    static_assert(sizeof(Particle) % sizeof(float) == 0, "Particle is read as a strided float array");
+    const double* verts = fixedPoint ? delaunayInput.assign(fixedPositions.data(), n, 3)
+                                     : delaunayInput.assign(&particles[0].x, n, sizeof(Particle) / sizeof(float), true);
 
-    // Ensure Geogram is initialized (idempotent)
-    static bool g_geogram_initialized_ps = false;
-    if (!g_geogram_initialized_ps) {
-        GEO::initialize();
-        g_geogram_initialized_ps = true;
-    }
+    // Ensure Geogram is initialized (shared guard, see GeogramInit.h)
+    initialize_geogram();
 
     // Construct periodic Delaunay
     std::unique_ptr<GEO::PeriodicDelaunay3d> delaunay;
     delaunay = std::make_unique<GEO::PeriodicDelaunay3d>(GEO::vec3(1.0, 1.0, 1.0));
     delaunay->set_stores_cicl(false);
-    delaunay->set_vertices(static_cast<int>(n), verts.data());
+    delaunay->set_vertices(static_cast<int>(n), verts);
+    if (periodicWarmStart && periodicInstances.size() == n) {
+        // Band of about half a mean spacing around the box: the copies of the
+        // particles that moved into it are inserted up front rather than repaired
+        delaunay->set_periodic_warm_start(periodicInstances.data(), 0.5 / std::cbrt(double(n)));
+    }
     try {
         delaunay->compute();
     } catch (...) {
+        periodicInstances.clear();
         return; // Fail silently this frame
     }
+    if (periodicWarmStart) {
+        const GEO::vector<GEO::Numeric::uint32>& instances = delaunay->periodic_vertex_instances();
+        periodicInstances.assign(instances.begin(), instances.end());
+    }
 
     const int numTets = delaunay->nb_cells();
     if (numTets <= 0) return;
 
-    // For each particle, store circumcenters of incident tetrahedra (unwrapped around the particle)
-    std::vector<std::vector<Eigen::Vector3f>> cellCenters(n);
-
-    auto toVec3 = [](float x, float y, float z) -> GEO::vec3 { return GEO::vec3(double(x), double(y), double(z)); };
-
+    // Canonical tet keys (particle indices, sorted), in sorted order: stars are then
+    // listed in the same order whatever order Geogram produced the tets in
+    newTetKeys.resize(std::size_t(numTets));
     for (int t = 0; t < numTets; ++t) {
-        int vIdx[4];
+        TetKey& key = newTetKeys[std::size_t(t)];
         for (int k = 0; k < 4; ++k) {
-            vIdx[k] = delaunay->cell_vertex(t, k);
+            // Map to base indices in [0, n)
+            const int vi = delaunay->cell_vertex(t, k);
+            key.v[k] = (vi < 0) ? 0u : uint32_t(vi % int(n));
         }
+        std::sort(key.v, key.v + 4);
+    }
+    std::sort(newTetKeys.begin(), newTetKeys.end());
 
-        // Map to base indices in [0, n)
-        int base[4];
-        for (int k = 0; k < 4; ++k) {
-            int vi = vIdx[k];
-            if (vi < 0) { base[k] = 0; } else { base[k] = vi % int(n); }
+    // Diff against the previous pass: the particles of added or removed tets have a new star
+    const bool rebuild = (starOffsets.size() != n + 1);
+    starChanged.assign(n, rebuild ? 1 : 0);
+    oldToNewTet.assign(tetKeys.size(), 0u);
+    if (!rebuild) {
+        auto markChanged = [&](const TetKey& key) {
+            for (int k = 0; k < 4; ++k) starChanged[key.v[k]] = 1;
+        };
+        std::size_t o = 0;
+        std::size_t m = 0;
+        while (o < tetKeys.size() && m < newTetKeys.size()) {
+            if (tetKeys[o] < newTetKeys[m]) {
+                markChanged(tetKeys[o++]);
+            } else if (newTetKeys[m] < tetKeys[o]) {
+                markChanged(newTetKeys[m++]);
+            } else {
+                oldToNewTet[o++] = uint32_t(m++);
+            }
         }
+        for (; o < tetKeys.size(); ++o) markChanged(tetKeys[o]);
+        for (; m < newTetKeys.size(); ++m) markChanged(newTetKeys[m]);
+    }
+    changedStarCount = std::size_t(std::count(starChanged.begin(), starChanged.end(), 1));
 
-        // Base positions
+    // Circumcenters of every tet unwrapped around each of its vertices (geometry is
+    // refreshed for all the stars, only their structure is kept)
+    tetCenters.resize(std::size_t(numTets) * 12u);
+    for (std::size_t t = 0; t < newTetKeys.size(); ++t) {
         Eigen::Vector3f p[4];
         for (int k = 0; k < 4; ++k) {
-            p[k].x() = particles[base[k]].x;
-            p[k].y() = particles[base[k]].y;
-            p[k].z() = particles[base[k]].z;
-        }
-
-        // For each vertex in the tetrahedron, compute circumcenter unwrapped around that vertex's particle
-        for (int local = 0; local < 4; ++local) {
-            const int particleIndex = base[local];
-            const Eigen::Vector3f pi(particleIndex >= 0 ? particles[particleIndex].x : 0.0f,
-                                     particleIndex >= 0 ? particles[particleIndex].y : 0.0f,
-                                     particleIndex >= 0 ? particles[particleIndex].z : 0.0f);
-
-            // Unwrap other vertices around pi using minimum-image convention
-            Eigen::Vector3f q[4];
-            for (int m = 0; m < 4; ++m) {
-                Eigen::Vector3f d = p[m] - pi;
-                d.x() -= std::round(d.x());
-                d.y() -= std::round(d.y());
-                d.z() -= std::round(d.z());
-                q[m] = pi + d;
-            }
+            const Particle& q = particles[newTetKeys[t].v[k]];
+            p[k] = Eigen::Vector3f(q.x, q.y, q.z);
+        }
+        Eigen::Vector3f centers[4];
+        computeUnwrappedCircumcenters(p, centers);
+        float* out = &tetCenters[12u * t];
+        for (int k = 0; k < 4; ++k) {
+            for (int c = 0; c < 3; ++c) *out++ = centers[k][c];
+        }
+    }
 
-            // Compute circumcenter (Eigen-based)
-            Eigen::Vector3f center = computeTetraCircumcenter(q[0], q[1], q[2], q[3]);
-            cellCenters[particleIndex].push_back(center);
+    // Stars (CSR, entry = 4 * tet + local vertex): unchanged ones are renumbered,
+    // changed ones are collected again from the new tets
+    newStarOffsets.assign(n + 1, 0u);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!starChanged[i]) newStarOffsets[i + 1] = starOffsets[i + 1] - starOffsets[i];
+    }
+    for (const TetKey& key : newTetKeys) {
+        for (int k = 0; k < 4; ++k) {
+            if (starChanged[key.v[k]]) ++newStarOffsets[key.v[k] + 1];
         }
     }
+    for (std::size_t i = 0; i < n; ++i) newStarOffsets[i + 1] += newStarOffsets[i];
+    newStarEntries.resize(newStarOffsets[n]);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (starChanged[i]) continue;
+        uint32_t* out = &newStarEntries[newStarOffsets[i]];
+        for (uint32_t e = starOffsets[i]; e < starOffsets[i + 1]; ++e) {
+            *out++ = 4u * oldToNewTet[starEntries[e] / 4u] + starEntries[e] % 4u;
+        }
+    }
+    starCursor.assign(newStarOffsets.begin(), newStarOffsets.end() - 1);
+    for (std::size_t t = 0; t < newTetKeys.size(); ++t) {
+        for (uint32_t k = 0; k < 4; ++k) {
+            const uint32_t v = newTetKeys[t].v[k];
+            if (starChanged[v]) newStarEntries[starCursor[v]++] = 4u * uint32_t(t) + k;
+        }
+    }
+    tetKeys.swap(newTetKeys);
+    starOffsets.swap(newStarOffsets);
+    starEntries.swap(newStarEntries);
+    if (delaunayPairList) buildPairList();
 
-    // Apply PCA per particle to get the principal axis and steer velocity
+    // Circumcenters of the star of particle i, in star order
+    std::vector<Eigen::Vector3f> centers;
+    auto gatherStar = [&](std::size_t i) {
+        centers.clear();
+        for (uint32_t e = starOffsets[i]; e < starOffsets[i + 1]; ++e) {
+            centers.push_back(Eigen::Map<const Eigen::Vector3f>(&tetCenters[3u * starEntries[e]]));
+        }
+    };
+
+    // Covariance of every star with at least a few samples (of its circumcenters,
+    // read in place, or of its cell), then the principal axes of all of them in one batch
+    pcaParticles.clear();
     for (std::size_t i = 0; i < n; ++i) {
-        const auto& centers = cellCenters[i];
-        if (centers.size() < 4) continue; // Need at least a few samples
-
-        // Compute mean
-        Eigen::Vector3f mean(0.0f, 0.0f, 0.0f);
-        for (const auto& c : centers) mean += c;
-        mean /= float(centers.size());
-
-        // Covariance
-        Eigen::Matrix3f cov = Eigen::Matrix3f::Zero();
-        for (const auto& c : centers) {
-            Eigen::Vector3f d = c - mean;
-            cov += d * d.transpose();
-        }
-        cov /= std::max(1, int(centers.size() - 1));
-
-        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3f> solver(cov);
-        if (solver.info() != Eigen::Success) continue;
-        Eigen::Vector3f eigenvalues = solver.eigenvalues();
-        Eigen::Matrix3f eigenvectors = solver.eigenvectors();
-
-        // Index of max eigenvalue (largest principal component)
-        int idx = 0;
-        if (eigenvalues[1] > eigenvalues[idx]) idx = 1;
-        if (eigenvalues[2] > eigenvalues[idx]) idx = 2;
-        
-        float maxEigenvalue = eigenvalues[idx];
-        Eigen::Vector3f principalAxis = eigenvectors.col(idx).normalized();
+        if (starOffsets[i + 1] - starOffsets[i] >= 4) pcaParticles.push_back(uint32_t(i));
+    }
+    const std::size_t nbPca = pcaParticles.size();
+    pcaBatch.resize(nbPca);
+    pcaMeans.resize(3u * nbPca);
+    pcaResiduals.resize(3u * nbPca);
+    if (steeringSource != STEERING_CIRCUMCENTERS) {
+        computeCellMoments(steeringSource == STEERING_LAGUERRE_INERTIA);
+    } else {
+        for (std::size_t b = 0; b < nbPca; ++b) {
+            const uint32_t first = starOffsets[pcaParticles[b]];
+            const uint32_t last = starOffsets[pcaParticles[b] + 1];
+            float* mean = &pcaMeans[3 * b];
+            mean[0] = mean[1] = mean[2] = 0.0f;
+            for (uint32_t e = first; e < last; ++e) {
+                const float* c = &tetCenters[3u * starEntries[e]];
+                for (int k = 0; k < 3; ++k) mean[k] += c[k];
+            }
+            for (int k = 0; k < 3; ++k) mean[k] /= float(last - first);
 
-        // Compute axis length from eigenvalue (square root gives standard deviation along axis)
-        float axisLength = std::sqrt(std::max(0.0f, maxEigenvalue));
-        
-        // Determine skewness/asymmetry by checking distribution of points along axis
-        float skewness = 0.0f;
-        for (const auto& c : centers) {
-            Eigen::Vector3f d = c - mean;
-            skewness += d.dot(principalAxis);
+            // Covariance, and the sum of the deviations for the axis direction below
+            float xx = 0.0f, xy = 0.0f, xz = 0.0f, yy = 0.0f, yz = 0.0f, zz = 0.0f;
+            float* residual = &pcaResiduals[3 * b];
+            residual[0] = residual[1] = residual[2] = 0.0f;
+            for (uint32_t e = first; e < last; ++e) {
+                const float* c = &tetCenters[3u * starEntries[e]];
+                const float dx = c[0] - mean[0];
+                const float dy = c[1] - mean[1];
+                const float dz = c[2] - mean[2];
+                xx += dx * dx; xy += dx * dy; xz += dx * dz;
+                yy += dy * dy; yz += dy * dz; zz += dz * dz;
+                residual[0] += dx; residual[1] += dy; residual[2] += dz;
+            }
+            const float norm = 1.0f / float(std::max(1, int(last - first) - 1));
+            pcaBatch.set(b, xx * norm, xy * norm, xz * norm, yy * norm, yz * norm, zz * norm);
         }
-        skewness /= float(centers.size());
-        
-        // Disambiguate direction: if skewness is negative, flip axis
-        if (skewness < 0.0f) {
-            principalAxis = -principalAxis;
+    }
+    pcaBatch.solve();
+
+    // Steer each particle along its principal axis
+    for (std::size_t b = 0; b < nbPca; ++b) {
+        const std::size_t i = pcaParticles[b];
+        const Eigen::Vector3f mean(pcaMeans[3 * b], pcaMeans[3 * b + 1], pcaMeans[3 * b + 2]);
+        Eigen::Vector3f principalAxis(pcaBatch.axis(b, 0), pcaBatch.axis(b, 1), pcaBatch.axis(b, 2));
+
+        // No axis for a flat sample or an empty cell: clear the previous one, and
+        // collapse the segment to the mean (the particle itself for an empty cell)
+        if (!(pcaBatch.eigenvalue(b, 0) > 0.0f)) {
+            for (int k = 0; k < 3; ++k) {
+                axes[i * 3u + k] = 0.0f;
+                axisSegments[i * 6u + k] = mean[k];
+                axisSegments[i * 6u + 3u + k] = mean[k];
+            }
+            continue;
         }
 
+        // Square root of the eigenvalue: standard deviation along the axis
+        const float axisLength = std::sqrt(std::max(0.0f, pcaBatch.eigenvalue(b, 0)));
+
+        // Direction: flipped if the deviations along the axis sum to a negative value
+        // (the skewness test of principalAxis3d()), or toward the cell centroid
+        const Eigen::Vector3f residual(pcaResiduals[3 * b], pcaResiduals[3 * b + 1], pcaResiduals[3 * b + 2]);
+        if (residual.dot(principalAxis) < 0.0f) principalAxis = -principalAxis;
+
         // Apply steering as acceleration
         particles[i].vx += steeringStrength * principalAxis.x() * dt;
         particles[i].vy += steeringStrength * principalAxis.y() * dt;
@@ -354,53 +1025,450 @@ void ParticleSystem::applyVoronoiSteering(float dt) {
     }
 
     // Optional: very lightweight face triangulation per particle
-    // We approximate faces by creating a star from the mean of its circumcenters
+    // We approximate faces by creating a star from the mean of its circumcenters.
+    // Each particle owns a slot of the face buffers; the slots of unchanged stars keep
+    // their place and only get new geometry. A slot is reported dirty when any of its
+    // values differs from the previous pass.
+    layoutFaceSlots();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t first = 3u * faceSlotOffsets[i];
+        const std::size_t last = first + 3u * faceSlotCapacities[i];
+        float* positionOut = facePositions.data() + first;
+        float* normalOut = faceNormals.data() + first;
+        float* axisOut = faceAxes.data() + first;
+        bool slotChanged = false;
+        auto put = [&](float*& out, float value) {
+            slotChanged = slotChanged || (*out != value);
+            *out++ = value;
+        };
+
+        gatherStar(i);
+        if (centers.size() >= 3) {
+            // Compute center and normal by PCA again (largest axis gives orientation; use second/third for plane)
+            Eigen::Vector3f mean(0,0,0);
+            for (const auto& c : centers) mean += c;
+            mean /= float(centers.size());
+
+            // Compute a rough normal as average of triangle normals to mean
+            Eigen::Vector3f normal(0,0,0);
+            for (size_t k = 0; k + 2 < centers.size(); ++k) {
+                Eigen::Vector3f a = centers[k] - mean;
+                Eigen::Vector3f b = centers[k+1] - mean;
+                normal += a.cross(b);
+            }
+            if (normal.norm() == 0.0f) normal = Eigen::Vector3f(0,0,1);
+            normal.normalize();
+
+            auto emit = [&](const Eigen::Vector3f& position) {
+                put(positionOut, position.x()); put(positionOut, position.y()); put(positionOut, position.z());
+                put(normalOut, normal.x()); put(normalOut, normal.y()); put(normalOut, normal.z());
+                put(axisOut, axes[i * 3u + 0u]); put(axisOut, axes[i * 3u + 1u]); put(axisOut, axes[i * 3u + 2u]);
+            };
+
+            // Triangle fan around mean: (mean, c0, c1)
+            for (size_t k = 0; k < centers.size(); ++k) {
+                emit(mean);
+                emit(centers[k]);
+                emit(centers[(k+1) % centers.size()]);
+            }
+        }
+
+        // Unused capacity: degenerate (zero-area) triangles
+        auto nonZero = [](float value) { return value != 0.0f; };
+        slotChanged = slotChanged || std::any_of(positionOut, facePositions.data() + last, nonZero) ||
+                      std::any_of(normalOut, faceNormals.data() + last, nonZero) ||
+                      std::any_of(axisOut, faceAxes.data() + last, nonZero);
+        std::fill(positionOut, facePositions.data() + last, 0.0f);
+        std::fill(normalOut, faceNormals.data() + last, 0.0f);
+        std::fill(axisOut, faceAxes.data() + last, 0.0f);
+        if (slotChanged && !faceLayoutReset) addFaceDirtyRange(faceSlotOffsets[i], faceSlotCapacities[i]);
+    }
+}
+
+void ParticleSystem::computeCellMoments(bool weighted) {
+    const std::size_t nbPca = pcaParticles.size();
+    GEO::parallel_for_slice(0, GEO::index_t(nbPca), [&](GEO::index_t begin, GEO::index_t end) {
+        GEO::ConvexCell C;
+        std::vector<uint32_t> neighbors;
+        std::vector<GEO::vec4> planes;
+        for (GEO::index_t b = begin; b < end; ++b) {
+            const uint32_t i = pcaParticles[b];
+            const Particle& pi = particles[i];
+
+            // Delaunay neighbors: the other vertices of the star tets
+            neighbors.clear();
+            for (uint32_t e = starOffsets[i]; e < starOffsets[i + 1]; ++e) {
+                const TetKey& key = tetKeys[starEntries[e] / 4u];
+                for (int k = 0; k < 4; ++k) {
+                    if (key.v[k] != i) neighbors.push_back(key.v[k]);
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+            // (Power) bisectors relative to the particle, with the minimum-image
+            // neighbor d: |x|^2 - wi <= |x - d|^2 - wj. The unit cube centered on
+            // the particle bounds its cell on the torus.
+            const double wi = weighted ? double(pi.radius) * double(pi.radius) : 0.0;
+            planes.clear();
+            for (uint32_t j : neighbors) {
+                const Particle& pj = particles[j];
+                double d[3] = { double(pj.x) - double(pi.x), double(pj.y) - double(pi.y),
+                                double(pj.z) - double(pi.z) };
+                for (double& dc : d) dc -= std::nearbyint(dc);
+                const double wj = weighted ? double(pj.radius) * double(pj.radius) : 0.0;
+                planes.push_back(GEO::vec4(-2.0 * d[0], -2.0 * d[1], -2.0 * d[2],
+                                           d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + wi - wj));
+            }
+            C.init_with_box(-0.5, -0.5, -0.5, 0.5, 0.5, 0.5);
+            C.clip_by_planes(GEO::vec3(0.0, 0.0, 0.0), GEO::index_t(planes.size()), planes.data());
+
+            double m = 0.0;
+            GEO::vec3 mg(0.0, 0.0, 0.0);
+            double I[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+            if (!C.empty()) {
+                C.compute_geometry();
+                C.compute_second_moments(m, mg, I);
+            }
+            float* center = &pcaMeans[3 * b];
+            float* toCentroid = &pcaResiduals[3 * b];
+            if (!(m > 0.0)) {
+                // Empty (power) cell: zero covariance, no axis
+                pcaBatch.set(b, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+                center[0] = pi.x; center[1] = pi.y; center[2] = pi.z;
+                toCentroid[0] = toCentroid[1] = toCentroid[2] = 0.0f;
+                continue;
+            }
+
+            // Covariance of the solid cell about its centroid g
+            const GEO::vec3 g = (1.0 / m) * mg;
+            pcaBatch.set(b, float(I[0] / m - g.x * g.x), float(I[1] / m - g.x * g.y), float(I[2] / m - g.x * g.z),
+                         float(I[3] / m - g.y * g.y), float(I[4] / m - g.y * g.z), float(I[5] / m - g.z * g.z));
+            center[0] = pi.x + float(g.x);
+            center[1] = pi.y + float(g.y);
+            center[2] = pi.z + float(g.z);
+            toCentroid[0] = float(g.x);
+            toCentroid[1] = float(g.y);
+            toCentroid[2] = float(g.z);
+        }
+    });
+}
+
+void ParticleSystem::buildPairList() {
+    const std::size_t n = particles.size();
+
+    // Unique edges of the tets (i < j, the keys are sorted)
+    pairList.clear();
+    for (const TetKey& key : tetKeys) {
+        for (int a = 0; a < 4; ++a) {
+            for (int b = a + 1; b < 4; ++b) {
+                if (key.v[a] == key.v[b]) continue;
+                pairList.push_back(key.v[a]);
+                pairList.push_back(key.v[b]);
+            }
+        }
+    }
+    {
+        // Sort and dedupe the pairs as 64-bit keys
+        std::vector<uint64_t> keys(pairList.size() / 2);
+        for (std::size_t p = 0; p < keys.size(); ++p) {
+            keys[p] = (uint64_t(pairList[2 * p]) << 32) | pairList[2 * p + 1];
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        pairList.resize(2 * keys.size());
+        for (std::size_t p = 0; p < keys.size(); ++p) {
+            pairList[2 * p] = uint32_t(keys[p] >> 32);
+            pairList[2 * p + 1] = uint32_t(keys[p]);
+        }
+    }
+
+    // Adjacency (CSR, both directions)
+    pairAdjacencyOffsets.assign(n + 1, 0u);
+    for (uint32_t v : pairList) ++pairAdjacencyOffsets[v + 1];
+    for (std::size_t i = 0; i < n; ++i) pairAdjacencyOffsets[i + 1] += pairAdjacencyOffsets[i];
+    pairAdjacency.resize(pairList.size());
+    starCursor.assign(pairAdjacencyOffsets.begin(), pairAdjacencyOffsets.end() - 1);
+    for (std::size_t p = 0; p < pairList.size(); p += 2) {
+        pairAdjacency[starCursor[pairList[p]]++] = pairList[p + 1];
+        pairAdjacency[starCursor[pairList[p + 1]]++] = pairList[p];
+    }
+
+    // Clearance of i. A particle m that is not a neighbor of i lies outside the
+    // cells of i and of its neighbors, so the segment from i to m crosses a cell
+    // k of the second ring (touching cells are Delaunay neighbors): |pi - pm| is
+    // at least the distance from pi to the closest of those cells. Cell k is on
+    // its side of its bisector with i and with each neighbor j of i adjacent to
+    // k, the farthest of these half-spaces bounds its distance.
+    pairListPositions.resize(3 * n);
+    pairListClearances.resize(n);
+    pairStamps.assign(n, uint32_t(-1));
+    pairRingBounds.resize(n);
+    auto minimumImage = [](double d) { return d - std::nearbyint(d); };
+    for (std::size_t i = 0; i < n; ++i) {
+        const Particle& pi = particles[i];
+        pairListPositions[3 * i] = pi.x;
+        pairListPositions[3 * i + 1] = pi.y;
+        pairListPositions[3 * i + 2] = pi.z;
+        auto offset = [&](uint32_t k, double d[3]) {
+            d[0] = minimumImage(double(particles[k].x) - pi.x);
+            d[1] = minimumImage(double(particles[k].y) - pi.y);
+            d[2] = minimumImage(double(particles[k].z) - pi.z);
+            return d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+        };
+
+        // Stamps: 2k for i and its neighbors, 2k + 1 for the second ring
+        const uint32_t first = pairAdjacencyOffsets[i];
+        const uint32_t last = pairAdjacencyOffsets[i + 1];
+        pairStamps[i] = uint32_t(2 * i);
+        for (uint32_t a = first; a < last; ++a) pairStamps[pairAdjacency[a]] = uint32_t(2 * i);
+        pairRing.clear();
+        for (uint32_t a = first; a < last; ++a) {
+            const uint32_t j = pairAdjacency[a];
+            double dj[3];
+            const double dj2 = offset(j, dj);
+            for (uint32_t b = pairAdjacencyOffsets[j]; b < pairAdjacencyOffsets[j + 1]; ++b) {
+                const uint32_t k = pairAdjacency[b];
+                if (pairStamps[k] == uint32_t(2 * i)) continue;
+                double dk[3];
+                const double dk2 = offset(k, dk);
+                if (pairStamps[k] != uint32_t(2 * i + 1)) {
+                    pairStamps[k] = uint32_t(2 * i + 1);
+                    pairRingBounds[k] = 0.5 * std::sqrt(dk2);
+                    pairRing.push_back(k);
+                }
+                const double e[3] = { dk[0] - dj[0], dk[1] - dj[1], dk[2] - dj[2] };
+                const double e2 = e[0] * e[0] + e[1] * e[1] + e[2] * e[2];
+                if (e2 > 0.0) pairRingBounds[k] = std::max(pairRingBounds[k], (dk2 - dj2) / (2.0 * std::sqrt(e2)));
+            }
+        }
+        double clearance = std::numeric_limits<double>::max();
+        for (uint32_t k : pairRing) clearance = std::min(clearance, pairRingBounds[k]);
+        pairListClearances[i] = float(clearance);
+    }
+}
+
+bool ParticleSystem::collectUncoveredContacts(float rangeFactor) {
+    const std::size_t n = particles.size();
+    pairExtra.clear();
+    if (pairListClearances.size() != n) return false;
+    auto displacement = [&](std::size_t i) {
+        float d2 = 0.0f;
+        const float p[3] = { particles[i].x, particles[i].y, particles[i].z };
+        for (int c = 0; c < 3; ++c) {
+            float d = p[c] - pairListPositions[3 * i + c];
+            d -= std::round(d);
+            d2 += d * d;
+        }
+        return std::sqrt(d2);
+    };
+
+    // Particle k out of the list of i: |pi - pk| >= clearance(i) - disp(i) - disp(k)
+    // stays beyond the range (r(i) + r(k)) * rangeFactor of the potential while i is
+    // covered, with a small relative margin for the float rounding. A missed contact
+    // needs two uncovered particles.
+    float maxDisplacement = 0.0f;
+    float maxRadius = 0.0f;
+    for (std::size_t i = 0; i < n; ++i) {
+        maxDisplacement = std::max(maxDisplacement, displacement(i));
+        maxRadius = std::max(maxRadius, particles[i].radius);
+    }
+    pairUncovered.clear();
+    for (std::size_t i = 0; i < n; ++i) {
+        const float reach = displacement(i) + maxDisplacement + (particles[i].radius + maxRadius) * rangeFactor;
+        if (!(reach * 1.0001f < pairListClearances[i])) pairUncovered.push_back(uint32_t(i));
+    }
+    if (2 * pairUncovered.size() > n) return false;
+
+    // Contacts between uncovered particles that are not Delaunay edges
+    for (std::size_t a = 0; a < pairUncovered.size(); ++a) {
+        const uint32_t i = pairUncovered[a];
+        for (uint32_t e = pairAdjacencyOffsets[i]; e < pairAdjacencyOffsets[i + 1]; ++e) {
+            pairStamps[pairAdjacency[e]] = uint32_t(2 * i);
+        }
+        for (std::size_t b = a + 1; b < pairUncovered.size(); ++b) {
+            const uint32_t k = pairUncovered[b];
+            if (pairStamps[k] == uint32_t(2 * i)) continue;
+            float d2 = 0.0f;
+            const float d[3] = { particles[k].x - particles[i].x, particles[k].y - particles[i].y,
+                                 particles[k].z - particles[i].z };
+            for (float dc : d) {
+                dc -= std::round(dc);
+                d2 += dc * dc;
+            }
+            const float cutoff = (particles[i].radius + particles[k].radius) * rangeFactor * 1.0001f;
+            if (d2 < cutoff * cutoff) {
+                pairExtra.push_back(i);
+                pairExtra.push_back(k);
+            }
+        }
+    }
+    return true;
+}
+
+void ParticleSystem::applyVoronoiSteering2d(float dt) {
+    const std::size_t n = particles.size();
+    if (n < 3) return; // Need triangles
+
+    // x,y for the 2D triangulation (exact in fixed point)
+    delaunayInput2d.resize(2u * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (fixedPoint) {
+            delaunayInput2d[2 * i] = double(fixedPositions[3 * i]) / FIXED_SCALE;
+            delaunayInput2d[2 * i + 1] = double(fixedPositions[3 * i + 1]) / FIXED_SCALE;
+        } else {
+            delaunayInput2d[2 * i] = double(particles[i].x);
+            delaunayInput2d[2 * i + 1] = double(particles[i].y);
+        }
+    }
+
+    // Ensure Geogram is initialized (shared guard, see GeogramInit.h)
+    initialize_geogram();
+    if (!delaunay2d.compute(delaunayInput2d.data(), n, true)) return;
+
+    const uint32_t* offsets = delaunay2d.getCellOffsetBufferPtr();
+    const double* vertices = delaunay2d.getCellVertexBufferPtr();
+    cellPolygonOffsets.assign(offsets, offsets + n + 1);
+    cellPolygonVertices.assign(vertices, vertices + 2u * delaunay2d.getCellVertexCount());
+
+    // Faces are rebuilt whole, there is no slot layout to keep in 2D
+    resetSteeringTopology();
+    changedStarCount = n;
+    faceLayoutReset = true;
     facePositions.clear();
     faceNormals.clear();
     faceAxes.clear();
-    facePositions.reserve(n * 3 * 6); // rough reserve
-    faceNormals.reserve(n * 3 * 6);
-    faceAxes.reserve(n * 3 * 6);
 
     for (std::size_t i = 0; i < n; ++i) {
-        const auto& centers = cellCenters[i];
-        if (centers.size() < 3) continue;
-        // Compute center and normal by PCA again (largest axis gives orientation; use second/third for plane)
-        Eigen::Vector3f mean(0,0,0);
-        for (const auto& c : centers) mean += c;
-        mean /= float(centers.size());
-
-        // Compute a rough normal as average of triangle normals to mean
-        Eigen::Vector3f normal(0,0,0);
-        for (size_t k = 0; k + 2 < centers.size(); ++k) {
-            Eigen::Vector3f a = centers[k] - mean;
-            Eigen::Vector3f b = centers[k+1] - mean;
-            normal += a.cross(b);
-        }
-        if (normal.norm() == 0.0f) normal = Eigen::Vector3f(0,0,1);
-        normal.normalize();
-
-        // Triangle fan around mean
-        for (size_t k = 0; k < centers.size(); ++k) {
-            const Eigen::Vector3f& c0 = centers[k];
-            const Eigen::Vector3f& c1 = centers[(k+1) % centers.size()];
-            // push triangle (mean, c0, c1)
-            const float ax = axes[i * 3u + 0u];
-            const float ay = axes[i * 3u + 1u];
-            const float az = axes[i * 3u + 2u];
-            // mean
-            facePositions.insert(facePositions.end(), { mean.x(), mean.y(), mean.z() });
-            faceNormals.insert(faceNormals.end(), { normal.x(), normal.y(), normal.z() });
-            faceAxes.insert(faceAxes.end(), { ax, ay, az });
-            // c0
-            facePositions.insert(facePositions.end(), { c0.x(), c0.y(), c0.z() });
-            faceNormals.insert(faceNormals.end(), { normal.x(), normal.y(), normal.z() });
-            faceAxes.insert(faceAxes.end(), { ax, ay, az });
-            // c1
-            facePositions.insert(facePositions.end(), { c1.x(), c1.y(), c1.z() });
-            faceNormals.insert(faceNormals.end(), { normal.x(), normal.y(), normal.z() });
-            faceAxes.insert(faceAxes.end(), { ax, ay, az });
+        const std::size_t count = offsets[i + 1] - offsets[i];
+        if (count < 3) continue; // Need a polygon
+        const double* polygon = vertices + 2u * offsets[i];
+
+        // Mean and covariance of the polygon vertices (the Voronoi vertices)
+        Eigen::Vector2f mean(0.0f, 0.0f);
+        for (std::size_t k = 0; k < count; ++k) mean += Eigen::Vector2f(float(polygon[2 * k]), float(polygon[2 * k + 1]));
+        mean /= float(count);
+        float sxx = 0.0f, sxy = 0.0f, syy = 0.0f;
+        for (std::size_t k = 0; k < count; ++k) {
+            const float dx = float(polygon[2 * k]) - mean.x();
+            const float dy = float(polygon[2 * k + 1]) - mean.y();
+            sxx += dx * dx;
+            sxy += dx * dy;
+            syy += dy * dy;
+        }
+        const float norm = 1.0f / float(count - 1);
+        sxx *= norm;
+        sxy *= norm;
+        syy *= norm;
+
+        // Largest eigenpair of the 2x2 covariance, closed form
+        const float halfTrace = 0.5f * (sxx + syy);
+        const float halfGap = 0.5f * (sxx - syy);
+        const float maxEigenvalue = halfTrace + std::sqrt(halfGap * halfGap + sxy * sxy);
+        Eigen::Vector2f principalAxis = (std::fabs(sxy) > 0.0f)
+            ? Eigen::Vector2f(maxEigenvalue - syy, sxy)
+            : (sxx >= syy ? Eigen::Vector2f(1.0f, 0.0f) : Eigen::Vector2f(0.0f, 1.0f));
+        principalAxis.normalize();
+        const float axisLength = std::sqrt(std::max(0.0f, maxEigenvalue));
+
+        // Disambiguate direction: if skewness is negative, flip axis
+        float skewness = 0.0f;
+        for (std::size_t k = 0; k < count; ++k) {
+            skewness += (Eigen::Vector2f(float(polygon[2 * k]), float(polygon[2 * k + 1])) - mean).dot(principalAxis);
+        }
+        if (skewness < 0.0f) principalAxis = -principalAxis;
+
+        // Apply steering as acceleration (in plane)
+        particles[i].vx += steeringStrength * principalAxis.x() * dt;
+        particles[i].vy += steeringStrength * principalAxis.y() * dt;
+
+        axes[i * 3u + 0u] = principalAxis.x();
+        axes[i * 3u + 1u] = principalAxis.y();
+        axes[i * 3u + 2u] = 0.0f;
+
+        const Eigen::Vector2f halfExtent = 0.5f * axisLength * principalAxis;
+        axisSegments[i * 6u + 0u] = mean.x() - halfExtent.x();
+        axisSegments[i * 6u + 1u] = mean.y() - halfExtent.y();
+        axisSegments[i * 6u + 2u] = 0.0f;
+        axisSegments[i * 6u + 3u] = mean.x() + halfExtent.x();
+        axisSegments[i * 6u + 4u] = mean.y() + halfExtent.y();
+        axisSegments[i * 6u + 5u] = 0.0f;
+
+        // Triangle fan around the mean, in the z = 0 plane
+        auto emit = [&](float x, float y) {
+            facePositions.insert(facePositions.end(), { x, y, 0.0f });
+            faceNormals.insert(faceNormals.end(), { 0.0f, 0.0f, 1.0f });
+            faceAxes.insert(faceAxes.end(), { principalAxis.x(), principalAxis.y(), 0.0f });
+        };
+        for (std::size_t k = 0; k < count; ++k) {
+            const std::size_t next = (k + 1) % count;
+            emit(mean.x(), mean.y());
+            emit(float(polygon[2 * k]), float(polygon[2 * k + 1]));
+            emit(float(polygon[2 * next]), float(polygon[2 * next + 1]));
+        }
+    }
+    faceDirtyRanges.assign({ 0u, uint32_t(facePositions.size() / 3u) });
+}
+
+void ParticleSystem::addFaceDirtyRange(uint32_t first, uint32_t count) {
+    if (count == 0) return;
+    if (!faceDirtyRanges.empty()) {
+        uint32_t& lastCount = faceDirtyRanges.back();
+        if (faceDirtyRanges[faceDirtyRanges.size() - 2] + lastCount == first) {
+            lastCount += count;
+            return;
         }
     }
+    faceDirtyRanges.push_back(first);
+    faceDirtyRanges.push_back(count);
 }
 
+void ParticleSystem::layoutFaceSlots() {
+    const std::size_t n = particles.size();
+    auto required = [&](std::size_t i) -> uint32_t {
+        const uint32_t size = starOffsets[i + 1] - starOffsets[i];
+        return (size >= 3) ? 3u * size : 0u;
+    };
+    faceDirtyRanges.clear();
+    faceLayoutReset = (faceSlotOffsets.size() != n);
+    std::size_t end = facePositions.size() / 3u;
+    if (!faceLayoutReset) {
+        std::size_t live = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (starChanged[i]) {
+                const uint32_t need = required(i);
+                if (need > faceSlotCapacities[i]) {
+                    // Too small: the old slot is cleared and the star moves to the end
+                    const std::size_t first = 3u * faceSlotOffsets[i];
+                    const std::size_t count = 3u * faceSlotCapacities[i];
+                    std::fill_n(facePositions.begin() + first, count, 0.0f);
+                    std::fill_n(faceNormals.begin() + first, count, 0.0f);
+                    std::fill_n(faceAxes.begin() + first, count, 0.0f);
+                    addFaceDirtyRange(faceSlotOffsets[i], faceSlotCapacities[i]);
+                    faceSlotOffsets[i] = uint32_t(end);
+                    faceSlotCapacities[i] = need + FACE_SLOT_SLACK;
+                    end += faceSlotCapacities[i];
+                }
+            }
+            live += faceSlotCapacities[i];
+        }
+        // Too many abandoned slots: repack
+        faceLayoutReset = (end > 2u * live);
+    }
+    if (faceLayoutReset) {
+        faceDirtyRanges.clear();
+        faceSlotOffsets.resize(n);
+        faceSlotCapacities.resize(n);
+        end = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            faceSlotOffsets[i] = uint32_t(end);
+            faceSlotCapacities[i] = required(i) + FACE_SLOT_SLACK;
+            end += faceSlotCapacities[i];
+        }
+        addFaceDirtyRange(0u, uint32_t(end));
+    }
+    facePositions.resize(3u * end, 0.0f);
+    faceNormals.resize(3u * end, 0.0f);
+    faceAxes.resize(3u * end, 0.0f);
+}
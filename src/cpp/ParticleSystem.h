@@ -2,6 +2,13 @@
 
 #include <vector>
 #include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+#include "PointBuffer.h"
+#include "PeriodicDelaunay2d.h"
+#include "SymmetricEigen3.h"
 
 // ParticleSystem implements the simulation core for Cherry Core (soft-sphere repulsion)
 // and will later include Long Axis steering informed by Voronoi cell PCA.
@@ -11,6 +18,13 @@
 // - Start with a simple, robust repulsion step (O(N^2)), replace with spatial index later
 // - Operate in a unit periodic domain [0,1)^3 (minimum image convention for distances)
 // - Provide a minimal embind-friendly API: init, update, get buffer pointer, count
+// - Optional fixed-point positions (uint32 fractions of the box): the periodic
+//   wrap is the integer overflow, minimum-image differences are a signed
+//   subtraction, and Delaunay gets the exact coordinates. Runs are bit-for-bit
+//   reproducible; the float positions are then derived for interop only.
+// - Optional 2D mode for monolayers: particles stay in the z = 0 plane of the
+//   unit square, steering uses PeriodicDelaunay2d and a 2x2 PCA, and the
+//   Voronoi cells are also output as polygons.
 
 struct Particle {
     // Position in unit cube [0,1)^3
@@ -30,6 +44,13 @@ struct Particle {
     int id;
 };
 
+// PCA of a point cloud (count points, x,y,z packed): mean, unit axis of the
+// largest covariance eigenvalue and the standard deviation along it. False if
+// count < 2 or the eigen solver fails. Per-cell reference (Eigen's iterative
+// solver) of the 3D steering, which runs all the cells through
+// SymmetricEigen3Batch.
+bool principalAxis3d(const float* points, std::size_t count, float mean[3], float axis[3], float& deviation);
+
 class ParticleSystem {
 public:
     ParticleSystem();
@@ -60,12 +81,25 @@ public:
     float* getAxisSegmentBufferPtr();
 
     // Voronoi face buffers (triangulated)
-    // Returns total vertex count in the face buffers
+    // Returns total vertex count in the face buffers. Each particle owns a slot
+    // of the buffers, padded with degenerate (zero-area) triangles.
     std::size_t getFaceVertexCount() const { return facePositions.size() / 3u; }
     float* getFacePositionBufferPtr();
     float* getFaceNormalBufferPtr();
     float* getFaceAxisBufferPtr();
 
+    // Topology changes of the last steering pass. Every slot is rewritten in
+    // place, but only the particles whose Delaunay star changed get new
+    // triangles. Dirty ranges are (first vertex, vertex count) pairs covering
+    // the slots whose positions, normals or axes differ from the previous pass
+    // (moved or new stars, and the slots abandoned by stars that outgrew
+    // them); the other vertices are unchanged. After a layout reset the
+    // buffers were reallocated or repacked and must be read again whole.
+    std::size_t getChangedStarCount() const { return changedStarCount; }
+    std::size_t getFaceDirtyRangeCount() const { return faceDirtyRanges.size() / 2u; }
+    uint32_t* getFaceDirtyRangeBufferPtr();
+    bool wasFaceLayoutReset() const { return faceLayoutReset; }
+
     // Parameter setters for live tuning from JS
     void setSteeringStrength(float strength) { steeringStrength = strength; }
     void setRepulsionStrength(float strength) { repulsionStrength = strength; }
@@ -74,6 +108,109 @@ public:
     void setMinSpeed(float v) { minSpeed = v; }
     void setMaxSpeed(float v) { maxSpeed = v; }
 
+    // Fixed-point positions (off by default). Enabling rounds the current
+    // positions to the nearest 2^-32 of the box.
+    void setFixedPoint(bool enabled);
+    bool isFixedPoint() const { return fixedPoint; }
+
+    // 3D steering: seed each triangulation with the periodic copies the
+    // previous one needed (off by default). Same tets, the copies are checked
+    // and completed when particles cross the band.
+    void setPeriodicWarmStart(bool enabled);
+    bool isPeriodicWarmStart() const { return periodicWarmStart; }
+
+    // 3D steering axis source: STEERING_CIRCUMCENTERS (default, PCA of the
+    // circumcenters of the Delaunay star), STEERING_VORONOI_INERTIA (exact
+    // second-moment tensor of the Voronoi cell, clipped from the star
+    // neighbors) or STEERING_LAGUERRE_INERTIA (same with power weights r^2;
+    // exact as long as the power cell has the same neighbors as the Voronoi
+    // cell, which holds for similar radii). The inertia axes are oriented
+    // toward the cell centroid.
+    enum SteeringSource { STEERING_CIRCUMCENTERS = 0, STEERING_VORONOI_INERTIA = 1, STEERING_LAGUERRE_INERTIA = 2 };
+    void setSteeringSource(int source);
+    int getSteeringSource() const { return steeringSource; }
+
+    // Pair potential of the contact forces (see PairPotentials.h), all scaled by
+    // the repulsion strength: POTENTIAL_LINEAR (default, strength * overlap),
+    // POTENTIAL_HERTZ, POTENTIAL_COHESIVE (linear spring plus a cohesive well,
+    // see setCohesion()), POTENTIAL_WCA or POTENTIAL_TABULATED (linear until a
+    // table is set).
+    enum PairPotential {
+        POTENTIAL_LINEAR = 0,
+        POTENTIAL_HERTZ = 1,
+        POTENTIAL_COHESIVE = 2,
+        POTENTIAL_WCA = 3,
+        POTENTIAL_TABULATED = 4
+    };
+    void setPairPotential(int potential);
+    int getPairPotential() const { return pairPotential; }
+
+    // Cohesive well: peak attraction relative to the spring, and width as a
+    // fraction of the contact distance (defaults 0.1 and 0.2)
+    void setCohesion(float strength, float range);
+
+    // Tabulated potential: force / (strength * (ri + rj)) sampled at count
+    // evenly spaced values of dist / (ri + rj) over [0, range], interpolated
+    // linearly. At most MAX_POTENTIAL_TABLE_SIZE samples, so that the table
+    // stays in cache. False (table unchanged) on invalid input.
+    static const std::size_t MAX_POTENTIAL_TABLE_SIZE = 4096;
+    bool setPairPotentialTable(const float* values, std::size_t count, float range);
+    std::size_t getPairPotentialTableSize() const { return potentialTable.size(); }
+
+    // Contact network of the last update (off by default): every pair closer
+    // than ri + rj, unordered, as
+    // - pairs: i, j (2 uint32 per contact)
+    // - overlaps: ri + rj - dist (float)
+    // - forces: force of the pair potential along the center line, positive
+    //   when repulsive (float)
+    // - offsets: periodic translation of j next to i (3 int8 per contact, the
+    //   image of j is pj + offset)
+    // plus the coordination number of each particle (uint32 per particle).
+    // Filled by the force kernel itself, so it costs nothing for the pairs
+    // out of contact.
+    void setContactExport(bool enabled);
+    bool isContactExport() const { return contactExport; }
+    std::size_t getContactCount() const { return contactOverlaps.size(); }
+    uint32_t* getContactPairBufferPtr();
+    float* getContactOverlapBufferPtr();
+    float* getContactForceBufferPtr();
+    int8_t* getContactOffsetBufferPtr();
+    uint32_t* getCoordinationBufferPtr();
+
+    // 3D repulsion candidates from the steering triangulation (off by default):
+    // each steering pass lists the unique Delaunay edges, and the repulsion
+    // visits only those pairs until the next pass. A particle farther than its
+    // clearance from every particle that is not a Delaunay neighbor (lower
+    // bound from the second ring of Voronoi cells, see buildPairList()),
+    // displacements since the pass included, cannot miss a contact; the other
+    // ones are searched against each other. Frames where most particles moved
+    // too far go back to the full pair search.
+    void setDelaunayPairList(bool enabled);
+    bool isDelaunayPairList() const { return delaunayPairList; }
+
+    // Frames whose repulsion used the Delaunay pairs, and frames that had a
+    // list but fell back to the full search, since it was enabled; particles
+    // searched outside the list in the last frame that used it
+    std::size_t getPairListFrameCount() const { return pairListFrames; }
+    std::size_t getPairListFallbackCount() const { return pairListFallbacks; }
+    std::size_t getPairListUncoveredCount() const { return pairUncovered.size(); }
+
+    // Dimension of the simulation, 3 (default) or 2. Switching to 2 flattens
+    // the particles into the z = 0 plane.
+    void setDimension(int dim);
+    int getDimension() const { return dimension; }
+
+    // 2D only: Voronoi polygons of the last steering pass, particle i is
+    // vertices [offsets[i], offsets[i+1]) (x,y floats, counterclockwise,
+    // unwrapped next to the particle). Empty in 3D.
+    std::size_t getCellPolygonVertexCount() const { return cellPolygonVertices.size() / 2u; }
+    uint32_t* getCellPolygonOffsetBufferPtr();
+    float* getCellPolygonVertexBufferPtr();
+
+    // Raw pointer to the fixed-point positions (x,y,z uint32 per particle),
+    // nullptr unless fixed point is enabled. Position p is u / 2^32.
+    uint32_t* getFixedPositionBufferPtr();
+
 private:
     // Helper to wrap a coordinate into [0,1)
     static inline float wrap01(float v) {
@@ -88,14 +225,6 @@ private:
         return v;
     }
 
-    // Compute minimum image displacement in periodic unit cube
-    static inline void minimumImage(float dx, float dy, float dz, float& outDx, float& outDy, float& outDz) {
-        // Shift into [-0.5, 0.5) range for each component
-        outDx = dx - std::round(dx);
-        outDy = dy - std::round(dy);
-        outDz = dz - std::round(dz);
-    }
-
     // Simulation parameters (tuned later for aesthetics/performance)
     float repulsionStrength;   // Scales the soft contact force magnitude
     float damping;             // Simple velocity damping per second (e.g., 0.98 -> mild)
@@ -104,20 +233,128 @@ private:
     int frameCounter;          // Internal frame counter
     float minSpeed;            // Clamp min speed after forces
     float maxSpeed;            // Clamp max speed after forces
+    bool fixedPoint;           // Positions live in fixedPositions
+    int dimension;             // 3, or 2 for the z = 0 plane
+    bool periodicWarmStart;    // Reuse the periodic copies across steering passes
+    int steeringSource;        // SteeringSource of the 3D steering axes
+    bool delaunayPairList;     // Repulsion over the Delaunay edges of the last steering pass
+    int pairPotential;         // PairPotential of the contact forces
+    float cohesionStrength;    // POTENTIAL_COHESIVE well depth, relative to the spring
+    float cohesionRange;       // POTENTIAL_COHESIVE well width, fraction of ri + rj
+    std::vector<float> potentialTable; // POTENTIAL_TABULATED samples
+    float potentialTableRange;         // dist / (ri + rj) of the last sample
+    bool contactExport;        // Record the contacts of each update
 
     std::vector<Particle> particles;
     std::vector<float> positions; // x,y,z packed for interop
     std::vector<float> radii;     // radii packed for interop
     std::vector<float> axes;      // normalized steering axis per particle (x,y,z)
     std::vector<float> axisSegments; // axis segment endpoints per particle (6 floats: start_xyz, end_xyz)
+    std::vector<uint32_t> fixedPositions; // x,y,z fractions of the box in fixed-point mode, else empty
 
     // Triangulated Voronoi faces (positions, normals, and owner-particle axis per vertex)
     std::vector<float> facePositions;
     std::vector<float> faceNormals;
     std::vector<float> faceAxes;
 
+    // Tet of the periodic Delaunay, identified by its particle indices (sorted)
+    struct TetKey {
+        uint32_t v[4];
+        bool operator<(const TetKey& other) const {
+            return std::lexicographical_compare(v, v + 4, other.v, other.v + 4);
+        }
+    };
+
+    // Steering topology kept from the previous pass, to diff against
+    std::vector<TetKey> tetKeys;             // sorted
+    std::vector<uint32_t> starOffsets;       // star of particle i: starEntries[starOffsets[i], starOffsets[i+1])
+    std::vector<uint32_t> starEntries;       // 4 * index in tetKeys + local vertex
+    std::vector<uint32_t> faceSlotOffsets;   // first face vertex of each particle
+    std::vector<uint32_t> faceSlotCapacities; // face vertices reserved for each particle
+    std::vector<uint32_t> faceDirtyRanges;   // (first vertex, vertex count) pairs
+    std::size_t changedStarCount;
+    bool faceLayoutReset;
+
+    // Steering scratch (reused across frames)
+    std::vector<TetKey> newTetKeys;
+    std::vector<uint32_t> oldToNewTet, newStarOffsets, newStarEntries, starCursor;
+    std::vector<unsigned char> starChanged;
+    std::vector<float> tetCenters;           // 4 unwrapped circumcenters per tet
+
+    // Steering PCA batch: particles with a large enough star, center of the axis
+    // segment and direction the axis is oriented along (x,y,z each), covariances
+    // and eigenpairs
+    std::vector<uint32_t> pcaParticles;
+    std::vector<float> pcaMeans, pcaResiduals;
+    SymmetricEigen3Batch pcaBatch;
+
+    // Repulsion candidates of the last 3D steering pass: unique Delaunay edges
+    // (i < j pairs), the positions they were built at and the clearance of each
+    // particle (lower bound of its distance to any particle that is not a
+    // Delaunay neighbor). Empty when there is no valid list. Per frame, the
+    // uncovered particles and their contacts outside the list.
+    std::vector<uint32_t> pairList;
+    std::vector<uint32_t> pairUncovered, pairExtra;
+    std::vector<float> pairListPositions;
+    std::vector<float> pairListClearances;
+    std::vector<uint32_t> pairAdjacencyOffsets, pairAdjacency, pairStamps, pairRing;
+    std::vector<double> pairRingBounds;
+    std::size_t pairListFrames;
+    std::size_t pairListFallbacks;
+
+    // Double-precision Delaunay input, reused across steering frames
+    PointBuffer delaunayInput;
+
+    // Periodic copies required by the last 3D triangulation (bit k: translation
+    // k of the 27, per particle), empty when no warm start is possible
+    std::vector<uint32_t> periodicInstances;
+
+    // 2D steering: triangulation, its input (x,y packed) and the cell polygons
+    PeriodicDelaunay2d delaunay2d;
+    std::vector<double> delaunayInput2d;
+    std::vector<uint32_t> cellPolygonOffsets;
+    std::vector<float> cellPolygonVertices;
+
+    // Contacts of the last update (see setContactExport()), empty when off
+    std::vector<uint32_t> contactPairs;
+    std::vector<float> contactOverlaps;
+    std::vector<float> contactForces;
+    std::vector<int8_t> contactOffsets;
+    std::vector<uint32_t> coordination;
+
+    // Structure-of-arrays scratch for the pair loop (reused across frames)
+    std::vector<float> soaX, soaY, soaZ, soaRadius;
+    std::vector<float> soaVx, soaVy, soaVz;
+    std::vector<uint32_t> soaFixedX, soaFixedY, soaFixedZ;
+
+    // Pair potential impulses over all pairs (SIMD in the simd128 builds)
+    void applyRepulsion(float dt);
+
     // Compute Voronoi-based steering using PCA of each cell's circumcenter cloud
     void applyVoronoiSteering(float dt);
+
+    // Inertia steering sources: covariance of each pcaParticles cell as a solid
+    // (second moments over the ConvexCell clipped by the star neighbors)
+    void computeCellMoments(bool weighted);
+
+    // 2D steering: PCA of each Voronoi polygon, faces are the polygon fans
+    void applyVoronoiSteering2d(float dt);
+
+    // Drops the steering topology (face slots, stars, pair list), the next pass rebuilds it
+    void resetSteeringTopology();
+
+    // Pair list from tetKeys, with the clearances at the current positions
+    void buildPairList();
+
+    // Particles whose displacement since buildPairList() exceeds their clearance
+    // and the pairs among them within the potential range that the list misses
+    // (pairUncovered, pairExtra). False if they are most of the particles.
+    bool collectUncoveredContacts(float rangeFactor);
+
+    // Face buffer slots for the new stars; the abandoned slots, or everything
+    // on a layout reset, go to faceDirtyRanges
+    void layoutFaceSlots();
+    void addFaceDirtyRange(uint32_t first, uint32_t count);
 };
 
 
@@ -0,0 +1,245 @@
+#include "PeriodicDelaunay2d.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+// Initial band width, in mean point spacings (N^-1/2)
+const double GHOST_SPACINGS = 4.0;
+
+// Circumcenter and squared radius (infinite for flat triangles)
+inline void circumcircle(const GEO::vec2& p0, const GEO::vec2& p1, const GEO::vec2& p2,
+                         GEO::vec2& center, double& radius2) {
+    const GEO::vec2 a = p1 - p0;
+    const GEO::vec2 b = p2 - p0;
+    const double denominator = 2.0 * (a.x * b.y - a.y * b.x);
+    if (denominator == 0.0) {
+        center = p0;
+        radius2 = std::numeric_limits<double>::infinity();
+        return;
+    }
+    const double la2 = GEO::length2(a);
+    const double lb2 = GEO::length2(b);
+    const GEO::vec2 offset((b.y * la2 - a.y * lb2) / denominator, (a.x * lb2 - b.x * la2) / denominator);
+    center = p0 + offset;
+    radius2 = GEO::length2(offset);
+}
+
+// Keeps the part of the convex polygon where dot(q - origin, normal) <= limit
+void clipPolygon(std::vector<GEO::vec2>& polygon, const GEO::vec2& origin, const GEO::vec2& normal, double limit,
+                 std::vector<GEO::vec2>& scratch) {
+    scratch.clear();
+    const std::size_t count = polygon.size();
+    for (std::size_t k = 0; k < count; ++k) {
+        const GEO::vec2& p = polygon[k];
+        const GEO::vec2& q = polygon[(k + 1) % count];
+        const double dp = GEO::dot(p - origin, normal) - limit;
+        const double dq = GEO::dot(q - origin, normal) - limit;
+        if (dp <= 0.0) scratch.push_back(p);
+        if ((dp < 0.0 && dq > 0.0) || (dp > 0.0 && dq < 0.0)) {
+            scratch.push_back(p + (dp / (dp - dq)) * (q - p));
+        }
+    }
+    polygon.swap(scratch);
+}
+
+} // namespace
+
+PeriodicDelaunay2d::PeriodicDelaunay2d() : ghostWidth(0.0), ghostCount(0) {}
+
+void PeriodicDelaunay2d::clear() {
+    triangles.clear();
+    triangleOffsets.clear();
+    cellOffsets.clear();
+    cellVertices.clear();
+    cellAreas.clear();
+    ghostWidth = 0.0;
+    ghostCount = 0;
+}
+
+bool PeriodicDelaunay2d::triangulate(const double* points, std::size_t numPoints, bool periodic, double width) {
+    vertexPositions.assign(points, points + 2 * numPoints);
+    vertexSource.resize(numPoints);
+    vertexShift.assign(2 * numPoints, 0);
+    for (std::size_t i = 0; i < numPoints; ++i) vertexSource[i] = uint32_t(i);
+
+    if (periodic) {
+        for (std::size_t i = 0; i < numPoints; ++i) {
+            for (int sx = -1; sx <= 1; ++sx) {
+                for (int sy = -1; sy <= 1; ++sy) {
+                    if (sx == 0 && sy == 0) continue;
+                    const double x = points[2 * i] + sx;
+                    const double y = points[2 * i + 1] + sy;
+                    if (x < -width || x > 1.0 + width || y < -width || y > 1.0 + width) continue;
+                    vertexPositions.push_back(x);
+                    vertexPositions.push_back(y);
+                    vertexSource.push_back(uint32_t(i));
+                    vertexShift.push_back(int8_t(sx));
+                    vertexShift.push_back(int8_t(sy));
+                }
+            }
+        }
+    }
+    ghostCount = vertexSource.size() - numPoints;
+
+    // ParallelDelaunay2d when there are threads to run it (same triangles)
+    const bool parallel = GEO::Process::maximum_concurrent_threads() > 1;
+    GEO::Delaunay_var delaunay = GEO::Delaunay::create(2, parallel ? "PDEL2d" : "BDEL2d");
+
+    // Cocircular points (lattices) are split by the symbolic perturbation. It
+    // must rank the points by coordinates, as PeriodicDelaunay3d does, so that
+    // every image of a cocircular set is split the same way: the default order
+    // (vertex addresses) changes from one image to the next.
+    const GEO::PCK::SOSMode previousMode = GEO::PCK::get_SOS_mode();
+    if (periodic) GEO::PCK::set_SOS_mode(GEO::PCK::SOS_LEXICO);
+    bool ok = true;
+    try {
+        delaunay->set_vertices(GEO::index_t(vertexSource.size()), vertexPositions.data());
+    } catch (...) {
+        ok = false;
+    }
+    GEO::PCK::set_SOS_mode(previousMode);
+    if (!ok) return false;
+    extendedTriangles.resize(3u * delaunay->nb_cells());
+    for (GEO::index_t t = 0; t < delaunay->nb_cells(); ++t) {
+        for (GEO::index_t lv = 0; lv < 3; ++lv) {
+            extendedTriangles[3 * t + lv] = uint32_t(delaunay->cell_vertex(t, lv));
+        }
+    }
+    return !extendedTriangles.empty();
+}
+
+bool PeriodicDelaunay2d::compute(const double* points, std::size_t numPoints, bool periodic) {
+    clear();
+    if (points == nullptr || numPoints < 3) {
+        std::cerr << "Periodic Delaunay 2d: at least 3 points are needed." << std::endl;
+        return false;
+    }
+    for (std::size_t k = 0; k < 2 * numPoints; ++k) {
+        if (!std::isfinite(points[k])) {
+            std::cerr << "Periodic Delaunay 2d: invalid coordinate." << std::endl;
+            return false;
+        }
+    }
+
+    auto position = [&](uint32_t v) { return GEO::vec2(vertexPositions[2 * v], vertexPositions[2 * v + 1]); };
+
+    // Phases I and II, the band grows until every triangle touching the square is certified
+    double width = periodic ? std::min(1.0, GHOST_SPACINGS / std::sqrt(double(numPoints))) : 0.0;
+    std::size_t uncertified = 0;
+    for (;;) {
+        if (!triangulate(points, numPoints, periodic, width)) {
+            std::cerr << "Periodic Delaunay 2d: triangulation failed." << std::endl;
+            clear();
+            return false;
+        }
+        if (!periodic) break;
+        uncertified = 0;
+        for (std::size_t t = 0; t < extendedTriangles.size() / 3u; ++t) {
+            const uint32_t* T = &extendedTriangles[3 * t];
+            if (T[0] >= numPoints && T[1] >= numPoints && T[2] >= numPoints) continue;
+            GEO::vec2 center;
+            double radius2 = 0.0;
+            circumcircle(position(T[0]), position(T[1]), position(T[2]), center, radius2);
+            const double radius = std::sqrt(radius2);
+            if (!(center.x - radius >= -width && center.x + radius <= 1.0 + width &&
+                  center.y - radius >= -width && center.y + radius <= 1.0 + width)) {
+                ++uncertified;
+            }
+        }
+        if (uncertified == 0 || width >= 1.0) break;
+        width = std::min(1.0, 2.0 * width);
+    }
+    if (uncertified > 0) {
+        std::cerr << "Periodic Delaunay 2d: " << uncertified
+                  << " triangles could not be certified (too few points for the period)." << std::endl;
+    }
+    ghostWidth = width;
+
+    // Triangles, each periodic one once: the copy whose smallest vertex is in the square
+    auto vertexLess = [&](uint32_t a, uint32_t b) {
+        if (vertexSource[a] != vertexSource[b]) return vertexSource[a] < vertexSource[b];
+        const GEO::vec2 pa = position(a);
+        const GEO::vec2 pb = position(b);
+        return (pa.x != pb.x) ? pa.x < pb.x : pa.y < pb.y;
+    };
+    for (std::size_t t = 0; t < extendedTriangles.size() / 3u; ++t) {
+        uint32_t T[3] = { extendedTriangles[3 * t], extendedTriangles[3 * t + 1], extendedTriangles[3 * t + 2] };
+        uint32_t smallest = T[0];
+        if (vertexLess(T[1], smallest)) smallest = T[1];
+        if (vertexLess(T[2], smallest)) smallest = T[2];
+        if (smallest >= numPoints) continue;
+
+        const GEO::vec2 p0 = position(T[0]);
+        const GEO::vec2 a = position(T[1]) - p0;
+        const GEO::vec2 b = position(T[2]) - p0;
+        if (a.x * b.y - a.y * b.x < 0.0) std::swap(T[1], T[2]);
+        for (int lv = 0; lv < 3; ++lv) {
+            triangles.push_back(vertexSource[T[lv]]);
+            triangleOffsets.push_back(int8_t(vertexShift[2 * T[lv]] - vertexShift[2 * T[0]]));
+            triangleOffsets.push_back(int8_t(vertexShift[2 * T[lv] + 1] - vertexShift[2 * T[0] + 1]));
+        }
+    }
+    // Euler characteristic of the torus: V - E + F = 0 with 3F = 2E, so F = 2V
+    if (periodic && triangles.size() != 6u * numPoints) {
+        std::cerr << "Periodic Delaunay 2d: " << triangles.size() / 3u << " triangles instead of " << 2u * numPoints
+                  << " (duplicate points?)." << std::endl;
+    }
+
+    // Delaunay neighbors of every point (extended vertex indices), from the triangles around it
+    std::vector<uint32_t> neighborOffsets(numPoints + 1, 0u);
+    for (uint32_t v : extendedTriangles) {
+        if (v < numPoints) neighborOffsets[v + 1] += 2;
+    }
+    for (std::size_t i = 0; i < numPoints; ++i) neighborOffsets[i + 1] += neighborOffsets[i];
+    std::vector<uint32_t> neighbors(neighborOffsets[numPoints]);
+    std::vector<uint32_t> cursor(neighborOffsets.begin(), neighborOffsets.end() - 1);
+    for (std::size_t t = 0; t < extendedTriangles.size() / 3u; ++t) {
+        for (int lv = 0; lv < 3; ++lv) {
+            const uint32_t v = extendedTriangles[3 * t + lv];
+            if (v >= numPoints) continue;
+            neighbors[cursor[v]++] = extendedTriangles[3 * t + (lv + 1) % 3];
+            neighbors[cursor[v]++] = extendedTriangles[3 * t + (lv + 2) % 3];
+        }
+    }
+
+    // Cells: the square (centered on the point in periodic mode, which bounds any
+    // cell of the torus) clipped by the bisectors with the Delaunay neighbors
+    cellOffsets.assign(1, 0u);
+    cellAreas.assign(numPoints, 0.0);
+    std::vector<GEO::vec2> polygon;
+    std::vector<GEO::vec2> scratch;
+    for (std::size_t i = 0; i < numPoints; ++i) {
+        std::sort(neighbors.begin() + neighborOffsets[i], neighbors.begin() + neighborOffsets[i + 1]);
+        const auto last = std::unique(neighbors.begin() + neighborOffsets[i], neighbors.begin() + neighborOffsets[i + 1]);
+        const GEO::vec2 p = position(uint32_t(i));
+        polygon.clear();
+        if (neighbors.begin() + neighborOffsets[i] != last) {
+            const double x0 = periodic ? p.x - 0.5 : 0.0;
+            const double y0 = periodic ? p.y - 0.5 : 0.0;
+            polygon = { GEO::vec2(x0, y0), GEO::vec2(x0 + 1.0, y0), GEO::vec2(x0 + 1.0, y0 + 1.0), GEO::vec2(x0, y0 + 1.0) };
+        }
+        for (auto it = neighbors.begin() + neighborOffsets[i]; it != last && !polygon.empty(); ++it) {
+            const GEO::vec2 d = position(*it) - p;
+            clipPolygon(polygon, p, d, 0.5 * GEO::length2(d), scratch);
+        }
+
+        double area = 0.0;
+        for (std::size_t k = 0; k < polygon.size(); ++k) {
+            const GEO::vec2& u = polygon[k];
+            const GEO::vec2& w = polygon[(k + 1) % polygon.size()];
+            area += u.x * w.y - u.y * w.x;
+            cellVertices.push_back(u.x);
+            cellVertices.push_back(u.y);
+        }
+        cellAreas[i] = 0.5 * area;
+        cellOffsets.push_back(uint32_t(cellVertices.size() / 2u));
+    }
+    return true;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// PeriodicDelaunay2d triangulates a point set of the unit square, periodic
+// (flat torus) or not, with Geogram's 2D Delaunay (ParallelDelaunay2d when
+// several threads are available), and extracts the Voronoi cells as polygons.
+//
+// Periodic mode follows the two phases of PeriodicDelaunay3d on the 3x3 image
+// set, without inserting all the images:
+// - phase I:  the points are triangulated together with their images within
+//   ghostWidth of the square (a band of the 8 neighboring copies),
+// - phase II: each triangle with a vertex in the square is certified: its
+//   circumcircle must lie inside the square extended by the band, so no
+//   missing image can violate it. If one does not, the band is doubled and
+//   phase I runs again. A band of width 1 holds the full 3x3 image set.
+// Each periodic triangle is output once: the copy whose smallest vertex
+// (point index, then position) is in the square. Cocircular points are split
+// by a perturbation that ranks them by coordinates (PCK::SOS_LEXICO), the
+// same for every image, so lattices also give the 2n triangles of the torus.
+//
+// Results:
+// - triangles:       3 point indices per triangle, counterclockwise
+// - triangleOffsets: 2 int8 per vertex, the periodic translation of vertex k
+//                    relative to vertex 0 (as in AlphaFiltration, in 2D)
+// - cellOffsets:     numPoints+1 uint32, cell i is polygon vertices
+//                    [cellOffsets[i], cellOffsets[i+1])
+// - cellVertices:    2 doubles per polygon vertex, counterclockwise, unwrapped
+//                    next to the point (periodic cells may leave the square);
+//                    non-periodic cells are clipped by the square
+// - cellAreas:       one double per cell (duplicate points get an empty cell)
+
+class PeriodicDelaunay2d {
+public:
+    PeriodicDelaunay2d();
+
+    // Points x,y packed in [0,1)^2. Geogram must have been initialized.
+    // Returns false on invalid input or when the triangulation fails.
+    bool compute(const double* points, std::size_t numPoints, bool periodic);
+
+    std::size_t getPointCount() const { return cellAreas.size(); }
+    std::size_t getTriangleCount() const { return triangles.size() / 3u; }
+
+    // Band width used by the last periodic compute(), and the number of images in it
+    double getGhostWidth() const { return ghostWidth; }
+    std::size_t getGhostCount() const { return ghostCount; }
+
+    uint32_t* getTriangleBufferPtr() { return triangles.empty() ? nullptr : triangles.data(); }
+    int8_t* getTriangleOffsetBufferPtr() { return triangleOffsets.empty() ? nullptr : triangleOffsets.data(); }
+    uint32_t* getCellOffsetBufferPtr() { return cellOffsets.empty() ? nullptr : cellOffsets.data(); }
+    double* getCellVertexBufferPtr() { return cellVertices.empty() ? nullptr : cellVertices.data(); }
+    double* getCellAreaBufferPtr() { return cellAreas.empty() ? nullptr : cellAreas.data(); }
+    std::size_t getCellVertexCount() const { return cellVertices.size() / 2u; }
+
+private:
+    void clear();
+
+    // Phase I: points + images within width of the square (positions, source
+    // point and shift of every vertex), then the Delaunay triangulation
+    bool triangulate(const double* points, std::size_t numPoints, bool periodic, double width);
+
+    std::vector<uint32_t> triangles;
+    std::vector<int8_t> triangleOffsets;
+    std::vector<uint32_t> cellOffsets;
+    std::vector<double> cellVertices;
+    std::vector<double> cellAreas;
+    double ghostWidth;
+    std::size_t ghostCount;
+
+    // Extended point set of the last triangulation: vertex v is the image of
+    // point vertexSource[v] translated by vertexShift[2v..2v+1]
+    std::vector<double> vertexPositions;
+    std::vector<uint32_t> vertexSource;
+    std::vector<int8_t> vertexShift;
+    std::vector<uint32_t> extendedTriangles;
+};
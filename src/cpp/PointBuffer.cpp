@@ -0,0 +1,91 @@
+#include "PointBuffer.h"
+
+#include <cmath>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+// Below this many points the conversion runs on the calling thread
+const std::size_t PARALLEL_THRESHOLD = 1u << 16;
+
+inline double wrap01(double x) {
+    x -= std::floor(x);
+    // Tiny negative inputs round up to 1.0
+    return (x >= 1.0) ? 0.0 : x;
+}
+
+// Runs body(begin, end) over [0, count), in parallel slices for large counts
+template <class Body>
+void forEachRange(std::size_t count, const Body& body) {
+    if (count < PARALLEL_THRESHOLD) {
+        body(std::size_t(0), count);
+        return;
+    }
+    GEO::parallel_for_slice(0, GEO::index_t(count), [&](GEO::index_t b, GEO::index_t e) {
+        body(std::size_t(b), std::size_t(e));
+    });
+}
+
+} // namespace
+
+template <class T>
+const double* PointBuffer::convert(const T* points, std::size_t count, std::size_t stride, bool wrap) {
+    double* out = resize(count);
+    forEachRange(count, [&](std::size_t b, std::size_t e) {
+        const T* in = points + b * stride;
+        if (wrap) {
+            for (std::size_t i = b; i < e; ++i, in += stride) {
+                out[3 * i] = wrap01(double(in[0]));
+                out[3 * i + 1] = wrap01(double(in[1]));
+                out[3 * i + 2] = wrap01(double(in[2]));
+            }
+        } else {
+            for (std::size_t i = b; i < e; ++i, in += stride) {
+                out[3 * i] = double(in[0]);
+                out[3 * i + 1] = double(in[1]);
+                out[3 * i + 2] = double(in[2]);
+            }
+        }
+    });
+    return data();
+}
+
+const double* PointBuffer::assign(const float* points, std::size_t count, std::size_t stride, bool wrap) {
+    return convert(points, count, stride, wrap);
+}
+
+const double* PointBuffer::assign(const double* points, std::size_t count, std::size_t stride, bool wrap) {
+    return convert(points, count, stride, wrap);
+}
+
+const double* PointBuffer::assign(const uint32_t* fixed, std::size_t count, std::size_t stride) {
+    // u / 2^32 is exact in a double and already in [0,1)
+    const double scale = 1.0 / 4294967296.0;
+    double* out = resize(count);
+    forEachRange(count, [&](std::size_t b, std::size_t e) {
+        const uint32_t* in = fixed + b * stride;
+        for (std::size_t i = b; i < e; ++i, in += stride) {
+            out[3 * i] = double(in[0]) * scale;
+            out[3 * i + 1] = double(in[1]) * scale;
+            out[3 * i + 2] = double(in[2]) * scale;
+        }
+    });
+    return data();
+}
+
+double* PointBuffer::resize(std::size_t count) {
+    // Capacity is kept, shrinking only moves the end
+    coordinates.resize(3u * count);
+    return coordinates.data();
+}
+
+void PointBuffer::wrapInPlace() {
+    double* coords = coordinates.data();
+    forEachRange(getPointCount(), [&](std::size_t b, std::size_t e) {
+        for (std::size_t k = 3 * b; k < 3 * e; ++k) {
+            coords[k] = wrap01(coords[k]);
+        }
+    });
+}
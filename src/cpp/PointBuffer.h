@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// PointBuffer stages point coordinates for Delaunay::set_vertices(), which
+// expects packed x,y,z doubles and keeps a pointer to them.
+//
+// Sources may be float or double, packed or strided (e.g. the x,y,z members
+// of an array of structs). They are converted into a double array owned by
+// the buffer, wrapped into the unit period on request, in a single pass
+// (split across the Geogram threads for large inputs). The storage is reused
+// from call to call, so a per-frame caller does not reallocate.
+//
+// The returned pointer stays valid until the next assign()/resize().
+
+class PointBuffer {
+public:
+    // count points, point i starting at points[i * stride] (stride >= 3, in
+    // values). Returns the packed doubles.
+    const double* assign(const float* points, std::size_t count, std::size_t stride, bool wrap);
+    const double* assign(const double* points, std::size_t count, std::size_t stride, bool wrap);
+
+    // Fixed-point source (uint32 fractions of the period): the conversion is
+    // exact and already wrapped.
+    const double* assign(const uint32_t* fixed, std::size_t count, std::size_t stride);
+
+    // Storage for count packed points, for sources that write the doubles
+    // themselves (e.g. a JS typed array copy), then wrapInPlace() if needed.
+    double* resize(std::size_t count);
+    void wrapInPlace();
+
+    const double* data() const { return coordinates.empty() ? nullptr : coordinates.data(); }
+    std::size_t getPointCount() const { return coordinates.size() / 3u; }
+
+private:
+    template <class T>
+    const double* convert(const T* points, std::size_t count, std::size_t stride, bool wrap);
+
+    std::vector<double> coordinates;
+};
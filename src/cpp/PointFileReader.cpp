@@ -0,0 +1,467 @@
+#include "PointFileReader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+// ASCII windows and line counts are split in this many pieces per thread
+const std::size_t PIECES_PER_THREAD = 4;
+
+inline double wrap01(double x) {
+    x -= std::floor(x);
+    return (x >= 1.0) ? 0.0 : x;
+}
+
+inline bool hostIsLittleEndian() {
+    const uint16_t one = 1;
+    unsigned char first = 0;
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+inline bool endsWith(const std::string& s, const char* suffix) {
+    const std::size_t n = std::strlen(suffix);
+    if (s.size() < n) return false;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (std::tolower(static_cast<unsigned char>(s[s.size() - n + i])) != suffix[i]) return false;
+    }
+    return true;
+}
+
+// A line holds a point unless it is blank or a '#' comment
+inline bool isPointLine(const char* begin, const char* end) {
+    while (begin < end && (*begin == ' ' || *begin == '\t' || *begin == '\r')) ++begin;
+    return begin < end && *begin != '#';
+}
+
+inline const char* lineEnd(const char* p, const char* end) {
+    const void* newline = std::memchr(p, '\n', std::size_t(end - p));
+    return newline ? static_cast<const char*>(newline) : end;
+}
+
+std::size_t countPointLines(const char* begin, const char* end) {
+    std::size_t count = 0;
+    for (const char* p = begin; p < end;) {
+        const char* e = lineEnd(p, end);
+        if (isPointLine(p, e)) ++count;
+        p = e + 1;
+    }
+    return count;
+}
+
+// Splits [begin, end) in about nbPieces ranges that end on line boundaries
+std::vector<const char*> splitAtLines(const char* begin, const char* end, std::size_t nbPieces) {
+    std::vector<const char*> bounds(1, begin);
+    const std::size_t size = std::size_t(end - begin);
+    for (std::size_t k = 1; k < nbPieces; ++k) {
+        const char* p = begin + size * k / nbPieces;
+        if (p <= bounds.back()) continue;
+        p = lineEnd(p, end);
+        if (p < end) ++p;
+        if (p > bounds.back() && p < end) bounds.push_back(p);
+    }
+    bounds.push_back(end);
+    return bounds;
+}
+
+} // namespace
+
+PointFileReader::PointFileReader()
+    : format(Format::Auto), fd(-1), mapped(nullptr), mappedSize(0), pointCount(0), dataOffset(0), dataEnd(0),
+      stride(0), swapBytes(false), ascii(false) {
+    for (int a = 0; a < 3; ++a) {
+        propertyOffset[a] = 0;
+        propertyType[a] = Scalar::Float64;
+        column[a] = a;
+    }
+}
+
+PointFileReader::~PointFileReader() {
+    close();
+}
+
+void PointFileReader::close() {
+    if (mapped != nullptr) {
+        munmap(mapped, mappedSize);
+        mapped = nullptr;
+    }
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    mappedSize = 0;
+    pointCount = 0;
+}
+
+bool PointFileReader::open(const std::string& path, Format requested) {
+    close();
+
+    fd = ::open(path.c_str(), O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0 || info.st_size <= 0) {
+        std::cerr << "Point reader: cannot open " << path << std::endl;
+        close();
+        return false;
+    }
+    mappedSize = std::size_t(info.st_size);
+    // Private writable mapping: in-place wrapping copies only the touched pages
+    void* address = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (address == MAP_FAILED) {
+        std::cerr << "Point reader: cannot map " << path << std::endl;
+        mappedSize = 0;
+        close();
+        return false;
+    }
+    mapped = static_cast<char*>(address);
+    madvise(mapped, mappedSize, MADV_SEQUENTIAL);
+
+    format = requested;
+    if (format == Format::Auto) {
+        if (endsWith(path, ".ply")) format = Format::PLY;
+        else if (endsWith(path, ".xyz") || endsWith(path, ".txt") || endsWith(path, ".asc")) format = Format::AsciiXYZ;
+        else if (endsWith(path, ".f32")) format = Format::RawFloat32;
+        else format = Format::RawFloat64;
+    }
+
+    ascii = false;
+    swapBytes = false;
+    dataOffset = 0;
+    dataEnd = mappedSize;
+    for (int a = 0; a < 3; ++a) column[a] = a;
+
+    bool ok = true;
+    switch (format) {
+    case Format::RawFloat64:
+    case Format::RawFloat32: {
+        const std::size_t scalarSize = (format == Format::RawFloat64) ? 8u : 4u;
+        stride = 3u * scalarSize;
+        for (int a = 0; a < 3; ++a) {
+            propertyOffset[a] = std::size_t(a) * scalarSize;
+            propertyType[a] = (format == Format::RawFloat64) ? Scalar::Float64 : Scalar::Float32;
+        }
+        pointCount = mappedSize / stride;
+        if (mappedSize % stride != 0) {
+            std::cerr << "Point reader: ignoring " << mappedSize % stride << " trailing bytes." << std::endl;
+        }
+        break;
+    }
+    case Format::AsciiXYZ:
+        ascii = true;
+        ok = countAsciiLines();
+        break;
+    case Format::PLY:
+        ok = parsePlyHeader() && (!ascii || countAsciiLines());
+        break;
+    case Format::Auto:
+        ok = false;
+        break;
+    }
+
+    if (!ok) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool PointFileReader::parsePlyHeader() {
+    const char* end = mapped + mappedSize;
+    const char* p = mapped;
+    bool firstElement = true;
+    bool inVertex = false;
+    std::size_t recordSize = 0;
+    int propertyIndex = 0;
+    bool found[3] = { false, false, false };
+    const char* names[3] = { "x", "y", "z" };
+
+    for (int lineNumber = 0; p < end; ++lineNumber) {
+        const char* e = lineEnd(p, end);
+        std::string line(p, e);
+        p = (e < end) ? e + 1 : end;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (lineNumber == 0) {
+            if (keyword != "ply") {
+                std::cerr << "Point reader: not a PLY file." << std::endl;
+                return false;
+            }
+        } else if (keyword == "format") {
+            std::string type;
+            tokens >> type;
+            if (type == "ascii") {
+                ascii = true;
+            } else if (type == "binary_little_endian") {
+                swapBytes = !hostIsLittleEndian();
+            } else if (type == "binary_big_endian") {
+                swapBytes = hostIsLittleEndian();
+            } else {
+                std::cerr << "Point reader: unknown PLY format " << type << std::endl;
+                return false;
+            }
+        } else if (keyword == "element") {
+            std::string name;
+            std::size_t count = 0;
+            tokens >> name >> count;
+            if (firstElement) {
+                if (name != "vertex") {
+                    std::cerr << "Point reader: the PLY vertex element must come first." << std::endl;
+                    return false;
+                }
+                pointCount = count;
+                inVertex = true;
+            } else {
+                inVertex = false;
+            }
+            firstElement = false;
+        } else if (keyword == "property" && inVertex) {
+            std::string type;
+            std::string name;
+            tokens >> type >> name;
+            Scalar scalar;
+            std::size_t size;
+            if (type == "char" || type == "int8") { scalar = Scalar::Int8; size = 1; }
+            else if (type == "uchar" || type == "uint8") { scalar = Scalar::UInt8; size = 1; }
+            else if (type == "short" || type == "int16") { scalar = Scalar::Int16; size = 2; }
+            else if (type == "ushort" || type == "uint16") { scalar = Scalar::UInt16; size = 2; }
+            else if (type == "int" || type == "int32") { scalar = Scalar::Int32; size = 4; }
+            else if (type == "uint" || type == "uint32") { scalar = Scalar::UInt32; size = 4; }
+            else if (type == "float" || type == "float32") { scalar = Scalar::Float32; size = 4; }
+            else if (type == "double" || type == "float64") { scalar = Scalar::Float64; size = 8; }
+            else {
+                std::cerr << "Point reader: unsupported PLY vertex property " << type << std::endl;
+                return false;
+            }
+            for (int a = 0; a < 3; ++a) {
+                if (name == names[a]) {
+                    found[a] = true;
+                    propertyType[a] = scalar;
+                    propertyOffset[a] = recordSize;
+                    column[a] = propertyIndex;
+                }
+            }
+            recordSize += size;
+            ++propertyIndex;
+        } else if (keyword == "end_header") {
+            if (!found[0] || !found[1] || !found[2]) {
+                std::cerr << "Point reader: PLY vertices need x, y and z." << std::endl;
+                return false;
+            }
+            stride = recordSize;
+            dataOffset = std::size_t(p - mapped);
+            dataEnd = ascii ? mappedSize : dataOffset + pointCount * stride;
+            if (dataEnd > mappedSize) {
+                std::cerr << "Point reader: truncated PLY file." << std::endl;
+                return false;
+            }
+            return true;
+        }
+    }
+    std::cerr << "Point reader: missing PLY end_header." << std::endl;
+    return false;
+}
+
+bool PointFileReader::countAsciiLines() {
+    const char* begin = mapped + dataOffset;
+    const char* end = mapped + dataEnd;
+    const std::vector<const char*> bounds = splitAtLines(
+        begin, end, std::size_t(GEO::Process::maximum_concurrent_threads()) * PIECES_PER_THREAD);
+    const std::size_t nbPieces = bounds.size() - 1;
+    std::vector<std::size_t> counts(nbPieces, 0);
+    GEO::parallel_for(0, GEO::index_t(nbPieces), [&](GEO::index_t k) {
+        counts[k] = countPointLines(bounds[k], bounds[k + 1]);
+    });
+
+    if (format == Format::AsciiXYZ) {
+        pointCount = 0;
+        for (std::size_t count : counts) pointCount += count;
+        return true;
+    }
+
+    // ASCII PLY: the vertex block ends after pointCount lines, other elements follow
+    std::size_t remaining = pointCount;
+    for (std::size_t k = 0; k < nbPieces; ++k) {
+        if (counts[k] < remaining) {
+            remaining -= counts[k];
+            continue;
+        }
+        for (const char* p = bounds[k]; p < bounds[k + 1];) {
+            const char* e = lineEnd(p, bounds[k + 1]);
+            if (isPointLine(p, e) && --remaining == 0) {
+                dataEnd = std::size_t(std::min(e + 1, end) - mapped);
+                return true;
+            }
+            p = e + 1;
+        }
+    }
+    if (pointCount == 0) {
+        dataEnd = dataOffset;
+        return true;
+    }
+    std::cerr << "Point reader: truncated PLY vertex list." << std::endl;
+    return false;
+}
+
+bool PointFileReader::decodeBinary(std::size_t first, std::size_t count, bool wrap, double* out) const {
+    const char* base = mapped + dataOffset + first * stride;
+    GEO::parallel_for_slice(0, GEO::index_t(count), [&](GEO::index_t b, GEO::index_t e) {
+        for (GEO::index_t i = b; i < e; ++i) {
+            const char* record = base + std::size_t(i) * stride;
+            for (int a = 0; a < 3; ++a) {
+                unsigned char bytes[8];
+                const std::size_t size = (propertyType[a] == Scalar::Float64) ? 8u
+                    : (propertyType[a] == Scalar::Float32 || propertyType[a] == Scalar::Int32 ||
+                       propertyType[a] == Scalar::UInt32) ? 4u
+                    : (propertyType[a] == Scalar::Int16 || propertyType[a] == Scalar::UInt16) ? 2u : 1u;
+                std::memcpy(bytes, record + propertyOffset[a], size);
+                if (swapBytes) std::reverse(bytes, bytes + size);
+                double value = 0.0;
+                switch (propertyType[a]) {
+                case Scalar::Int8: { int8_t v; std::memcpy(&v, bytes, 1); value = v; break; }
+                case Scalar::UInt8: { uint8_t v; std::memcpy(&v, bytes, 1); value = v; break; }
+                case Scalar::Int16: { int16_t v; std::memcpy(&v, bytes, 2); value = v; break; }
+                case Scalar::UInt16: { uint16_t v; std::memcpy(&v, bytes, 2); value = v; break; }
+                case Scalar::Int32: { int32_t v; std::memcpy(&v, bytes, 4); value = v; break; }
+                case Scalar::UInt32: { uint32_t v; std::memcpy(&v, bytes, 4); value = v; break; }
+                case Scalar::Float32: { float v; std::memcpy(&v, bytes, 4); value = v; break; }
+                case Scalar::Float64: { std::memcpy(&value, bytes, 8); break; }
+                }
+                out[3 * std::size_t(i) + a] = wrap ? wrap01(value) : value;
+            }
+        }
+    });
+    return true;
+}
+
+std::size_t PointFileReader::decodeAscii(const char* begin, const char* end, bool wrap, double* out) const {
+    const int lastColumn = std::max(column[0], std::max(column[1], column[2]));
+    const char* fileEnd = mapped + mappedSize;
+    std::size_t count = 0;
+    std::string lastLine;
+
+    for (const char* p = begin; p < end;) {
+        const char* e = lineEnd(p, end);
+        const char* next = e + 1;
+        if (!isPointLine(p, e)) {
+            p = next;
+            continue;
+        }
+        // strtod needs a terminator: the final line of the mapping has none
+        const char* line = p;
+        if (e == fileEnd) {
+            lastLine.assign(p, e);
+            line = lastLine.c_str();
+            e = line + lastLine.size();
+        }
+
+        double values[3] = { 0.0, 0.0, 0.0 };
+        bool ok = true;
+        const char* q = line;
+        for (int c = 0; c <= lastColumn && ok; ++c) {
+            char* parsed = nullptr;
+            const double v = std::strtod(q, &parsed);
+            ok = (parsed != q) && (parsed <= e);
+            q = parsed;
+            for (int a = 0; a < 3; ++a) {
+                if (column[a] == c) values[a] = v;
+            }
+        }
+        if (ok) {
+            for (int a = 0; a < 3; ++a) out[3 * count + a] = wrap ? wrap01(values[a]) : values[a];
+            ++count;
+        }
+        p = next;
+    }
+    return count;
+}
+
+bool PointFileReader::forEachChunk(std::size_t chunkPoints, bool wrap, const ChunkCallback& callback) {
+    if (mapped == nullptr) return false;
+    chunkPoints = std::max<std::size_t>(chunkPoints, 1);
+    std::vector<double> buffer;
+
+    if (!ascii) {
+        for (std::size_t first = 0; first < pointCount; first += chunkPoints) {
+            const std::size_t count = std::min(chunkPoints, pointCount - first);
+            buffer.resize(3u * count);
+            if (!decodeBinary(first, count, wrap, buffer.data()) || !callback(buffer.data(), count)) return false;
+        }
+        return true;
+    }
+
+    // ASCII: windows of about chunkPoints lines, split in pieces decoded in parallel
+    const char* end = mapped + dataEnd;
+    const double bytesPerPoint = (pointCount > 0) ? double(dataEnd - dataOffset) / double(pointCount) : 1.0;
+    const std::size_t windowBytes = std::max<std::size_t>(std::size_t(bytesPerPoint * double(chunkPoints)), 1);
+    const std::size_t nbPieces = std::size_t(GEO::Process::maximum_concurrent_threads()) * PIECES_PER_THREAD;
+    std::size_t decoded = 0;
+
+    for (const char* window = mapped + dataOffset; window < end;) {
+        const char* windowEnd = (std::size_t(end - window) <= windowBytes) ? end : lineEnd(window + windowBytes, end);
+        if (windowEnd < end) ++windowEnd;
+
+        const std::vector<const char*> bounds = splitAtLines(window, windowEnd, nbPieces);
+        const std::size_t pieces = bounds.size() - 1;
+        std::vector<std::size_t> offsets(pieces + 1, 0);
+        GEO::parallel_for(0, GEO::index_t(pieces), [&](GEO::index_t k) {
+            offsets[k + 1] = countPointLines(bounds[k], bounds[k + 1]);
+        });
+        for (std::size_t k = 0; k < pieces; ++k) offsets[k + 1] += offsets[k];
+
+        buffer.resize(3u * offsets[pieces]);
+        std::atomic<bool> malformed(false);
+        GEO::parallel_for(0, GEO::index_t(pieces), [&](GEO::index_t k) {
+            const std::size_t count = decodeAscii(bounds[k], bounds[k + 1], wrap, buffer.data() + 3u * offsets[k]);
+            if (count != offsets[k + 1] - offsets[k]) malformed = true;
+        });
+        if (malformed) {
+            std::cerr << "Point reader: malformed line after point " << decoded << std::endl;
+            return false;
+        }
+
+        decoded += offsets[pieces];
+        if (offsets[pieces] > 0 && !callback(buffer.data(), offsets[pieces])) return false;
+        window = windowEnd;
+    }
+    return true;
+}
+
+bool PointFileReader::readAll(std::vector<double>& points, bool wrap) {
+    points.clear();
+    points.reserve(3u * pointCount);
+    return forEachChunk(pointCount, wrap, [&](const double* chunk, std::size_t count) {
+        points.insert(points.end(), chunk, chunk + 3u * count);
+        return true;
+    });
+}
+
+const double* PointFileReader::getMappedPoints(bool wrap) {
+    if (mapped == nullptr || format != Format::RawFloat64) return nullptr;
+    double* points = reinterpret_cast<double*>(mapped);
+    if (wrap) {
+        GEO::parallel_for_slice(0, GEO::index_t(pointCount), [&](GEO::index_t b, GEO::index_t e) {
+            for (std::size_t c = 3u * std::size_t(b); c < 3u * std::size_t(e); ++c) {
+                // Only out-of-range values are written, untouched pages stay shared
+                if (points[c] < 0.0 || points[c] >= 1.0) points[c] = wrap01(points[c]);
+            }
+        });
+    }
+    return points;
+}
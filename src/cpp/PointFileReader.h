@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+// PointFileReader streams large point files for the native tools.
+//
+// The file is memory-mapped (POSIX mmap) and decoded in chunks, each chunk
+// split across the Geogram threads. Coordinates are wrapped into the unit
+// period while they are decoded, there is no separate wrapping pass.
+//
+// Formats:
+// - RawFloat64: packed x,y,z doubles. This is already the layout expected by
+//   PeriodicDelaunay3d::set_vertices(), getMappedPoints() exposes it without
+//   copy (the mapping is private, wrapping only copies the pages it changes).
+// - RawFloat32: packed x,y,z floats.
+// - AsciiXYZ:   one point per line, first three columns, '#' comments.
+// - PLY:        ascii or binary (little/big endian) vertex element with x,y,z
+//               properties of any scalar type. The vertex element must come
+//               first in the file.
+
+class PointFileReader {
+public:
+    enum class Format { Auto, RawFloat32, RawFloat64, AsciiXYZ, PLY };
+
+    // Receives count points (x,y,z packed), returns false to stop.
+    using ChunkCallback = std::function<bool(const double* points, std::size_t count)>;
+
+    PointFileReader();
+    ~PointFileReader();
+
+    PointFileReader(const PointFileReader&) = delete;
+    PointFileReader& operator=(const PointFileReader&) = delete;
+
+    // Maps the file and reads the header / counts the points. Auto picks the
+    // format from the extension (.ply, .xyz/.txt/.asc, .f32, anything else raw float64).
+    bool open(const std::string& path, Format format = Format::Auto);
+    void close();
+
+    Format getFormat() const { return format; }
+    std::size_t getPointCount() const { return pointCount; }
+
+    // Decodes the points in chunks of chunkPoints, in file order.
+    bool forEachChunk(std::size_t chunkPoints, bool wrap, const ChunkCallback& callback);
+
+    // Decodes all the points into points (3 doubles per point).
+    bool readAll(std::vector<double>& points, bool wrap);
+
+    // RawFloat64 only: the mapped coordinates themselves, wrapped in place
+    // when requested. Valid until close(). Returns nullptr for other formats.
+    const double* getMappedPoints(bool wrap);
+
+private:
+    // Scalar type of a PLY property
+    enum class Scalar { Int8, UInt8, Int16, UInt16, Int32, UInt32, Float32, Float64 };
+
+    bool parsePlyHeader();
+    bool countAsciiLines();
+    bool decodeBinary(std::size_t first, std::size_t count, bool wrap, double* out) const;
+    std::size_t decodeAscii(const char* begin, const char* end, bool wrap, double* out) const;
+
+    Format format;
+    int fd;
+    char* mapped;
+    std::size_t mappedSize;
+
+    std::size_t pointCount;
+    std::size_t dataOffset;  // first byte of the point data
+    std::size_t dataEnd;     // one past the last byte of the point data
+
+    // Binary records (raw and binary PLY)
+    std::size_t stride;
+    std::size_t propertyOffset[3];
+    Scalar propertyType[3];
+    bool swapBytes;
+
+    // ASCII records (AsciiXYZ and ascii PLY)
+    bool ascii;
+    int column[3];  // column of x, y, z
+};
@@ -0,0 +1,195 @@
+#include "SymmetricEigen3.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+// Geogram (PSM version vendored in this repo), for the thread slices
+#include "Delaunay_psm.h"
+
+// Eigen for the near-degenerate fallback
+#include <Eigen/Dense>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+namespace {
+
+// Below this many matrices the batch runs on the calling thread
+const std::size_t PARALLEL_THRESHOLD = 1u << 14;
+
+// The cross products of the rows of A - lambda0 I give the axis to about
+// FLT_EPSILON * |A| / (lambda0 - lambda1): below this relative gap the
+// iterative solver is used
+const float MIN_RELATIVE_GAP = 1e-3f;
+
+const float TWO_PI_OVER_3 = 2.0943951023931957f;
+
+// Largest eigenpair of the symmetric matrix with scaled entries (|a| <= 1),
+// from q = trace / 3, the deviation p and r = det((A - qI) / p) / 2, once the
+// angle phi = acos(r) / 3 is known. False if the spectrum is too degenerate.
+inline bool largestEigenpair(const float a[6], float q, float p, float phi, float lambda[3], float v[3]) {
+    lambda[0] = q + 2.0f * p * std::cos(phi);
+    lambda[2] = q + 2.0f * p * std::cos(phi + TWO_PI_OVER_3);
+    lambda[1] = 3.0f * q - lambda[0] - lambda[2];
+    if (!(lambda[0] - lambda[1] > MIN_RELATIVE_GAP * (std::fabs(q) + p))) return false;
+
+    // Rows of A - lambda0 I (a: xx xy xz yy yz zz), the best conditioned cross product
+    const float r0[3] = { a[0] - lambda[0], a[1], a[2] };
+    const float r1[3] = { a[1], a[3] - lambda[0], a[4] };
+    const float r2[3] = { a[2], a[4], a[5] - lambda[0] };
+    const float* rows[3][2] = { { r0, r1 }, { r0, r2 }, { r1, r2 } };
+    float best = 0.0f;
+    for (int k = 0; k < 3; ++k) {
+        const float* u = rows[k][0];
+        const float* w = rows[k][1];
+        const float c[3] = { u[1] * w[2] - u[2] * w[1], u[2] * w[0] - u[0] * w[2], u[0] * w[1] - u[1] * w[0] };
+        const float n2 = c[0] * c[0] + c[1] * c[1] + c[2] * c[2];
+        if (n2 > best) {
+            best = n2;
+            v[0] = c[0];
+            v[1] = c[1];
+            v[2] = c[2];
+        }
+    }
+    if (!(best > 0.0f)) return false;
+    const float inv = 1.0f / std::sqrt(best);
+    for (int c = 0; c < 3; ++c) v[c] *= inv;
+    return true;
+}
+
+inline float anisotropyOf(const float lambda[3]) {
+    return (lambda[0] > 0.0f) ? (lambda[0] - lambda[1]) / lambda[0] : 0.0f;
+}
+
+} // namespace
+
+void SymmetricEigen3Batch::resize(std::size_t count) {
+    for (std::vector<float>& e : entries) e.resize(count);
+    for (std::vector<float>& e : eigenvalues) e.resize(count);
+    for (std::vector<float>& a : axes) a.resize(count);
+    anisotropies.resize(count);
+}
+
+std::size_t SymmetricEigen3Batch::solveRange(std::size_t begin, std::size_t end) {
+    std::size_t fallbacks = 0;
+
+    // Iterative solver for one matrix, unscaled
+    auto fallback = [&](std::size_t i) {
+        Eigen::Matrix3f A;
+        A << entries[XX][i], entries[XY][i], entries[XZ][i],
+             entries[XY][i], entries[YY][i], entries[YZ][i],
+             entries[XZ][i], entries[YZ][i], entries[ZZ][i];
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3f> solver(A);
+        float lambda[3] = { 0.0f, 0.0f, 0.0f };
+        Eigen::Vector3f v(0.0f, 0.0f, 0.0f);
+        if (solver.info() == Eigen::Success) {
+            // Eigen sorts them in increasing order, stored in decreasing order
+            for (int k = 0; k < 3; ++k) lambda[k] = solver.eigenvalues()[2 - k];
+            v = solver.eigenvectors().col(2).normalized();
+        }
+        for (int k = 0; k < 3; ++k) eigenvalues[k][i] = lambda[k];
+        for (int c = 0; c < 3; ++c) axes[c][i] = v[c];
+        anisotropies[i] = anisotropyOf(lambda);
+        ++fallbacks;
+    };
+
+    // Eigenpair of matrix i from its scaled entries a, the scale and q, p, r
+    // (see largestEigenpair()), or the fallback
+    auto finish = [&](std::size_t i, const float a[6], float scale, float q, float p, float r) {
+        float lambda[3];
+        float v[3];
+        // NaNs (zero or non-finite scale) fail the comparisons
+        if (!(scale > 0.0f) || !std::isfinite(scale) || !(p > 0.0f) ||
+            !largestEigenpair(a, q, p, std::acos(r) * (1.0f / 3.0f), lambda, v)) {
+            fallback(i);
+            return;
+        }
+        for (int k = 0; k < 3; ++k) eigenvalues[k][i] = lambda[k] * scale;
+        for (int c = 0; c < 3; ++c) axes[c][i] = v[c];
+        anisotropies[i] = anisotropyOf(lambda);
+    };
+
+    // Closed form for one matrix
+    auto closedForm = [&](std::size_t i) {
+        float a[6];
+        float scale = 0.0f;
+        for (int e = 0; e < 6; ++e) {
+            a[e] = entries[e][i];
+            scale = std::max(scale, std::fabs(a[e]));
+        }
+        const float inv = 1.0f / scale;
+        for (float& x : a) x *= inv;
+        const float q = (a[0] + a[3] + a[5]) * (1.0f / 3.0f);
+        const float b0 = a[0] - q;
+        const float b3 = a[3] - q;
+        const float b5 = a[5] - q;
+        const float p2 = b0 * b0 + b3 * b3 + b5 * b5 + 2.0f * (a[1] * a[1] + a[2] * a[2] + a[4] * a[4]);
+        const float p = std::sqrt(p2 * (1.0f / 6.0f));
+        const float det = b0 * (b3 * b5 - a[4] * a[4]) - a[1] * (a[1] * b5 - a[4] * a[2]) +
+                          a[2] * (a[1] * a[4] - b3 * a[2]);
+        const float r = (p > 0.0f) ? std::min(1.0f, std::max(-1.0f, 0.5f * det / (p * p * p))) : 1.0f;
+        finish(i, a, scale, q, p, r);
+    };
+
+    std::size_t i = begin;
+#ifdef __wasm_simd128__
+    // Four matrices at a time; only acos / cos and the final eigenpair run per lane
+    const v128_t third = wasm_f32x4_splat(1.0f / 3.0f);
+    for (; i + 4 <= end; i += 4) {
+        v128_t a[6];
+        v128_t scale = wasm_f32x4_splat(0.0f);
+        for (int e = 0; e < 6; ++e) {
+            a[e] = wasm_v128_load(&entries[e][i]);
+            scale = wasm_f32x4_max(scale, wasm_f32x4_abs(a[e]));
+        }
+        const v128_t inv = wasm_f32x4_div(wasm_f32x4_splat(1.0f), scale);
+        for (v128_t& x : a) x = wasm_f32x4_mul(x, inv);
+        const v128_t q = wasm_f32x4_mul(wasm_f32x4_add(wasm_f32x4_add(a[0], a[3]), a[5]), third);
+        const v128_t b0 = wasm_f32x4_sub(a[0], q);
+        const v128_t b3 = wasm_f32x4_sub(a[3], q);
+        const v128_t b5 = wasm_f32x4_sub(a[5], q);
+        const v128_t offDiagonal = wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_mul(a[1], a[1]), wasm_f32x4_mul(a[2], a[2])),
+                                                  wasm_f32x4_mul(a[4], a[4]));
+        const v128_t p2 = wasm_f32x4_add(
+            wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_mul(b0, b0), wasm_f32x4_mul(b3, b3)), wasm_f32x4_mul(b5, b5)),
+            wasm_f32x4_add(offDiagonal, offDiagonal));
+        const v128_t p = wasm_f32x4_sqrt(wasm_f32x4_mul(p2, wasm_f32x4_splat(1.0f / 6.0f)));
+        const v128_t det = wasm_f32x4_add(
+            wasm_f32x4_sub(wasm_f32x4_mul(b0, wasm_f32x4_sub(wasm_f32x4_mul(b3, b5), wasm_f32x4_mul(a[4], a[4]))),
+                           wasm_f32x4_mul(a[1], wasm_f32x4_sub(wasm_f32x4_mul(a[1], b5), wasm_f32x4_mul(a[4], a[2])))),
+            wasm_f32x4_mul(a[2], wasm_f32x4_sub(wasm_f32x4_mul(a[1], a[4]), wasm_f32x4_mul(b3, a[2]))));
+        const v128_t r = wasm_f32x4_div(wasm_f32x4_mul(wasm_f32x4_splat(0.5f), det),
+                                        wasm_f32x4_mul(wasm_f32x4_mul(p, p), p));
+        const v128_t rClamped = wasm_f32x4_min(wasm_f32x4_splat(1.0f), wasm_f32x4_max(wasm_f32x4_splat(-1.0f), r));
+
+        float lanes[6][4];
+        float laneScale[4], laneQ[4], laneP[4], laneR[4];
+        for (int e = 0; e < 6; ++e) wasm_v128_store(lanes[e], a[e]);
+        wasm_v128_store(laneScale, scale);
+        wasm_v128_store(laneQ, q);
+        wasm_v128_store(laneP, p);
+        wasm_v128_store(laneR, rClamped);
+        for (int l = 0; l < 4; ++l) {
+            const float al[6] = { lanes[0][l], lanes[1][l], lanes[2][l], lanes[3][l], lanes[4][l], lanes[5][l] };
+            finish(i + l, al, laneScale[l], laneQ[l], laneP[l], laneR[l]);
+        }
+    }
+#endif
+    for (; i < end; ++i) closedForm(i);
+    return fallbacks;
+}
+
+void SymmetricEigen3Batch::solve() {
+    const std::size_t count = size();
+    if (count < PARALLEL_THRESHOLD) {
+        fallbackCount = solveRange(0, count);
+        return;
+    }
+    std::atomic<std::size_t> fallbacks(0);
+    GEO::parallel_for_slice(0, GEO::index_t(count), [&](GEO::index_t b, GEO::index_t e) {
+        fallbacks += solveRange(std::size_t(b), std::size_t(e));
+    });
+    fallbackCount = fallbacks;
+}
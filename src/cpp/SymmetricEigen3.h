@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+// SymmetricEigen3Batch computes the largest eigenpair of many symmetric 3x3
+// matrices (the per-particle covariances of the steering PCA) in one pass.
+//
+// The matrices are stored as structure of arrays (one array per unique
+// entry), filled with set(), then solve() runs the closed-form decomposition
+// (trigonometric solution of the characteristic polynomial, eigenvector from
+// the cross products of the rows of A - lambda I), four matrices per step in
+// the wasm simd128 builds. Matrices whose two largest eigenvalues are too
+// close for the cross products (near-degenerate spectra, isotropic clouds)
+// go through Eigen's iterative solver instead. Large batches are split
+// across the Geogram threads.
+//
+// Outputs, per matrix: the eigenvalues in decreasing order, the unit axis of
+// the largest one (sign arbitrary, zero if even the fallback fails, e.g. on
+// NaNs) and the anisotropy (lambda0 - lambda1) / lambda0, 0 for an isotropic
+// or non-positive matrix.
+// The storage is reused from call to call.
+
+class SymmetricEigen3Batch {
+public:
+    void resize(std::size_t count);
+    std::size_t size() const { return entries[XX].size(); }
+
+    void set(std::size_t i, float xx, float xy, float xz, float yy, float yz, float zz) {
+        entries[XX][i] = xx;
+        entries[XY][i] = xy;
+        entries[XZ][i] = xz;
+        entries[YY][i] = yy;
+        entries[YZ][i] = yz;
+        entries[ZZ][i] = zz;
+    }
+
+    void solve();
+
+    // k = 0 is the largest eigenvalue
+    float eigenvalue(std::size_t i, int k) const { return eigenvalues[k][i]; }
+    float axis(std::size_t i, int c) const { return axes[c][i]; }
+    float anisotropy(std::size_t i) const { return anisotropies[i]; }
+
+    // Matrices that took the iterative fallback in the last solve()
+    std::size_t getFallbackCount() const { return fallbackCount; }
+
+private:
+    enum Entry { XX, XY, XZ, YY, YZ, ZZ };
+
+    // Closed form over [begin, end), returns the number of fallbacks
+    std::size_t solveRange(std::size_t begin, std::size_t end);
+
+    std::vector<float> entries[6];
+    std::vector<float> eigenvalues[3];
+    std::vector<float> axes[3];
+    std::vector<float> anisotropies;
+    std::size_t fallbackCount = 0;
+};
@@ -0,0 +1,304 @@
+#include "TiledPeriodicDelaunay.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+// Records buffered per block before appending them to its scratch file
+const std::size_t FLUSH_THRESHOLD = 4096;
+
+// Automatic ghost width, in mean point spacings (N^-1/3)
+const double GHOST_SPACINGS = 4.0;
+
+// Tets passed to the sink at once
+const std::size_t TET_BATCH = 4096;
+
+inline double wrap01(double x) {
+    x -= std::floor(x);
+    return (x >= 1.0) ? 0.0 : x;
+}
+
+// Circumcenter relative to p0 and squared radius (infinite for flat tets)
+inline void circumsphere(const GEO::vec3& p0, const GEO::vec3& p1, const GEO::vec3& p2, const GEO::vec3& p3,
+                         GEO::vec3& center, double& radius2) {
+    const GEO::vec3 a = p1 - p0;
+    const GEO::vec3 b = p2 - p0;
+    const GEO::vec3 c = p3 - p0;
+    const double denominator = 2.0 * GEO::dot(a, GEO::cross(b, c));
+    if (denominator == 0.0) {
+        center = p0;
+        radius2 = std::numeric_limits<double>::infinity();
+        return;
+    }
+    const GEO::vec3 offset = (GEO::length2(a) * GEO::cross(b, c) +
+                              GEO::length2(b) * GEO::cross(c, a) +
+                              GEO::length2(c) * GEO::cross(a, b)) / denominator;
+    center = p0 + offset;
+    radius2 = GEO::length2(offset);
+}
+
+} // namespace
+
+TiledPeriodicDelaunay::TiledPeriodicDelaunay(int tilesPerAxis, double ghostWidth, const std::string& scratchDir)
+    : tiles(std::max(1, tilesPerAxis)), ghostWidth(ghostWidth), scratchDir(scratchDir), nextIndex(0) {}
+
+std::string TiledPeriodicDelaunay::blockPath(int block) const {
+    return scratchDir + "/block_" + std::to_string(block) + ".pts";
+}
+
+std::string TiledPeriodicDelaunay::metaPath() const {
+    return scratchDir + "/tiles.meta";
+}
+
+bool TiledPeriodicDelaunay::beginDistribution(uint64_t expectedPoints) {
+    const double blockSize = 1.0 / tiles;
+    if (ghostWidth <= 0.0) {
+        if (expectedPoints == 0) {
+            std::cerr << "Tiled Delaunay: the ghost width needs the number of points." << std::endl;
+            return false;
+        }
+        ghostWidth = std::min(GHOST_SPACINGS * std::cbrt(1.0 / double(expectedPoints)), blockSize);
+    }
+    // Ghosts only go to adjacent blocks
+    if (ghostWidth > blockSize) {
+        std::cerr << "Tiled Delaunay: ghost width " << ghostWidth << " exceeds the block size "
+                  << blockSize << ", use fewer tiles." << std::endl;
+        return false;
+    }
+
+    nextIndex = 0;
+    pending.assign(std::size_t(getBlockCount()), std::vector<BlockPoint>());
+    for (int b = 0; b < getBlockCount(); ++b) {
+        std::ofstream file(blockPath(b), std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "Tiled Delaunay: cannot create " << blockPath(b) << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TiledPeriodicDelaunay::flushBlock(int block) {
+    std::vector<BlockPoint>& records = pending[std::size_t(block)];
+    if (records.empty()) return true;
+    std::ofstream file(blockPath(block), std::ios::binary | std::ios::app);
+    file.write(reinterpret_cast<const char*>(records.data()), std::streamsize(records.size() * sizeof(BlockPoint)));
+    records.clear();
+    if (!file) {
+        std::cerr << "Tiled Delaunay: cannot write " << blockPath(block) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool TiledPeriodicDelaunay::addPoints(const double* points, std::size_t numPoints) {
+    if (pending.empty()) {
+        std::cerr << "Tiled Delaunay: addPoints() called before beginDistribution()." << std::endl;
+        return false;
+    }
+    if (nextIndex + numPoints > uint64_t(std::numeric_limits<uint32_t>::max())) {
+        std::cerr << "Tiled Delaunay: too many points for 32-bit indices." << std::endl;
+        return false;
+    }
+
+    const double blockSize = 1.0 / tiles;
+    for (std::size_t i = 0; i < numPoints; ++i) {
+        double p[3];
+        // Per axis: the owner block, then the neighbors whose ghost layer holds an image
+        int axisBlock[3][3];
+        int axisShift[3][3];
+        int axisCount[3];
+        for (int a = 0; a < 3; ++a) {
+            p[a] = wrap01(points[3 * i + a]);
+            const int c = std::min(int(p[a] * tiles), tiles - 1);
+            axisBlock[a][0] = c;
+            axisShift[a][0] = 0;
+            axisCount[a] = 1;
+            if (p[a] - c * blockSize < ghostWidth) {
+                axisBlock[a][axisCount[a]] = (c == 0) ? tiles - 1 : c - 1;
+                axisShift[a][axisCount[a]] = (c == 0) ? 1 : 0;
+                ++axisCount[a];
+            }
+            if ((c + 1) * blockSize - p[a] < ghostWidth) {
+                axisBlock[a][axisCount[a]] = (c == tiles - 1) ? 0 : c + 1;
+                axisShift[a][axisCount[a]] = (c == tiles - 1) ? -1 : 0;
+                ++axisCount[a];
+            }
+        }
+
+        for (int ix = 0; ix < axisCount[0]; ++ix) {
+            for (int iy = 0; iy < axisCount[1]; ++iy) {
+                for (int iz = 0; iz < axisCount[2]; ++iz) {
+                    BlockPoint record;
+                    const int k[3] = { ix, iy, iz };
+                    for (int a = 0; a < 3; ++a) {
+                        record.shift[a] = int8_t(axisShift[a][k[a]]);
+                        record.position[a] = p[a] + axisShift[a][k[a]];
+                    }
+                    record.index = uint32_t(nextIndex);
+                    record.owned = (ix == 0 && iy == 0 && iz == 0) ? 1 : 0;
+                    const int block = (axisBlock[0][ix] * tiles + axisBlock[1][iy]) * tiles + axisBlock[2][iz];
+                    pending[std::size_t(block)].push_back(record);
+                    if (pending[std::size_t(block)].size() >= FLUSH_THRESHOLD && !flushBlock(block)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        ++nextIndex;
+    }
+    return true;
+}
+
+bool TiledPeriodicDelaunay::endDistribution() {
+    bool ok = true;
+    for (int b = 0; b < int(pending.size()); ++b) {
+        ok = flushBlock(b) && ok;
+    }
+    pending.clear();
+    pending.shrink_to_fit();
+
+    std::ofstream meta(metaPath(), std::ios::trunc);
+    meta.precision(17);
+    meta << tiles << " " << ghostWidth << " " << nextIndex << std::endl;
+    return ok && bool(meta);
+}
+
+bool TiledPeriodicDelaunay::openDistribution() {
+    std::ifstream meta(metaPath());
+    int metaTiles = 0;
+    if (!(meta >> metaTiles >> ghostWidth >> nextIndex) || metaTiles < 1) {
+        std::cerr << "Tiled Delaunay: no distribution in " << scratchDir << std::endl;
+        return false;
+    }
+    tiles = metaTiles;
+    return true;
+}
+
+void TiledPeriodicDelaunay::removeScratchFiles() const {
+    for (int b = 0; b < getBlockCount(); ++b) {
+        std::remove(blockPath(b).c_str());
+    }
+    std::remove(metaPath().c_str());
+}
+
+bool TiledPeriodicDelaunay::triangulateBlock(int block, const TetSink& sink, BlockReport& report) const {
+    report = BlockReport();
+    if (block < 0 || block >= getBlockCount()) return false;
+
+    GEO::Stopwatch watch("block", false);
+
+    std::vector<BlockPoint> records;
+    {
+        std::ifstream file(blockPath(block), std::ios::binary | std::ios::ate);
+        if (!file) {
+            std::cerr << "Tiled Delaunay: cannot read " << blockPath(block) << std::endl;
+            return false;
+        }
+        const std::streamoff size = file.tellg();
+        records.resize(std::size_t(size) / sizeof(BlockPoint));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(records.data()), std::streamsize(records.size() * sizeof(BlockPoint)));
+        if (!file) return false;
+    }
+
+    std::vector<double> vertices(records.size() * 3u);
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        vertices[3 * i] = records[i].position[0];
+        vertices[3 * i + 1] = records[i].position[1];
+        vertices[3 * i + 2] = records[i].position[2];
+        if (records[i].owned) ++report.ownedPoints; else ++report.ghostPoints;
+    }
+    if (report.ownedPoints == 0) {
+        report.seconds = watch.elapsed_time();
+        return true;
+    }
+    if (records.size() < 4) {
+        std::cerr << "Tiled Delaunay: block " << block << " has fewer than 4 points." << std::endl;
+        return false;
+    }
+
+    std::unique_ptr<GEO::PeriodicDelaunay3d> delaunay = std::make_unique<GEO::PeriodicDelaunay3d>(false);
+    delaunay->set_stores_cicl(false);
+    delaunay->set_vertices(GEO::index_t(records.size()), vertices.data());
+    try {
+        delaunay->compute();
+    } catch (...) {
+        return false;
+    }
+
+    // Block extended by the ghost layer, circumspheres of owned tets must fit inside
+    const double blockSize = 1.0 / tiles;
+    const int bc[3] = { block / (tiles * tiles), (block / tiles) % tiles, block % tiles };
+    double regionMin[3];
+    double regionMax[3];
+    for (int a = 0; a < 3; ++a) {
+        regionMin[a] = bc[a] * blockSize - ghostWidth;
+        regionMax[a] = (bc[a] + 1) * blockSize + ghostWidth;
+    }
+
+    std::vector<Tet> batch;
+    batch.reserve(TET_BATCH);
+    for (GEO::index_t t = 0; t < delaunay->nb_cells(); ++t) {
+        GEO::index_t local[4];
+        bool finite = true;
+        for (GEO::index_t lv = 0; lv < 4; ++lv) {
+            local[lv] = delaunay->cell_vertex(t, lv);
+            finite = finite && (local[lv] != GEO::NO_INDEX);
+        }
+        if (!finite) continue;
+
+        // Owned by the block holding the canonical copy of the smallest index
+        GEO::index_t owner = local[0];
+        for (GEO::index_t lv = 1; lv < 4; ++lv) {
+            const BlockPoint& r = records[local[lv]];
+            if (r.index < records[owner].index || (r.index == records[owner].index && r.owned)) owner = local[lv];
+        }
+        if (!records[owner].owned) continue;
+
+        const GEO::vec3 p0(records[local[0]].position);
+        const GEO::vec3 p1(records[local[1]].position);
+        const GEO::vec3 p2(records[local[2]].position);
+        const GEO::vec3 p3(records[local[3]].position);
+
+        GEO::vec3 center;
+        double radius2 = 0.0;
+        circumsphere(p0, p1, p2, p3, center, radius2);
+        const double radius = std::sqrt(radius2);
+        bool certified = std::isfinite(radius);
+        for (int a = 0; a < 3 && certified; ++a) {
+            certified = (center[a] - radius >= regionMin[a]) && (center[a] + radius <= regionMax[a]);
+        }
+        if (!certified) ++report.uncertifiedTets;
+
+        Tet tet;
+        for (int lv = 0; lv < 4; ++lv) {
+            const BlockPoint& r = records[local[lv]];
+            tet.vertices[lv] = r.index;
+            for (int a = 0; a < 3; ++a) {
+                tet.offsets[3 * lv + a] = int8_t(r.shift[a] - records[local[0]].shift[a]);
+            }
+        }
+        batch.push_back(tet);
+        report.ownedVolume += GEO::Geom::tetra_volume(p0, p1, p2, p3);
+        ++report.ownedTets;
+
+        if (batch.size() == TET_BATCH) {
+            sink(batch.data(), batch.size());
+            batch.clear();
+        }
+    }
+    if (!batch.empty()) sink(batch.data(), batch.size());
+
+    report.seconds = watch.elapsed_time();
+    return true;
+}
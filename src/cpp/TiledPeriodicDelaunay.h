@@ -0,0 +1,98 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+// TiledPeriodicDelaunay triangulates a periodic point set of the unit cube
+// that does not fit in a single PeriodicDelaunay3d, one block at a time.
+//
+// The periodic box is split in tilesPerAxis^3 blocks. Pass 1 (distribution)
+// streams the points into one scratch file per block: the points of the block
+// itself ("owned") plus the periodic images of the points that lie within
+// ghostWidth of its faces ("ghosts"). Pass 2 triangulates each block file
+// independently with a non-periodic PeriodicDelaunay3d, so memory is bounded
+// by the block size, and emits the tets it owns: a tet is owned by the block
+// that holds the canonical (non-ghost) copy of its smallest vertex index. Each
+// tet of the periodic triangulation is thus emitted exactly once over all
+// blocks. Blocks are independent and can be processed by separate processes
+// sharing the scratch directory.
+//
+// Seam consistency:
+// - an owned tet is certified when its circumsphere lies inside the block
+//   extended by the ghost layer (no missing point can violate it);
+//   uncertified tets are reported, and mean the ghost layer is too thin,
+// - the owned tet volumes of all blocks sum to 1 when the seams neither
+//   duplicate nor drop tets.
+//
+// Only the unweighted (Delaunay) case is supported.
+
+class TiledPeriodicDelaunay {
+public:
+    // One tet of the periodic triangulation, in global point indices.
+    // offsets[3*k..3*k+2] is the periodic translation of vertex k relative
+    // to vertex 0, as in AlphaFiltration.
+    struct Tet {
+        uint32_t vertices[4];
+        int8_t offsets[12];
+    };
+
+    struct BlockReport {
+        uint64_t ownedPoints = 0;
+        uint64_t ghostPoints = 0;
+        uint64_t ownedTets = 0;
+        uint64_t uncertifiedTets = 0;
+        double ownedVolume = 0.0;
+        double seconds = 0.0;
+    };
+
+    using TetSink = std::function<void(const Tet* tets, std::size_t count)>;
+
+    // ghostWidth <= 0 picks a width from the point density at beginDistribution().
+    TiledPeriodicDelaunay(int tilesPerAxis, double ghostWidth, const std::string& scratchDir);
+
+    int getBlockCount() const { return tiles * tiles * tiles; }
+    double getGhostWidth() const { return ghostWidth; }
+
+    // Pass 1: stream the points (x,y,z packed, wrapped into [0,1)), indices are
+    // assigned in order of arrival. expectedPoints is used for the automatic
+    // ghost width.
+    bool beginDistribution(uint64_t expectedPoints);
+    bool addPoints(const double* points, std::size_t numPoints);
+    bool endDistribution();
+
+    // Reads the tiling and ghost width written by endDistribution(), for a
+    // process that only runs pass 2 on an existing scratch directory.
+    bool openDistribution();
+
+    uint64_t getPointCount() const { return nextIndex; }
+
+    // Pass 2: triangulate one block from its scratch file and emit its owned tets.
+    // Geogram must have been initialized.
+    bool triangulateBlock(int block, const TetSink& sink, BlockReport& report) const;
+
+    // Deletes the block files and the tiling description from the scratch directory.
+    void removeScratchFiles() const;
+
+private:
+    // Scratch file record: translated position, global index, periodic shift
+    struct BlockPoint {
+        double position[3];
+        uint32_t index;
+        int8_t shift[3];
+        uint8_t owned;
+    };
+
+    std::string blockPath(int block) const;
+    std::string metaPath() const;
+    bool flushBlock(int block);
+
+    int tiles;
+    double ghostWidth;
+    std::string scratchDir;
+
+    uint64_t nextIndex;
+    std::vector<std::vector<BlockPoint>> pending;
+};
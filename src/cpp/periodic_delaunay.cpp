@@ -6,20 +6,53 @@
 #include <vector>
 #include <set>
 #include <algorithm>
+#include <cmath>
 #include "ParticleSystem.h"
+#include "AlphaFiltration.h"
+#include "BoundedVoronoi.h"
+#include "KnnVoronoi.h"
+#include "PeriodicDelaunay2d.h"
+#include "GeogramInit.h"
+#include "PointBuffer.h"
 #include <cstdint>
 
-// Global initialization flag
-static bool g_geogram_initialized = false;
+// Points staged for Geogram, reused from call to call (calls from JS are synchronous)
+static PointBuffer g_points;
 
-// Initialize Geogram once
-void initialize_geogram() {
-    if (!g_geogram_initialized) {
-        // Initialize Geogram using the PSM's initialize function
-        GEO::initialize();
-        g_geogram_initialized = true;
-        std::cout << "Geogram initialized." << std::endl;
+// Spatial order of the tets returned by compute_delaunay (see PeriodicDelaunay3d::set_cell_order)
+static GEO::PeriodicDelaunay3d::CellOrder g_cell_order = GEO::PeriodicDelaunay3d::CELL_ORDER_NONE;
+
+// 0: pool order (default), 1: Hilbert curve, 2: Morton curve
+void set_delaunay_cell_order_js(int order) {
+    g_cell_order = (order == 1) ? GEO::PeriodicDelaunay3d::CELL_ORDER_HILBERT
+                 : (order == 2) ? GEO::PeriodicDelaunay3d::CELL_ORDER_MORTON
+                                : GEO::PeriodicDelaunay3d::CELL_ORDER_NONE;
+}
+
+// Copy num_points xyz triplets from a JS array or typed array (Float32Array,
+// Float64Array, ...) into g_points, wrapping into [0,1) in periodic mode.
+// A single TypedArray.set() converts the values straight into the wasm-side doubles.
+static bool read_points_js(emscripten::val points_array, int num_points, bool is_periodic, const char* caller) {
+    const std::size_t count = static_cast<std::size_t>(num_points < 0 ? 0 : num_points) * 3u;
+    const double length = points_array["length"].isUndefined() ? 0.0 : points_array["length"].as<double>();
+    if (num_points < 0 || length < double(count)) {
+        std::cerr << caller << ": expected " << num_points * 3 << " coordinates." << std::endl;
+        return false;
+    }
+    double* coords = g_points.resize(static_cast<std::size_t>(num_points));
+    if (count > 0) {
+        emscripten::val source = points_array;
+        if (length > double(count)) {
+            const bool typed = emscripten::val::global("ArrayBuffer").call<bool>("isView", points_array);
+            source = points_array.call<emscripten::val>(typed ? "subarray" : "slice", 0, double(count));
+        }
+        // The view must not outlive a heap growth: nothing allocates before set()
+        emscripten::val(emscripten::typed_memory_view(count, coords)).call<void>("set", source);
+    }
+    if (is_periodic) {
+        g_points.wrapInPlace();
     }
+    return true;
 }
 
 // Wrapper function that uses Emscripten's val for easier JavaScript interaction
@@ -38,22 +71,17 @@ emscripten::val compute_periodic_delaunay_js(emscripten::val points_array, int n
     }
     
     delaunay->set_stores_cicl(false);
+    delaunay->set_cell_order(g_cell_order);
 
     std::cout << "Delaunay object created. Periodic mode: " << is_periodic << std::endl;
     std::cout << "Processing " << num_points << " points." << std::endl;
 
     // --- 3. Get points from JavaScript array ---
-    std::vector<double> vertices;
-    vertices.reserve(num_points * 3);
-    
-    // Extract points from JavaScript Float64Array
-    for (int i = 0; i < num_points * 3; i++) {
-        double coord = points_array[i].as<double>();
-        // Ensure coordinates are in [0,1) range
-        while (coord < 0.0) coord += 1.0;
-        while (coord >= 1.0) coord -= 1.0;
-        vertices.push_back(coord);
+    // Coordinates are brought into [0,1) in both modes
+    if (!read_points_js(points_array, num_points, true, "Delaunay")) {
+        return emscripten::val::null();
     }
+    const double* vertices = g_points.data();
     
     // Print first few points for debugging
     std::cout << "First 3 points:" << std::endl;
@@ -65,7 +93,7 @@ emscripten::val compute_periodic_delaunay_js(emscripten::val points_array, int n
     }
 
     // --- 4. Set vertices ---
-    delaunay->set_vertices(num_points, vertices.data());
+    delaunay->set_vertices(num_points, vertices);
     std::cout << "Vertices set. Actual vertex count: " << delaunay->nb_vertices() << std::endl;
 
     // --- 5. Compute ---
@@ -169,9 +197,113 @@ emscripten::val compute_periodic_delaunay_js(emscripten::val points_array, int n
     return result;
 }
 
+// Copy optional per-point radii from a JS array (null/undefined leaves radii empty)
+static bool read_radii_js(emscripten::val radii_array, int num_points,
+                          std::vector<double>& radii, const char* caller) {
+    radii.clear();
+    if (radii_array.isNull() || radii_array.isUndefined()) {
+        return true;
+    }
+    radii = emscripten::convertJSArrayToNumberVector<double>(radii_array);
+    if (radii.size() < static_cast<std::size_t>(num_points)) {
+        std::cerr << caller << ": expected " << num_points << " radii." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Alpha-complex filtration from JS arrays (radii may be null/undefined for the unweighted case)
+bool compute_alpha_filtration_js(AlphaFiltration& self, emscripten::val points_array, int num_points,
+                                 emscripten::val radii_array, bool is_periodic) {
+    initialize_geogram();
+
+    std::vector<double> radii;
+    if (!read_points_js(points_array, num_points, is_periodic, "Alpha filtration") ||
+        !read_radii_js(radii_array, num_points, radii, "Alpha filtration")) {
+        return false;
+    }
+
+    return self.compute(g_points.data(), static_cast<std::size_t>(num_points),
+                        radii.empty() ? nullptr : radii.data(), is_periodic);
+}
+
+// Bounded (box-clipped) Voronoi/Laguerre cells for the non-periodic mode
+bool compute_bounded_voronoi_js(BoundedVoronoi& self, emscripten::val points_array, int num_points,
+                                emscripten::val radii_array) {
+    initialize_geogram();
+
+    std::vector<double> radii;
+    if (!read_points_js(points_array, num_points, false, "Bounded Voronoi") ||
+        !read_radii_js(radii_array, num_points, radii, "Bounded Voronoi")) {
+        return false;
+    }
+
+    return self.compute(g_points.data(), static_cast<std::size_t>(num_points),
+                        radii.empty() ? nullptr : radii.data());
+}
+
+// Delaunay-free Voronoi cells (grid kNN + convex cell clipping)
+bool compute_knn_voronoi_js(KnnVoronoi& self, emscripten::val points_array, int num_points, bool is_periodic) {
+    initialize_geogram();
+
+    if (!read_points_js(points_array, num_points, is_periodic, "kNN Voronoi")) {
+        return false;
+    }
+
+    return self.compute(g_points.data(), static_cast<std::size_t>(num_points), is_periodic);
+}
+
+// Points x,y in the unit square, wrapped into [0,1) in periodic mode
+static std::vector<double> g_points_2d;
+
+// 2D Delaunay triangulation and Voronoi polygons, periodic or clipped by the square
+bool compute_periodic_delaunay_2d_js(PeriodicDelaunay2d& self, emscripten::val points_array, int num_points,
+                                     bool is_periodic) {
+    initialize_geogram();
+
+    const std::size_t count = static_cast<std::size_t>(num_points < 0 ? 0 : num_points) * 2u;
+    const double length = points_array["length"].isUndefined() ? 0.0 : points_array["length"].as<double>();
+    if (num_points < 0 || length < double(count)) {
+        std::cerr << "Periodic Delaunay 2d: expected " << num_points * 2 << " coordinates." << std::endl;
+        return false;
+    }
+    g_points_2d.resize(count);
+    if (count > 0) {
+        emscripten::val source = points_array;
+        if (length > double(count)) {
+            const bool typed = emscripten::val::global("ArrayBuffer").call<bool>("isView", points_array);
+            source = points_array.call<emscripten::val>(typed ? "subarray" : "slice", 0, double(count));
+        }
+        emscripten::val(emscripten::typed_memory_view(count, g_points_2d.data())).call<void>("set", source);
+    }
+    if (is_periodic) {
+        for (double& c : g_points_2d) {
+            c -= std::floor(c);
+            if (c >= 1.0) c = 0.0;
+        }
+    }
+
+    return self.compute(g_points_2d.data(), static_cast<std::size_t>(num_points), is_periodic);
+}
+
+// Tabulated pair potential of a ParticleSystem from a JS array or typed array
+bool set_pair_potential_table_js(ParticleSystem& self, emscripten::val values_array, float range) {
+    const std::vector<float> values = emscripten::convertJSArrayToNumberVector<float>(values_array);
+    if (!self.setPairPotentialTable(values.data(), values.size(), range)) {
+        std::cerr << "Pair potential table: expected 2 to " << ParticleSystem::MAX_POTENTIAL_TABLE_SIZE
+                  << " values and a positive range." << std::endl;
+        return false;
+    }
+    return true;
+}
+
 // --- 7. Embind module ---
 EMSCRIPTEN_BINDINGS(my_module) {
     emscripten::function("compute_delaunay", &compute_periodic_delaunay_js);
+    emscripten::function("set_delaunay_cell_order", &set_delaunay_cell_order_js);
+    // Optional: warm Geogram up before the first compute (e.g. while the page is idle)
+    emscripten::function("initialize_geogram", &initialize_geogram);
+    emscripten::function("geogram_init_seconds", &geogram_init_seconds);
 
     using emscripten::optional_override;
 
@@ -208,10 +340,195 @@ EMSCRIPTEN_BINDINGS(my_module) {
         .function("getFaceAxisBufferByteOffset", optional_override([](ParticleSystem& self) {
             return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFaceAxisBufferPtr()));
         }))
+        // Topology changes of the last steering pass (dirty ranges: Uint32Array of (first vertex, vertex count) pairs)
+        .function("getChangedStarCount", optional_override([](const ParticleSystem& self) {
+            return static_cast<uint32_t>(self.getChangedStarCount());
+        }))
+        .function("getFaceDirtyRangeCount", optional_override([](const ParticleSystem& self) {
+            return static_cast<uint32_t>(self.getFaceDirtyRangeCount());
+        }))
+        .function("getFaceDirtyRangeBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFaceDirtyRangeBufferPtr()));
+        }))
+        .function("wasFaceLayoutReset", &ParticleSystem::wasFaceLayoutReset)
         .function("setSteeringStrength", &ParticleSystem::setSteeringStrength)
         .function("setRepulsionStrength", &ParticleSystem::setRepulsionStrength)
         .function("setDamping", &ParticleSystem::setDamping)
         .function("setSteeringEveryNFrames", &ParticleSystem::setSteeringEveryNFrames)
         .function("setMinSpeed", &ParticleSystem::setMinSpeed)
-        .function("setMaxSpeed", &ParticleSystem::setMaxSpeed);
+        .function("setMaxSpeed", &ParticleSystem::setMaxSpeed)
+        .function("setDimension", &ParticleSystem::setDimension)
+        .function("getDimension", &ParticleSystem::getDimension)
+        // 2D only: Voronoi polygons (Uint32Array offsets, particleCount+1; Float32Array x,y)
+        .function("getCellPolygonVertexCount", optional_override([](const ParticleSystem& self) {
+            return static_cast<uint32_t>(self.getCellPolygonVertexCount());
+        }))
+        .function("getCellPolygonOffsetBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getCellPolygonOffsetBufferPtr()));
+        }))
+        .function("getCellPolygonVertexBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getCellPolygonVertexBufferPtr()));
+        }))
+        .function("setFixedPoint", &ParticleSystem::setFixedPoint)
+        .function("isFixedPoint", &ParticleSystem::isFixedPoint)
+        .function("setPeriodicWarmStart", &ParticleSystem::setPeriodicWarmStart)
+        .function("isPeriodicWarmStart", &ParticleSystem::isPeriodicWarmStart)
+        .function("setSteeringSource", &ParticleSystem::setSteeringSource)
+        .function("getSteeringSource", &ParticleSystem::getSteeringSource)
+        .function("setPairPotential", &ParticleSystem::setPairPotential)
+        .function("getPairPotential", &ParticleSystem::getPairPotential)
+        .function("setCohesion", &ParticleSystem::setCohesion)
+        .function("setPairPotentialTable", &set_pair_potential_table_js)
+        .function("getPairPotentialTableSize", optional_override([](const ParticleSystem& self) {
+            return static_cast<uint32_t>(self.getPairPotentialTableSize());
+        }))
+        .function("setDelaunayPairList", &ParticleSystem::setDelaunayPairList)
+        .function("isDelaunayPairList", &ParticleSystem::isDelaunayPairList)
+        .function("getPairListFrameCount", optional_override([](const ParticleSystem& self) {
+            return static_cast<uint32_t>(self.getPairListFrameCount());
+        }))
+        .function("getPairListFallbackCount", optional_override([](const ParticleSystem& self) {
+            return static_cast<uint32_t>(self.getPairListFallbackCount());
+        }))
+        .function("getPairListUncoveredCount", optional_override([](const ParticleSystem& self) {
+            return static_cast<uint32_t>(self.getPairListUncoveredCount());
+        }))
+        .function("setContactExport", &ParticleSystem::setContactExport)
+        .function("isContactExport", &ParticleSystem::isContactExport)
+        .function("getContactCount", optional_override([](const ParticleSystem& self) {
+            return static_cast<uint32_t>(self.getContactCount());
+        }))
+        // Uint32Array view (i, j per contact)
+        .function("getContactPairBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getContactPairBufferPtr()));
+        }))
+        // Float32Array views (1 per contact)
+        .function("getContactOverlapBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getContactOverlapBufferPtr()));
+        }))
+        .function("getContactForceBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getContactForceBufferPtr()));
+        }))
+        // Int8Array view (3 per contact)
+        .function("getContactOffsetBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getContactOffsetBufferPtr()));
+        }))
+        // Uint32Array view (1 per particle)
+        .function("getCoordinationBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getCoordinationBufferPtr()));
+        }))
+        // Uint32Array view (3 per particle), 0 unless fixed point is enabled
+        .function("getFixedPositionBufferByteOffset", optional_override([](ParticleSystem& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFixedPositionBufferPtr()));
+        }));
+
+    // Alpha-complex filtration (sorted simplices with squared alpha values)
+    emscripten::class_<AlphaFiltration>("AlphaFiltration")
+        .constructor<>()
+        .function("compute", &compute_alpha_filtration_js)
+        .function("getSimplexCount", optional_override([](const AlphaFiltration& self) {
+            return static_cast<uint32_t>(self.getSimplexCount());
+        }))
+        .function("getSimplexCountOfDimension", optional_override([](const AlphaFiltration& self, int dimension) {
+            return static_cast<uint32_t>(self.getSimplexCount(dimension));
+        }))
+        .function("getValueBufferByteOffset", optional_override([](AlphaFiltration& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getValueBufferPtr()));
+        }))
+        .function("getVertexBufferByteOffset", optional_override([](AlphaFiltration& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getVertexBufferPtr()));
+        }))
+        .function("getBoundaryBufferByteOffset", optional_override([](AlphaFiltration& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getBoundaryBufferPtr()));
+        }))
+        .function("getOffsetBufferByteOffset", optional_override([](AlphaFiltration& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getOffsetBufferPtr()));
+        }));
+
+    // Bounded Voronoi cells clipped to the domain box (non-periodic mode)
+    emscripten::class_<BoundedVoronoi>("BoundedVoronoi")
+        .constructor<>()
+        .function("setBox", &BoundedVoronoi::setBox)
+        .function("compute", &compute_bounded_voronoi_js)
+        .function("getCellCount", optional_override([](const BoundedVoronoi& self) {
+            return static_cast<uint32_t>(self.getCellCount());
+        }))
+        .function("getFaceCount", optional_override([](const BoundedVoronoi& self) {
+            return static_cast<uint32_t>(self.getFaceCount());
+        }))
+        .function("getPolygonVertexCount", optional_override([](const BoundedVoronoi& self) {
+            return static_cast<uint32_t>(self.getPolygonVertexCount());
+        }))
+        .function("getVolumeBufferByteOffset", optional_override([](BoundedVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getVolumeBufferPtr()));
+        }))
+        .function("getFaceOffsetBufferByteOffset", optional_override([](BoundedVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFaceOffsetBufferPtr()));
+        }))
+        .function("getFaceNeighborBufferByteOffset", optional_override([](BoundedVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFaceNeighborBufferPtr()));
+        }))
+        .function("getFaceAreaBufferByteOffset", optional_override([](BoundedVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFaceAreaBufferPtr()));
+        }))
+        .function("getPolygonOffsetBufferByteOffset", optional_override([](BoundedVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getPolygonOffsetBufferPtr()));
+        }))
+        .function("getPolygonVertexBufferByteOffset", optional_override([](BoundedVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getPolygonVertexBufferPtr()));
+        }));
+
+    // 2D Delaunay triangles and Voronoi polygons (periodic or clipped by the square)
+    emscripten::class_<PeriodicDelaunay2d>("PeriodicDelaunay2d")
+        .constructor<>()
+        .function("compute", &compute_periodic_delaunay_2d_js)
+        .function("getPointCount", optional_override([](const PeriodicDelaunay2d& self) {
+            return static_cast<uint32_t>(self.getPointCount());
+        }))
+        .function("getTriangleCount", optional_override([](const PeriodicDelaunay2d& self) {
+            return static_cast<uint32_t>(self.getTriangleCount());
+        }))
+        .function("getCellVertexCount", optional_override([](const PeriodicDelaunay2d& self) {
+            return static_cast<uint32_t>(self.getCellVertexCount());
+        }))
+        .function("getGhostWidth", &PeriodicDelaunay2d::getGhostWidth)
+        .function("getTriangleBufferByteOffset", optional_override([](PeriodicDelaunay2d& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getTriangleBufferPtr()));
+        }))
+        .function("getTriangleOffsetBufferByteOffset", optional_override([](PeriodicDelaunay2d& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getTriangleOffsetBufferPtr()));
+        }))
+        .function("getCellOffsetBufferByteOffset", optional_override([](PeriodicDelaunay2d& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getCellOffsetBufferPtr()));
+        }))
+        .function("getCellVertexBufferByteOffset", optional_override([](PeriodicDelaunay2d& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getCellVertexBufferPtr()));
+        }))
+        .function("getCellAreaBufferByteOffset", optional_override([](PeriodicDelaunay2d& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getCellAreaBufferPtr()));
+        }));
+
+    // Voronoi cells without a global triangulation (periodic or box-clipped)
+    emscripten::class_<KnnVoronoi>("KnnVoronoi")
+        .constructor<>()
+        .function("compute", &compute_knn_voronoi_js)
+        .function("getCellCount", optional_override([](const KnnVoronoi& self) {
+            return static_cast<uint32_t>(self.getCellCount());
+        }))
+        .function("getFaceCount", optional_override([](const KnnVoronoi& self) {
+            return static_cast<uint32_t>(self.getFaceCount());
+        }))
+        .function("getAverageClipCount", &KnnVoronoi::getAverageClipCount)
+        .function("getVolumeBufferByteOffset", optional_override([](KnnVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getVolumeBufferPtr()));
+        }))
+        .function("getFaceOffsetBufferByteOffset", optional_override([](KnnVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFaceOffsetBufferPtr()));
+        }))
+        .function("getFaceNeighborBufferByteOffset", optional_override([](KnnVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFaceNeighborBufferPtr()));
+        }))
+        .function("getFaceAreaBufferByteOffset", optional_override([](KnnVoronoi& self) {
+            return static_cast<uintptr_t>(reinterpret_cast<uintptr_t>(self.getFaceAreaBufferPtr()));
+        }));
 }
\ No newline at end of file
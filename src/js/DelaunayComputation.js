@@ -80,6 +80,11 @@ export class DelaunayComputation {
                 
                 // Compute Voronoi diagram from Delaunay
                 this._computeVoronoiBarycentric();
+
+                // Non-periodic mode: exact cells clipped to the unit box (native)
+                if (!this.isPeriodic && wasmModule.BoundedVoronoi) {
+                    this._computeBoundedVoronoiCells(wasmModule);
+                }
             } else {
                 console.warn('No tetrahedra generated');
                 this.tetrahedra = [];
@@ -237,6 +242,49 @@ export class DelaunayComputation {
         console.log(`Computed ${this.voronoiEdges.length} Voronoi edges.`);
     }
 
+    /**
+     * Compute bounded Voronoi cells (clipped to the unit box) natively
+     * Fills this.voronoiCells with {volume, faces: [{neighbor, area, vertices}]}
+     * where neighbor is -1-k for box wall k (xmin, xmax, ymin, ymax, zmin, zmax)
+     * @private
+     */
+    _computeBoundedVoronoiCells(wasmModule) {
+        const cells = new wasmModule.BoundedVoronoi();
+        try {
+            if (!cells.compute(this.points, this.numPoints, null)) {
+                console.warn('Bounded Voronoi computation failed');
+                this.voronoiCells = [];
+                return;
+            }
+
+            const numCells = cells.getCellCount();
+            const numFaces = cells.getFaceCount();
+            const numPolygonVertices = cells.getPolygonVertexCount();
+            const volumes = new Float64Array(wasmModule.HEAPF64.buffer, cells.getVolumeBufferByteOffset(), numCells);
+            const faceOffsets = new Uint32Array(wasmModule.HEAP32.buffer, cells.getFaceOffsetBufferByteOffset(), numCells + 1);
+            const faceNeighbors = new Int32Array(wasmModule.HEAP32.buffer, cells.getFaceNeighborBufferByteOffset(), numFaces);
+            const faceAreas = new Float64Array(wasmModule.HEAPF64.buffer, cells.getFaceAreaBufferByteOffset(), numFaces);
+            const polygonOffsets = new Uint32Array(wasmModule.HEAP32.buffer, cells.getPolygonOffsetBufferByteOffset(), numFaces + 1);
+            const polygonVertices = new Float32Array(wasmModule.HEAPF32.buffer, cells.getPolygonVertexBufferByteOffset(), numPolygonVertices * 3);
+
+            this.voronoiCells = [];
+            for (let i = 0; i < numCells; i++) {
+                const faces = [];
+                for (let f = faceOffsets[i]; f < faceOffsets[i + 1]; f++) {
+                    const vertices = [];
+                    for (let v = polygonOffsets[f]; v < polygonOffsets[f + 1]; v++) {
+                        vertices.push([polygonVertices[v * 3], polygonVertices[v * 3 + 1], polygonVertices[v * 3 + 2]]);
+                    }
+                    faces.push({ neighbor: faceNeighbors[f], area: faceAreas[f], vertices });
+                }
+                this.voronoiCells.push({ volume: volumes[i], faces });
+            }
+            console.log(`Computed ${this.voronoiCells.length} bounded Voronoi cells.`);
+        } finally {
+            cells.delete();
+        }
+    }
+
     /**
      * Check if an edge crosses periodic boundaries
      * @private
@@ -288,6 +336,7 @@ export class DelaunayComputation {
             numPoints: this.numPoints,
             numTetrahedra: this.tetrahedra.length,
             numVoronoiEdges: this.voronoiEdges.length,
+            numVoronoiCells: this.voronoiCells.length,
             isPeriodic: this.isPeriodic
         };
     }
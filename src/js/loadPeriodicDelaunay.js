@@ -0,0 +1,103 @@
+/**
+ * loadPeriodicDelaunay.js
+ *
+ * Loads the fastest WASM build the runtime supports (see `./build.sh release`):
+ *   - periodic_delaunay.simd-mt.js  simd128 + pthreads, needs SharedArrayBuffer
+ *                                   (browser pages must be cross-origin isolated:
+ *                                   COOP same-origin + COEP require-corp)
+ *   - periodic_delaunay.simd.js     simd128
+ *   - periodic_delaunay.scalar.js   baseline
+ *
+ * Works in browsers (classic script injection) and in node (require).
+ * All variants export the same PeriodicDelaunayModule factory, so only one of
+ * them can be loaded per page.
+ */
+
+export const WASM_VARIANTS = ['simd-mt', 'simd', 'scalar'];
+
+// Smallest modules using a simd128 instruction / a shared memory with an atomic
+// (same probes as the wasm-feature-detect package)
+const SIMD_PROBE = new Uint8Array([
+    0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1, 8, 0, 65, 0, 253, 15, 253, 98, 11
+]);
+const THREADS_PROBE = new Uint8Array([
+    0, 97, 115, 109, 1, 0, 0, 0, 1, 4, 1, 96, 0, 0, 3, 2, 1, 0, 5, 4, 1, 3, 1, 1, 10, 11, 1, 9, 0, 65, 0, 254, 16, 2, 0, 26, 11
+]);
+
+const isNode = typeof process !== 'undefined' && process.versions != null && process.versions.node != null;
+
+/**
+ * Runtime WASM features.
+ * @returns {{simd: boolean, threads: boolean}}
+ */
+export function detectWasmFeatures() {
+    if (typeof WebAssembly === 'undefined') {
+        return { simd: false, threads: false };
+    }
+    const simd = WebAssembly.validate(SIMD_PROBE);
+    // Browsers only expose SharedArrayBuffer to cross-origin isolated pages
+    const isolated = isNode || globalThis.crossOriginIsolated === true;
+    const threads = isolated && typeof SharedArrayBuffer !== 'undefined' && WebAssembly.validate(THREADS_PROBE);
+    return { simd, threads };
+}
+
+/**
+ * Best variant for the given features.
+ * @param {{simd: boolean, threads: boolean}} features
+ * @returns {string} one of WASM_VARIANTS
+ */
+export function pickWasmVariant(features = detectWasmFeatures()) {
+    if (features.simd && features.threads) return 'simd-mt';
+    if (features.simd) return 'simd';
+    return 'scalar';
+}
+
+async function loadFactoryNode(scriptUrl) {
+    const { createRequire } = await import('node:module');
+    const require = createRequire(import.meta.url);
+    const { fileURLToPath } = await import('node:url');
+    return require(fileURLToPath(scriptUrl));
+}
+
+function loadFactoryBrowser(scriptUrl) {
+    if (typeof window.PeriodicDelaunayModule === 'function') {
+        return Promise.resolve(window.PeriodicDelaunayModule);
+    }
+    return new Promise((resolve, reject) => {
+        const script = document.createElement('script');
+        script.src = scriptUrl;
+        script.onload = () => resolve(window.PeriodicDelaunayModule);
+        script.onerror = () => reject(new Error(`Cannot load ${scriptUrl}`));
+        document.head.appendChild(script);
+    });
+}
+
+/**
+ * Loads and instantiates a module variant.
+ * @param {Object} [options]
+ * @param {string|URL} [options.baseUrl] directory of the dist/ files, relative to this file (default ../../dist/)
+ * @param {string} [options.variant] force a variant instead of feature detection
+ * @param {Object} [options.moduleArgs] extra arguments for the Emscripten factory
+ * @returns {Promise<Object>} the module, with `wasmVariant` set to the variant loaded
+ */
+export async function loadPeriodicDelaunay(options = {}) {
+    const variant = options.variant || pickWasmVariant();
+    if (!WASM_VARIANTS.includes(variant)) {
+        throw new Error(`Unknown WASM variant ${variant}`);
+    }
+    const baseUrl = new URL(options.baseUrl || '../../dist/', import.meta.url);
+    const scriptUrl = new URL(`periodic_delaunay.${variant}.js`, baseUrl);
+
+    const factory = isNode ? await loadFactoryNode(scriptUrl) : await loadFactoryBrowser(scriptUrl.href);
+    const { fileURLToPath } = isNode ? await import('node:url') : {};
+    const module = await factory({
+        // .wasm (and the pthread worker script) next to the glue script
+        locateFile: (path) => {
+            const url = new URL(path, baseUrl);
+            return isNode ? fileURLToPath(url) : url.href;
+        },
+        ...options.moduleArgs
+    });
+    module.wasmVariant = variant;
+    return module;
+}
@@ -0,0 +1,229 @@
+// Native command-line driver for large periodic triangulations.
+//
+// Usage:
+//   periodic_delaunay_cli --input points.f64 --output tets.bin [options]
+//
+// Options:
+//   --input FILE        points file (see PointFileReader): raw float64 (default),
+//                       .f32 raw float32, .xyz/.txt/.asc ASCII, .ply
+//   --format F          auto | f64 | f32 | xyz | ply (default auto, from the extension)
+//   --random N          N uniform random points instead of --input (--seed S)
+//   --output FILE       binary tets (see below), omitted: only report
+//   --tiles T           T^3 blocks (default 1)
+//   --ghost W           ghost layer width (default: 4 mean point spacings)
+//   --scratch DIR       directory for the block files (default .)
+//   --phase P           all | distribute | triangulate (default all)
+//   --blocks FIRST:LAST block range for the triangulate phase (default all)
+//
+// Several processes can share a scratch directory: run --phase distribute
+// once, then --phase triangulate with disjoint --blocks and outputs.
+//
+// Output file: "PDT1", uint32 record size (28), uint64 tet count, then one
+// TiledPeriodicDelaunay::Tet per tet (4 uint32 vertex indices, 12 int8
+// periodic offsets relative to the first vertex).
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "PointFileReader.h"
+#include "TiledPeriodicDelaunay.h"
+
+// Geogram (PSM version vendored in this repo)
+#include "Delaunay_psm.h"
+
+namespace {
+
+static_assert(sizeof(TiledPeriodicDelaunay::Tet) == 28, "unexpected Tet layout");
+
+// Points read or generated at once during the distribution pass
+const std::size_t POINT_CHUNK = std::size_t(1) << 20;
+
+// Owned volumes of all blocks must add up to the unit cube
+const double VOLUME_TOLERANCE = 1e-9;
+
+struct Options {
+    std::string input;
+    std::string output;
+    std::string scratch = ".";
+    std::string phase = "all";
+    PointFileReader::Format format = PointFileReader::Format::Auto;
+    uint64_t randomPoints = 0;
+    unsigned seed = 42;
+    int tiles = 1;
+    double ghost = 0.0;
+    int firstBlock = 0;
+    int lastBlock = -1;
+};
+
+bool parseArguments(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+        const std::string value = argv[++i];
+        if (arg == "--input") options.input = value;
+        else if (arg == "--output") options.output = value;
+        else if (arg == "--scratch") options.scratch = value;
+        else if (arg == "--phase") options.phase = value;
+        else if (arg == "--format") {
+            if (value == "auto") options.format = PointFileReader::Format::Auto;
+            else if (value == "f64") options.format = PointFileReader::Format::RawFloat64;
+            else if (value == "f32") options.format = PointFileReader::Format::RawFloat32;
+            else if (value == "xyz") options.format = PointFileReader::Format::AsciiXYZ;
+            else if (value == "ply") options.format = PointFileReader::Format::PLY;
+            else {
+                std::cerr << "Unknown format " << value << std::endl;
+                return false;
+            }
+        } else if (arg == "--random") options.randomPoints = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--seed") options.seed = unsigned(std::atoi(value.c_str()));
+        else if (arg == "--tiles") options.tiles = std::atoi(value.c_str());
+        else if (arg == "--ghost") options.ghost = std::atof(value.c_str());
+        else if (arg == "--blocks") {
+            const std::size_t colon = value.find(':');
+            options.firstBlock = std::atoi(value.substr(0, colon).c_str());
+            options.lastBlock = (colon == std::string::npos) ? options.firstBlock
+                                                             : std::atoi(value.substr(colon + 1).c_str());
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return false;
+        }
+    }
+    if (options.phase != "all" && options.phase != "distribute" && options.phase != "triangulate") {
+        std::cerr << "Unknown phase " << options.phase << std::endl;
+        return false;
+    }
+    if (options.phase != "triangulate" && options.input.empty() && options.randomPoints == 0) {
+        std::cerr << "Either --input or --random is required." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Pass 1: stream the point file (or random points) into the blocks
+bool distribute(const Options& options, TiledPeriodicDelaunay& tiled) {
+    std::vector<double> chunk;
+    if (!options.input.empty()) {
+        PointFileReader reader;
+        if (!reader.open(options.input, options.format) || !tiled.beginDistribution(reader.getPointCount())) {
+            return false;
+        }
+        // Wrapped into the period while decoding
+        if (!reader.forEachChunk(POINT_CHUNK, true, [&](const double* points, std::size_t count) {
+                return tiled.addPoints(points, count);
+            })) {
+            return false;
+        }
+    } else {
+        std::mt19937 rng(options.seed);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        if (!tiled.beginDistribution(options.randomPoints)) return false;
+        for (uint64_t done = 0; done < options.randomPoints;) {
+            const std::size_t count = std::size_t(std::min<uint64_t>(POINT_CHUNK, options.randomPoints - done));
+            chunk.resize(3u * count);
+            for (double& c : chunk) c = uniform(rng);
+            if (!tiled.addPoints(chunk.data(), count)) return false;
+            done += count;
+        }
+    }
+    return tiled.endDistribution();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (argc < 2 || !parseArguments(argc, argv, options)) {
+        std::cerr << "Usage: periodic_delaunay_cli (--input FILE [--format F] | --random N) [--output FILE] [--tiles T] "
+                     "[--ghost W] [--scratch DIR] [--phase all|distribute|triangulate] [--blocks FIRST:LAST]"
+                  << std::endl;
+        return 1;
+    }
+
+    GEO::initialize();
+
+    TiledPeriodicDelaunay tiled(options.tiles, options.ghost, options.scratch);
+    GEO::Stopwatch total("total", false);
+
+    if (options.phase != "triangulate") {
+        if (!distribute(options, tiled)) return 1;
+        std::cout << "distributed " << tiled.getPointCount() << " points in " << tiled.getBlockCount()
+                  << " blocks, ghost width " << tiled.getGhostWidth() << " (" << total.elapsed_time() << " s)" << std::endl;
+        if (options.phase == "distribute") return 0;
+    } else if (!tiled.openDistribution()) {
+        return 1;
+    }
+
+    const int firstBlock = std::max(0, options.firstBlock);
+    const int lastBlock = (options.lastBlock < 0) ? tiled.getBlockCount() - 1
+                                                  : std::min(options.lastBlock, tiled.getBlockCount() - 1);
+
+    std::ofstream output;
+    uint64_t tetCount = 0;
+    if (!options.output.empty()) {
+        output.open(options.output, std::ios::binary | std::ios::trunc);
+        const uint32_t recordSize = uint32_t(sizeof(TiledPeriodicDelaunay::Tet));
+        output.write("PDT1", 4);
+        output.write(reinterpret_cast<const char*>(&recordSize), sizeof(recordSize));
+        output.write(reinterpret_cast<const char*>(&tetCount), sizeof(tetCount));
+        if (!output) {
+            std::cerr << "Cannot write " << options.output << std::endl;
+            return 1;
+        }
+    }
+
+    auto sink = [&](const TiledPeriodicDelaunay::Tet* tets, std::size_t count) {
+        if (output.is_open()) {
+            output.write(reinterpret_cast<const char*>(tets), std::streamsize(count * sizeof(*tets)));
+        }
+        tetCount += count;
+    };
+
+    double ownedVolume = 0.0;
+    uint64_t uncertified = 0;
+    for (int block = firstBlock; block <= lastBlock; ++block) {
+        TiledPeriodicDelaunay::BlockReport report;
+        if (!tiled.triangulateBlock(block, sink, report)) {
+            std::cerr << "Block " << block << " failed." << std::endl;
+            return 1;
+        }
+        ownedVolume += report.ownedVolume;
+        uncertified += report.uncertifiedTets;
+        std::cout << "block " << block << ": " << report.ownedPoints << " points + " << report.ghostPoints
+                  << " ghosts, " << report.ownedTets << " tets, " << report.uncertifiedTets << " uncertified ("
+                  << report.seconds << " s)" << std::endl;
+    }
+
+    if (output.is_open()) {
+        output.seekp(8);
+        output.write(reinterpret_cast<const char*>(&tetCount), sizeof(tetCount));
+        if (!output) {
+            std::cerr << "Cannot write " << options.output << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "tets " << tetCount << ", owned volume " << ownedVolume << ", uncertified " << uncertified
+              << " (" << total.elapsed_time() << " s)" << std::endl;
+
+    const bool allBlocks = (firstBlock == 0 && lastBlock == tiled.getBlockCount() - 1);
+    if (options.phase == "all") tiled.removeScratchFiles();
+
+    // Seam check: duplicated or missing tets show up in the volume
+    bool consistent = (uncertified == 0);
+    if (allBlocks) consistent = consistent && std::fabs(ownedVolume - 1.0) < VOLUME_TOLERANCE;
+    if (!consistent) {
+        std::cerr << "Block seams are inconsistent, increase --ghost." << std::endl;
+        return 2;
+    }
+    return 0;
+}